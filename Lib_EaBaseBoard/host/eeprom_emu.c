@@ -0,0 +1,249 @@
+/*****************************************************************************
+ *   eeprom_emu.c:  Host emulator for the base board 24LC08 EEPROM
+ *
+ ******************************************************************************/
+
+/*
+ * A 24LC08 on the emulated I2C2 bus (i2c_emu.c). See eeprom_emu.h.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <string.h>
+#include "i2c_emu.h"
+#include "eeprom_emu.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+#define BLOCK_COUNT  (EEPROM_EMU_SIZE / EEPROM_EMU_BLOCK_SIZE)
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+static uint8_t memory[EEPROM_EMU_SIZE];
+static uint16_t pointer = 0;            /* internal address counter */
+static uint8_t present = 1;
+static uint64_t writeEnd = 0;           /* end of the running write cycle */
+static uint32_t writeNs = EEPROM_EMU_WRITE_US * 1000;
+
+/* Write transfer being received */
+static uint8_t wordAddress = 0;         /* next byte is the word address */
+static uint16_t page = 0;
+static uint8_t written = 0;             /* data bytes since the word address */
+
+static uint32_t pageWrites = 0;
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * Description:
+ *    Address byte, acknowledged if no write cycle is running. A start also
+ *    ends a page write that hasn't been stopped.
+ *
+ *****************************************************************************/
+static uint8_t start(uint8_t addr, uint8_t read, uint64_t ns)
+{
+    if (!present || ns < writeEnd)
+        return 0;
+
+    written = 0;
+    if (read) {
+        pointer = (addr - EEPROM_EMU_I2C_ADDR) * EEPROM_EMU_BLOCK_SIZE +
+                (pointer % EEPROM_EMU_BLOCK_SIZE);
+    }
+    else {
+        wordAddress = 1;
+    }
+    return 1;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    The first byte written is the word address within the block, the
+ *    others are data and go to the page it is in, wrapping around at the
+ *    end of the page
+ *
+ *****************************************************************************/
+static void write(uint8_t addr, uint8_t value)
+{
+    if (wordAddress) {
+        pointer = (addr - EEPROM_EMU_I2C_ADDR) * EEPROM_EMU_BLOCK_SIZE + value;
+        page = pointer & ~(EEPROM_EMU_PAGE_SIZE - 1);
+        wordAddress = 0;
+        return;
+    }
+
+    memory[page + ((pointer + written) & (EEPROM_EMU_PAGE_SIZE - 1))] = value;
+    written++;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Reads wrap around at the end of the block
+ *
+ *****************************************************************************/
+static uint8_t read(uint8_t addr)
+{
+    uint16_t block = (addr - EEPROM_EMU_I2C_ADDR) * EEPROM_EMU_BLOCK_SIZE;
+    uint8_t value = memory[pointer];
+
+    pointer = block + ((pointer + 1) % EEPROM_EMU_BLOCK_SIZE);
+    return value;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    The write cycle starts with the stop, only if there was data
+ *
+ *****************************************************************************/
+static void stop(uint8_t addr, uint64_t ns)
+{
+    (void)addr;
+
+    if (written > 0) {
+        writeEnd = ns + writeNs;
+        pageWrites++;
+    }
+    written = 0;
+}
+
+static const i2c_emu_device_t device = {
+    "24LC08", EEPROM_EMU_I2C_ADDR, BLOCK_COUNT, start, write, read, stop
+};
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * Description:
+ *    Erased EEPROM, no write cycle running, default write cycle time. Also
+ *    resets the bus (see i2cEmu_reset()) and attaches the EEPROM to it.
+ *
+ *****************************************************************************/
+void eepromEmu_reset(void)
+{
+    i2cEmu_reset();
+    i2cEmu_attach(&device);
+
+    memset(memory, 0xff, sizeof(memory));
+    pointer = 0;
+    present = 1;
+    writeEnd = 0;
+    writeNs = EEPROM_EMU_WRITE_US * 1000;
+    wordAddress = 0;
+    written = 0;
+    pageWrites = 0;
+}
+
+void eepromEmu_setBusClock(uint32_t hz)
+{
+    i2cEmu_setBusClock(hz);
+}
+
+void eepromEmu_setWriteCycle(uint32_t us)
+{
+    writeNs = us * 1000;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Take the EEPROM off the bus (0) or put it back (1), without it every
+ *    address is left unacknowledged
+ *
+ *****************************************************************************/
+void eepromEmu_setPresent(uint8_t on)
+{
+    present = on;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Let time pass without waiting for the bus, see i2cEmu_wait()
+ *
+ *****************************************************************************/
+void eepromEmu_wait(uint32_t us)
+{
+    i2cEmu_wait(us);
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Simulated time since eepromEmu_reset() in nanoseconds
+ *
+ *****************************************************************************/
+uint64_t eepromEmu_now(void)
+{
+    return i2cEmu_now();
+}
+
+uint8_t eepromEmu_isWriting(void)
+{
+    return i2cEmu_now() < writeEnd;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Complete the interrupt driven transfers, e.g. of a write started by
+ *    eeprom_writeAsync(), until the bus is idle. On the target this happens
+ *    in the background.
+ *
+ *****************************************************************************/
+void eepromEmu_run(void)
+{
+    i2cEmu_run();
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Memory of the emulated EEPROM, EEPROM_EMU_SIZE bytes
+ *
+ *****************************************************************************/
+uint8_t *eepromEmu_getMemory(void)
+{
+    return memory;
+}
+
+void eepromEmu_getStats(eeprom_emu_stats_t *s)
+{
+    i2c_emu_stats_t bus;
+
+    (void)i2cEmu_getDeviceStats(EEPROM_EMU_I2C_ADDR, &bus);
+    s->transfers = bus.transfers;
+    s->attempts = bus.attempts;
+    s->nacks = bus.nacks;
+    s->failures = bus.failures;
+    s->pageWrites = pageWrites;
+    s->interrupts = bus.interrupts;
+    s->busNs = bus.busNs;
+    s->blockedNs = bus.blockedNs;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Clear the statistics, those of the whole bus with them
+ *
+ *****************************************************************************/
+void eepromEmu_clearStats(void)
+{
+    i2cEmu_clearStats();
+    pageWrites = 0;
+}
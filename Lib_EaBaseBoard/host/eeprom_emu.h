@@ -0,0 +1,61 @@
+/*****************************************************************************
+ *   eeprom_emu.h:  Host emulator for the base board 24LC08 EEPROM
+ *
+ ******************************************************************************/
+
+/*
+ * Runs the unmodified eeprom.c on a PC, with a 24LC08 on the emulated I2C2
+ * bus (see i2c_emu.h): 1 KiB in four 256 byte blocks at I2C addresses
+ * 0x50 - 0x53, written in 16 byte pages. Like the real device it doesn't
+ * acknowledge its address while a write cycle is running, so the write
+ * cycle time decides how often the driver has to retry.
+ *
+ * Time is simulated by the bus emulator, eepromEmu_wait() lets time pass as
+ * if the CPU was busy with something else.
+ *
+ * Build with the stand-ins first on the include path, e.g. from the
+ * repository root:
+ *
+ *   gcc -ILib_EaBaseBoard/host/inc -ILib_EaBaseBoard/host \
+ *       -ILib_EaBaseBoard/inc -ILib_MCU/inc app.c \
+ *       Lib_EaBaseBoard/src/i2cbus.c Lib_EaBaseBoard/src/eeprom.c \
+ *       Lib_EaBaseBoard/host/i2c_emu.c Lib_EaBaseBoard/host/eeprom_emu.c
+ */
+#ifndef __EEPROM_EMU_H
+#define __EEPROM_EMU_H
+
+#include <stdint.h>
+
+#define EEPROM_EMU_SIZE         1024
+#define EEPROM_EMU_BLOCK_SIZE   256
+#define EEPROM_EMU_PAGE_SIZE    16
+#define EEPROM_EMU_I2C_ADDR     0x50    /* first block, the others follow */
+
+/* Power up default: the data sheet maximum write cycle time */
+#define EEPROM_EMU_WRITE_US     5000
+
+typedef struct
+{
+    uint32_t transfers;     /* transfers to the EEPROM, see i2c_emu_stats_t */
+    uint32_t attempts;      /* address bytes sent, retries included */
+    uint32_t nacks;         /* attempts the EEPROM didn't acknowledge */
+    uint32_t failures;      /* transfers given up after all retries */
+    uint32_t pageWrites;    /* write cycles started */
+    uint32_t interrupts;    /* I2C interrupts of interrupt driven transfers */
+    uint64_t busNs;         /* time the bus was in use */
+    uint64_t blockedNs;     /* time the CPU waited for them */
+} eeprom_emu_stats_t;
+
+void eepromEmu_reset(void);
+void eepromEmu_setBusClock(uint32_t hz);
+void eepromEmu_setWriteCycle(uint32_t us);
+void eepromEmu_setPresent(uint8_t present);
+void eepromEmu_wait(uint32_t us);
+uint64_t eepromEmu_now(void);
+uint8_t eepromEmu_isWriting(void);
+void eepromEmu_run(void);
+uint8_t *eepromEmu_getMemory(void);
+void eepromEmu_getStats(eeprom_emu_stats_t *stats);
+void eepromEmu_clearStats(void);
+
+#endif /* end __EEPROM_EMU_H */
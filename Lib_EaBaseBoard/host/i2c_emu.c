@@ -0,0 +1,530 @@
+/*****************************************************************************
+ *   i2c_emu.c:  Host emulator for the base board I2C2 bus
+ *
+ ******************************************************************************/
+
+/*
+ * Implements the I2C driver functions and the interrupt control used by
+ * i2cbus.c and the base board drivers on a PC, with the attached device
+ * models on the bus and simulated bus timing. See i2c_emu.h.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "LPC17xx.h"
+#include "lpc17xx_i2c.h"
+#include "i2c_emu.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+/* Statistics of transfers to addresses no device answers */
+#define NO_DEVICE    I2C_EMU_MAX_DEVICES
+
+/* An interrupt driven transfer on the bus */
+typedef struct
+{
+    I2C_M_SETUP_Type *setup;
+    uint32_t device;
+    uint64_t end;           /* when its last bit has been sent */
+    uint32_t status;
+    uint32_t irqs;
+} pending_t;
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+LPC_I2C_TypeDef hostEmu_i2c2;
+
+static const i2c_emu_device_t *devices[I2C_EMU_MAX_DEVICES];
+static uint32_t deviceCount = 0;
+
+static pending_t pending;
+static uint8_t complete = 0;
+
+/* NVIC enable bit of I2C2, and whether I2C2_IRQHandler() is running */
+static uint8_t irqEnabled = 0;
+static uint8_t inIrq = 0;
+static uint8_t eagerIrq = 0;
+
+static uint32_t bitNs = 1000000000 / I2C_EMU_BUS_HZ;
+static uint64_t now = 0;
+
+static i2c_emu_stats_t stats[I2C_EMU_MAX_DEVICES + 1];
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * Description:
+ *    Stop the program, the bus has been used in a way the target can't
+ *    handle
+ *
+ *****************************************************************************/
+static void misuse(const char *what)
+{
+    fprintf(stderr, "i2c_emu: %s\n", what);
+    abort();
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Find the device answering an address
+ *
+ * Returns:
+ *    index in devices, NO_DEVICE if there is none
+ *
+ *****************************************************************************/
+static uint32_t findDevice(uint32_t addr)
+{
+    uint32_t i;
+
+    for (i = 0; i < deviceCount; i++) {
+        if (addr >= devices[i]->addr &&
+                addr < (uint32_t)devices[i]->addr + devices[i]->count)
+            return i;
+    }
+    return NO_DEVICE;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Send an address byte (start or repeated start first)
+ *
+ * Params:
+ *   [in] setup - the transfer
+ *   [in] dev - index of the device answering its address
+ *   [in] read - 1 for a read, 0 for a write
+ *   [in] t - bus time, advanced by the bits sent
+ *   [in] irqs - incremented by the I2C interrupts it takes
+ *
+ * Returns:
+ *    1 if the address was acknowledged, 0 otherwise
+ *
+ *****************************************************************************/
+static uint8_t sendAddress(I2C_M_SETUP_Type *setup, uint32_t dev,
+        uint8_t read, uint64_t *t, uint32_t *irqs)
+{
+    const i2c_emu_device_t *d;
+    uint8_t ack;
+
+    *t += (uint64_t)(1 + 9) * bitNs;
+    *irqs += 2;
+    stats[dev].attempts++;
+
+    if (dev == NO_DEVICE) {
+        ack = 0;
+    }
+    else {
+        d = devices[dev];
+        ack = d->start == NULL || d->start(setup->sl_addr7bit, read, *t);
+    }
+
+    if (!ack)
+        stats[dev].nacks++;
+    return ack;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    One try of a transfer, like Lib_MCU does it: a write of tx_length bytes
+ *    if there are any, then a read of rx_length bytes, after a repeated
+ *    start if there was a write
+ *
+ * Returns:
+ *    1 if the transfer is done, 0 if an address wasn't acknowledged
+ *
+ *****************************************************************************/
+static uint8_t tryTransfer(I2C_M_SETUP_Type *setup, uint32_t dev,
+        uint64_t *t, uint32_t *irqs)
+{
+    const i2c_emu_device_t *d = (dev == NO_DEVICE) ? NULL : devices[dev];
+    uint32_t i;
+
+    if (setup->tx_data != NULL && setup->tx_length != 0) {
+        if (!sendAddress(setup, dev, 0, t, irqs))
+            return 0;
+
+        for (i = 0; i < setup->tx_length; i++) {
+            *t += 9 * bitNs;
+            if (d->write != NULL)
+                d->write(setup->sl_addr7bit, setup->tx_data[i]);
+        }
+        *irqs += setup->tx_length;
+        stats[dev].bytes += setup->tx_length;
+        setup->tx_count = setup->tx_length;
+    }
+
+    if (setup->rx_data != NULL && setup->rx_length != 0) {
+        if (!sendAddress(setup, dev, 1, t, irqs))
+            return 0;
+
+        for (i = 0; i < setup->rx_length; i++) {
+            *t += 9 * bitNs;
+            setup->rx_data[i] = (d->read != NULL) ?
+                    d->read(setup->sl_addr7bit) : 0xff;
+        }
+        *irqs += setup->rx_length;
+        stats[dev].bytes += setup->rx_length;
+        setup->rx_count = setup->rx_length;
+    }
+
+    *t += bitNs;
+    if (d != NULL && d->stop != NULL)
+        d->stop(setup->sl_addr7bit, *t);
+    return 1;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Run a transfer with retries, up to retransmissions_max of them
+ *
+ * Params:
+ *   [in] setup - the transfer
+ *   [in] dev - index of the device answering its address
+ *   [in] start - when it starts
+ *   [out] end - when its last bit has been sent
+ *   [in] irqs - incremented by the I2C interrupts it takes
+ *
+ * Returns:
+ *    status of the transfer, I2C_SETUP_STATUS_DONE set on success
+ *
+ *****************************************************************************/
+static uint32_t transfer(I2C_M_SETUP_Type *setup, uint32_t dev,
+        uint64_t start, uint64_t *end, uint32_t *irqs)
+{
+    uint64_t t = start;
+    uint32_t status = I2C_SETUP_STATUS_DONE;
+
+    stats[dev].transfers++;
+
+    while (!tryTransfer(setup, dev, &t, irqs)) {
+        setup->tx_count = 0;
+        setup->rx_count = 0;
+        if (setup->retransmissions_count >= setup->retransmissions_max) {
+            t += bitNs;
+            stats[dev].failures++;
+            status = 0;
+            break;
+        }
+        setup->retransmissions_count++;
+    }
+
+    stats[dev].busNs += t - start;
+    *end = t;
+    return status;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Complete the interrupt driven transfer on the bus: time moves on to its
+ *    end if it isn't there yet, and the I2C interrupt handler runs
+ *
+ *****************************************************************************/
+static void completePending(void)
+{
+    pending_t p = pending;
+
+    pending.setup = NULL;
+    if (now < p.end)
+        now = p.end;
+
+    p.setup->status = p.status;
+    stats[p.device].interrupts += p.irqs;
+    /* the end stage of I2C_MasterHandler() disables the interrupt */
+    irqEnabled = 0;
+    complete = 1;
+    inIrq = 1;
+    I2C2_IRQHandler();
+    inIrq = 0;
+    complete = 0;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    In eager mode, complete the transfers on the bus while the interrupt
+ *    is enabled, as if it preempted the code that just enabled it
+ *
+ *****************************************************************************/
+static void eagerComplete(void)
+{
+    while (eagerIrq && irqEnabled && !inIrq && pending.setup != NULL)
+        completePending();
+}
+
+/******************************************************************************
+ * Public Functions: driver stand-ins
+ *****************************************************************************/
+
+Status I2C_MasterTransferData(LPC_I2C_TypeDef *I2Cx, I2C_M_SETUP_Type *TransferCfg,
+        I2C_TRANSFER_OPT_Type Opt)
+{
+    uint32_t dev = findDevice(TransferCfg->sl_addr7bit);
+    uint64_t end;
+    uint32_t irqs = 0;
+
+    (void)I2Cx;
+
+    if (pending.setup != NULL)
+        misuse("transfer started while another one is on the bus");
+
+    TransferCfg->tx_count = 0;
+    TransferCfg->rx_count = 0;
+    TransferCfg->status = 0;
+
+    if (Opt == I2C_TRANSFER_INTERRUPT) {
+        pending.setup = TransferCfg;
+        pending.device = dev;
+        pending.status = transfer(TransferCfg, dev, now, &pending.end, &irqs);
+        pending.irqs = irqs;
+        /* I2C_IntCmd(I2Cx, ENABLE) */
+        irqEnabled = 1;
+        eagerComplete();
+        return SUCCESS;
+    }
+
+    TransferCfg->retransmissions_count = 0;
+    TransferCfg->status = transfer(TransferCfg, dev, now, &end, &irqs);
+    stats[dev].blockedNs += end - now;
+    now = end;
+    return (TransferCfg->status & I2C_SETUP_STATUS_DONE) ? SUCCESS : ERROR;
+}
+
+void I2C_MasterHandler(LPC_I2C_TypeDef *I2Cx)
+{
+    (void)I2Cx;     /* the transfer is completed by completePending() */
+}
+
+uint32_t I2C_MasterTransferComplete(LPC_I2C_TypeDef *I2Cx)
+{
+    uint32_t c = complete;
+
+    (void)I2Cx;
+    complete = 0;
+    return c;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Sleep until the interrupt driven transfer on the bus has completed.
+ *    Nothing else can wake the CPU on the host, so sleeping without one
+ *    would never end.
+ *
+ *****************************************************************************/
+void i2cEmu_wfi(void)
+{
+    uint64_t start = now;
+    uint32_t dev = pending.device;
+
+    if (pending.setup == NULL)
+        misuse("__WFI() without a transfer on the bus would sleep forever");
+    if (!irqEnabled)
+        misuse("__WFI() with the I2C interrupt disabled would sleep forever");
+
+    completePending();
+    stats[dev].blockedNs += now - start;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    NVIC_EnableIRQ() and NVIC_DisableIRQ() of I2C2
+ *
+ *****************************************************************************/
+void i2cEmu_setIrqEnabled(uint8_t enabled)
+{
+    irqEnabled = enabled;
+    eagerComplete();
+}
+
+/*
+ * Used when i2cbus.c isn't linked
+ */
+__attribute__((weak)) void I2C2_IRQHandler(void)
+{
+}
+
+/******************************************************************************
+ * Public Functions: emulator
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * Description:
+ *    Put a device on the bus. Attaching it again does nothing.
+ *
+ *****************************************************************************/
+void i2cEmu_attach(const i2c_emu_device_t *device)
+{
+    uint32_t i;
+
+    for (i = 0; i < deviceCount; i++) {
+        if (devices[i] == device)
+            return;
+    }
+
+    if (deviceCount == I2C_EMU_MAX_DEVICES)
+        misuse("too many devices");
+    devices[deviceCount++] = device;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Nothing on the bus, time and statistics cleared, default bus clock.
+ *    The attached devices stay attached.
+ *
+ *****************************************************************************/
+void i2cEmu_reset(void)
+{
+    memset(&pending, 0, sizeof(pending));
+    complete = 0;
+    irqEnabled = 0;
+    inIrq = 0;
+    eagerIrq = 0;
+    bitNs = 1000000000 / I2C_EMU_BUS_HZ;
+    now = 0;
+    i2cEmu_clearStats();
+}
+
+void i2cEmu_setBusClock(uint32_t hz)
+{
+    bitNs = 1000000000 / hz;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Complete interrupt driven transfers as soon as their interrupt is
+ *    enabled (1) instead of when their time has passed (0, the default)
+ *
+ *****************************************************************************/
+void i2cEmu_setEagerIrq(uint8_t eager)
+{
+    eagerIrq = eager;
+    eagerComplete();
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Let time pass without waiting for the bus, interrupt driven transfers
+ *    that end meanwhile complete in the background
+ *
+ *****************************************************************************/
+void i2cEmu_wait(uint32_t us)
+{
+    uint64_t until = now + (uint64_t)us * 1000;
+
+    while (irqEnabled && pending.setup != NULL && pending.end <= until)
+        completePending();
+
+    now = until;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Simulated time since i2cEmu_reset() in nanoseconds
+ *
+ *****************************************************************************/
+uint64_t i2cEmu_now(void)
+{
+    return now;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Let time pass until the bus is idle, completing the interrupt driven
+ *    transfers and the ones their handlers start. On the target this
+ *    happens in the background.
+ *
+ *****************************************************************************/
+void i2cEmu_run(void)
+{
+    while (pending.setup != NULL) {
+        if (!irqEnabled)
+            misuse("waiting for a transfer with the I2C interrupt disabled");
+        completePending();
+    }
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Check if an interrupt driven transfer is on the bus
+ *
+ *****************************************************************************/
+uint8_t i2cEmu_isBusy(void)
+{
+    return pending.setup != NULL;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Statistics of all transfers, whatever their address
+ *
+ *****************************************************************************/
+void i2cEmu_getStats(i2c_emu_stats_t *s)
+{
+    uint32_t i;
+
+    memset(s, 0, sizeof(*s));
+    for (i = 0; i <= I2C_EMU_MAX_DEVICES; i++) {
+        s->transfers += stats[i].transfers;
+        s->bytes += stats[i].bytes;
+        s->attempts += stats[i].attempts;
+        s->nacks += stats[i].nacks;
+        s->failures += stats[i].failures;
+        s->interrupts += stats[i].interrupts;
+        s->busNs += stats[i].busNs;
+        s->blockedNs += stats[i].blockedNs;
+    }
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Statistics of the transfers to one device
+ *
+ * Params:
+ *   [in] addr - any address the device answers
+ *   [out] s - the statistics
+ *
+ * Returns:
+ *    0 on success, -1 if no device answers the address
+ *
+ *****************************************************************************/
+int i2cEmu_getDeviceStats(uint8_t addr, i2c_emu_stats_t *s)
+{
+    uint32_t dev = findDevice(addr);
+
+    if (dev == NO_DEVICE)
+        return -1;
+
+    *s = stats[dev];
+    return 0;
+}
+
+void i2cEmu_clearStats(void)
+{
+    memset(stats, 0, sizeof(stats));
+}
@@ -0,0 +1,95 @@
+/*****************************************************************************
+ *   i2c_emu.h:  Host emulator for the base board I2C2 bus
+ *
+ ******************************************************************************/
+
+/*
+ * Runs the unmodified base board drivers and i2cbus.c on a PC. The host
+ * stand-ins for the I2C driver (host/inc/lpc17xx_i2c.h) and for the few
+ * core functions i2cbus.c uses (host/inc/LPC17xx.h) are implemented here.
+ * Device models (oled_emu.c, eeprom_emu.c, pca9532_emu.c, light_emu.c)
+ * attach themselves to the bus and see every transfer to their addresses
+ * byte by byte, like on the wires; a transfer to an address nobody answers
+ * is not acknowledged.
+ *
+ * Time is simulated: every bit on the bus takes one bit time of the bus
+ * clock. A polled transfer blocks the CPU for all of it. An interrupt
+ * driven transfer runs in the background and completes, calling
+ * I2C2_IRQHandler(), when the simulated time reaches its end: while the
+ * CPU sleeps in __WFI(), or while i2cEmu_wait() lets time pass as if the
+ * CPU was busy with something else. Only one transfer can be on the bus,
+ * starting another before it has completed aborts the program.
+ *
+ * The NVIC enable bit of I2C2 is modelled: I2C_MasterTransferData() sets it
+ * like I2C_IntCmd() does, the end of a transfer clears it, and a transfer
+ * only completes while it is set. With i2cEmu_setEagerIrq() a transfer
+ * completes as soon as its interrupt is enabled, outside the handler, the
+ * earliest the interrupt could preempt the code on the target. That finds
+ * code that expects the interrupt to stay masked and enables it anyway.
+ *
+ * Build with the stand-ins first on the include path and link this file
+ * together with the device models, e.g. from the repository root:
+ *
+ *   gcc -ILib_EaBaseBoard/host/inc -ILib_EaBaseBoard/host \
+ *       -ILib_EaBaseBoard/inc -ILib_MCU/inc app.c \
+ *       Lib_EaBaseBoard/src/i2cbus.c Lib_EaBaseBoard/src/eeprom.c \
+ *       Lib_EaBaseBoard/host/i2c_emu.c Lib_EaBaseBoard/host/eeprom_emu.c
+ */
+#ifndef __I2C_EMU_H
+#define __I2C_EMU_H
+
+#include <stdint.h>
+
+/* Power up default */
+#define I2C_EMU_BUS_HZ          100000
+
+/* Number of devices that can be attached */
+#define I2C_EMU_MAX_DEVICES     8
+
+/*
+ * A device on the bus, answering count addresses from addr on. start() is
+ * called for every address byte (start or repeated start), ns is the time
+ * it is sent, and returns 1 to acknowledge it. write() and read() are
+ * called for the bytes that follow an acknowledged address, stop() when
+ * the transfer ends with a stop. Any of them may be NULL.
+ */
+typedef struct
+{
+    const char *name;
+    uint8_t addr;
+    uint8_t count;
+    uint8_t (*start)(uint8_t addr, uint8_t read, uint64_t ns);
+    void (*write)(uint8_t addr, uint8_t value);
+    uint8_t (*read)(uint8_t addr);
+    void (*stop)(uint8_t addr, uint64_t ns);
+} i2c_emu_device_t;
+
+typedef struct
+{
+    uint32_t transfers;     /* calls of I2C_MasterTransferData() */
+    uint32_t bytes;         /* bytes after the address bytes, both ways */
+    uint32_t attempts;      /* address bytes sent, retries included */
+    uint32_t nacks;         /* address bytes not acknowledged */
+    uint32_t failures;      /* transfers given up after all retries */
+    uint32_t interrupts;    /* I2C interrupts of interrupt driven transfers */
+    uint64_t busNs;         /* time the bus was in use */
+    uint64_t blockedNs;     /* time the CPU waited, polled or in __WFI() */
+} i2c_emu_stats_t;
+
+void i2cEmu_attach(const i2c_emu_device_t *device);
+void i2cEmu_reset(void);
+void i2cEmu_setBusClock(uint32_t hz);
+void i2cEmu_setEagerIrq(uint8_t eager);
+void i2cEmu_wait(uint32_t us);
+uint64_t i2cEmu_now(void);
+void i2cEmu_run(void);
+uint8_t i2cEmu_isBusy(void);
+void i2cEmu_getStats(i2c_emu_stats_t *stats);
+int i2cEmu_getDeviceStats(uint8_t addr, i2c_emu_stats_t *stats);
+void i2cEmu_clearStats(void);
+
+/* Stand-ins for __WFI() and the NVIC, see host/inc/LPC17xx.h */
+void i2cEmu_wfi(void);
+void i2cEmu_setIrqEnabled(uint8_t enabled);
+
+#endif /* end __I2C_EMU_H */
@@ -0,0 +1,36 @@
+/*****************************************************************************
+ *   LPC17xx.h:  Host stand-in for the LPC17xx device header
+ *
+ *   Only the interrupt control i2cbus.c uses. There is only one thread of
+ *   execution on the host, so masking all interrupts does nothing; __WFI()
+ *   completes the I2C transfer on the bus and calls I2C2_IRQHandler(), see
+ *   i2c_emu.h. The NVIC enable bit of I2C2, the only interrupt there is, is
+ *   kept by the emulator.
+ *
+ ******************************************************************************/
+#ifndef __LPC17xx_H__
+#define __LPC17xx_H__
+
+#include <stdint.h>
+
+typedef enum IRQn
+{
+    I2C2_IRQn = 12
+} IRQn_Type;
+
+void i2cEmu_wfi(void);
+void i2cEmu_setIrqEnabled(uint8_t enabled);
+
+#define __disable_irq()             ((void)0)
+#define __enable_irq()              ((void)0)
+#define __WFI()                     i2cEmu_wfi()
+#define __DSB()                     ((void)0)
+#define __ISB()                     ((void)0)
+
+#define NVIC_EnableIRQ(irq)         ((void)(irq), i2cEmu_setIrqEnabled(1))
+#define NVIC_DisableIRQ(irq)        ((void)(irq), i2cEmu_setIrqEnabled(0))
+#define NVIC_SetPriority(irq, prio) ((void)(irq), (void)(prio))
+
+void I2C2_IRQHandler(void);
+
+#endif /* end __LPC17xx_H__ */
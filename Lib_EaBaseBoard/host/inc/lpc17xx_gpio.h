@@ -0,0 +1,18 @@
+/*****************************************************************************
+ *   lpc17xx_gpio.h:  Host stand-in for the LPC17xx GPIO driver
+ *
+ *   Only what the base board drivers use. Implemented by oled_emu.c, see
+ *   oled_emu.h for how to build.
+ *
+ ******************************************************************************/
+#ifndef LPC17XX_GPIO_H_
+#define LPC17XX_GPIO_H_
+
+#include "lpc_types.h"
+
+void GPIO_SetDir(uint8_t portNum, uint32_t bitValue, uint8_t dir);
+void GPIO_SetValue(uint8_t portNum, uint32_t bitValue);
+void GPIO_ClearValue(uint8_t portNum, uint32_t bitValue);
+uint32_t GPIO_ReadValue(uint8_t portNum);
+
+#endif /* end LPC17XX_GPIO_H_ */
@@ -0,0 +1,47 @@
+/*****************************************************************************
+ *   lpc17xx_i2c.h:  Host stand-in for the LPC17xx I2C driver
+ *
+ *   Only what i2cbus.c and the base board drivers use. Implemented by
+ *   i2c_emu.c, see i2c_emu.h for how to build.
+ *
+ ******************************************************************************/
+#ifndef LPC17XX_I2C_H_
+#define LPC17XX_I2C_H_
+
+#include "lpc_types.h"
+
+typedef struct {
+    uint32_t id;
+} LPC_I2C_TypeDef;
+
+extern LPC_I2C_TypeDef hostEmu_i2c2;
+#define LPC_I2C2 (&hostEmu_i2c2)
+
+typedef struct
+{
+    uint32_t sl_addr7bit;
+    uint8_t *tx_data;
+    uint32_t tx_length;
+    uint32_t tx_count;
+    uint8_t *rx_data;
+    uint32_t rx_length;
+    uint32_t rx_count;
+    uint32_t retransmissions_max;
+    uint32_t retransmissions_count;
+    uint32_t status;
+    void (*callback)(void);
+} I2C_M_SETUP_Type;
+
+#define I2C_SETUP_STATUS_DONE   (1<<10)
+
+typedef enum {
+    I2C_TRANSFER_POLLING = 0,
+    I2C_TRANSFER_INTERRUPT
+} I2C_TRANSFER_OPT_Type;
+
+Status I2C_MasterTransferData(LPC_I2C_TypeDef *I2Cx, I2C_M_SETUP_Type *TransferCfg,
+        I2C_TRANSFER_OPT_Type Opt);
+void I2C_MasterHandler(LPC_I2C_TypeDef *I2Cx);
+uint32_t I2C_MasterTransferComplete(LPC_I2C_TypeDef *I2Cx);
+
+#endif /* end LPC17XX_I2C_H_ */
@@ -0,0 +1,41 @@
+/*****************************************************************************
+ *   lpc17xx_ssp.h:  Host stand-in for the LPC17xx SSP driver
+ *
+ *   Only what the base board drivers use. Implemented by oled_emu.c, see
+ *   oled_emu.h for how to build.
+ *
+ ******************************************************************************/
+#ifndef LPC17XX_SSP_H_
+#define LPC17XX_SSP_H_
+
+#include "lpc_types.h"
+
+typedef struct {
+    uint32_t id;
+} LPC_SSP_TypeDef;
+
+extern LPC_SSP_TypeDef oledEmu_ssp1;
+#define LPC_SSP1 (&oledEmu_ssp1)
+
+#define SSP_DMA_RX ((uint32_t)(1<<0))
+#define SSP_DMA_TX ((uint32_t)(1<<1))
+
+typedef enum {
+    SSP_TRANSFER_POLLING = 0,
+    SSP_TRANSFER_INTERRUPT
+} SSP_TRANSFER_Type;
+
+typedef struct {
+    void *tx_data;
+    uint32_t tx_cnt;
+    void *rx_data;
+    uint32_t rx_cnt;
+    uint32_t length;
+    uint32_t status;
+} SSP_DATA_SETUP_Type;
+
+int32_t SSP_ReadWrite(LPC_SSP_TypeDef *SSPx, SSP_DATA_SETUP_Type *dataCfg,
+        SSP_TRANSFER_Type xfType);
+void SSP_DMACmd(LPC_SSP_TypeDef *SSPx, uint32_t DMAMode, FunctionalState NewState);
+
+#endif /* end LPC17XX_SSP_H_ */
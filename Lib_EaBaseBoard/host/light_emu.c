@@ -0,0 +1,117 @@
+/*****************************************************************************
+ *   light_emu.c:  Host emulator for the base board ISL29003 light sensor
+ *
+ ******************************************************************************/
+
+/*
+ * An ISL29003 on the emulated I2C2 bus (i2c_emu.c). See light_emu.h.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <string.h>
+#include "i2c_emu.h"
+#include "light_emu.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+#define REG_LSB_SENSOR  0x04
+#define REG_MSB_SENSOR  0x05
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+static uint8_t regs[LIGHT_EMU_REGS];
+static uint8_t pointer = 0;
+static uint8_t command = 0;             /* next byte is the register number */
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+static uint8_t start(uint8_t addr, uint8_t read, uint64_t ns)
+{
+    (void)addr;
+    (void)ns;
+
+    if (!read)
+        command = 1;
+    return 1;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    The first byte written is the register number, the others go to the
+ *    registers from there on
+ *
+ *****************************************************************************/
+static void write(uint8_t addr, uint8_t value)
+{
+    (void)addr;
+
+    if (command) {
+        pointer = value % LIGHT_EMU_REGS;
+        command = 0;
+        return;
+    }
+
+    regs[pointer] = value;
+    pointer = (pointer + 1) % LIGHT_EMU_REGS;
+}
+
+static uint8_t read(uint8_t addr)
+{
+    uint8_t value = regs[pointer];
+
+    (void)addr;
+    pointer = (pointer + 1) % LIGHT_EMU_REGS;
+    return value;
+}
+
+static const i2c_emu_device_t device = {
+    "ISL29003", LIGHT_EMU_I2C_ADDR, 1, start, write, read, NULL
+};
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * Description:
+ *    All registers 0. Also resets the bus (see i2cEmu_reset()) and attaches
+ *    the sensor to it.
+ *
+ *****************************************************************************/
+void lightEmu_reset(void)
+{
+    i2cEmu_reset();
+    i2cEmu_attach(&device);
+
+    memset(regs, 0, sizeof(regs));
+    pointer = 0;
+    command = 0;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Set the ADC value read from the sensor registers
+ *
+ *****************************************************************************/
+void lightEmu_setData(uint16_t data)
+{
+    regs[REG_LSB_SENSOR] = data & 0xff;
+    regs[REG_MSB_SENSOR] = data >> 8;
+}
+
+uint8_t lightEmu_getRegister(uint8_t reg)
+{
+    return regs[reg % LIGHT_EMU_REGS];
+}
@@ -0,0 +1,31 @@
+/*****************************************************************************
+ *   light_emu.h:  Host emulator for the base board ISL29003 light sensor
+ *
+ ******************************************************************************/
+
+/*
+ * Runs the unmodified light.c on a PC, with an ISL29003 on the emulated
+ * I2C2 bus (see i2c_emu.h) at address 0x44: eight registers, the sensor
+ * value in the LSB and MSB sensor registers is set with lightEmu_setData().
+ *
+ * Build with the stand-ins first on the include path, e.g. from the
+ * repository root:
+ *
+ *   gcc -ILib_EaBaseBoard/host/inc -ILib_EaBaseBoard/host \
+ *       -ILib_EaBaseBoard/inc -ILib_MCU/inc app.c \
+ *       Lib_EaBaseBoard/src/i2cbus.c Lib_EaBaseBoard/src/light.c \
+ *       Lib_EaBaseBoard/host/i2c_emu.c Lib_EaBaseBoard/host/light_emu.c
+ */
+#ifndef __LIGHT_EMU_H
+#define __LIGHT_EMU_H
+
+#include <stdint.h>
+
+#define LIGHT_EMU_I2C_ADDR      0x44
+#define LIGHT_EMU_REGS          8
+
+void lightEmu_reset(void);
+void lightEmu_setData(uint16_t data);
+uint8_t lightEmu_getRegister(uint8_t reg);
+
+#endif /* end __LIGHT_EMU_H */
@@ -0,0 +1,499 @@
+/*****************************************************************************
+ *   oled_emu.c:  Host emulator for the base board OLED display
+ *
+ ******************************************************************************/
+
+/*
+ * Implements the GPIO, SSP and GPDMA driver functions used by oled.c on a
+ * PC, puts the display on the emulated I2C2 bus (i2c_emu.c) and decodes
+ * what is sent to the SSD1305. See oled_emu.h.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "lpc17xx_gpio.h"
+#include "lpc17xx_ssp.h"
+#include "lpc17xx_gpdma.h"
+#include "oled.h"
+#include "i2c_emu.h"
+#include "oled_emu.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+/* Pins used by oled.c */
+#define CS_PORT      0
+#define CS_PIN       (1<<6)     /* active low */
+#define DC_PORT      2
+#define DC_PIN       (1<<7)     /* high for data, low for commands */
+
+#define DMA_CHANNELS 8
+
+typedef struct
+{
+    GPDMA_Channel_CFG_Type cfg;
+    uint8_t enabled;
+    uint8_t tcPending;
+} dma_channel_t;
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+LPC_SSP_TypeDef oledEmu_ssp1;
+
+static uint8_t csHigh = 1;
+static uint8_t dcHigh = 0;
+static uint32_t sspDmaMode = 0;
+static dma_channel_t dma[DMA_CHANNELS];
+
+/* I2C write being received */
+static uint8_t i2cControl = 0;          /* last control byte */
+static uint8_t i2cExpectControl = 1;    /* next byte is a control byte */
+
+/* Emulated SSD1305 */
+static uint8_t gddram[OLED_EMU_PAGES][OLED_EMU_COLUMNS];
+static uint8_t page = 0;
+static uint8_t column = 0;
+static uint8_t argsLeft = 0;
+static uint8_t displayOn = 0;
+static uint8_t inverse = 0;
+
+static oled_emu_stats_t stats;
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * Description:
+ *    Number of argument bytes following an SSD1305 command
+ *
+ *****************************************************************************/
+static uint8_t commandArgs(uint8_t cmd)
+{
+    switch (cmd) {
+    case 0x20: case 0x81: case 0x82: case 0xa8: case 0xad: case 0xd3:
+    case 0xd5: case 0xd8: case 0xd9: case 0xda: case 0xdb:
+        return 1;
+    case 0x21: case 0x22: case 0xa3:
+        return 2;
+    case 0x91: case 0x92: case 0x93:
+        return 4;
+    case 0x26: case 0x27: case 0x29: case 0x2a:
+        return 5;
+    default:
+        return 0;
+    }
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Decode a command byte. Only page addressing is emulated, the other
+ *    commands are skipped together with their arguments.
+ *
+ *****************************************************************************/
+static void command(uint8_t cmd)
+{
+    stats.commandBytes++;
+
+    if (argsLeft > 0) {
+        argsLeft--;
+        return;
+    }
+
+    if (cmd <= 0x0f) {
+        column = (column & 0xf0) | cmd;
+    }
+    else if (cmd <= 0x1f) {
+        column = (column & 0x0f) | ((cmd & 0x0f) << 4);
+    }
+    else if (cmd >= 0xb0 && cmd <= 0xb7) {
+        page = cmd & 0x07;
+    }
+    else if (cmd == 0xa6 || cmd == 0xa7) {
+        inverse = cmd & 0x01;
+    }
+    else if (cmd == 0xae || cmd == 0xaf) {
+        displayOn = cmd & 0x01;
+    }
+    else {
+        argsLeft = commandArgs(cmd);
+    }
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Write a data byte at the current address, the column moves on
+ *
+ *****************************************************************************/
+static void data(uint8_t value)
+{
+    stats.dataBytes++;
+
+    if (column < OLED_EMU_COLUMNS) {
+        gddram[page][column] = value;
+        column++;
+    }
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Clock bytes into the display, it only listens while selected
+ *
+ *****************************************************************************/
+static void sendBytes(const uint8_t *buf, uint32_t len)
+{
+    uint32_t i;
+
+    if (csHigh)
+        return;
+
+    for (i = 0; i < len; i++) {
+        if (dcHigh)
+            data(buf[i]);
+        else
+            command(buf[i]);
+    }
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    I2C address byte, only writes are acknowledged. A control byte comes
+ *    first.
+ *
+ *****************************************************************************/
+static uint8_t i2cStart(uint8_t addr, uint8_t read, uint64_t ns)
+{
+    (void)addr;
+    (void)ns;
+
+    if (read)
+        return 0;
+
+    stats.i2cTransfers++;
+    i2cExpectControl = 1;
+    return 1;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Decode a byte of an I2C write to the display. Every control byte tells
+ *    if commands or data follow (D/C#) and if that is only the next byte
+ *    (Co set, then another control byte) or everything up to the stop.
+ *
+ *****************************************************************************/
+static void i2cWrite(uint8_t addr, uint8_t value)
+{
+    (void)addr;
+
+    stats.i2cBytes++;
+
+    if (i2cExpectControl) {
+        i2cControl = value;
+        i2cExpectControl = 0;
+        return;
+    }
+
+    if (i2cControl & 0x40)
+        data(value);
+    else
+        command(value);
+
+    if (i2cControl & 0x80)
+        i2cExpectControl = 1;
+}
+
+static const i2c_emu_device_t i2cDevice = {
+    "SSD1305", OLED_EMU_I2C_ADDR, 1, i2cStart, i2cWrite, NULL, NULL
+};
+
+/******************************************************************************
+ * Public Functions: driver stand-ins
+ *****************************************************************************/
+
+void GPIO_SetDir(uint8_t portNum, uint32_t bitValue, uint8_t dir)
+{
+    (void)portNum;
+    (void)bitValue;
+    (void)dir;
+}
+
+void GPIO_SetValue(uint8_t portNum, uint32_t bitValue)
+{
+    if (portNum == CS_PORT && (bitValue & CS_PIN))
+        csHigh = 1;
+    if (portNum == DC_PORT && (bitValue & DC_PIN))
+        dcHigh = 1;
+}
+
+void GPIO_ClearValue(uint8_t portNum, uint32_t bitValue)
+{
+    if (portNum == CS_PORT && (bitValue & CS_PIN))
+        csHigh = 0;
+    if (portNum == DC_PORT && (bitValue & DC_PIN))
+        dcHigh = 0;
+}
+
+uint32_t GPIO_ReadValue(uint8_t portNum)
+{
+    (void)portNum;
+    return 0xffffffff;      /* all inputs pulled up, no button pressed */
+}
+
+int32_t SSP_ReadWrite(LPC_SSP_TypeDef *SSPx, SSP_DATA_SETUP_Type *dataCfg,
+        SSP_TRANSFER_Type xfType)
+{
+    (void)SSPx;
+    (void)xfType;
+
+    stats.transfers++;
+    sendBytes((const uint8_t *)dataCfg->tx_data, dataCfg->length);
+    if (dataCfg->rx_data != NULL)
+        memset(dataCfg->rx_data, 0, dataCfg->length);
+
+    dataCfg->tx_cnt = dataCfg->length;
+    dataCfg->rx_cnt = dataCfg->length;
+    dataCfg->status = 0;
+    return (int32_t)dataCfg->length;
+}
+
+void SSP_DMACmd(LPC_SSP_TypeDef *SSPx, uint32_t DMAMode, FunctionalState NewState)
+{
+    (void)SSPx;
+
+    if (NewState == ENABLE)
+        sspDmaMode |= DMAMode;
+    else
+        sspDmaMode &= ~DMAMode;
+}
+
+void GPDMA_Init(void)
+{
+    memset(dma, 0, sizeof(dma));
+}
+
+Status GPDMA_Setup(GPDMA_Channel_CFG_Type *GPDMAChannelConfig)
+{
+    dma_channel_t *ch = &dma[GPDMAChannelConfig->ChannelNum];
+
+    if (ch->enabled)
+        return ERROR;
+
+    ch->cfg = *GPDMAChannelConfig;
+    ch->tcPending = 0;
+    return SUCCESS;
+}
+
+IntStatus GPDMA_IntGetStatus(GPDMA_Status_Type type, uint8_t channel)
+{
+    switch (type) {
+    case GPDMA_STAT_INT:
+    case GPDMA_STAT_INTTC:
+    case GPDMA_STAT_RAWINTTC:
+        return dma[channel].tcPending ? SET : RESET;
+    case GPDMA_STAT_ENABLED_CH:
+        return dma[channel].enabled ? SET : RESET;
+    default:
+        return RESET;       /* transfers never fail */
+    }
+}
+
+void GPDMA_ClearIntPending(GPDMA_StateClear_Type type, uint8_t channel)
+{
+    if (type == GPDMA_STATCLR_INTTC)
+        dma[channel].tcPending = 0;
+}
+
+void GPDMA_ChannelCmd(uint8_t channelNum, FunctionalState NewState)
+{
+    dma[channelNum].enabled = (NewState == ENABLE);
+}
+
+/******************************************************************************
+ * Public Functions: emulator
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * Description:
+ *    Power up state: display memory cleared, no DMA, statistics cleared.
+ *    Also resets the bus (see i2cEmu_reset()) and attaches the display to
+ *    it.
+ *
+ *****************************************************************************/
+void oledEmu_reset(void)
+{
+    i2cEmu_reset();
+    i2cEmu_attach(&i2cDevice);
+
+    csHigh = 1;
+    dcHigh = 0;
+    sspDmaMode = 0;
+    memset(dma, 0, sizeof(dma));
+    i2cControl = 0;
+    i2cExpectControl = 1;
+    memset(gddram, 0, sizeof(gddram));
+    page = 0;
+    column = 0;
+    argsLeft = 0;
+    displayOn = 0;
+    inverse = 0;
+    oledEmu_clearStats();
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Complete the GPDMA transfers on SSP1 and call oled_dmaIrqHandler()
+ *    after each one, and the interrupt driven I2C writes (see i2cEmu_run()),
+ *    until the flush started by oled_flushDma() is done. On the target this
+ *    happens in the background.
+ *
+ *****************************************************************************/
+void oledEmu_runDma(void)
+{
+    uint8_t progress = 1;
+    uint8_t tx;
+    uint8_t rx;
+
+    while (progress) {
+        progress = 0;
+
+        for (tx = 0; tx < DMA_CHANNELS; tx++) {
+            dma_channel_t *txCh = &dma[tx];
+            if (!txCh->enabled || (sspDmaMode & SSP_DMA_TX) == 0 ||
+                    txCh->cfg.TransferType != GPDMA_TRANSFERTYPE_M2P ||
+                    txCh->cfg.DstConn != GPDMA_CONN_SSP1_Tx) {
+                continue;
+            }
+
+            sendBytes((const uint8_t *)(uintptr_t)txCh->cfg.SrcMemAddr,
+                    txCh->cfg.TransferSize);
+            stats.dmaTransfers++;
+            stats.dmaBytes += txCh->cfg.TransferSize;
+            txCh->enabled = 0;
+            txCh->tcPending = 1;
+
+            /* The same number of bytes is clocked in */
+            for (rx = 0; rx < DMA_CHANNELS; rx++) {
+                dma_channel_t *rxCh = &dma[rx];
+                if (rxCh->enabled && (sspDmaMode & SSP_DMA_RX) &&
+                        rxCh->cfg.TransferType == GPDMA_TRANSFERTYPE_P2M &&
+                        rxCh->cfg.SrcConn == GPDMA_CONN_SSP1_Rx) {
+                    memset((void *)(uintptr_t)rxCh->cfg.DstMemAddr, 0,
+                            rxCh->cfg.TransferSize);
+                    rxCh->enabled = 0;
+                    rxCh->tcPending = 1;
+                }
+            }
+            progress = 1;
+        }
+
+        if (progress)
+            oled_dmaIrqHandler();
+
+        if (i2cEmu_isBusy()) {
+            i2cEmu_run();
+            progress = 1;
+        }
+    }
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Read a pixel of the panel, in the same coordinates as oled.c
+ *
+ * Returns:
+ *    1 if the pixel is lit, 0 otherwise
+ *
+ *****************************************************************************/
+uint8_t oledEmu_getPixel(uint8_t x, uint8_t y)
+{
+    uint8_t on;
+
+    if (x >= OLED_DISPLAY_WIDTH || y >= OLED_DISPLAY_HEIGHT)
+        return 0;
+
+    on = (gddram[y >> 3][OLED_EMU_FIRST_COLUMN + x] >> (y & 0x07)) & 0x01;
+    return on ^ inverse;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Raw display memory, OLED_EMU_PAGES rows of OLED_EMU_COLUMNS bytes
+ *
+ *****************************************************************************/
+const uint8_t *oledEmu_getGddram(void)
+{
+    return &gddram[0][0];
+}
+
+uint8_t oledEmu_isDisplayOn(void)
+{
+    return displayOn;
+}
+
+void oledEmu_getStats(oled_emu_stats_t *s)
+{
+    *s = stats;
+}
+
+void oledEmu_clearStats(void)
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Save the panel as a binary PGM image, lit pixels are white
+ *
+ * Params:
+ *   [in] path - file to write
+ *   [in] scale - size of a display pixel in image pixels, at least 1
+ *
+ * Returns:
+ *    0 on success, -1 if the file couldn't be written
+ *
+ *****************************************************************************/
+int oledEmu_writePgm(const char *path, uint8_t scale)
+{
+    FILE *f;
+    uint8_t row[OLED_DISPLAY_WIDTH * 255];
+    uint32_t x, y, i;
+    int ok;
+
+    if (scale == 0)
+        scale = 1;
+
+    f = fopen(path, "wb");
+    if (f == NULL)
+        return -1;
+
+    ok = fprintf(f, "P5\n%d %d\n255\n", OLED_DISPLAY_WIDTH * scale,
+            OLED_DISPLAY_HEIGHT * scale) > 0;
+
+    for (y = 0; y < OLED_DISPLAY_HEIGHT * scale; y++) {
+        for (x = 0; x < OLED_DISPLAY_WIDTH * scale; x++) {
+            row[x] = oledEmu_getPixel(x / scale, y / scale) ? 255 : 0;
+        }
+        i = OLED_DISPLAY_WIDTH * scale;
+        ok = ok && fwrite(row, 1, i, f) == i;
+    }
+
+    return (fclose(f) == 0 && ok) ? 0 : -1;
+}
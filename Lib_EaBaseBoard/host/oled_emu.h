@@ -0,0 +1,61 @@
+/*****************************************************************************
+ *   oled_emu.h:  Host emulator for the base board OLED display
+ *
+ ******************************************************************************/
+
+/*
+ * Runs the unmodified oled.c on a PC. The host stand-ins in host/inc take
+ * the place of the GPIO, SSP, GPDMA and I2C drivers, this file implements
+ * the first three and puts the display on the emulated I2C2 bus (see
+ * i2c_emu.h): the SSD1305 command and data stream on SSP1, or on I2C2
+ * when oled.c is built with OLED_USE_I2C, is decoded into an emulated
+ * display memory (GDDRAM) that can be read back or saved as a PGM image,
+ * and every byte on the bus is counted.
+ *
+ * Build with the stand-ins first on the include path, e.g. from the
+ * repository root:
+ *
+ *   gcc -no-pie -ILib_EaBaseBoard/host/inc -ILib_EaBaseBoard/host \
+ *       -ILib_EaBaseBoard/inc -ILib_MCU/inc app.c \
+ *       Lib_EaBaseBoard/src/oled.c Lib_EaBaseBoard/src/font5x7.c \
+ *       Lib_EaBaseBoard/host/oled_emu.c Lib_EaBaseBoard/host/i2c_emu.c
+ *
+ * With OLED_USE_I2C also link Lib_EaBaseBoard/src/i2cbus.c.
+ *
+ * -no-pie keeps static data below 4 GB, oled.c hands buffer addresses to
+ * GPDMA as 32-bit values like on the target.
+ */
+#ifndef __OLED_EMU_H
+#define __OLED_EMU_H
+
+#include <stdint.h>
+
+/* The SSD1305 has 132 columns, the panel shows OLED_DISPLAY_WIDTH of them */
+#define OLED_EMU_COLUMNS        132
+#define OLED_EMU_PAGES          8
+#define OLED_EMU_FIRST_COLUMN   18
+
+/* I2C address of the display */
+#define OLED_EMU_I2C_ADDR       0x3c
+
+typedef struct
+{
+    uint32_t transfers;     /* polled SSP transfers */
+    uint32_t commandBytes;  /* bytes sent with D/C low */
+    uint32_t dataBytes;     /* bytes sent with D/C high, DMA included */
+    uint32_t dmaTransfers;  /* GPDMA transfers to SSP1 */
+    uint32_t dmaBytes;      /* bytes sent by GPDMA */
+    uint32_t i2cTransfers;  /* I2C writes to the display, retries included */
+    uint32_t i2cBytes;      /* bytes after the address, control bytes included */
+} oled_emu_stats_t;
+
+void oledEmu_reset(void);
+void oledEmu_runDma(void);
+uint8_t oledEmu_getPixel(uint8_t x, uint8_t y);
+const uint8_t *oledEmu_getGddram(void);
+uint8_t oledEmu_isDisplayOn(void);
+void oledEmu_getStats(oled_emu_stats_t *stats);
+void oledEmu_clearStats(void);
+int oledEmu_writePgm(const char *path, uint8_t scale);
+
+#endif /* end __OLED_EMU_H */
@@ -0,0 +1,201 @@
+/*****************************************************************************
+ *   pca9532_emu.c:  Host emulator for the base board PCA9532 LED dimmer
+ *
+ ******************************************************************************/
+
+/*
+ * A PCA9532 on the emulated I2C2 bus (i2c_emu.c). See pca9532_emu.h.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <string.h>
+#include "i2c_emu.h"
+#include "pca9532_emu.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+#define REG_INPUT0   0x00
+#define REG_INPUT1   0x01
+#define REG_PSC0     0x02
+#define REG_LS0      0x06
+
+#define CTRL_AUTO_INC 0x10
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+static uint8_t regs[PCA9532_EMU_REGS];
+static uint8_t pointer = 0;             /* register addressed next */
+static uint8_t autoInc = 0;
+static uint8_t control = 0;             /* next byte is the control register */
+
+static pca9532_emu_stats_t stats;
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * Description:
+ *    INPUT0 and INPUT1 follow the LED pins. A blinking LED is read as on.
+ *
+ *****************************************************************************/
+static uint8_t readInput(uint8_t reg)
+{
+    uint8_t first = (reg == REG_INPUT0) ? 0 : 8;
+    uint8_t value = 0;
+    uint8_t i;
+
+    for (i = 0; i < 8; i++) {
+        if (pca9532Emu_getSelector(first + i) == PCA9532_EMU_LS_OFF)
+            value |= (1 << i);
+    }
+    return value;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    With auto-increment the register pointer goes from LS3 back to INPUT0
+ *
+ *****************************************************************************/
+static void next(void)
+{
+    if (autoInc)
+        pointer = (pointer + 1) % PCA9532_EMU_REGS;
+}
+
+static uint8_t start(uint8_t addr, uint8_t read, uint64_t ns)
+{
+    (void)addr;
+    (void)ns;
+
+    if (!read)
+        control = 1;
+    return 1;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    The first byte written is the control register: the register number
+ *    and the auto-increment flag. The others go to the registers.
+ *
+ *****************************************************************************/
+static void write(uint8_t addr, uint8_t value)
+{
+    (void)addr;
+
+    if (control) {
+        pointer = (value & 0x0f) % PCA9532_EMU_REGS;
+        autoInc = (value & CTRL_AUTO_INC) != 0;
+        control = 0;
+        return;
+    }
+
+    /* the input registers are read only */
+    if (pointer >= REG_PSC0) {
+        stats.regWrites++;
+        if (pointer >= REG_LS0) {
+            stats.lsWrites++;
+            if (regs[pointer] != value)
+                stats.lsChanges++;
+        }
+        regs[pointer] = value;
+    }
+    next();
+}
+
+static uint8_t read(uint8_t addr)
+{
+    uint8_t value;
+
+    (void)addr;
+
+    value = (pointer <= REG_INPUT1) ? readInput(pointer) : regs[pointer];
+    next();
+    return value;
+}
+
+static const i2c_emu_device_t device = {
+    "PCA9532", PCA9532_EMU_I2C_ADDR, 1, start, write, read, NULL
+};
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * Description:
+ *    Power up state, all LEDs off. Also resets the bus (see i2cEmu_reset())
+ *    and attaches the PCA9532 to it.
+ *
+ *****************************************************************************/
+void pca9532Emu_reset(void)
+{
+    i2cEmu_reset();
+    i2cEmu_attach(&device);
+
+    memset(regs, 0, sizeof(regs));
+    pointer = 0;
+    autoInc = 0;
+    control = 0;
+    pca9532Emu_clearStats();
+}
+
+uint8_t pca9532Emu_getRegister(uint8_t reg)
+{
+    if (reg <= REG_INPUT1)
+        return readInput(reg);
+    return regs[reg % PCA9532_EMU_REGS];
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    LED selector of a LED, 0 - 15 (base board LED4 - LED19)
+ *
+ * Returns:
+ *    one of the PCA9532_EMU_LS_ values
+ *
+ *****************************************************************************/
+uint8_t pca9532Emu_getSelector(uint8_t led)
+{
+    return (regs[REG_LS0 + (led / 4) % 4] >> ((led % 4) * 2)) & 3;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Mask of the LEDs with a LED selector, bit 0 is LED4 like in pca9532.h
+ *
+ *****************************************************************************/
+uint16_t pca9532Emu_getLeds(uint8_t selector)
+{
+    uint16_t mask = 0;
+    uint8_t i;
+
+    for (i = 0; i < 16; i++) {
+        if (pca9532Emu_getSelector(i) == selector)
+            mask |= (1 << i);
+    }
+    return mask;
+}
+
+void pca9532Emu_getStats(pca9532_emu_stats_t *s)
+{
+    *s = stats;
+}
+
+void pca9532Emu_clearStats(void)
+{
+    memset(&stats, 0, sizeof(stats));
+}
@@ -0,0 +1,48 @@
+/*****************************************************************************
+ *   pca9532_emu.h:  Host emulator for the base board PCA9532 LED dimmer
+ *
+ ******************************************************************************/
+
+/*
+ * Runs the unmodified pca9532.c on a PC, with a PCA9532 on the emulated
+ * I2C2 bus (see i2c_emu.h) at address 0x60: the ten registers, written and
+ * read with or without auto-increment like on the real device. The LEDs
+ * are active low, so an INPUT bit reads 0 for a LED that is on.
+ *
+ * Build with the stand-ins first on the include path, e.g. from the
+ * repository root:
+ *
+ *   gcc -ILib_EaBaseBoard/host/inc -ILib_EaBaseBoard/host \
+ *       -ILib_EaBaseBoard/inc -ILib_MCU/inc app.c \
+ *       Lib_EaBaseBoard/src/i2cbus.c Lib_EaBaseBoard/src/pca9532.c \
+ *       Lib_EaBaseBoard/host/i2c_emu.c Lib_EaBaseBoard/host/pca9532_emu.c
+ */
+#ifndef __PCA9532_EMU_H
+#define __PCA9532_EMU_H
+
+#include <stdint.h>
+
+#define PCA9532_EMU_I2C_ADDR    0x60
+#define PCA9532_EMU_REGS        10
+
+/* LED selector values in the LS registers */
+#define PCA9532_EMU_LS_OFF      0
+#define PCA9532_EMU_LS_ON       1
+#define PCA9532_EMU_LS_BLINK0   2
+#define PCA9532_EMU_LS_BLINK1   3
+
+typedef struct
+{
+    uint32_t regWrites;     /* register bytes written, any register */
+    uint32_t lsWrites;      /* bytes written to LS0 - LS3 */
+    uint32_t lsChanges;     /* of them, the ones that changed the register */
+} pca9532_emu_stats_t;
+
+void pca9532Emu_reset(void);
+uint8_t pca9532Emu_getRegister(uint8_t reg);
+uint8_t pca9532Emu_getSelector(uint8_t led);
+uint16_t pca9532Emu_getLeds(uint8_t selector);
+void pca9532Emu_getStats(pca9532_emu_stats_t *stats);
+void pca9532Emu_clearStats(void);
+
+#endif /* end __PCA9532_EMU_H */
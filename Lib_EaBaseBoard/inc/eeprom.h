@@ -8,10 +8,15 @@
 #ifndef __EEPROM_H
 #define __EEPROM_H
 
+/* Called when a write started by eeprom_writeAsync() is done */
+typedef void (*eeprom_done_t)(int16_t result);
 
 void eeprom_init (void);
 int16_t eeprom_read(uint8_t* buf, uint16_t offset, uint16_t len);
 int16_t eeprom_write(uint8_t* buf, uint16_t offset, uint16_t len);
+int16_t eeprom_writeAsync(uint8_t* buf, uint16_t offset, uint16_t len,
+        eeprom_done_t done);
+uint8_t eeprom_isBusy(void);
 
 
 #endif /* end __EEPROM_H */
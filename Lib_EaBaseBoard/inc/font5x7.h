@@ -8,7 +8,11 @@
 #ifndef __FONT5x7_H
 #define __FONT5x7_H
 
+/* Width of a character cell in pixels, columns 6 and 7 of font5x7 are never drawn */
+#define FONT5X7_COLUMNS 6
+
 extern const unsigned char font5x7[][8];
+extern const unsigned char font5x7_columns[][FONT5X7_COLUMNS];
 
 
 #endif /* end __FONT5x7_H */
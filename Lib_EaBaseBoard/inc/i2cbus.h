@@ -0,0 +1,68 @@
+/*****************************************************************************
+ *   i2cbus.h:  Header file for the shared I2C2 bus
+ *
+******************************************************************************/
+#ifndef __I2CBUS_H
+#define __I2CBUS_H
+
+#include "lpc_types.h"
+
+/*
+ * Shared access to I2C2 for the base board drivers. The I2C2 interrupt
+ * handler, I2C2_IRQHandler(), is defined in i2cbus.c.
+ */
+
+/* Transfers that can wait for the bus, the running one not included */
+#define I2CBUS_QUEUE_SIZE 8
+
+/* Retries after a NACK used by i2cbus_write(), i2cbus_read() and
+ * i2cbus_writeRead() */
+#define I2CBUS_RETRIES 3
+
+typedef enum
+{
+    I2CBUS_IDLE,    /* never submitted */
+    I2CBUS_BUSY,    /* waiting in the queue or running */
+    I2CBUS_DONE,
+    I2CBUS_ERROR    /* not acknowledged after all retries */
+} i2cbus_status_t;
+
+typedef struct i2cbus_xfer_s i2cbus_xfer_t;
+
+/* Called from the I2C interrupt when a transfer has finished */
+typedef void (*i2cbus_done_t)(i2cbus_xfer_t* xfer);
+
+/*
+ * A transfer writes txLen bytes and then, after a repeated start, reads
+ * rxLen bytes; either length may be 0. The transfer and its buffers belong
+ * to the caller and must stay valid while the status is I2CBUS_BUSY.
+ */
+struct i2cbus_xfer_s
+{
+    uint8_t addr;                   /* 7 bit address */
+    uint8_t* txBuf;
+    uint16_t txLen;
+    uint8_t* rxBuf;
+    uint16_t rxLen;
+    uint16_t retries;               /* tries after a NACK */
+    i2cbus_done_t done;             /* may be NULL */
+    volatile i2cbus_status_t status;
+};
+
+
+void i2cbus_init (void);
+int i2cbus_submit(i2cbus_xfer_t* xfer);
+int i2cbus_run(i2cbus_xfer_t* xfer);
+int i2cbus_write(uint8_t addr, uint8_t* buf, uint32_t len);
+int i2cbus_read(uint8_t addr, uint8_t* buf, uint32_t len);
+int i2cbus_writeRead(uint8_t addr, uint8_t* txBuf, uint32_t txLen,
+        uint8_t* rxBuf, uint32_t rxLen);
+void i2cbus_lock(void);
+void i2cbus_unlock(void);
+uint8_t i2cbus_isIdle(void);
+
+
+#endif /* end __I2CBUS_H */
+/****************************************************************************
+**                            End Of File
+*****************************************************************************/
@@ -40,10 +40,14 @@ typedef enum
     LIGHT_CYCLE_16
 } light_cycle_t;
 
+/* Called when a read started by light_readAsync() is done */
+typedef void (*light_done_t)(int32_t lux);
+
 
 void light_init (void);
 void light_enable (void);
 uint32_t light_read(void);
+int light_readAsync(light_done_t done);
 void light_setMode(light_mode_t mode);
 void light_setWidth(light_width_t width);
 void light_setRange(light_range_t newRange);
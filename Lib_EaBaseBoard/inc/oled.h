@@ -11,6 +11,18 @@
 #define OLED_DISPLAY_WIDTH  96
 #define OLED_DISPLAY_HEIGHT 64
 
+/* Widest field of oled_putNumber(), enough for any int32_t */
+#define OLED_NUMBER_CHARS_MAX 11
+
+/* GPDMA channels used by oled_flushDma(), channel 0 has the highest priority
+ * and is left to the application */
+#ifndef OLED_DMA_TX_CHANNEL
+#define OLED_DMA_TX_CHANNEL 1
+#endif
+#ifndef OLED_DMA_RX_CHANNEL
+#define OLED_DMA_RX_CHANNEL 2
+#endif
+
 
 typedef enum
 {
@@ -18,6 +30,8 @@ typedef enum
     OLED_COLOR_WHITE
 } oled_color_t;
 
+typedef void (*oled_flush_done_t)(void);
+
 
 void oled_init (void);
 void oled_putPixel(uint8_t x, uint8_t y, oled_color_t color);
@@ -29,6 +43,13 @@ void oled_clearScreen(oled_color_t color);
 void oled_putString(uint8_t x, uint8_t y, uint8_t *pStr, oled_color_t fb,
         oled_color_t bg);
 uint8_t oled_putChar(uint8_t x, uint8_t y, uint8_t ch, oled_color_t fb, oled_color_t bg);
+uint8_t oled_putNumber(uint8_t x, uint8_t y, int32_t value, uint8_t chars,
+        oled_color_t fb, oled_color_t bg);
+void oled_flush(void);
+void oled_setAutoFlush(uint8_t enable);
+uint8_t oled_flushDma(oled_flush_done_t done);
+uint8_t oled_isFlushing(void);
+void oled_dmaIrqHandler(void);
 
 
 #endif /* end __OLED_H */
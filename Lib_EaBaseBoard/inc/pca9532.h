@@ -58,6 +58,8 @@ void pca9532_setBlink0Leds(uint16_t ledMask);
 void pca9532_setBlink1Period(uint8_t period);
 void pca9532_setBlink1Duty(uint8_t duty);
 void pca9532_setBlink1Leds(uint16_t ledMask);
+void pca9532_beginUpdate(void);
+void pca9532_endUpdate(void);
 
 #endif /* end __PCA9532C_H */
 /****************************************************************************
@@ -8,21 +8,19 @@
 
 /*
  * NOTE: I2C must have been initialized before calling any functions in this
- * file.
+ * file. The transfers go through the shared bus queue, see i2cbus.c.
  */
 
 /******************************************************************************
  * Includes
  *****************************************************************************/
 
-#include "lpc17xx_i2c.h"
+#include "i2cbus.h"
 #include "acc.h"
 
 /******************************************************************************
  * Defines and typedefs
  *****************************************************************************/
-#define I2CDEV LPC_I2C2
-
 #define ACC_I2C_ADDR    (0x1D)
 
 #define ACC_ADDR_XOUTL  0x00
@@ -73,50 +71,12 @@
  * Local variables
  *****************************************************************************/
 
-static int I2CRead(uint8_t addr, uint8_t* buf, uint32_t len)
-{
-	I2C_M_SETUP_Type rxsetup;
-
-	rxsetup.sl_addr7bit = addr;
-	rxsetup.tx_data = NULL;	// Get address to read at writing address
-	rxsetup.tx_length = 0;
-	rxsetup.rx_data = buf;
-	rxsetup.rx_length = len;
-	rxsetup.retransmissions_max = 3;
-
-	if (I2C_MasterTransferData(I2CDEV, &rxsetup, I2C_TRANSFER_POLLING) == SUCCESS){
-		return (0);
-	} else {
-		return (-1);
-	}
-}
-
-static int I2CWrite(uint8_t addr, uint8_t* buf, uint32_t len)
-{
-	I2C_M_SETUP_Type txsetup;
-
-	txsetup.sl_addr7bit = addr;
-	txsetup.tx_data = buf;
-	txsetup.tx_length = len;
-	txsetup.rx_data = NULL;
-	txsetup.rx_length = 0;
-	txsetup.retransmissions_max = 3;
-
-	if (I2C_MasterTransferData(I2CDEV, &txsetup, I2C_TRANSFER_POLLING) == SUCCESS){
-		return (0);
-	} else {
-		return (-1);
-	}
-}
-
-
 static uint8_t getStatus(void)
 {
     uint8_t buf[1];
 
     buf[0] = ACC_ADDR_STATUS;
-    I2CWrite(ACC_I2C_ADDR, buf, 1);
-    I2CRead(ACC_I2C_ADDR, buf, 1);
+    i2cbus_writeRead(ACC_I2C_ADDR, buf, 1, buf, 1);
 
     return buf[0];
 }
@@ -126,8 +86,7 @@ static uint8_t getModeControl(void)
     uint8_t buf[1];
 
     buf[0] = ACC_ADDR_MCTL;
-    I2CWrite(ACC_I2C_ADDR, buf, 1);
-    I2CRead(ACC_I2C_ADDR, buf, 1);
+    i2cbus_writeRead(ACC_I2C_ADDR, buf, 1, buf, 1);
 
     return buf[0];
 }
@@ -138,7 +97,7 @@ static void setModeControl(uint8_t mctl)
 
     buf[0] = ACC_ADDR_MCTL;
     buf[1] = mctl;
-    I2CWrite(ACC_I2C_ADDR, buf, 2);
+    i2cbus_write(ACC_I2C_ADDR, buf, 2);
 }
 
 /******************************************************************************
@@ -188,20 +147,17 @@ void acc_read (int8_t *x, int8_t *y, int8_t *z)
      * at once. Change to reading them one-by-one.
      */
     buf[0] = ACC_ADDR_XOUT8;
-    I2CWrite(ACC_I2C_ADDR, buf, 1);
-    I2CRead(ACC_I2C_ADDR, buf, 1);
+    i2cbus_writeRead(ACC_I2C_ADDR, buf, 1, buf, 1);
 
     *x = (int8_t)buf[0];
 
     buf[0] = ACC_ADDR_YOUT8;
-    I2CWrite(ACC_I2C_ADDR, buf, 1);
-    I2CRead(ACC_I2C_ADDR, buf, 1);
+    i2cbus_writeRead(ACC_I2C_ADDR, buf, 1, buf, 1);
 
     *y = (int8_t)buf[0];
 
     buf[0] = ACC_ADDR_ZOUT8;
-    I2CWrite(ACC_I2C_ADDR, buf, 1);
-    I2CRead(ACC_I2C_ADDR, buf, 1);
+    i2cbus_writeRead(ACC_I2C_ADDR, buf, 1, buf, 1);
 
     *z = (int8_t)buf[0];
 }
@@ -8,16 +8,16 @@
 
 /*
  * NOTE: I2C must have been initialized before calling any functions in this
- * file.
+ * file. The transfers go through the shared bus queue, see i2cbus.c.
  */
 
 /******************************************************************************
  * Includes
  *****************************************************************************/
 
-#include "lpc17xx_i2c.h"
 #include "string.h"
 #include "stdio.h"
+#include "i2cbus.h"
 #include "eeprom.h"
 
 /******************************************************************************
@@ -28,8 +28,6 @@
 #define MIN(x, y) ((x) < (y) ? (x) : (y))
 #endif
 
-#define I2CDEV LPC_I2C2
-
 #define EEPROM_I2C_ADDR1    (0x50)
 #define EEPROM_I2C_ADDR2    (0x51)
 #define EEPROM_I2C_ADDR3    (0x52)
@@ -39,6 +37,20 @@
 #define EEPROM_BLOCK_SIZE  256
 #define EEPROM_PAGE_SIZE    16
 
+/*
+ * The EEPROM doesn't acknowledge its address while a write cycle is running
+ * (5 ms at most), so every transfer is tried again until it does. Each try
+ * is queued again on the bus, so the other devices get their turn while
+ * the EEPROM is busy. A try is about eleven bit times: 250 of them are
+ * 28 ms at 100 kHz and 7 ms at 400 kHz.
+ */
+#define EEPROM_ACK_POLL_MAX 250
+
+/* State of a write started by eeprom_writeAsync() */
+#define ASYNC_IDLE  0
+#define ASYNC_WRITE 1   /* sending pages */
+#define ASYNC_POLL  2   /* waiting for the write cycle of the last page */
+
 
 /******************************************************************************
  * External global variables
@@ -48,53 +60,179 @@
  * Local variables
  *****************************************************************************/
 
+static volatile uint8_t asyncState = ASYNC_IDLE;
+static i2cbus_xfer_t asyncXfer;
+static uint16_t asyncTries = 0;
+static uint8_t asyncPage[EEPROM_PAGE_SIZE + 1];
+static uint8_t asyncAddr = 0;
+static uint8_t* asyncBuf = NULL;
+static uint16_t asyncOffset = 0;
+static uint16_t asyncLen = 0;
+static uint16_t asyncSent = 0;
+static eeprom_done_t asyncDone = NULL;
+
 
 /******************************************************************************
  * Local Functions
  *****************************************************************************/
 
-static int I2CRead(uint8_t addr, uint8_t* buf, uint32_t len)
+/******************************************************************************
+ *
+ * Description:
+ *    Run a transfer and wait for it, trying again while the EEPROM doesn't
+ *    acknowledge. Blocks for the running write cycle (5 ms at most), and
+ *    for EEPROM_ACK_POLL_MAX tries if the EEPROM never answers.
+ *
+ *****************************************************************************/
+static int I2CTransfer(uint8_t addr, uint8_t* txBuf, uint32_t txLen,
+        uint8_t* rxBuf, uint32_t rxLen)
 {
-	I2C_M_SETUP_Type rxsetup;
-
-	rxsetup.sl_addr7bit = addr;
-	rxsetup.tx_data = NULL;	// Get address to read at writing address
-	rxsetup.tx_length = 0;
-	rxsetup.rx_data = buf;
-	rxsetup.rx_length = len;
-	rxsetup.retransmissions_max = 3;
-
-	if (I2C_MasterTransferData(I2CDEV, &rxsetup, I2C_TRANSFER_POLLING) == SUCCESS){
-		return (0);
-	} else {
-		return (-1);
-	}
+    i2cbus_xfer_t xfer;
+    uint16_t tries = 0;
+
+    xfer.addr = addr;
+    xfer.txBuf = txBuf;
+    xfer.txLen = txLen;
+    xfer.rxBuf = rxBuf;
+    xfer.rxLen = rxLen;
+    xfer.retries = 0;
+    xfer.done = NULL;
+    xfer.status = I2CBUS_IDLE;
+
+    while (i2cbus_run(&xfer) != 0) {
+        if (tries++ >= EEPROM_ACK_POLL_MAX)
+            return -1;
+    }
+
+    return 0;
 }
 
-static int I2CWrite(uint8_t addr, uint8_t* buf, uint32_t len)
+/******************************************************************************
+ *
+ * Description:
+ *    Prepare the write of one page: the word address followed by as much of
+ *    the data as fits up to the end of the page the offset is in
+ *
+ * Params:
+ *   [out] page - word address and data, EEPROM_PAGE_SIZE + 1 bytes
+ *   [out] addr - I2C address of the block the page is in
+ *   [in] buf - data to write
+ *   [in] offset - offset to write to
+ *   [in] len - number of bytes left to write
+ *
+ * Returns:
+ *   number of data bytes in the page
+ *
+ *****************************************************************************/
+static uint16_t buildPage(uint8_t* page, uint8_t* addr, uint8_t* buf,
+        uint16_t offset, uint16_t len)
 {
-	I2C_M_SETUP_Type txsetup;
-
-	txsetup.sl_addr7bit = addr;
-	txsetup.tx_data = buf;
-	txsetup.tx_length = len;
-	txsetup.rx_data = NULL;
-	txsetup.rx_length = 0;
-	txsetup.retransmissions_max = 3;
-
-	if (I2C_MasterTransferData(I2CDEV, &txsetup, I2C_TRANSFER_POLLING) == SUCCESS){
-		return (0);
-	} else {
-		return (-1);
-	}
+    uint16_t wLen = EEPROM_PAGE_SIZE - (offset % EEPROM_PAGE_SIZE);
+
+    wLen = MIN(wLen, len);
+
+    *addr = EEPROM_I2C_ADDR1 + (offset / EEPROM_BLOCK_SIZE);
+    page[0] = offset % EEPROM_BLOCK_SIZE;
+    memcpy(&page[1], buf, wLen);
+
+    return wLen;
 }
 
+static void asyncXferDone(i2cbus_xfer_t* xfer);
 
-static void eepromDelay(void)
+/******************************************************************************
+ *
+ * Description:
+ *    Queue a transfer of asyncPage
+ *
+ * Params:
+ *   [in] len - number of bytes, 1 to only send the word address
+ *
+ * Returns:
+ *   0 on success, -1 if the bus queue is full
+ *
+ *****************************************************************************/
+static int startAsyncTransfer(uint16_t len)
+{
+    asyncXfer.addr = asyncAddr;
+    asyncXfer.txBuf = asyncPage;
+    asyncXfer.txLen = len;
+    asyncXfer.rxBuf = NULL;
+    asyncXfer.rxLen = 0;
+    asyncXfer.retries = 0;
+    asyncXfer.done = asyncXferDone;
+    asyncTries = 0;
+    return i2cbus_submit(&asyncXfer);
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Queue the next page of an asynchronous write
+ *
+ * Returns:
+ *   0 on success, -1 if the bus queue is full
+ *
+ *****************************************************************************/
+static int startAsyncPage(void)
 {
-    volatile int i = 0;
+    uint16_t wLen = buildPage(asyncPage, &asyncAddr, &asyncBuf[asyncSent],
+            asyncOffset + asyncSent, asyncLen - asyncSent);
 
-    for (i = 0; i <0x20000; i++);
+    asyncSent += wLen;
+    return startAsyncTransfer(wLen + 1);
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    End an asynchronous write and tell the caller
+ *
+ * Params:
+ *   [in] result - passed on to the callback
+ *
+ *****************************************************************************/
+static void finishAsync(int16_t result)
+{
+    asyncState = ASYNC_IDLE;
+    if (asyncDone != NULL)
+        asyncDone(result);
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Called from the I2C interrupt when a transfer of an asynchronous write
+ *    has finished. A try the EEPROM didn't acknowledge is queued again,
+ *    behind whatever else is waiting for the bus.
+ *
+ *****************************************************************************/
+static void asyncXferDone(i2cbus_xfer_t* xfer)
+{
+    int ret = 0;
+
+    if (xfer->status != I2CBUS_DONE) {
+        if (asyncTries < EEPROM_ACK_POLL_MAX) {
+            asyncTries++;
+            ret = i2cbus_submit(xfer);
+        }
+        else {
+            ret = -1;
+        }
+    }
+    else if (asyncSent < asyncLen) {
+        ret = startAsyncPage();
+    }
+    else if (asyncState == ASYNC_WRITE) {
+        asyncState = ASYNC_POLL;
+        ret = startAsyncTransfer(1);
+    }
+    else {
+        finishAsync(asyncLen);
+    }
+
+    if (ret != 0)
+        finishAsync(-1);
 }
 
 /******************************************************************************
@@ -115,7 +253,15 @@ void eeprom_init (void)
 /******************************************************************************
  *
  * Description:
- *    Read from the EEPROM
+ *    Read from the EEPROM. The bytes of each 256 byte block are read in a
+ *    single transaction: the word address, a repeated start and then all
+ *    the data. A read right after a write waits for its write cycle.
+ *
+ *    Blocks until the data has been read: about 90 us per byte at 100 kHz
+ *    (23 ms for the settings log), plus up to 5 ms if a write cycle is
+ *    still running, e.g. after a reset during a save. Meant for loading at
+ *    boot. Fails right away while eeprom_writeAsync() is running, see
+ *    eeprom_isBusy().
  *
  * Params:
  *   [in] buf - read buffer
@@ -129,20 +275,29 @@ void eeprom_init (void)
 int16_t eeprom_read(uint8_t* buf, uint16_t offset, uint16_t len)
 {
     uint8_t addr = 0;
-    int i = 0;
-
-    uint16_t off = offset;
+    uint8_t off = 0;
+    uint16_t rLen = 0;
+    uint16_t done = 0;
 
     if (len > EEPROM_TOTAL_SIZE || offset+len > EEPROM_TOTAL_SIZE) {
         return -1;
     }
 
-    addr = EEPROM_I2C_ADDR1 + (offset/EEPROM_BLOCK_SIZE);
-    off = offset % EEPROM_BLOCK_SIZE;
+    if (asyncState != ASYNC_IDLE) {
+        return -1;
+    }
 
-    I2CWrite((addr), (uint8_t*)&off, 1);
-    for ( i = 0; i < 0x2000; i++);
-    I2CRead((addr), buf, len);
+    while (done < len) {
+        addr = EEPROM_I2C_ADDR1 + ((offset + done) / EEPROM_BLOCK_SIZE);
+        off = (offset + done) % EEPROM_BLOCK_SIZE;
+        rLen = MIN(EEPROM_BLOCK_SIZE - off, len - done);
+
+        if (I2CTransfer(addr, &off, 1, &buf[done], rLen) != 0) {
+            return -1;
+        }
+
+        done += rLen;
+    }
 
     return len;
 
@@ -151,7 +306,10 @@ int16_t eeprom_read(uint8_t* buf, uint16_t offset, uint16_t len)
 /******************************************************************************
  *
  * Description:
- *    Write to the EEPROM
+ *    Write to the EEPROM. Returns when the write cycle of the last page is
+ *    done, which is found out by polling the EEPROM until it acknowledges
+ *    again. Blocks for the write cycle of every page, up to 5 ms each; use
+ *    eeprom_writeAsync() where that is too long.
  *
  * Params:
  *   [in] buf - data to write
@@ -167,35 +325,95 @@ int16_t eeprom_write(uint8_t* buf, uint16_t offset, uint16_t len)
     uint8_t addr = 0;
     int16_t written = 0;
     uint16_t wLen = 0;
-    uint16_t off = offset;
-    uint8_t tmp[17];
+    uint8_t tmp[EEPROM_PAGE_SIZE + 1];
 
     if (len > EEPROM_TOTAL_SIZE || offset+len > EEPROM_TOTAL_SIZE) {
         return -1;
     }
 
-    addr = EEPROM_I2C_ADDR1 + (offset/EEPROM_BLOCK_SIZE);
-    off = offset % EEPROM_BLOCK_SIZE;
-    wLen = ((((off >> 4) + 1) << 4) - off);
-    wLen = MIN(wLen, len);
-
-    while (len) {
-        tmp[0] = off;
-        memcpy(&tmp[1], (void*)&buf[written], wLen);
-        I2CWrite((addr), tmp, wLen+1);
+    if (asyncState != ASYNC_IDLE) {
+        return -1;
+    }
 
-        /* delay to wait for a write cycle */
-        eepromDelay();
+    while (written < len) {
+        /* retried while the previous page is still being written */
+        wLen = buildPage(tmp, &addr, &buf[written], offset + written,
+                len - written);
+        if (I2CTransfer(addr, tmp, wLen + 1, NULL, 0) != 0) {
+            return -1;
+        }
 
-        len     -= wLen;
         written += wLen;
-        off  += wLen;
-
-        wLen = MIN(EEPROM_PAGE_SIZE, len);
+    }
 
-        addr += off / EEPROM_BLOCK_SIZE;
-        off  = off % EEPROM_BLOCK_SIZE;
+    /* only the word address: acknowledged once the last page is written */
+    if (written > 0 && I2CTransfer(addr, tmp, 1, NULL, 0) != 0) {
+        return -1;
     }
 
     return written;
 }
+
+/******************************************************************************
+ *
+ * Description:
+ *    Start writing to the EEPROM and return right away. The pages are
+ *    queued on the bus one after the other from the I2C interrupt, and done
+ *    is called from there once the last write cycle is over. The data must
+ *    stay valid until then.
+ *
+ * Params:
+ *   [in] buf - data to write
+ *   [in] offset - offset to start to write to
+ *   [in] len - number of bytes to write
+ *   [in] done - called with the number of written bytes or -1 in case of
+ *               an error, may be NULL
+ *
+ * Returns:
+ *   number of bytes that will be written, 0 if there is nothing to write
+ *   (done isn't called) or -1 if the offset is invalid, a write is already
+ *   running or the bus queue is full
+ *
+ *****************************************************************************/
+int16_t eeprom_writeAsync(uint8_t* buf, uint16_t offset, uint16_t len,
+        eeprom_done_t done)
+{
+    if (len > EEPROM_TOTAL_SIZE || offset+len > EEPROM_TOTAL_SIZE) {
+        return -1;
+    }
+
+    if (asyncState != ASYNC_IDLE) {
+        return -1;
+    }
+
+    if (len == 0) {
+        return 0;
+    }
+
+    asyncBuf = buf;
+    asyncOffset = offset;
+    asyncLen = len;
+    asyncSent = 0;
+    asyncDone = done;
+    asyncState = ASYNC_WRITE;
+    if (startAsyncPage() != 0) {
+        asyncState = ASYNC_IDLE;
+        return -1;
+    }
+
+    return len;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Check if a write started by eeprom_writeAsync() is still running
+ *
+ * Returns:
+ *   1 if it is, 0 otherwise
+ *
+ *****************************************************************************/
+uint8_t eeprom_isBusy(void)
+{
+    return asyncState != ASYNC_IDLE;
+}
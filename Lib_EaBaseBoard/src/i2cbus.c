@@ -0,0 +1,338 @@
+/*****************************************************************************
+ *   i2cbus.c:  Interrupt driven transfer queue for the I2C2 bus
+ *
+ ******************************************************************************/
+
+/*
+ * All base board drivers on I2C2 go through this file. Transfers are queued
+ * and sent one after the other from the I2C2 interrupt, so a driver can
+ * start a transfer and return right away (i2cbus_submit()), or wait for it
+ * (i2cbus_run() and the helpers built on it) without another driver's
+ * transfer getting in between.
+ *
+ * NOTE: I2C2 must have been initialized (pins, clock and I2C_Cmd) before
+ * calling any functions in this file. Transfers may be started from the
+ * main loop and from the done callbacks; waiting for one only from the
+ * main loop.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include "LPC17xx.h"
+#include "lpc17xx_i2c.h"
+#include "i2cbus.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+#define I2CDEV LPC_I2C2
+
+
+/******************************************************************************
+ * External global variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+/* Transfer on the bus, NULL while the bus is idle */
+static i2cbus_xfer_t* current = NULL;
+static I2C_M_SETUP_Type setup;
+
+/* Transfers waiting for the bus, oldest first */
+static i2cbus_xfer_t* queue[I2CBUS_QUEUE_SIZE];
+static uint8_t queueFirst = 0;
+static uint8_t queueCount = 0;
+
+static uint32_t lockDepth = 0;
+
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * Description:
+ *    Start the oldest waiting transfer, if there is one. Called from the
+ *    interrupt and from the outermost i2cbus_unlock(), never inside a
+ *    locked section: starting a transfer enables the I2C2 interrupt in the
+ *    NVIC (I2C_IntCmd() in I2C_MasterTransferData()), which would end the
+ *    lock.
+ *
+ *****************************************************************************/
+static void startNext(void)
+{
+    i2cbus_xfer_t* xfer;
+
+    if (queueCount == 0)
+        return;
+
+    xfer = queue[queueFirst];
+    queueFirst = (queueFirst + 1) % I2CBUS_QUEUE_SIZE;
+    queueCount--;
+    current = xfer;
+
+    setup.sl_addr7bit = xfer->addr;
+    setup.tx_data = xfer->txBuf;
+    setup.tx_length = xfer->txLen;
+    setup.rx_data = xfer->rxBuf;
+    setup.rx_length = xfer->rxLen;
+    setup.retransmissions_max = xfer->retries;
+    setup.retransmissions_count = 0;
+    I2C_MasterTransferData(I2CDEV, &setup, I2C_TRANSFER_INTERRUPT);
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Sleep until a transfer has finished
+ *
+ * Params:
+ *   [in] xfer - the transfer, or NULL to wait for room in the queue
+ *
+ *****************************************************************************/
+static void waitFor(i2cbus_xfer_t* xfer)
+{
+    for (;;) {
+        /* the interrupt can't slip in between the check and WFI, WFI still
+         * wakes up on it */
+        __disable_irq();
+        if (xfer != NULL ? xfer->status != I2CBUS_BUSY
+                : queueCount < I2CBUS_QUEUE_SIZE) {
+            __enable_irq();
+            return;
+        }
+        __WFI();
+        __enable_irq();
+    }
+}
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * Description:
+ *    Empty the bus queue. It starts out empty, so this is only needed to
+ *    start over, with no transfer running.
+ *
+ *****************************************************************************/
+void i2cbus_init (void)
+{
+    current = NULL;
+    queueFirst = 0;
+    queueCount = 0;
+    lockDepth = 0;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Queue a transfer and return right away. It is sent once the transfers
+ *    queued before it are done, and xfer->done is called from the I2C
+ *    interrupt when it has finished. Inside i2cbus_lock() an idle bus is
+ *    only started by the outermost i2cbus_unlock().
+ *
+ * Params:
+ *   [in] xfer - the transfer, addr to retries and done filled in
+ *
+ * Returns:
+ *   0 if the transfer was queued, -1 if it is still busy or the queue is
+ *   full
+ *
+ *****************************************************************************/
+int i2cbus_submit(i2cbus_xfer_t* xfer)
+{
+    int ret = 0;
+
+    i2cbus_lock();
+
+    if (xfer->status == I2CBUS_BUSY || queueCount == I2CBUS_QUEUE_SIZE) {
+        ret = -1;
+    }
+    else {
+        xfer->status = I2CBUS_BUSY;
+        queue[(queueFirst + queueCount) % I2CBUS_QUEUE_SIZE] = xfer;
+        queueCount++;
+    }
+
+    i2cbus_unlock();
+
+    return ret;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Queue a transfer and sleep until it has finished. Waits for room if
+ *    the queue is full. Must not be called from an interrupt handler.
+ *
+ * Params:
+ *   [in] xfer - the transfer, addr to done filled in, not busy
+ *
+ * Returns:
+ *   0 on success, -1 if the transfer failed
+ *
+ *****************************************************************************/
+int i2cbus_run(i2cbus_xfer_t* xfer)
+{
+    while (i2cbus_submit(xfer) != 0) {
+        waitFor(NULL);
+    }
+
+    waitFor(xfer);
+
+    return (xfer->status == I2CBUS_DONE) ? 0 : -1;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Write to a device and wait until it is done, see i2cbus_run()
+ *
+ * Params:
+ *   [in] addr - 7 bit address
+ *   [in] buf - data to write
+ *   [in] len - number of bytes to write
+ *
+ * Returns:
+ *   0 on success, -1 if the transfer failed
+ *
+ *****************************************************************************/
+int i2cbus_write(uint8_t addr, uint8_t* buf, uint32_t len)
+{
+    return i2cbus_writeRead(addr, buf, len, NULL, 0);
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Read from a device and wait until it is done, see i2cbus_run()
+ *
+ * Params:
+ *   [in] addr - 7 bit address
+ *   [in] buf - read buffer
+ *   [in] len - number of bytes to read
+ *
+ * Returns:
+ *   0 on success, -1 if the transfer failed
+ *
+ *****************************************************************************/
+int i2cbus_read(uint8_t addr, uint8_t* buf, uint32_t len)
+{
+    return i2cbus_writeRead(addr, NULL, 0, buf, len);
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Write to a device, typically a register number, then read from it
+ *    after a repeated start, and wait until it is done, see i2cbus_run()
+ *
+ * Params:
+ *   [in] addr - 7 bit address
+ *   [in] txBuf - data to write
+ *   [in] txLen - number of bytes to write
+ *   [in] rxBuf - read buffer
+ *   [in] rxLen - number of bytes to read
+ *
+ * Returns:
+ *   0 on success, -1 if the transfer failed
+ *
+ *****************************************************************************/
+int i2cbus_writeRead(uint8_t addr, uint8_t* txBuf, uint32_t txLen,
+        uint8_t* rxBuf, uint32_t rxLen)
+{
+    i2cbus_xfer_t xfer;
+
+    xfer.addr = addr;
+    xfer.txBuf = txBuf;
+    xfer.txLen = txLen;
+    xfer.rxBuf = rxBuf;
+    xfer.rxLen = rxLen;
+    xfer.retries = I2CBUS_RETRIES;
+    xfer.done = NULL;
+    xfer.status = I2CBUS_IDLE;
+
+    return i2cbus_run(&xfer);
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Keep the I2C interrupt, and with it the done callbacks, from running
+ *    until i2cbus_unlock(). For drivers that share state with their
+ *    callbacks. Calls may be nested. Only the I2C2 interrupt is masked, the
+ *    others (audio DMA, UART) keep running. Transfers submitted to an idle
+ *    bus meanwhile are started by the outermost i2cbus_unlock().
+ *
+ *****************************************************************************/
+void i2cbus_lock(void)
+{
+    if (lockDepth == 0) {
+        NVIC_DisableIRQ(I2C2_IRQn);
+        /* the interrupt must be masked before the shared state is touched */
+        __DSB();
+        __ISB();
+    }
+    lockDepth++;
+}
+
+void i2cbus_unlock(void)
+{
+    lockDepth--;
+    if (lockDepth == 0) {
+        /* transfers queued while locked wait for an idle bus until here */
+        if (current == NULL)
+            startNext();
+        NVIC_EnableIRQ(I2C2_IRQn);
+    }
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Check if the bus is idle
+ *
+ * Returns:
+ *   1 if no transfer is running or waiting, 0 otherwise
+ *
+ *****************************************************************************/
+uint8_t i2cbus_isIdle(void)
+{
+    return current == NULL;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    I2C2 interrupt handler. Steps the running transfer through the Lib_MCU
+ *    master state machine; when it has finished the next one is started
+ *    before the done callback is called, so the bus doesn't wait for it.
+ *
+ *****************************************************************************/
+void I2C2_IRQHandler(void)
+{
+    i2cbus_xfer_t* xfer = current;
+
+    if (xfer == NULL)
+        return;
+
+    I2C_MasterHandler(I2CDEV);
+    if (!I2C_MasterTransferComplete(I2CDEV))
+        return;
+
+    xfer->status = (setup.status & I2C_SETUP_STATUS_DONE) ? I2CBUS_DONE
+            : I2CBUS_ERROR;
+    current = NULL;
+    startNext();
+
+    if (xfer->done != NULL)
+        xfer->done(xfer);
+}
@@ -8,22 +8,20 @@
 
 /*
  * NOTE: I2C must have been initialized before calling any functions in this
- * file.
+ * file. The transfers go through the shared bus queue, see i2cbus.c.
  */
 
 /******************************************************************************
  * Includes
  *****************************************************************************/
 
-#include "lpc17xx_i2c.h"
+#include "i2cbus.h"
 #include "light.h"
 
 /******************************************************************************
  * Defines and typedefs
  *****************************************************************************/
 
-#define I2CDEV LPC_I2C2
-
 #define LIGHT_I2C_ADDR    (0x44)
 
 #define ADDR_CMD        0x00
@@ -71,54 +69,21 @@
 static uint32_t range = RANGE_K1;
 static uint32_t width = WIDTH_16_VAL;
 
+/* Read started by light_readAsync(): LSB and MSB register */
+static i2cbus_xfer_t readXfer[2];
+static uint8_t readReg[2] = {ADDR_LSB_SENSOR, ADDR_MSB_SENSOR};
+static uint8_t readData[2];
+static light_done_t readDone = NULL;
+
 /******************************************************************************
  * Local Functions
  *****************************************************************************/
 
-static int I2CRead(uint8_t addr, uint8_t* buf, uint32_t len)
-{
-	I2C_M_SETUP_Type rxsetup;
-
-	rxsetup.sl_addr7bit = addr;
-	rxsetup.tx_data = NULL;	// Get address to read at writing address
-	rxsetup.tx_length = 0;
-	rxsetup.rx_data = buf;
-	rxsetup.rx_length = len;
-	rxsetup.retransmissions_max = 3;
-
-	if (I2C_MasterTransferData(I2CDEV, &rxsetup, I2C_TRANSFER_POLLING) == SUCCESS){
-		return (0);
-	} else {
-		return (-1);
-	}
-}
-
-static int I2CWrite(uint8_t addr, uint8_t* buf, uint32_t len)
-{
-	I2C_M_SETUP_Type txsetup;
-
-	txsetup.sl_addr7bit = addr;
-	txsetup.tx_data = buf;
-	txsetup.tx_length = len;
-	txsetup.rx_data = NULL;
-	txsetup.rx_length = 0;
-	txsetup.retransmissions_max = 3;
-
-	if (I2C_MasterTransferData(I2CDEV, &txsetup, I2C_TRANSFER_POLLING) == SUCCESS){
-		return (0);
-	} else {
-		return (-1);
-	}
-}
-
-
 static uint8_t readCommandReg(void)
 {
     uint8_t buf[1];
     buf[0] = ADDR_CMD;
-    I2CWrite(LIGHT_I2C_ADDR, buf, 1);
-
-    I2CRead(LIGHT_I2C_ADDR, buf, 1);
+    i2cbus_writeRead(LIGHT_I2C_ADDR, buf, 1, buf, 1);
 
     return buf[0];
 }
@@ -128,13 +93,31 @@ static uint8_t readControlReg(void)
 {
     uint8_t buf[1];
     buf[0] = ADDR_CTRL;
-    I2CWrite(LIGHT_I2C_ADDR, buf, 1);
-
-    I2CRead(LIGHT_I2C_ADDR, buf, 1);
+    i2cbus_writeRead(LIGHT_I2C_ADDR, buf, 1, buf, 1);
 
     return buf[0];
 }
 
+/*
+ * Called from the I2C interrupt when the MSB of a read started by
+ * light_readAsync() has been read, the LSB was read before it
+ */
+static void readFinished(i2cbus_xfer_t* xfer)
+{
+    uint32_t data;
+
+    if (readDone == NULL)
+        return;
+
+    if (readXfer[0].status != I2CBUS_DONE || xfer->status != I2CBUS_DONE) {
+        readDone(-1);
+        return;
+    }
+
+    data = (readData[1] << 8 | readData[0]);
+    readDone(range*data / width);
+}
+
 /******************************************************************************
  * Public Functions
  *****************************************************************************/
@@ -161,7 +144,7 @@ void light_enable (void)
     uint8_t buf[2];
     buf[0] = ADDR_CMD;
     buf[1] = CMD_ENABLE;
-    I2CWrite(LIGHT_I2C_ADDR, buf, 2);
+    i2cbus_write(LIGHT_I2C_ADDR, buf, 2);
 
     range = RANGE_K1;
     width = WIDTH_16_VAL;
@@ -182,14 +165,12 @@ uint32_t light_read(void)
     uint8_t buf[1];
 
     buf[0] = ADDR_LSB_SENSOR;
-    I2CWrite(LIGHT_I2C_ADDR, buf, 1);
-    I2CRead(LIGHT_I2C_ADDR, buf, 1);
+    i2cbus_writeRead(LIGHT_I2C_ADDR, buf, 1, buf, 1);
 
     data = buf[0];
 
     buf[0] = ADDR_MSB_SENSOR;
-    I2CWrite(LIGHT_I2C_ADDR, buf, 1);
-    I2CRead(LIGHT_I2C_ADDR, buf, 1);
+    i2cbus_writeRead(LIGHT_I2C_ADDR, buf, 1, buf, 1);
 
     data = (buf[0] << 8 | data);
 
@@ -200,6 +181,56 @@ uint32_t light_read(void)
     return (range*data / width);
 }
 
+/******************************************************************************
+ *
+ * Description:
+ *    Start reading the sensor value and return right away. done is called
+ *    from the I2C interrupt with the value when it has been read.
+ *
+ * Params:
+ *   [in] done - called with the light sensor value (in units of Lux), or
+ *               -1 if it couldn't be read
+ *
+ * Returns:
+ *      0 if the read was started, -1 if the previous one is still running
+ *      or the bus queue is full
+ *
+ *****************************************************************************/
+int light_readAsync(light_done_t done)
+{
+    int ret = 0;
+    uint8_t i;
+
+    i2cbus_lock();
+
+    if (readXfer[0].status == I2CBUS_BUSY
+            || readXfer[1].status == I2CBUS_BUSY) {
+        i2cbus_unlock();
+        return -1;
+    }
+
+    readDone = done;
+    for (i = 0; i < 2; i++) {
+        readXfer[i].addr = LIGHT_I2C_ADDR;
+        readXfer[i].txBuf = &readReg[i];
+        readXfer[i].txLen = 1;
+        readXfer[i].rxBuf = &readData[i];
+        readXfer[i].rxLen = 1;
+        readXfer[i].retries = I2CBUS_RETRIES;
+        readXfer[i].done = (i == 1) ? readFinished : NULL;
+    }
+
+    /* The LSB is read even if the MSB doesn't fit, the value is
+     * only passed on once both have been read */
+    ret = i2cbus_submit(&readXfer[0]);
+    if (ret == 0)
+        ret = i2cbus_submit(&readXfer[1]);
+
+    i2cbus_unlock();
+
+    return ret;
+}
+
 /******************************************************************************
  *
  * Description:
@@ -221,7 +252,7 @@ void light_setMode(light_mode_t mode)
 
     buf[0] = ADDR_CMD;
     buf[1] = cmd;
-    I2CWrite(LIGHT_I2C_ADDR, buf, 2);
+    i2cbus_write(LIGHT_I2C_ADDR, buf, 2);
 }
 
 /******************************************************************************
@@ -245,7 +276,7 @@ void light_setWidth(light_width_t newWidth)
 
     buf[0] = ADDR_CMD;
     buf[1] = cmd;
-    I2CWrite(LIGHT_I2C_ADDR, buf, 2);
+    i2cbus_write(LIGHT_I2C_ADDR, buf, 2);
 
     switch(newWidth) {
     case LIGHT_WIDTH_16BITS:
@@ -284,7 +315,7 @@ void light_setRange(light_range_t newRange)
 
     buf[0] = ADDR_CTRL;
     buf[1] = ctrl;
-    I2CWrite(LIGHT_I2C_ADDR, buf, 2);
+    i2cbus_write(LIGHT_I2C_ADDR, buf, 2);
 
     switch(newRange) {
     case LIGHT_RANGE_1000:
@@ -320,7 +351,7 @@ void light_setHiThreshold(uint32_t luxTh)
 
     buf[0] = ADDR_IRQTH_HI;
     buf[1] = ((data >> 8) & 0xff);
-    I2CWrite(LIGHT_I2C_ADDR, buf, 2);
+    i2cbus_write(LIGHT_I2C_ADDR, buf, 2);
 }
 
 /******************************************************************************
@@ -341,7 +372,7 @@ void light_setLoThreshold(uint32_t luxTh)
 
     buf[0] = ADDR_IRQTH_LO;
     buf[1] = ((data >> 8) & 0xff);
-    I2CWrite(LIGHT_I2C_ADDR, buf, 2);
+    i2cbus_write(LIGHT_I2C_ADDR, buf, 2);
 }
 
 /******************************************************************************
@@ -367,7 +398,7 @@ void light_setIrqInCycles(light_cycle_t cycles)
 
     buf[0] = ADDR_CTRL;
     buf[1] = ctrl;
-    I2CWrite(LIGHT_I2C_ADDR, buf, 2);
+    i2cbus_write(LIGHT_I2C_ADDR, buf, 2);
 }
 
 /******************************************************************************
@@ -402,7 +433,7 @@ void light_clearIrqStatus(void)
 
     buf[0] = (ADDR_CTRL | ADDR_CLAR_INT);
     buf[1] = ctrl;
-    I2CWrite(LIGHT_I2C_ADDR, buf, 2);
+    i2cbus_write(LIGHT_I2C_ADDR, buf, 2);
 }
 
 /******************************************************************************
@@ -422,11 +453,11 @@ void light_shutdown(void)
 
     buf[0] = ADDR_CMD;
     buf[1] = cmd;
-    I2CWrite(LIGHT_I2C_ADDR, buf, 2);
+    i2cbus_write(LIGHT_I2C_ADDR, buf, 2);
 
     /* second power-down */
     cmd |= CMD_APDCP;
     buf[0] = ADDR_CMD;
     buf[1] = cmd;
-    I2CWrite(LIGHT_I2C_ADDR, buf, 2);
+    i2cbus_write(LIGHT_I2C_ADDR, buf, 2);
 }
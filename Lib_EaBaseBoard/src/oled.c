@@ -1,5 +1,5 @@
 /*****************************************************************************
- *   light.c:  Driver for the ISL29003 Light-to-Digital Output Sensor
+ *   oled.c:  Driver for the OLED Display
  *
  *   Copyright(C) 2009, Embedded Artists AB
  *   All rights reserved.
@@ -18,9 +18,11 @@
  *****************************************************************************/
 
 #include <string.h>
+#include "LPC17xx.h"
 #include "lpc17xx_gpio.h"
-#include "lpc17xx_i2c.h"
 #include "lpc17xx_ssp.h"
+#include "lpc17xx_gpdma.h"
+#include "i2cbus.h"
 #include "oled.h"
 #include "font5x7.h"
 
@@ -31,7 +33,6 @@
 //#define OLED_USE_I2C
 
 #ifdef OLED_USE_I2C
-#define I2CDEV LPC_I2C2
 #define OLED_I2C_ADDR (0x3c)
 #else
 
@@ -44,12 +45,27 @@
 
 /*
  * The display controller can handle a resolutiom of 132x64. The OLED
- * on the base board is 96x64.
+ * on the base board is 96x64.
  */
 #define X_OFFSET 18
 
 #define SHADOW_FB_SIZE (OLED_DISPLAY_WIDTH*OLED_DISPLAY_HEIGHT >> 3)
 
+/* Number of 8 pixel high pages */
+#define PAGE_COUNT (OLED_DISPLAY_HEIGHT >> 3)
+
+/*
+ * Cost of another write within a page in byte times: the address commands
+ * (with OLED_USE_I2C also their control bytes, the data control byte, the
+ * slave address and the start and stop). Unchanged columns between two
+ * changed runs are sent along when that is cheaper, see nextRun().
+ */
+#ifdef OLED_USE_I2C
+#define RUN_SETUP_BYTES 9
+#else
+#define RUN_SETUP_BYTES 3
+#endif
+
 #define setAddress(page,lowerAddr,higherAddr)\
     writeCommand(page);\
     writeCommand(lowerAddr);\
@@ -70,36 +86,76 @@
  * serial mode (only parallel mode). Since it isn't possible to write only
  * one pixel to the display (a minimum of one column, 8 pixels, is always
  * wriiten) a shadow framebuffer is needed to keep track of the display
- * data.
+ * data.
  */
 static uint8_t shadowFB[SHADOW_FB_SIZE];
 
-static uint8_t const  font_mask[8] = {0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01};
+/*
+ * The display memory as last sent. Every run is copied here and sent from
+ * here, so a flush only sends the columns where shadowFB differs. A page
+ * is only compared once it has been sent in full since oled_init(), until
+ * then its display memory is unknown (bit clear in sentKnown).
+ */
+static uint8_t sentFB[SHADOW_FB_SIZE];
+static uint8_t sentKnown = 0;
 
+/*
+ * Drawing only changes shadowFB. The columns changed since the last flush
+ * are tracked per page, so oled_flush() only sends those. A page is clean
+ * when dirtyFirst > dirtyLast.
+ */
+static uint8_t dirtyFirst[PAGE_COUNT];
+static uint8_t dirtyLast[PAGE_COUNT];
 
-/******************************************************************************
- * Local Functions
- *****************************************************************************/
-#ifdef OLED_USE_I2C
-static int I2CWrite(uint8_t addr, uint8_t* buf, uint32_t len)
-{
-	I2C_M_SETUP_Type txsetup;
+/*
+ * When set, every public drawing function flushes before returning, which
+ * keeps the behaviour of applications that never call oled_flush().
+ */
+static uint8_t autoFlush = 1;
 
-	txsetup.sl_addr7bit = addr;
-	txsetup.tx_data = buf;
-	txsetup.tx_length = len;
-	txsetup.rx_data = NULL;
-	txsetup.rx_length = 0;
-	txsetup.retransmissions_max = 3;
+/*
+ * Flush started by oled_flushDma(). The dirty spans are copied when it
+ * starts, so drawing can go on while the DMA interrupt (the I2C interrupt
+ * with OLED_USE_I2C) sends the pages. dmaPage is the page being sent,
+ * PAGE_COUNT when no flush is running. dmaFirst moves past every run as it
+ * is started.
+ */
+static uint8_t dmaFirst[PAGE_COUNT];
+static uint8_t dmaLast[PAGE_COUNT];
+static volatile uint8_t dmaPage = PAGE_COUNT;
+static oled_flush_done_t dmaDone = NULL;
 
-	if (I2C_MasterTransferData(I2CDEV, &txsetup, I2C_TRANSFER_POLLING) == SUCCESS){
-		return (0);
-	} else {
-		return (-1);
-	}
-}
+/*
+ * Pages of which a run couldn't be sent by a background flush, one bit
+ * per page. Only set from the interrupt, drawing may be changing the dirty
+ * spans meanwhile. The next flush marks these pages dirty in full, so
+ * they are sent again.
+ */
+static volatile uint8_t failedPages = 0;
+
+#ifdef OLED_USE_I2C
+/*
+ * A run is sent as one I2C write: the three address commands, each after
+ * a control byte with Co set (one byte follows, then another control
+ * byte), and a control byte with Co clear for the data up to the stop.
+ * The buffer is static because the bus queue sends it in the background.
+ */
+#define I2C_PAGE_HEADER 7
+static uint8_t i2cPage[I2C_PAGE_HEADER + OLED_DISPLAY_WIDTH];
+static i2cbus_xfer_t i2cXfer;
+#else
+/*
+ * Bytes clocked in while sending. They are never used, the RX channel is
+ * only there because its terminal count tells when the last byte has
+ * actually left the SSP.
+ */
+static uint8_t dmaRxDiscard[OLED_DISPLAY_WIDTH];
 #endif
 
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
 /******************************************************************************
  *
  * Description:
@@ -120,7 +176,7 @@ writeCommand(uint8_t data)
     buf[0] = 0x00; // write Co & D/C bits
     buf[1] = data; // data
 
-    I2CWrite(OLED_I2C_ADDR, buf, 2);
+    i2cbus_write(OLED_I2C_ADDR, buf, 2);
 
 #else
     SSP_DATA_SETUP_Type xferConfig;
@@ -138,94 +194,407 @@ writeCommand(uint8_t data)
 #endif
 }
 
+#ifndef OLED_USE_I2C
 /******************************************************************************
  *
  * Description:
- *    Write data to the display
+ *    Write a buffer of data to the display in one transfer
  *
  * Params:
- *   [in] data - data (color) to write to the display
+ *   [in] data - data (columns) to write to the display
+ *   [in] len  - number of bytes to write, at most OLED_DISPLAY_WIDTH
  *
  *****************************************************************************/
 static void
-writeData(uint8_t data)
+writeDataBuf(const uint8_t *data, unsigned int len)
 {
-#ifdef OLED_USE_I2C
-    uint8_t buf[2];
-
-    buf[0] = 0x40; // write Co & D/C bits
-    buf[1] = data; // data
-
-    I2CWrite(OLED_I2C_ADDR, buf, 2);
-
-
-#else
     SSP_DATA_SETUP_Type xferConfig;
+
     OLED_DATA();
     OLED_CS_ON();
 
-	xferConfig.tx_data = &data;
-	xferConfig.rx_data = NULL;
-	xferConfig.length  = 1;
+    xferConfig.tx_data = (void *)data;
+    xferConfig.rx_data = NULL;
+    xferConfig.length  = len;
 
     SSP_ReadWrite(LPC_SSP1, &xferConfig, SSP_TRANSFER_POLLING);
-    //SSPSend( (uint8_t *)&data, 1 );
 
     OLED_CS_OFF();
+}
 #endif
+
+/******************************************************************************
+ *
+ * Description:
+ *    Find the next run of columns of a page that has to be sent: from the
+ *    first column where shadowFB differs from sentFB to the last one before
+ *    a gap of more than RUN_SETUP_BYTES unchanged columns. A page whose
+ *    display memory isn't known yet is sent as one run.
+ *
+ * Params:
+ *   [in] page - page index
+ *   [in] from - first column to look at
+ *   [in] last - last column to look at
+ *   [out] runFirst - first column of the run
+ *   [out] runLast - last column of the run
+ *
+ * Returns:
+ *    1 if a run was found, 0 if nothing from..last has changed
+ *
+ *****************************************************************************/
+static uint8_t nextRun(uint8_t page, uint8_t from, uint8_t last,
+        uint8_t *runFirst, uint8_t *runLast)
+{
+    const uint8_t *shadow = &shadowFB[page*OLED_DISPLAY_WIDTH];
+    const uint8_t *sent = &sentFB[page*OLED_DISPLAY_WIDTH];
+    uint8_t x = from;
+    uint8_t end;
+
+    if (from > last)
+        return 0;
+
+    if ((sentKnown & (1 << page)) == 0) {
+        *runFirst = from;
+        *runLast = last;
+        return 1;
+    }
+
+    while (x <= last && shadow[x] == sent[x])
+        x++;
+    if (x > last)
+        return 0;
+
+    /* Stop looking once the gap since the last change is too long */
+    *runFirst = x;
+    end = x;
+    for (x++; x <= last && x - end <= RUN_SETUP_BYTES + 1; x++) {
+        if (shadow[x] != sent[x])
+            end = x;
+    }
+    *runLast = end;
+
+    return 1;
 }
 
 /******************************************************************************
  *
  * Description:
- *    Write len number of data to the display
+ *    Copy a run from shadowFB to sentFB just before it is sent. Drawing
+ *    may change shadowFB while the run is sent in the background, so the
+ *    run is sent from the copy.
  *
  * Params:
- *   [in] data - data (color) to write to the display
- *   [in] len  - number of bytes to write
+ *   [in] page - page index
+ *   [in] first - first column of the run
+ *   [in] last - last column of the run
+ *
+ * Returns:
+ *    The run in sentFB
  *
  *****************************************************************************/
-static void
-writeDataLen(unsigned char data, unsigned int len)
+static const uint8_t *takeRun(uint8_t page, uint8_t first, uint8_t last)
+{
+    uint8_t *sent = &sentFB[page*OLED_DISPLAY_WIDTH + first];
+
+    memcpy(sent, &shadowFB[page*OLED_DISPLAY_WIDTH + first], last - first + 1);
+    if (first == 0 && last == OLED_DISPLAY_WIDTH - 1)
+        sentKnown |= 1 << page;
+
+    return sent;
+}
+
+#ifdef OLED_USE_I2C
+/******************************************************************************
+ *
+ * Description:
+ *    Fill i2cPage with the address commands and the data of a run
+ *
+ * Params:
+ *   [in] page - page index
+ *   [in] first - first column to send
+ *   [in] last - last column to send
+ *
+ * Returns:
+ *    Number of bytes to write
+ *
+ *****************************************************************************/
+static uint32_t buildI2cPage(uint8_t page, uint8_t first, uint8_t last)
 {
-    // TODO: optimize (at least from a RAM point of view)
+    uint16_t add = first + X_OFFSET;
+    uint32_t len = last - first + 1;
+
+    i2cPage[0] = 0x80;                  // Co = 1, D/C# = 0: one command
+    i2cPage[1] = 0xB0 + page;           // Page address
+    i2cPage[2] = 0x80;
+    i2cPage[3] = 0x0F & add;            // Low column address
+    i2cPage[4] = 0x80;
+    i2cPage[5] = 0x10 | (add >> 4);     // High column address
+    i2cPage[6] = 0x40;                  // Co = 0, D/C# = 1: data to the end
+    memcpy(&i2cPage[I2C_PAGE_HEADER], takeRun(page, first, last), len);
+
+    return I2C_PAGE_HEADER + len;
+}
+#endif
 
+/******************************************************************************
+ *
+ * Description:
+ *    Send a run of a page to the display and wait until it is done
+ *
+ * Params:
+ *   [in] page - page index
+ *   [in] first - first column to send
+ *   [in] last - last column to send
+ *
+ *****************************************************************************/
+static void writePage(uint8_t page, uint8_t first, uint8_t last)
+{
 #ifdef OLED_USE_I2C
-    int i;
-    uint8_t buf[140];
+    i2cbus_write(OLED_I2C_ADDR, i2cPage, buildI2cPage(page, first, last));
+#else
+    uint16_t add = first + X_OFFSET;
+
+    setAddress(0xB0 + page,             // Page address
+            0x0F & add,                 // Low column address
+            0x10 | (add >> 4));         // High column address
+    writeDataBuf(takeRun(page, first, last), last - first + 1);
+#endif
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Mark columns of a page as changed since the last flush
+ *
+ * Params:
+ *   [in] page - page index, 0 to PAGE_COUNT-1
+ *   [in] x0 - first changed column
+ *   [in] x1 - last changed column
+ *
+ *****************************************************************************/
+static void markDirty(uint8_t page, uint8_t x0, uint8_t x1)
+{
+    if (x0 < dirtyFirst[page])
+        dirtyFirst[page] = x0;
+    if (x1 > dirtyLast[page])
+        dirtyLast[page] = x1;
+}
 
-    buf[0] = 0x40; // write Co & D/C bits
+/******************************************************************************
+ *
+ * Description:
+ *    Mark all pages as clean
+ *
+ *****************************************************************************/
+static void clearDirty(void)
+{
+    uint8_t page;
+
+    for (page = 0; page < PAGE_COUNT; page++) {
+        dirtyFirst[page] = 0xFF;
+        dirtyLast[page] = 0;
+    }
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Mark the pages a background flush failed to send as dirty in full.
+ *    Only called while no background flush is running.
+ *
+ *****************************************************************************/
+static void markFailedDirty(void)
+{
+    uint8_t page;
 
-    for (i = 1; i < len+1; i++) {
-        buf[i] = data;
+    for (page = 0; page < PAGE_COUNT; page++) {
+        if (failedPages & (1 << page))
+            markDirty(page, 0, OLED_DISPLAY_WIDTH-1);
     }
+    failedPages = 0;
+}
 
-    I2CWrite(OLED_I2C_ADDR, buf, len+1);
+/******************************************************************************
+ *
+ * Description:
+ *    Flush the changes if auto flush is enabled
+ *
+ *****************************************************************************/
+static void flushIfAuto(void)
+{
+    if (autoFlush)
+        oled_flush();
+}
 
-#else
-    int i;
-    uint8_t buf[140];
-    SSP_DATA_SETUP_Type xferConfig;
+#ifdef OLED_USE_I2C
+/******************************************************************************
+ *
+ * Description:
+ *    Start sending the next run of a background flush, or finish the
+ *    flush when there are no more. The run is queued on the bus as one
+ *    I2C write, see i2cPageDone().
+ *
+ *****************************************************************************/
+static void i2cPageDone(i2cbus_xfer_t* xfer);
 
-    for (i = 0; i < len; i++) {
-        buf[i] = data;
+static void startI2cPage(void)
+{
+    uint8_t page = dmaPage;
+    uint8_t first;
+    uint8_t last;
+
+    while (page < PAGE_COUNT
+            && !nextRun(page, dmaFirst[page], dmaLast[page], &first, &last))
+        page++;
+
+    if (page >= PAGE_COUNT) {
+        dmaPage = PAGE_COUNT;
+        if (dmaDone != NULL)
+            dmaDone();
+        return;
+    }
+    dmaPage = page;
+    dmaFirst[page] = last + 1;
+
+    i2cXfer.addr = OLED_I2C_ADDR;
+    i2cXfer.txBuf = i2cPage;
+    i2cXfer.txLen = buildI2cPage(page, first, last);
+    i2cXfer.rxBuf = NULL;
+    i2cXfer.rxLen = 0;
+    i2cXfer.retries = I2CBUS_RETRIES;
+    i2cXfer.done = i2cPageDone;
+
+    /* Only fails with the bus queue full, the rest of the flush is given
+     * up and what the display holds is unknown now. The pages not sent
+     * are sent by the next flush. */
+    if (i2cbus_submit(&i2cXfer) != 0) {
+        sentKnown = 0;
+        failedPages |= 0xFF << page;
+        dmaPage = PAGE_COUNT;
+        if (dmaDone != NULL)
+            dmaDone();
+    }
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Called from the I2C interrupt when a run of a background flush has
+ *    been sent, starts the next one
+ *
+ *****************************************************************************/
+static void i2cPageDone(i2cbus_xfer_t* xfer)
+{
+    /* A run that failed after all retries ends the page, what the
+     * display holds is unknown now. The next flush sends it again. */
+    if (xfer->status != I2CBUS_DONE) {
+        sentKnown &= ~(1 << dmaPage);
+        failedPages |= 1 << dmaPage;
+        dmaPage++;
     }
+    startI2cPage();
+}
+#else
+/******************************************************************************
+ *
+ * Description:
+ *    Start sending the next run of a DMA flush, or finish the flush when
+ *    there are no more. The address is set with polled writes (three
+ *    bytes), the run is sent by GPDMA from sentFB.
+ *
+ *****************************************************************************/
+static void startDmaPage(void)
+{
+    GPDMA_Channel_CFG_Type cfg;
+    uint8_t page = dmaPage;
+    uint8_t first;
+    uint8_t last;
+    uint16_t add;
+    uint32_t len;
+
+    while (page < PAGE_COUNT
+            && !nextRun(page, dmaFirst[page], dmaLast[page], &first, &last))
+        page++;
+
+    if (page >= PAGE_COUNT) {
+        SSP_DMACmd(LPC_SSP1, SSP_DMA_TX, DISABLE);
+        SSP_DMACmd(LPC_SSP1, SSP_DMA_RX, DISABLE);
+        dmaPage = PAGE_COUNT;
+        if (dmaDone != NULL)
+            dmaDone();
+        return;
+    }
+    dmaPage = page;
+    dmaFirst[page] = last + 1;
+
+    add = first + X_OFFSET;
+    setAddress(0xB0 + page,             // Page address
+            0x0F & add,                 // Low column address
+            0x10 | (add >> 4));         // High column address
+    len = last - first + 1;
 
     OLED_DATA();
     OLED_CS_ON();
 
-	xferConfig.tx_data = buf;
-	xferConfig.rx_data = NULL;
-	xferConfig.length  = len;
+    /* RX first, so it is ready for the first byte coming back */
+    cfg.ChannelNum = OLED_DMA_RX_CHANNEL;
+    cfg.SrcMemAddr = 0;
+    cfg.DstMemAddr = (uint32_t)(uintptr_t)dmaRxDiscard;
+    cfg.TransferSize = len;
+    cfg.TransferWidth = 0;
+    cfg.TransferType = GPDMA_TRANSFERTYPE_P2M;
+    cfg.SrcConn = GPDMA_CONN_SSP1_Rx;
+    cfg.DstConn = 0;
+    cfg.DMALLI = 0;
+    GPDMA_Setup(&cfg);
+    GPDMA_ChannelCmd(OLED_DMA_RX_CHANNEL, ENABLE);
+
+    cfg.ChannelNum = OLED_DMA_TX_CHANNEL;
+    cfg.SrcMemAddr = (uint32_t)(uintptr_t)takeRun(page, first, last);
+    cfg.DstMemAddr = 0;
+    cfg.TransferType = GPDMA_TRANSFERTYPE_M2P;
+    cfg.SrcConn = 0;
+    cfg.DstConn = GPDMA_CONN_SSP1_Tx;
+    GPDMA_Setup(&cfg);
+    GPDMA_ChannelCmd(OLED_DMA_TX_CHANNEL, ENABLE);
+}
+#endif
 
-    SSP_ReadWrite(LPC_SSP1, &xferConfig, SSP_TRANSFER_POLLING);
+/******************************************************************************
+ *
+ * Description:
+ *    Draw one pixel into the shadow framebuffer
+ *
+ * Params:
+ *   [in] x - x position
+ *   [in] y - y position
+ *   [in] color - color of the pixel
+ *
+ *****************************************************************************/
+static void setPixel(uint8_t x, uint8_t y, oled_color_t color)
+{
+    uint8_t page;
+    uint8_t mask;
+    uint32_t shadowPos = 0;
 
-    //SSPSend( (uint8_t *)buf, len );
+    if (x >= OLED_DISPLAY_WIDTH) {
+        return;
+    }
+    if (y >= OLED_DISPLAY_HEIGHT) {
+        return;
+    }
 
-    OLED_CS_OFF();
-#endif
-}
+    page = y >> 3;
+    mask = 1 << (y & 0x07);         // Bit position is the row within the page
+    shadowPos = page*OLED_DISPLAY_WIDTH+x;
+
+    if(color > 0)
+        shadowFB[shadowPos] |= mask;
+    else
+        shadowFB[shadowPos] &= ~mask;
 
+    markDirty(page, x, x);
+}
 
 /******************************************************************************
  *
@@ -237,7 +606,7 @@ static void
 runInitSequence(void)
 {
     /*
-     * Recommended Initial code according to manufacturer
+     * Recommended Initial code according to manufacturer
      */
 
     writeCommand(0x02);//set low column address
@@ -281,20 +650,27 @@ runInitSequence(void)
 /******************************************************************************
  *
  * Description:
- *    Draw a horizontal line
+ *    Fill a rectangle in the shadow framebuffer, clipped to the display.
+ *    Every page the rectangle touches gets one row mask that is applied
+ *    to all its columns, so a span costs one byte store per column and
+ *    page instead of one per pixel.
  *
  * Params:
- *   [in] x0 - start x position
- *   [in] y0 - y position
- *   [in] x1 - end y position
- *   [in] color - color of the pixel
+ *   [in] x0 - start x position, may be off the display
+ *   [in] y0 - start y position, may be off the display
+ *   [in] x1 - end x position, included
+ *   [in] y1 - end y position, included
+ *   [in] color - color of the rectangle
  *
  *****************************************************************************/
-static void hLine(uint8_t x0, uint8_t y0, uint8_t x1, oled_color_t color)
+static void fillSpan(int16_t x0, int16_t y0, int16_t x1, int16_t y1, oled_color_t color)
 {
-    // TODO: optimize
-
-    uint8_t bak;
+    int16_t bak;
+    uint8_t page;
+    uint8_t lastPage;
+    uint8_t mask;
+    uint8_t *pos;
+    uint8_t *end;
 
     if (x0 > x1)
     {
@@ -302,12 +678,62 @@ static void hLine(uint8_t x0, uint8_t y0, uint8_t x1, oled_color_t color)
         x1 = x0;
         x0 = bak;
     }
-
-    while(x1 >= x0)
+    if (y0 > y1)
     {
-        oled_putPixel(x0, y0, color);
-        x0++;
+        bak = y1;
+        y1 = y0;
+        y0 = bak;
     }
+
+    if (x0 < 0)
+        x0 = 0;
+    if (y0 < 0)
+        y0 = 0;
+    if (x1 >= OLED_DISPLAY_WIDTH)
+        x1 = OLED_DISPLAY_WIDTH-1;
+    if (y1 >= OLED_DISPLAY_HEIGHT)
+        y1 = OLED_DISPLAY_HEIGHT-1;
+    if ((x0 > x1) || (y0 > y1))
+        return;
+
+    lastPage = y1 >> 3;
+    for (page = y0 >> 3; page <= lastPage; page++) {
+        mask = 0xff;
+        if (page == (y0 >> 3))
+            mask &= (uint8_t)(0xff << (y0 & 0x07));
+        if (page == lastPage)
+            mask &= (uint8_t)(0xff >> (7 - (y1 & 0x07)));
+
+        pos = &shadowFB[page*OLED_DISPLAY_WIDTH + x0];
+        end = &shadowFB[page*OLED_DISPLAY_WIDTH + x1];
+        if (mask == 0xff) {
+            memset(pos, (color == OLED_COLOR_WHITE) ? 0xff : 0x00, end - pos + 1);
+        } else if (color == OLED_COLOR_WHITE) {
+            for (; pos <= end; pos++)
+                *pos |= mask;
+        } else {
+            for (; pos <= end; pos++)
+                *pos &= ~mask;
+        }
+        markDirty(page, x0, x1);
+    }
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Draw a horizontal line
+ *
+ * Params:
+ *   [in] x0 - start x position
+ *   [in] y0 - y position
+ *   [in] x1 - end y position
+ *   [in] color - color of the pixel
+ *
+ *****************************************************************************/
+static void hLine(uint8_t x0, uint8_t y0, uint8_t x1, oled_color_t color)
+{
+    fillSpan(x0, y0, x1, y0, color);
 }
 
 /******************************************************************************
@@ -324,21 +750,150 @@ static void hLine(uint8_t x0, uint8_t y0, uint8_t x1, oled_color_t color)
  *****************************************************************************/
 static void vLine(uint8_t x0, uint8_t y0, uint8_t y1, oled_color_t color)
 {
-    uint8_t bak;
+    fillSpan(x0, y0, x0, y1, color);
+}
 
-    if(y0 > y1)
-    {
-        bak = y1;
-        y1 = y0;
-        y0 = bak;
+/******************************************************************************
+ *
+ * Description:
+ *    Draw one pixel into the shadow framebuffer without marking it dirty,
+ *    pixels off the display are skipped. Used by the primitives that mark
+ *    their whole area once with markArea().
+ *
+ * Params:
+ *   [in] x - x position, may be off the display
+ *   [in] y - y position, may be off the display
+ *   [in] color - color of the pixel
+ *
+ *****************************************************************************/
+static void plot(int16_t x, int16_t y, oled_color_t color)
+{
+    uint8_t *pos;
+
+    if ((x < 0) || (x >= OLED_DISPLAY_WIDTH) || (y < 0) || (y >= OLED_DISPLAY_HEIGHT)) {
+        return;
     }
 
-    while(y1 >= y0)
-    {
-        oled_putPixel(x0, y0, color);
-        y0++;
+    pos = &shadowFB[(y >> 3)*OLED_DISPLAY_WIDTH + x];
+    if (color == OLED_COLOR_WHITE)
+        *pos |= (uint8_t)(1 << (y & 0x07));
+    else
+        *pos &= (uint8_t)~(1 << (y & 0x07));
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Move a framebuffer position one row up or down
+ *
+ * Params:
+ *   [in] pos - framebuffer byte of the current row
+ *   [in/out] mask - bit of the current row in that byte
+ *   [in] step - 1 to move down, -1 to move up
+ *
+ * Returns:
+ *    Framebuffer byte of the new row
+ *
+ *****************************************************************************/
+static uint8_t *stepRow(uint8_t *pos, uint8_t *mask, int8_t step)
+{
+    if (step > 0) {
+        *mask <<= 1;
+        if (*mask == 0) {
+            *mask = 0x01;
+            pos += OLED_DISPLAY_WIDTH;
+        }
+    } else {
+        *mask >>= 1;
+        if (*mask == 0) {
+            *mask = 0x80;
+            pos -= OLED_DISPLAY_WIDTH;
+        }
+    }
+    return pos;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Bresenham line with both end points on the display. The position is
+ *    kept as a framebuffer pointer and a row bit, so each pixel is a
+ *    single masked store.
+ *
+ * Params:
+ *   [in] x0 - start x position
+ *   [in] y0 - start y position
+ *   [in] dx - horizontal length, not negative
+ *   [in] dy - vertical length, not negative
+ *   [in] dx_sym - 1 if the line goes right, -1 if left
+ *   [in] dy_sym - 1 if the line goes down, -1 if up
+ *   [in] color - color of the line
+ *
+ *****************************************************************************/
+static void lineOnScreen(uint8_t x0, uint8_t y0, int16_t dx, int16_t dy,
+        int8_t dx_sym, int8_t dy_sym, oled_color_t color)
+{
+    uint8_t *pos = &shadowFB[(y0 >> 3)*OLED_DISPLAY_WIDTH + x0];
+    uint8_t mask = (uint8_t)(1 << (y0 & 0x07));
+    int16_t major = (dx >= dy) ? dx : dy;
+    int16_t minor = (dx >= dy) ? dy : dx;
+    int16_t di = 2*minor - major;
+    int16_t n;
+
+    for (n = major; ; n--) {
+        if (color == OLED_COLOR_WHITE)
+            *pos |= mask;
+        else
+            *pos &= ~mask;
+        if (n == 0)
+            break;
+
+        if (dx >= dy) {
+            pos += dx_sym;
+            if (di >= 0)
+                pos = stepRow(pos, &mask, dy_sym);
+        } else {
+            pos = stepRow(pos, &mask, dy_sym);
+            if (di >= 0)
+                pos += dx_sym;
+        }
+        if (di < 0)
+            di += 2*minor;
+        else
+            di += 2*(minor - major);
+    }
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Mark a rectangle as changed, clipped to the display
+ *
+ * Params:
+ *   [in] x0 - left edge, may be off the display
+ *   [in] y0 - top edge, may be off the display
+ *   [in] x1 - right edge, included
+ *   [in] y1 - bottom edge, included
+ *
+ *****************************************************************************/
+static void markArea(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+    uint8_t page;
+
+    if (x0 < 0)
+        x0 = 0;
+    if (y0 < 0)
+        y0 = 0;
+    if (x1 >= OLED_DISPLAY_WIDTH)
+        x1 = OLED_DISPLAY_WIDTH-1;
+    if (y1 >= OLED_DISPLAY_HEIGHT)
+        y1 = OLED_DISPLAY_HEIGHT-1;
+    if ((x0 > x1) || (y0 > y1))
+        return;
+
+    for (page = y0 >> 3; page <= (y1 >> 3); page++) {
+        markDirty(page, x0, x1);
     }
-    return;
 }
 
 
@@ -374,6 +929,10 @@ void oled_init (void)
     runInitSequence();
 
     memset(shadowFB, 0, SHADOW_FB_SIZE);
+    memset(sentFB, 0, SHADOW_FB_SIZE);
+    sentKnown = 0;
+    failedPages = 0;
+    clearDirty();
 
     /* small delay before turning on power */
     for (i = 0; i < 0xffff; i++);
@@ -394,52 +953,174 @@ void oled_init (void)
  *
  *****************************************************************************/
 void oled_putPixel(uint8_t x, uint8_t y, oled_color_t color) {
-    uint8_t page;
-    uint16_t add;
-    uint8_t lAddr;
-    uint8_t hAddr;
-    uint8_t mask;
-    uint32_t shadowPos = 0;
+    setPixel(x, y, color);
+    flushIfAuto();
+}
 
-    if (x > OLED_DISPLAY_WIDTH) {
-        return;
+/******************************************************************************
+ *
+ * Description:
+ *    Send the changed parts of the shadow framebuffer to the display. Of
+ *    the columns drawn to since the last flush, only the runs that differ
+ *    from what the display shows are sent, each with its own address setup
+ *    (see nextRun()). With OLED_USE_I2C a run is a single I2C write.
+ *
+ *****************************************************************************/
+void oled_flush(void)
+{
+    uint8_t page;
+    uint8_t from;
+    uint8_t first;
+    uint8_t last;
+
+    /* Let a background flush finish first, both use the same bus. Its
+     * interrupt can't slip in between the check and WFI, WFI still wakes
+     * up on it. */
+    for (;;) {
+        __disable_irq();
+        if (dmaPage >= PAGE_COUNT) {
+            __enable_irq();
+            break;
+        }
+        __WFI();
+        __enable_irq();
     }
-    if (y > OLED_DISPLAY_HEIGHT) {
-        return;
+    markFailedDirty();
+
+    for (page = 0; page < PAGE_COUNT; page++) {
+        from = dirtyFirst[page];
+        while (nextRun(page, from, dirtyLast[page], &first, &last)) {
+            writePage(page, first, last);
+            from = last + 1;
+        }
+
+        dirtyFirst[page] = 0xFF;
+        dirtyLast[page] = 0;
     }
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Enable or disable flushing at the end of every drawing function
+ *
+ * Params:
+ *   [in] enable - 0 to only draw into the shadow framebuffer until
+ *                 oled_flush() is called, 1 to flush after every call
+ *                 (default)
+ *
+ *****************************************************************************/
+void oled_setAutoFlush(uint8_t enable)
+{
+    autoFlush = enable;
+    flushIfAuto();
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Start sending the changed parts of the shadow framebuffer with GPDMA
+ *    and return right away. Each changed run is sent from the DMA interrupt,
+ *    see oled_dmaIrqHandler(). Drawing may continue meanwhile, whatever is
+ *    drawn from now on is sent by the next flush.
+ *
+ *    GPDMA must have been initialized with GPDMA_Init() and the DMA
+ *    interrupt enabled. With OLED_USE_I2C the pages are queued on the I2C
+ *    bus instead (see i2cbus.c), one write after the other, and share it
+ *    with the other devices.
+ *
+ * Params:
+ *   [in] done - called from the DMA (I2C) interrupt when the last run has
+ *               been sent, may be NULL
+ *
+ * Returns:
+ *    1 if a flush was started, 0 if one is still running or nothing has
+ *    changed
+ *
+ *****************************************************************************/
+uint8_t oled_flushDma(oled_flush_done_t done)
+{
+    uint8_t page;
+    uint8_t dirty = 0;
 
-    /* page address */
-         if(y < 8)  page = 0xB0;
-    else if(y < 16) page = 0xB1;
-    else if(y < 24) page = 0xB2;
-    else if(y < 32) page = 0xB3;
-    else if(y < 40) page = 0xB4;
-    else if(y < 48) page = 0xB5;
-    else if(y < 56) page = 0xB6;
-    else            page = 0xB7;
+    if (dmaPage < PAGE_COUNT)
+        return 0;
 
-    add = x + X_OFFSET;
-    lAddr = 0x0F & add;             // Low address
-    hAddr = 0x10 | (add >> 4);      // High address
+    markFailedDirty();
+    for (page = 0; page < PAGE_COUNT; page++) {
+        dmaFirst[page] = dirtyFirst[page];
+        dmaLast[page] = dirtyLast[page];
+        if (dirtyFirst[page] <= dirtyLast[page])
+            dirty = 1;
+    }
+    if (!dirty)
+        return 0;
 
-    // Calculate mask from rows basically do a y%8 and remainder is bit position
-    add = y>>3;                     // Divide by 8
-    add <<= 3;                      // Multiply by 8
-    add = y - add;                  // Calculate bit position
-    mask = 1 << add;                // Left shift 1 by bit position
+    clearDirty();
+    dmaDone = done;
 
-    setAddress(page, lAddr, hAddr); // Set the address (sets the page,
-                                    // lower and higher column address pointers)
+#ifdef OLED_USE_I2C
+    dmaPage = 0;
+    startI2cPage();
+#else
+    SSP_DMACmd(LPC_SSP1, SSP_DMA_TX, ENABLE);
+    SSP_DMACmd(LPC_SSP1, SSP_DMA_RX, ENABLE);
+    dmaPage = 0;
+    startDmaPage();
+#endif
+    return 1;
+}
 
-    shadowPos = (page-0xB0)*OLED_DISPLAY_WIDTH+x;
+/******************************************************************************
+ *
+ * Description:
+ *    Check if a flush started with oled_flushDma() is still running
+ *
+ * Returns:
+ *    1 if running, 0 otherwise
+ *
+ *****************************************************************************/
+uint8_t oled_isFlushing(void)
+{
+    return dmaPage < PAGE_COUNT;
+}
 
-    if(color > 0)
-        shadowFB[shadowPos] |= mask;
-    else
-        shadowFB[shadowPos] &= ~mask;
+/******************************************************************************
+ *
+ * Description:
+ *    Handle the OLED channels in the GPDMA interrupt. GPDMA has a single
+ *    interrupt for all channels, so the application calls this from its
+ *    DMA_IRQHandler().
+ *
+ *****************************************************************************/
+void oled_dmaIrqHandler(void)
+{
+#ifndef OLED_USE_I2C
+    if (GPDMA_IntGetStatus(GPDMA_STAT_INT, OLED_DMA_TX_CHANNEL) == SET) {
+        GPDMA_ClearIntPending(GPDMA_STATCLR_INTTC, OLED_DMA_TX_CHANNEL);
+        if (GPDMA_IntGetStatus(GPDMA_STAT_INTERR, OLED_DMA_TX_CHANNEL) == SET) {
+            /* Nothing more will come back, give up on this page. What
+             * the display holds is unknown now, the next flush sends it
+             * again. */
+            GPDMA_ClearIntPending(GPDMA_STATCLR_INTERR, OLED_DMA_TX_CHANNEL);
+            GPDMA_ChannelCmd(OLED_DMA_RX_CHANNEL, DISABLE);
+            OLED_CS_OFF();
+            sentKnown &= ~(1 << dmaPage);
+            failedPages |= 1 << dmaPage;
+            dmaPage++;
+            startDmaPage();
+        }
+    }
 
+    if (GPDMA_IntGetStatus(GPDMA_STAT_INT, OLED_DMA_RX_CHANNEL) == SET) {
+        GPDMA_ClearIntPending(GPDMA_STATCLR_INTTC, OLED_DMA_RX_CHANNEL);
+        GPDMA_ClearIntPending(GPDMA_STATCLR_INTERR, OLED_DMA_RX_CHANNEL);
 
-    writeData(shadowFB[shadowPos]);
+        /* The last byte of the run has been clocked out */
+        OLED_CS_OFF();
+        startDmaPage();
+    }
+#endif
 }
 
 /******************************************************************************
@@ -469,6 +1150,7 @@ void oled_line(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, oled_color_t colo
     if(dx == 0)           /* vertical line */
     {
         vLine(x0, y0, y1, color);
+        flushIfAuto();
         return;
     }
 
@@ -485,6 +1167,7 @@ void oled_line(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, oled_color_t colo
     if(dy == 0)           /* horizontal line */
     {
         hLine(x0, y0, x1, color);
+        flushIfAuto();
         return;
     }
 
@@ -504,13 +1187,20 @@ void oled_line(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, oled_color_t colo
     dx_x2 = dx*2;
     dy_x2 = dy*2;
 
-    if(dx >= dy)
+    markArea(x0 < x1 ? x0 : x1, y0 < y1 ? y0 : y1, x0 < x1 ? x1 : x0, y0 < y1 ? y1 : y0);
+
+    if((x0 < OLED_DISPLAY_WIDTH) && (x1 < OLED_DISPLAY_WIDTH) &&
+       (y0 < OLED_DISPLAY_HEIGHT) && (y1 < OLED_DISPLAY_HEIGHT))
+    {
+        lineOnScreen(x0, y0, dx, dy, dx_sym, dy_sym, color);
+    }
+    else if(dx >= dy)
     {
         di = dy_x2 - dx;
         while(x0 != x1)
         {
 
-            oled_putPixel(x0, y0, color);
+            plot(x0, y0, color);
             x0 += dx_sym;
             if(di<0)
             {
@@ -522,14 +1212,14 @@ void oled_line(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, oled_color_t colo
                 y0 += dy_sym;
             }
         }
-        oled_putPixel(x0, y0, color);
+        plot(x0, y0, color);
     }
     else
     {
         di = dx_x2 - dy;
         while(y0 != y1)
         {
-            oled_putPixel(x0, y0, color);
+            plot(x0, y0, color);
             y0 += dy_sym;
             if(di < 0)
             {
@@ -541,8 +1231,9 @@ void oled_line(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, oled_color_t colo
                 x0 += dx_sym;
             }
         }
-        oled_putPixel(x0, y0, color);
+        plot(x0, y0, color);
     }
+    flushIfAuto();
     return;
 }
 
@@ -560,60 +1251,35 @@ void oled_line(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, oled_color_t colo
  *****************************************************************************/
 void oled_circle(uint8_t x0, uint8_t y0, uint8_t r, oled_color_t color)
 {
-    int16_t draw_x0, draw_y0;
-    int16_t draw_x1, draw_y1;
-    int16_t draw_x2, draw_y2;
-    int16_t draw_x3, draw_y3;
-    int16_t draw_x4, draw_y4;
-    int16_t draw_x5, draw_y5;
-    int16_t draw_x6, draw_y6;
-    int16_t draw_x7, draw_y7;
     int16_t xx, yy;
-    int16_t  di;
+    int16_t di;
 
     if(r == 0)          /* no radius */
     {
         return;
     }
 
-    draw_x0 = draw_x1 = x0;
-    draw_y0 = draw_y1 = y0 + r;
-    if(draw_y0 < OLED_DISPLAY_HEIGHT)
-    {
-        oled_putPixel(draw_x0, draw_y0, color);     /* 90 degree */
-    }
-
-    draw_x2 = draw_x3 = x0;
-    draw_y2 = draw_y3 = y0 - r;
-    if(draw_y2 >= 0)
-    {
-        oled_putPixel(draw_x2, draw_y2, color);    /* 270 degree */
-    }
-
-    draw_x4 = draw_x6 = x0 + r;
-    draw_y4 = draw_y6 = y0;
-    if(draw_x4 < OLED_DISPLAY_WIDTH)
-    {
-        oled_putPixel(draw_x4, draw_y4, color);     /* 0 degree */
-    }
-
-    draw_x5 = draw_x7 = x0 - r;
-    draw_y5 = draw_y7 = y0;
-    if(draw_x5>=0)
-    {
-        oled_putPixel(draw_x5, draw_y5, color);     /* 180 degree */
-    }
-
-    if(r == 1)
-    {
-        return;
-    }
+    markArea(x0 - r, y0 - r, x0 + r, y0 + r);
 
+    /* Midpoint circle, each point is mirrored to all eight octants */
     di = 3 - 2*r;
     xx = 0;
     yy = r;
-    while(xx < yy)
+    while(1)
     {
+        plot(x0 + xx, y0 + yy, color);
+        plot(x0 - xx, y0 + yy, color);
+        plot(x0 + xx, y0 - yy, color);
+        plot(x0 - xx, y0 - yy, color);
+        plot(x0 + yy, y0 + xx, color);
+        plot(x0 - yy, y0 + xx, color);
+        plot(x0 + yy, y0 - xx, color);
+        plot(x0 - yy, y0 - xx, color);
+
+        if(xx >= yy)
+        {
+            break;
+        }
 
         if(di < 0)
         {
@@ -623,63 +1289,11 @@ void oled_circle(uint8_t x0, uint8_t y0, uint8_t r, oled_color_t color)
         {
             di += 4*(xx - yy) + 10;
             yy--;
-            draw_y0--;
-            draw_y1--;
-            draw_y2++;
-            draw_y3++;
-            draw_x4--;
-            draw_x5++;
-            draw_x6--;
-            draw_x7++;
         }
         xx++;
-        draw_x0++;
-        draw_x1--;
-        draw_x2++;
-        draw_x3--;
-        draw_y4++;
-        draw_y5++;
-        draw_y6--;
-        draw_y7--;
-
-        if( (draw_x0 <= OLED_DISPLAY_WIDTH) && (draw_y0>=0) )
-        {
-            oled_putPixel(draw_x0, draw_y0, color);
-        }
-
-        if( (draw_x1 >= 0) && (draw_y1 >= 0) )
-        {
-            oled_putPixel(draw_x1, draw_y1, color);
-        }
-
-        if( (draw_x2 <= OLED_DISPLAY_WIDTH) && (draw_y2 <= OLED_DISPLAY_HEIGHT) )
-        {
-            oled_putPixel(draw_x2, draw_y2, color);
-        }
-
-        if( (draw_x3 >=0 ) && (draw_y3 <= OLED_DISPLAY_HEIGHT) )
-        {
-            oled_putPixel(draw_x3, draw_y3, color);
-        }
-
-        if( (draw_x4 <= /*OLED_DISPLAY_HEIGHT*/OLED_DISPLAY_WIDTH) && (draw_y4 >= 0) )
-        {
-            oled_putPixel(draw_x4, draw_y4, color);
-        }
-
-        if( (draw_x5 >= 0) && (draw_y5 >= 0) )
-        {
-            oled_putPixel(draw_x5, draw_y5, color);
-        }
-        if( (draw_x6 <= OLED_DISPLAY_WIDTH) && (draw_y6 <= OLED_DISPLAY_HEIGHT) )
-        {
-            oled_putPixel(draw_x6, draw_y6, color);
-        }
-        if( (draw_x7 >= 0) && (draw_y7 <= OLED_DISPLAY_HEIGHT) )
-        {
-            oled_putPixel(draw_x7, draw_y7, color);
-        }
     }
+
+    flushIfAuto();
     return;
 }
 
@@ -702,6 +1316,7 @@ void oled_rect(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, oled_color_t colo
     hLine(x0, y1, x1, color);
     vLine(x0, y0, y1, color);
     vLine(x1, y0, y1, color);
+    flushIfAuto();
 }
 
 /******************************************************************************
@@ -719,40 +1334,8 @@ void oled_rect(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, oled_color_t colo
  *****************************************************************************/
 void oled_fillRect(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, oled_color_t color)
 {
-    uint8_t i = 0;
-
-    if(x0 > x1)
-    {
-        i  = x0;
-        x0 = x1;
-        x1 = i;
-    }
-
-    if(y0 > y1)
-    {
-        i  = y0;
-        y0 = y1;
-        y1 = i;
-    }
-
-    if(y0 == y1)
-    {
-        hLine(x0, y0, x1, color);
-        return;
-    }
-
-    if(x0 == x1)
-    {
-        vLine(x0, y0, y1, color);
-        return;
-    }
-
-    while(y0 <= y1)
-    {
-        hLine(x0, y0, x1, color);
-        y0++;
-    }
-    return;
+    fillSpan(x0, y0, x1, y1, color);
+    flushIfAuto();
 }
 
 /******************************************************************************
@@ -772,23 +1355,42 @@ void oled_clearScreen(oled_color_t color)
     if (color == OLED_COLOR_WHITE)
         c = 0xff;
 
+    memset(shadowFB, c, SHADOW_FB_SIZE);
 
-    for(i=0xB0;i<0xB8;i++) {            // Go through all 8 pages
-        setAddress(i,0x00,0x10);
-        writeDataLen(c, 132);
+    for(i=0;i<PAGE_COUNT;i++) {         // Go through all 8 pages
+        markDirty(i, 0, OLED_DISPLAY_WIDTH-1);
     }
-
-    memset(shadowFB, c, SHADOW_FB_SIZE);
+    flushIfAuto();
 }
 
-uint8_t oled_putChar(uint8_t x, uint8_t y, uint8_t ch, oled_color_t fb, oled_color_t bg)
+/******************************************************************************
+ *
+ * Description:
+ *    Draw a character into the shadow framebuffer. The glyph columns from
+ *    font5x7_columns already have the layout of a display page byte, so
+ *    each column is written with at most two masked byte stores instead
+ *    of 8 pixels.
+ *
+ * Returns:
+ *    1 if the character was drawn, 0 if it doesn't fit on the display
+ *
+ *****************************************************************************/
+static uint8_t drawChar(uint8_t x, uint8_t y, uint8_t ch, oled_color_t fb, oled_color_t bg)
 {
-    unsigned char data = 0;
-    unsigned char i = 0, j = 0;
-
-    oled_color_t color = OLED_COLOR_BLACK;
+    const unsigned char *glyph;
+    uint8_t *upper;
+    uint8_t *lower;
+    uint8_t fbBits;
+    uint8_t bgBits;
+    uint8_t shift;
+    uint8_t upperMask;
+    uint8_t lowerMask;
+    uint8_t bits;
+    uint8_t page;
+    uint8_t i;
 
-    if((x >= (OLED_DISPLAY_WIDTH - 8)) || (y >= (OLED_DISPLAY_HEIGHT - 8)) )
+    /* The whole 6x8 cell has to be on the display */
+    if((x > (OLED_DISPLAY_WIDTH - FONT5X7_COLUMNS)) || (y > (OLED_DISPLAY_HEIGHT - 8)) )
     {
         return 0;
     }
@@ -798,29 +1400,44 @@ uint8_t oled_putChar(uint8_t x, uint8_t y, uint8_t ch, oled_color_t fb, oled_col
         ch = 0x20;      /* unknown character will be set to blank */
     }
 
-    ch -= 0x20;
-    for(i=0; i<8; i++)
-    {
-        data = font5x7[ch][i];
-        for(j=0; j<6; j++)
-        {
-            if( (data&font_mask[j])==0 )
-            {
-                color = bg;
-            }
-            else
-            {
-                color = fb;
-            }
-            oled_putPixel(x, y, color);
-            x++;
+    glyph = font5x7_columns[ch - 0x20];
+    fbBits = (fb == OLED_COLOR_WHITE) ? 0xff : 0x00;
+    bgBits = (bg == OLED_COLOR_WHITE) ? 0xff : 0x00;
+    page = y >> 3;
+    shift = y & 0x07;
+    upper = &shadowFB[page*OLED_DISPLAY_WIDTH + x];
+
+    if (shift == 0) {
+        /* The character cell is exactly one page */
+        for (i = 0; i < FONT5X7_COLUMNS; i++) {
+            upper[i] = (glyph[i] & fbBits) | (~glyph[i] & bgBits);
         }
-        y++;
-        x -= 6;
+        markDirty(page, x, x + FONT5X7_COLUMNS - 1);
+        return( 1 );
+    }
+
+    /* The cell spans two pages, y is then below OLED_DISPLAY_HEIGHT - 8 */
+    lower = upper + OLED_DISPLAY_WIDTH;
+    upperMask = 0xff << shift;
+    lowerMask = 0xff >> (8 - shift);
+    for (i = 0; i < FONT5X7_COLUMNS; i++) {
+        bits = (glyph[i] & fbBits) | (~glyph[i] & bgBits);
+        upper[i] = (upper[i] & ~upperMask) | (uint8_t)(bits << shift);
+        lower[i] = (lower[i] & ~lowerMask) | (bits >> (8 - shift));
     }
+    markDirty(page, x, x + FONT5X7_COLUMNS - 1);
+    markDirty(page + 1, x, x + FONT5X7_COLUMNS - 1);
     return( 1 );
 }
 
+uint8_t oled_putChar(uint8_t x, uint8_t y, uint8_t ch, oled_color_t fb, oled_color_t bg)
+{
+    uint8_t drawn = drawChar(x, y, ch, fb, bg);
+
+    flushIfAuto();
+    return drawn;
+}
+
 void oled_putString(uint8_t x, uint8_t y, uint8_t *pStr, oled_color_t fb,
         oled_color_t bg)
 {
@@ -830,11 +1447,91 @@ void oled_putString(uint8_t x, uint8_t y, uint8_t *pStr, oled_color_t fb,
       {
           break;
       }
-      if( oled_putChar(x, y, *pStr++, fb, bg) == 0 )
+      if( drawChar(x, y, *pStr++, fb, bg) == 0 )
       {
         break;
     }
     x += 6;
   }
+  flushIfAuto();
   return;
 }
+
+/******************************************************************************
+ *
+ * Description:
+ *    Draw a number right aligned in a field of character cells, e.g. a
+ *    parameter readout. The cells left of the number are cleared, so the
+ *    field can be redrawn with any value without clearing it first.
+ *
+ *    The digits are found from the right with one division each and the
+ *    glyph columns are copied straight into the shadow framebuffer, with
+ *    a single dirty span for the field. Fields not on a page boundary are
+ *    drawn like oled_putString().
+ *
+ * Params:
+ *   [in] x - left edge of the field
+ *   [in] y - top of the field
+ *   [in] value - number to draw, a minus sign is added if negative
+ *   [in] chars - width of the field in characters, at most
+ *                OLED_NUMBER_CHARS_MAX
+ *   [in] fb - foreground color
+ *   [in] bg - background color
+ *
+ * Returns:
+ *    1 if drawn, 0 if the number or the field doesn't fit (nothing is
+ *    drawn then)
+ *
+ *****************************************************************************/
+uint8_t oled_putNumber(uint8_t x, uint8_t y, int32_t value, uint8_t chars,
+        oled_color_t fb, oled_color_t bg)
+{
+    uint8_t cells[OLED_NUMBER_CHARS_MAX];
+    uint32_t magnitude = (value < 0) ? 0u - (uint32_t)value : (uint32_t)value;
+    const unsigned char *glyph;
+    uint8_t *dst;
+    uint8_t fbBits;
+    uint8_t bgBits;
+    uint8_t count = 0;
+    uint8_t i;
+    uint8_t c;
+
+    if (chars == 0 || chars > OLED_NUMBER_CHARS_MAX
+            || x + chars*FONT5X7_COLUMNS > OLED_DISPLAY_WIDTH
+            || y > OLED_DISPLAY_HEIGHT - 8)
+        return 0;
+
+    /* Characters from the right */
+    do {
+        cells[count++] = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while (magnitude != 0 && count < chars);
+
+    if (magnitude != 0 || (value < 0 && count == chars))
+        return 0;
+
+    if (value < 0)
+        cells[count++] = '-';
+    while (count < chars)
+        cells[count++] = ' ';
+
+    if ((y & 0x07) != 0) {
+        for (i = 0; i < chars; i++)
+            drawChar(x + i*FONT5X7_COLUMNS, y, cells[chars - 1 - i], fb, bg);
+        flushIfAuto();
+        return 1;
+    }
+
+    fbBits = (fb == OLED_COLOR_WHITE) ? 0xff : 0x00;
+    bgBits = (bg == OLED_COLOR_WHITE) ? 0xff : 0x00;
+    dst = &shadowFB[(y >> 3)*OLED_DISPLAY_WIDTH + x];
+    for (i = chars; i > 0; i--) {
+        glyph = font5x7_columns[cells[i - 1] - 0x20];
+        for (c = 0; c < FONT5X7_COLUMNS; c++)
+            *dst++ = (glyph[c] & fbBits) | (~glyph[c] & bgBits);
+    }
+    markDirty(y >> 3, x, x + chars*FONT5X7_COLUMNS - 1);
+
+    flushIfAuto();
+    return 1;
+}
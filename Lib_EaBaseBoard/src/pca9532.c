@@ -8,26 +8,29 @@
 
 /*
  * NOTE: I2C must have been initialized before calling any functions in this
- * file.
+ * file. The transfers go through the shared bus queue, see i2cbus.c.
  */
 
 /******************************************************************************
  * Includes
  *****************************************************************************/
 
-#include "lpc17xx_i2c.h"
+#include "i2cbus.h"
 #include "pca9532.h"
 
 /******************************************************************************
  * Defines and typedefs
  *****************************************************************************/
 
-#define I2CDEV LPC_I2C2
-
 #define LS_MODE_ON     0x01
 #define LS_MODE_BLINK0 0x02
 #define LS_MODE_BLINK1 0x03
 
+/* PSC0 to LS3, the registers that are written */
+#define REG_FIRST  PCA9532_PSC0
+#define REG_COUNT  (PCA9532_LS3 - PCA9532_PSC0 + 1)
+#define REG(r)     ((r) - REG_FIRST)
+
 /******************************************************************************
  * External global variables
  *****************************************************************************/
@@ -41,46 +44,33 @@ static uint16_t blink0Shadow = 0;
 static uint16_t blink1Shadow = 0;
 static uint16_t ledStateShadow = 0;
 
+/*
+ * Register values wanted (regShadow) and last sent to the device (regSent),
+ * PSC0 to LS3, power up values to begin with. Only the registers that
+ * differ are written, in one auto-increment write from the first to the
+ * last of them. Until the first write has been acknowledged the device
+ * state isn't known and all of them are written.
+ */
+static uint8_t regShadow[REG_COUNT] = {0x00, 0x80, 0x00, 0x80, 0, 0, 0, 0};
+static uint8_t regSent[REG_COUNT];
+static uint8_t regSentKnown = 0;
+
+/* Nesting depth of pca9532_beginUpdate() */
+static uint32_t updateDepth = 0;
+
+/*
+ * The registers are written in the background. A change made while the
+ * write is still running is sent by another write when it is done, see
+ * ledsDone().
+ */
+static i2cbus_xfer_t ledsXfer;
+static uint8_t ledsBuf[REG_COUNT + 1];
+static volatile uint8_t ledsPending = 0;
+
 /******************************************************************************
  * Local Functions
  *****************************************************************************/
 
-static int I2CRead(uint8_t addr, uint8_t* buf, uint32_t len)
-{
-	I2C_M_SETUP_Type rxsetup;
-
-	rxsetup.sl_addr7bit = addr;
-	rxsetup.tx_data = NULL;	// Get address to read at writing address
-	rxsetup.tx_length = 0;
-	rxsetup.rx_data = buf;
-	rxsetup.rx_length = len;
-	rxsetup.retransmissions_max = 3;
-
-	if (I2C_MasterTransferData(I2CDEV, &rxsetup, I2C_TRANSFER_POLLING) == SUCCESS){
-		return (0);
-	} else {
-		return (-1);
-	}
-}
-
-static int I2CWrite(uint8_t addr, uint8_t* buf, uint32_t len)
-{
-	I2C_M_SETUP_Type txsetup;
-
-	txsetup.sl_addr7bit = addr;
-	txsetup.tx_data = buf;
-	txsetup.tx_length = len;
-	txsetup.rx_data = NULL;
-	txsetup.rx_length = 0;
-	txsetup.retransmissions_max = 3;
-
-	if (I2C_MasterTransferData(I2CDEV, &txsetup, I2C_TRANSFER_POLLING) == SUCCESS){
-		return (0);
-	} else {
-		return (-1);
-	}
-}
-
 static void setLsStates(uint16_t states, uint8_t* ls, uint8_t mode)
 {
 #define IS_LED_SET(bit, x) ( ( ((x) & (bit)) != 0 ) ? 1 : 0 )
@@ -98,11 +88,19 @@ static void setLsStates(uint16_t states, uint8_t* ls, uint8_t mode)
     }
 }
 
-static void setLeds(void)
+static void ledsDone(i2cbus_xfer_t* xfer);
+
+/*
+ * Prepare the write of the registers that differ from the device. Returns
+ * 0 if there is nothing to write.
+ */
+static int buildLeds(void)
 {
-    uint8_t buf[5];
     uint8_t ls[4] = {0,0,0,0};
     uint16_t states = ledStateShadow;
+    int first = -1;
+    int last = -1;
+    int i = 0;
 
     /* LEDs in On/Off state */
     setLsStates(states, ls, LS_MODE_ON);
@@ -111,12 +109,101 @@ static void setLeds(void)
     setLsStates(blink0Shadow, ls, LS_MODE_BLINK0);
     setLsStates(blink1Shadow, ls, LS_MODE_BLINK1);
 
-    buf[0] = PCA9532_LS0 | PCA9532_AUTO_INC;
-    buf[1] = ls[0];
-    buf[2] = ls[1];
-    buf[3] = ls[2];
-    buf[4] = ls[3];
-    I2CWrite(PCA9532_I2C_ADDR, buf, 5);
+    for (i = 0; i < 4; i++) {
+        regShadow[REG(PCA9532_LS0) + i] = ls[i];
+    }
+
+    for (i = 0; i < REG_COUNT; i++) {
+        if (!regSentKnown || regShadow[i] != regSent[i]) {
+            if (first < 0)
+                first = i;
+            last = i;
+        }
+    }
+
+    if (first < 0)
+        return 0;
+
+    ledsBuf[0] = (REG_FIRST + first) | PCA9532_AUTO_INC;
+    for (i = first; i <= last; i++) {
+        ledsBuf[1 + i - first] = regShadow[i];
+        regSent[i] = regShadow[i];
+    }
+
+    ledsXfer.addr = PCA9532_I2C_ADDR;
+    ledsXfer.txBuf = ledsBuf;
+    ledsXfer.txLen = last - first + 2;
+    ledsXfer.rxBuf = NULL;
+    ledsXfer.rxLen = 0;
+    ledsXfer.retries = I2CBUS_RETRIES;
+    ledsXfer.done = ledsDone;
+
+    return 1;
+}
+
+/*
+ * Called from the I2C interrupt when the registers have been written
+ */
+static void ledsDone(i2cbus_xfer_t* xfer)
+{
+    if (xfer->status == I2CBUS_DONE) {
+        regSentKnown = 1;
+    }
+    else {
+        /* the device may have missed any of the writes so far */
+        regSentKnown = 0;
+    }
+
+    if (ledsPending) {
+        ledsPending = 0;
+        /* buildLeds() has marked the registers as sent, if the queue has
+         * been filled up meanwhile the next setLeds() writes all of them */
+        if (buildLeds() && i2cbus_submit(xfer) != 0)
+            regSentKnown = 0;
+    }
+}
+
+/*
+ * Send the shadow state to the device without waiting for the bus. Only
+ * waits if the bus queue is full. Does nothing between
+ * pca9532_beginUpdate() and pca9532_endUpdate().
+ */
+static void setLeds(void)
+{
+    int ret = 0;
+
+    if (updateDepth > 0)
+        return;
+
+    i2cbus_lock();
+    if (ledsXfer.status == I2CBUS_BUSY) {
+        ledsPending = 1;
+    }
+    else if (buildLeds()) {
+        ret = i2cbus_submit(&ledsXfer);
+        /* the device state isn't known until the write below is done */
+        if (ret != 0)
+            regSentKnown = 0;
+    }
+    i2cbus_unlock();
+
+    if (ret != 0)
+        (void)i2cbus_run(&ledsXfer);
+}
+
+/*
+ * PWM value of a duty cycle in percent
+ */
+static uint8_t dutyToPwm(uint8_t duty)
+{
+    uint32_t tmp = duty;
+    if (tmp > 100) {
+        tmp = 100;
+    }
+
+    tmp = (256 * tmp)/100;
+
+    return tmp;
 }
 
 /******************************************************************************
@@ -170,15 +257,11 @@ uint16_t pca9532_getLedState (uint32_t shadow)
          */
 
         buf[0] = PCA9532_INPUT0;
-        I2CWrite(PCA9532_I2C_ADDR, buf, 1);
-
-        I2CRead(PCA9532_I2C_ADDR, buf, 1);
+        i2cbus_writeRead(PCA9532_I2C_ADDR, buf, 1, buf, 1);
         ret = buf[0];
 
         buf[0] = PCA9532_INPUT1;
-        I2CWrite(PCA9532_I2C_ADDR, buf, 1);
-
-        I2CRead(PCA9532_I2C_ADDR, buf, 1);
+        i2cbus_writeRead(PCA9532_I2C_ADDR, buf, 1, buf, 1);
         ret |= (buf[0] << 8);
 
         /* invert since LEDs are active low */
@@ -227,11 +310,8 @@ void pca9532_setLeds (uint16_t ledOnMask, uint16_t ledOffMask)
  *****************************************************************************/
 void pca9532_setBlink0Period(uint8_t period)
 {
-    uint8_t buf[2];
-
-    buf[0] = PCA9532_PSC0;
-    buf[1] = period;
-    I2CWrite(PCA9532_I2C_ADDR, buf, 2);
+    regShadow[REG(PCA9532_PSC0)] = period;
+    setLeds();
 }
 
 /******************************************************************************
@@ -246,17 +326,8 @@ void pca9532_setBlink0Period(uint8_t period)
  *****************************************************************************/
 void pca9532_setBlink0Duty(uint8_t duty)
 {
-    uint8_t buf[2];
-    uint32_t tmp = duty;
-    if (tmp > 100) {
-        tmp = 100;
-    }
-
-    tmp = (256 * tmp)/100;
-
-    buf[0] = PCA9532_PWM0;
-    buf[1] = tmp;
-    I2CWrite(PCA9532_I2C_ADDR, buf, 2);
+    regShadow[REG(PCA9532_PWM0)] = dutyToPwm(duty);
+    setLeds();
 }
 
 /******************************************************************************
@@ -287,11 +358,8 @@ void pca9532_setBlink0Leds(uint16_t ledMask)
  *****************************************************************************/
 void pca9532_setBlink1Period(uint8_t period)
 {
-    uint8_t buf[2];
-
-    buf[0] = PCA9532_PSC1;
-    buf[1] = period;
-    I2CWrite(PCA9532_I2C_ADDR, buf, 2);
+    regShadow[REG(PCA9532_PSC1)] = period;
+    setLeds();
 }
 
 /******************************************************************************
@@ -306,18 +374,8 @@ void pca9532_setBlink1Period(uint8_t period)
  *****************************************************************************/
 void pca9532_setBlink1Duty(uint8_t duty)
 {
-    uint8_t buf[2];
-
-    uint32_t tmp = duty;
-    if (tmp > 100) {
-        tmp = 100;
-    }
-
-    tmp = (256 * tmp)/100;
-
-    buf[0] = PCA9532_PWM1;
-    buf[1] = tmp;
-    I2CWrite(PCA9532_I2C_ADDR, buf, 2);
+    regShadow[REG(PCA9532_PWM1)] = dutyToPwm(duty);
+    setLeds();
 }
 
 /******************************************************************************
@@ -335,3 +393,31 @@ void pca9532_setBlink1Leds(uint16_t ledMask)
     blink1Shadow |= ledMask;
     setLeds();
 }
+
+/******************************************************************************
+ *
+ * Description:
+ *    Collect the changes made by the other functions until
+ *    pca9532_endUpdate() and send them in a single write. Calls may be
+ *    nested, the changes are sent by the outermost pca9532_endUpdate().
+ *
+ *****************************************************************************/
+void pca9532_beginUpdate(void)
+{
+    updateDepth++;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Send the changes collected since pca9532_beginUpdate(). Registers
+ *    that are back to the value the device has aren't written.
+ *
+ *****************************************************************************/
+void pca9532_endUpdate(void)
+{
+    if (updateDepth > 0)
+        updateDepth--;
+
+    setLeds();
+}
@@ -8,14 +8,14 @@
 
 /*
  * NOTE: I2C must have been initialized before calling any functions in this
- * file.
+ * file. The transfers go through the shared bus queue, see i2cbus.c.
  */
 
 /******************************************************************************
  * Includes
  *****************************************************************************/
 
-#include "lpc17xx_i2c.h"
+#include "i2cbus.h"
 #include "lpc17xx_uart.h"
 #include "lpc17xx_gpio.h"
 #include "uart2.h"
@@ -24,8 +24,6 @@
  * Defines and typedefs
  *****************************************************************************/
 
-#define I2CDEV LPC_I2C2
-
 #define UART2_ADDR (0x48)
 
 #define R_RHR 0x00
@@ -65,49 +63,13 @@ static uint8_t channel = 0;
  * Local Functions
  *****************************************************************************/
 
-static int I2CRead(uint8_t addr, uint8_t* buf, uint32_t len)
-{
-	I2C_M_SETUP_Type rxsetup;
-
-	rxsetup.sl_addr7bit = addr;
-	rxsetup.tx_data = NULL;	// Get address to read at writing address
-	rxsetup.tx_length = 0;
-	rxsetup.rx_data = buf;
-	rxsetup.rx_length = len;
-	rxsetup.retransmissions_max = 3;
-
-	if (I2C_MasterTransferData(I2CDEV, &rxsetup, I2C_TRANSFER_POLLING) == SUCCESS){
-		return (0);
-	} else {
-		return (-1);
-	}
-}
-
-static int I2CWrite(uint8_t addr, uint8_t* buf, uint32_t len)
-{
-	I2C_M_SETUP_Type txsetup;
-
-	txsetup.sl_addr7bit = addr;
-	txsetup.tx_data = buf;
-	txsetup.tx_length = len;
-	txsetup.rx_data = NULL;
-	txsetup.rx_length = 0;
-	txsetup.retransmissions_max = 3;
-
-	if (I2C_MasterTransferData(I2CDEV, &txsetup, I2C_TRANSFER_POLLING) == SUCCESS){
-		return (0);
-	} else {
-		return (-1);
-	}
-}
-
 static void writeReg(uint8_t reg, uint8_t data)
 {
     uint8_t buf[2];
 
     buf[0] = SUB_ADDR(channel, reg);
     buf[1] = data;
-    I2CWrite(UART2_ADDR, buf, 2);
+    i2cbus_write(UART2_ADDR, buf, 2);
 }
 
 static uint8_t readReg(uint8_t reg)
@@ -115,8 +77,7 @@ static uint8_t readReg(uint8_t reg)
     uint8_t buf[1];
 
     buf[0] = SUB_ADDR(channel, reg);
-    I2CWrite(UART2_ADDR, buf, 1);
-    I2CRead(UART2_ADDR, buf, 1);
+    i2cbus_writeRead(UART2_ADDR, buf, 1, buf, 1);
 
     return buf[0];
 }
@@ -0,0 +1,116 @@
+#include "amplifier.h"
+
+#include "lpc17xx_gpio.h"
+#include "lpc17xx_timer.h"
+
+#include "lm4811.h"
+
+#if AMPLIFIER_LEVEL_MAX != LM4811_LEVEL_MAX
+#error "AMPLIFIER_LEVEL_MAX must match LM4811_LEVEL_MAX"
+#endif
+
+// LM4811 control pins, see init_amplifier().
+#define AMPLIFIER_PORT          0
+#define AMPLIFIER_CLOCK_PIN     (1UL << 27)
+#define AMPLIFIER_UP_PIN        (1UL << 28)
+
+// Timer1 ticks the pulse sequence, Timer0 is left to Timer0_Wait().
+#define AMPLIFIER_TIMER         LPC_TIM1
+#define AMPLIFIER_TIMER_IRQ     TIMER1_IRQn
+#define AMPLIFIER_TICK_US       1000
+
+// Pin changes aren't time critical, so this is below the audio and MIDI interrupts.
+#define AMPLIFIER_IRQ_PRIORITY  3
+
+static struct Lm4811 amplifier;
+
+/**
+ * @brief   Starts moving the amplifier to a level, the pulses are sent from the Timer1 interrupt.
+ *
+ * @note    init_amplifier() needs to be called before this function. The amplifier level is
+ *          unknown at power up, so it is first taken down through its whole range (about 30 ms).
+ *
+ * @param   level   Level from 0 to AMPLIFIER_LEVEL_MAX.
+ *
+ * @return  None
+ */
+void amplifier_init(uint8_t level) {
+    TIM_TIMERCFG_Type TIM_ConfigStruct;
+    TIM_MATCHCFG_Type TIM_MatchConfigStruct;
+
+    lm4811_init(&amplifier, level);
+
+    TIM_ConfigStruct.PrescaleOption = TIM_PRESCALE_USVAL;
+    TIM_ConfigStruct.PrescaleValue = 1;
+
+    TIM_MatchConfigStruct.MatchChannel = 0;
+    TIM_MatchConfigStruct.IntOnMatch = TRUE;
+    TIM_MatchConfigStruct.ResetOnMatch = TRUE;
+    TIM_MatchConfigStruct.StopOnMatch = FALSE;
+    TIM_MatchConfigStruct.ExtMatchOutputType = TIM_EXTMATCH_NOTHING;
+    TIM_MatchConfigStruct.MatchValue = AMPLIFIER_TICK_US;
+
+    TIM_Init(AMPLIFIER_TIMER, TIM_TIMER_MODE, &TIM_ConfigStruct);
+    TIM_ConfigMatch(AMPLIFIER_TIMER, &TIM_MatchConfigStruct);
+
+    NVIC_SetPriority(AMPLIFIER_TIMER_IRQ, AMPLIFIER_IRQ_PRIORITY);
+    NVIC_EnableIRQ(AMPLIFIER_TIMER_IRQ);
+    TIM_Cmd(AMPLIFIER_TIMER, ENABLE);
+}
+
+/**
+ * @brief   Changes the level the amplifier goes to. Returns right away.
+ *
+ * @note    Calls made while the amplifier is still moving just change its goal, so fast
+ *          rotary movement ends up as a single pulse train.
+ *
+ * @param   level   Level from 0 to AMPLIFIER_LEVEL_MAX.
+ *
+ * @return  None
+ */
+void amplifier_set_level(uint8_t level) {
+    // The interrupt stops the timer once the target is reached. Masking it here makes sure
+    // it can't do that between the target being set and the timer being started.
+    NVIC_DisableIRQ(AMPLIFIER_TIMER_IRQ);
+    lm4811_set_target(&amplifier, level);
+    TIM_Cmd(AMPLIFIER_TIMER, ENABLE);
+    NVIC_EnableIRQ(AMPLIFIER_TIMER_IRQ);
+}
+
+/**
+ * @brief   Checks if the amplifier has reached the last requested level.
+ *
+ * @return  bool    true if no pulses are pending.
+ */
+bool amplifier_is_settled(void) {
+    return lm4811_is_settled(&amplifier);
+}
+
+/**
+ * @brief   Timer1 interrupt handler, sends the next part of the pulse sequence.
+ *
+ * @return  None
+ */
+void TIMER1_IRQHandler(void) {
+    if (TIM_GetIntStatus(AMPLIFIER_TIMER, TIM_MR0_INT) == SET) {
+        TIM_ClearIntPending(AMPLIFIER_TIMER, TIM_MR0_INT);
+
+        bool running = lm4811_tick(&amplifier);
+
+        if (amplifier.up) {
+            GPIO_SetValue(AMPLIFIER_PORT, AMPLIFIER_UP_PIN);
+        } else {
+            GPIO_ClearValue(AMPLIFIER_PORT, AMPLIFIER_UP_PIN);
+        }
+        if (amplifier.clock) {
+            GPIO_SetValue(AMPLIFIER_PORT, AMPLIFIER_CLOCK_PIN);
+        } else {
+            GPIO_ClearValue(AMPLIFIER_PORT, AMPLIFIER_CLOCK_PIN);
+        }
+
+        // Don't wake the CPU every millisecond when there is nothing to send.
+        if (!running) {
+            TIM_Cmd(AMPLIFIER_TIMER, DISABLE);
+        }
+    }
+}
@@ -0,0 +1,13 @@
+#ifndef AMPLIFIER_H
+#define AMPLIFIER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define AMPLIFIER_LEVEL_MAX     15
+
+void amplifier_init(uint8_t level);
+void amplifier_set_level(uint8_t level);
+bool amplifier_is_settled(void);
+
+#endif
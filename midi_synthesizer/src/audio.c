@@ -0,0 +1,131 @@
+#include "audio.h"
+
+#include "lpc17xx_dac.h"
+#include "lpc17xx_gpdma.h"
+#include "lpc17xx_clkpwr.h"
+
+#include "synth.h"
+#include "midi_uart.h"
+#include "display.h"
+#include "scope.h"
+#include "vu_meter.h"
+
+// Priority of the DMA interrupt. Rendering one block takes well under a block period,
+// so short interrupts (UART, timers) are allowed to preempt it.
+#define AUDIO_IRQ_PRIORITY      2
+
+// The audio path is double buffered: GPDMA plays one buffer while the other one is rendered.
+// Both LLIs point at each other, so the DMA loops over the two buffers forever and raises
+// the terminal count interrupt every time it switches to the other buffer.
+static uint32_t render_buffers[2][AUDIO_BLOCK_SIZE];
+static GPDMA_LLI_Type DMA_LLI_Structs[2];
+static GPDMA_Channel_CFG_Type GPDMACfg;
+static DAC_CONVERTER_CFG_Type DAC_ConverterConfigStruct;
+
+/**
+ * @brief   Renders audio into the buffer that is not being read by GPDMA at the moment.
+ *
+ * @note    The idle buffer is found by checking the current DMA source address, so a
+ *          late interrupt can't cause us to render into the buffer that is playing.
+ *
+ * @return  None
+ */
+static void render_idle_buffer(void) {
+    struct MidiEvent event;
+    uint32_t src = LPC_GPDMACH0->DMACCSrcAddr;
+    uint32_t first_start = (uint32_t)render_buffers[0];
+    uint32_t first_end = first_start + sizeof(render_buffers[0]);
+
+    // Apply everything received since the last block, so note-on to sound latency is
+    // bounded by the block length.
+    while (midi_uart_read_event(&event)) {
+        synth_handle_midi_event(&event);
+    }
+
+    uint32_t *idle = ((src >= first_start) && (src < first_end)) ? render_buffers[1] : render_buffers[0];
+    synth_render_block(idle, AUDIO_BLOCK_SIZE);
+    // Only copies the block while the scope view waits for a capture.
+    scope_capture(idle, AUDIO_BLOCK_SIZE);
+    // Looks at a quarter of the samples, the LED meter only needs the envelope.
+    vu_meter_capture(idle, AUDIO_BLOCK_SIZE);
+}
+
+/**
+ * @brief   GPDMA interrupt handler, called every time the DAC finishes playing one buffer.
+ *
+ * @note    All channels share this interrupt, the OLED flush channels are handled first
+ *          because that only takes a moment and keeps the SSP busy while rendering.
+ *
+ * @return  None
+ */
+void DMA_IRQHandler(void) {
+    display_dma_interrupt();
+
+    if (GPDMA_IntGetStatus(GPDMA_STAT_INT, AUDIO_DMA_CHANNEL) == SET) {
+        if (GPDMA_IntGetStatus(GPDMA_STAT_INTTC, AUDIO_DMA_CHANNEL) == SET) {
+            GPDMA_ClearIntPending(GPDMA_STATCLR_INTTC, AUDIO_DMA_CHANNEL);
+            render_idle_buffer();
+        }
+        if (GPDMA_IntGetStatus(GPDMA_STAT_INTERR, AUDIO_DMA_CHANNEL) == SET) {
+            GPDMA_ClearIntPending(GPDMA_STATCLR_INTERR, AUDIO_DMA_CHANNEL);
+        }
+    }
+}
+
+/**
+ * @brief   Sets up DAC and GPDMA to continuously play the render buffers at AUDIO_SAMPLE_RATE.
+ *
+ * @note    init_dac() needs to be called before this function. Voices should be configured
+ *          with synth_init() beforehand, because both buffers are rendered before DMA starts.
+ *
+ * @return  None
+ */
+void audio_init(void) {
+    uint32_t control = GPDMA_DMACCxControl_TransferSize((uint32_t)AUDIO_BLOCK_SIZE)
+                     | GPDMA_DMACCxControl_SWidth(2UL) // source width 32 bit
+                     | GPDMA_DMACCxControl_DWidth(2UL) // dest. width 32 bit
+                     | GPDMA_DMACCxControl_SI          // source increment
+                     | GPDMA_DMACCxControl_I;          // terminal count interrupt
+
+    synth_render_block(render_buffers[0], AUDIO_BLOCK_SIZE);
+    synth_render_block(render_buffers[1], AUDIO_BLOCK_SIZE);
+
+    /* GPDMA block section -------------------------------------------- */
+    GPDMA_Init();
+
+    // Prepare DMA link list items, each one plays one buffer and links to the other.
+    for (uint32_t i = 0; i < 2U; i++) {
+        DMA_LLI_Structs[i].SrcAddr = (uint32_t)render_buffers[i];
+        DMA_LLI_Structs[i].DstAddr = (uint32_t)&(LPC_DAC->DACR);
+        DMA_LLI_Structs[i].NextLLI = (uint32_t)&DMA_LLI_Structs[(i + 1U) % 2U];
+        DMA_LLI_Structs[i].Control = control;
+    }
+
+    // Setup GPDMA channel --------------------------------
+    GPDMACfg.ChannelNum = AUDIO_DMA_CHANNEL;
+    // The channel starts with the first buffer and continues with the second LLI.
+    GPDMACfg.SrcMemAddr = (uint32_t)render_buffers[0];
+    // Destination memory - unused
+    GPDMACfg.DstMemAddr = 0;
+    GPDMACfg.TransferSize = AUDIO_BLOCK_SIZE;
+    // Transfer width - unused
+    GPDMACfg.TransferWidth = 0;
+    GPDMACfg.TransferType = GPDMA_TRANSFERTYPE_M2P;
+    // Source connection - unused
+    GPDMACfg.SrcConn = 0;
+    GPDMACfg.DstConn = GPDMA_CONN_DAC;
+    GPDMACfg.DMALLI = (uint32_t)&DMA_LLI_Structs[1];
+    GPDMA_Setup(&GPDMACfg);
+
+    // Run the DAC from undivided CCLK so AUDIO_DAC_TIMEOUT gives the exact sample rate.
+    CLKPWR_SetPCLKDiv(CLKPWR_PCLKSEL_DAC, CLKPWR_PCLKSEL_CCLK_DIV_1);
+    DAC_ConverterConfigStruct.CNT_ENA = SET;
+    DAC_ConverterConfigStruct.DMA_ENA = SET;
+    DAC_SetDMATimeOut(LPC_DAC, AUDIO_DAC_TIMEOUT);
+    DAC_ConfigDAConverterControl(LPC_DAC, &DAC_ConverterConfigStruct);
+
+    NVIC_SetPriority(DMA_IRQn, AUDIO_IRQ_PRIORITY);
+    NVIC_EnableIRQ(DMA_IRQn);
+
+    GPDMA_ChannelCmd(AUDIO_DMA_CHANNEL, ENABLE);
+}
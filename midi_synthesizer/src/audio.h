@@ -0,0 +1,20 @@
+#ifndef AUDIO_H
+#define AUDIO_H
+
+#include <stdint.h>
+
+// The DAC is clocked with CCLK (100 MHz), so the DMA timeout below gives exactly 32 kHz.
+#define AUDIO_SAMPLE_RATE       32000
+#define AUDIO_DAC_TIMEOUT       3125
+
+// Number of samples in each of the two render buffers (2 ms at 32 kHz).
+// Must be a power of two, gain ramps across a block are done with shifts.
+#define AUDIO_BLOCK_SIZE_LOG2   6
+#define AUDIO_BLOCK_SIZE        (1 << AUDIO_BLOCK_SIZE_LOG2)
+
+// GPDMA channel 0 has the highest priority, so it is reserved for the DAC.
+#define AUDIO_DMA_CHANNEL       0
+
+void audio_init(void);
+
+#endif
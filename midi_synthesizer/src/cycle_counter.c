@@ -0,0 +1,31 @@
+#include "cycle_counter.h"
+
+#include "LPC17xx.h"
+
+// CMSIS 1.30 doesn't describe the DWT unit, so only the two registers used here are defined.
+#define DWT_CTRL                (*(volatile uint32_t *)0xE0001000UL)
+#define DWT_CYCCNT              (*(volatile uint32_t *)0xE0001004UL)
+#define DWT_CTRL_CYCCNTENA      (1UL << 0)
+
+/**
+ * @brief   Starts the cycle counter.
+ *
+ * @note    The DWT unit is part of the debug block, so trace has to be enabled first.
+ *          This doesn't need a debugger to be attached.
+ *
+ * @return  None
+ */
+void cycle_counter_init(void) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT_CYCCNT = 0;
+    DWT_CTRL |= DWT_CTRL_CYCCNTENA;
+}
+
+/**
+ * @brief   Returns the current cycle count, can be called from interrupts too.
+ *
+ * @return  Core clock cycles since cycle_counter_init().
+ */
+uint32_t cycle_counter_now(void) {
+    return DWT_CYCCNT;
+}
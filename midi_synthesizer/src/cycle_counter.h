@@ -0,0 +1,12 @@
+#ifndef CYCLE_COUNTER_H
+#define CYCLE_COUNTER_H
+
+#include <stdint.h>
+
+// Core clock cycle counter (DWT CYCCNT) for measuring how long code takes.
+// It wraps around after about 43 s at 100 MHz, so only differences of readings are meaningful.
+
+void cycle_counter_init(void);
+uint32_t cycle_counter_now(void);
+
+#endif
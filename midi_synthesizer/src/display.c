@@ -0,0 +1,92 @@
+#include "display.h"
+
+#include <stddef.h>
+
+#include "oled.h"
+
+#include "cycle_counter.h"
+
+// CPU cycles spent sending the framebuffer, split by context so each counter has only
+// one writer: the main loop and the DMA interrupt. With OLED_USE_I2C in oled.c the pages
+// go through the I2C bus queue (see i2cbus.c), its interrupt isn't counted here.
+static uint32_t main_cycles = 0;
+static volatile uint32_t interrupt_cycles = 0;
+
+// Number of flushes that have completed.
+static volatile uint32_t flush_count = 0;
+
+/**
+ * @brief   Counts a completed flush, called from the DMA or I2C interrupt.
+ *
+ * @return  None
+ */
+static void flush_done(void) {
+    flush_count++;
+}
+
+/**
+ * @brief   Switches the OLED to drawing into the framebuffer only.
+ *
+ * @note    oled_init() needs to be called before this function. DMA flushes also need
+ *          audio_init(), which sets up GPDMA and its interrupt.
+ *
+ * @return  None
+ */
+void display_init(void) {
+    cycle_counter_init();
+    oled_setAutoFlush(0);
+}
+
+/**
+ * @brief   Sends everything drawn since the last flush.
+ *
+ * @note    With DMA this returns right away. If the previous flush is still running the
+ *          changes stay pending and are sent by a later call.
+ *
+ * @return  None
+ */
+void display_flush(void) {
+    uint32_t start = cycle_counter_now();
+
+#ifdef DISPLAY_FLUSH_POLLING
+    oled_flush();
+    flush_done();
+#else
+    (void)oled_flushDma(flush_done);
+#endif
+
+    main_cycles += cycle_counter_now() - start;
+}
+
+/**
+ * @brief   Handles the OLED GPDMA channels, called from DMA_IRQHandler().
+ *
+ * @return  None
+ */
+void display_dma_interrupt(void) {
+    uint32_t start = cycle_counter_now();
+
+    oled_dmaIrqHandler();
+
+    interrupt_cycles += cycle_counter_now() - start;
+}
+
+/**
+ * @brief   Returns the CPU time spent on sending the framebuffer so far.
+ *
+ * @note    The value wraps around, use the difference of two readings.
+ *
+ * @return  Core clock cycles, both from the main loop and the DMA interrupt.
+ */
+uint32_t display_cycles(void) {
+    return main_cycles + interrupt_cycles;
+}
+
+/**
+ * @brief   Returns how many flushes have completed so far.
+ *
+ * @return  Number of flushes.
+ */
+uint32_t display_flush_count(void) {
+    return flush_count;
+}
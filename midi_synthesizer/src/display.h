@@ -0,0 +1,18 @@
+#ifndef DISPLAY_H
+#define DISPLAY_H
+
+#include <stdint.h>
+
+// Sends the OLED framebuffer to the display. Drawing (see menu.c and scope.c) only changes the
+// framebuffer, display_flush() is called periodically from the main loop to send what
+// has changed. By default the pages are sent by GPDMA in the background (or, with
+// OLED_USE_I2C in oled.c, through the I2C bus queue); define DISPLAY_FLUSH_POLLING to use
+// blocking transfers instead, e.g. to compare CPU time.
+
+void display_init(void);
+void display_flush(void);
+void display_dma_interrupt(void);
+uint32_t display_cycles(void);
+uint32_t display_flush_count(void);
+
+#endif
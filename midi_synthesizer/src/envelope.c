@@ -0,0 +1,211 @@
+#include "envelope.h"
+
+#include "audio.h"
+
+// Exponential segments end when they get within -60 dB of their target, segment times
+// are measured to that point.
+#define ENV_SILENCE_LEVEL       (ENV_LEVEL_MAX / 1000UL)
+
+#define MS_PER_SECOND           1000UL
+
+/**
+ * @brief   Converts a segment time to the number of blocks it takes.
+ *
+ * @param   time_ms     Time in milliseconds.
+ *
+ * @return  Number of blocks, rounded and at least one.
+ */
+static uint32_t blocks_from_ms(uint32_t time_ms) {
+    uint32_t ms = (time_ms > (uint32_t)ENV_TIME_MAX_MS) ? (uint32_t)ENV_TIME_MAX_MS : time_ms;
+    uint32_t samples_per_block_ms = MS_PER_SECOND * (uint32_t)AUDIO_BLOCK_SIZE;
+    uint32_t blocks = ((ms * (uint32_t)AUDIO_SAMPLE_RATE) + (samples_per_block_ms / 2U)) / samples_per_block_ms;
+
+    return (blocks == 0U) ? 1U : blocks;
+}
+
+/**
+ * @brief   Raises a Q31 number to an integer power by repeated squaring.
+ *
+ * @param   base        Q31 number, at most ENV_LEVEL_MAX.
+ * @param   exponent    Power.
+ *
+ * @return  Q31 result.
+ */
+static uint32_t power_q31(uint32_t base, uint32_t exponent) {
+    uint64_t result = ENV_LEVEL_MAX;
+    uint64_t square = base;
+    uint32_t remaining = exponent;
+
+    while (remaining != 0U) {
+        if ((remaining & 1U) != 0U) {
+            result = (result * square) >> 31;
+        }
+        square = (square * square) >> 31;
+        remaining >>= 1;
+    }
+
+    return (uint32_t)result;
+}
+
+/**
+ * @brief   Finds the per-block factor of an exponential segment.
+ *
+ * @note    Binary search for the largest factor that falls to ENV_SILENCE_LEVEL within the
+ *          given number of blocks. Costs about a thousand multiplications, which is fine
+ *          when parameters change but not per block.
+ *
+ * @param   blocks  Length of the segment in blocks.
+ *
+ * @return  Q31 factor.
+ */
+static uint32_t factor_from_blocks(uint32_t blocks) {
+    uint32_t low = 0;
+    uint32_t high = ENV_LEVEL_MAX;
+
+    while ((high - low) > 1U) {
+        uint32_t middle = low + ((high - low) / 2U);
+        if (power_q31(middle, blocks) <= ENV_SILENCE_LEVEL) {
+            low = middle;
+        } else {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
+/**
+ * @brief   Precalculates envelope rates.
+ *
+ * @note    Attack time is the rise from silence to full scale. Decay and release times are
+ *          the time to fall by 60 dB of full scale. Times are rounded to whole blocks
+ *          (AUDIO_BLOCK_SIZE samples), a zero time still takes one block so it doesn't click.
+ *
+ * @param   params      Parameters to fill.
+ * @param   attack_ms   Attack time in milliseconds.
+ * @param   decay_ms    Decay time in milliseconds.
+ * @param   sustain     Q8 sustain level, from 0 to ENV_SUSTAIN_MAX.
+ * @param   release_ms  Release time in milliseconds.
+ *
+ * @return  None
+ */
+void env_set_params(struct EnvelopeParams *params, uint32_t attack_ms, uint32_t decay_ms,
+                    uint32_t sustain, uint32_t release_ms) {
+    uint32_t attack_blocks = blocks_from_ms(attack_ms);
+
+    // Round the step up, so full scale is reached in exactly attack_blocks blocks.
+    params->attack_step = (ENV_LEVEL_MAX + attack_blocks - 1U) / attack_blocks;
+    params->decay_factor = factor_from_blocks(blocks_from_ms(decay_ms));
+    params->release_factor = factor_from_blocks(blocks_from_ms(release_ms));
+    if (sustain >= (uint32_t)ENV_SUSTAIN_MAX) {
+        params->sustain = ENV_LEVEL_MAX;
+    } else {
+        params->sustain = sustain << (31 - 8);
+    }
+}
+
+/**
+ * @brief   Silences the envelope.
+ *
+ * @param   env     Pointer to the envelope.
+ *
+ * @return  None
+ */
+void env_init(struct Envelope *env) {
+    env->stage = ENV_STAGE_IDLE;
+    env->level = 0;
+}
+
+/**
+ * @brief   Starts the attack from the current level, so retriggered notes don't click.
+ *
+ * @param   env     Pointer to the envelope.
+ *
+ * @return  None
+ */
+void env_gate_on(struct Envelope *env) {
+    env->stage = ENV_STAGE_ATTACK;
+}
+
+/**
+ * @brief   Starts the release from the current level.
+ *
+ * @param   env     Pointer to the envelope.
+ *
+ * @return  None
+ */
+void env_gate_off(struct Envelope *env) {
+    if (env->stage != ENV_STAGE_IDLE) {
+        env->stage = ENV_STAGE_RELEASE;
+    }
+}
+
+/**
+ * @brief   Advances the envelope by one block.
+ *
+ * @note    The caller ramps its gain linearly from the previous level to the returned one
+ *          over the block, so there are no steps in the output.
+ *
+ * @param   env     Pointer to the envelope.
+ * @param   params  Segment rates.
+ *
+ * @return  Q31 level at the end of the block.
+ */
+uint32_t env_next_block(struct Envelope *env, const struct EnvelopeParams *params) {
+    uint32_t level = env->level;
+
+    switch (env->stage) {
+        case ENV_STAGE_ATTACK:
+            if ((ENV_LEVEL_MAX - level) <= params->attack_step) {
+                level = ENV_LEVEL_MAX;
+                env->stage = ENV_STAGE_DECAY;
+            } else {
+                level += params->attack_step;
+            }
+            break;
+        case ENV_STAGE_DECAY:
+            if (level <= params->sustain) {
+                // Sustain is above the current level, e.g. after a retrigger.
+                level = params->sustain;
+                env->stage = ENV_STAGE_SUSTAIN;
+            } else {
+                uint32_t distance = level - params->sustain;
+                distance = (uint32_t)(((uint64_t)distance * params->decay_factor) >> 31);
+                if (distance <= ENV_SILENCE_LEVEL) {
+                    level = params->sustain;
+                    env->stage = ENV_STAGE_SUSTAIN;
+                } else {
+                    level = params->sustain + distance;
+                }
+            }
+            break;
+        case ENV_STAGE_SUSTAIN:
+            // Sustain may have been changed in the meantime.
+            level = params->sustain;
+            break;
+        case ENV_STAGE_RELEASE:
+            level = (uint32_t)(((uint64_t)level * params->release_factor) >> 31);
+            if (level <= ENV_SILENCE_LEVEL) {
+                level = 0;
+                env->stage = ENV_STAGE_IDLE;
+            }
+            break;
+        default:
+            level = 0;
+            break;
+    }
+
+    env->level = level;
+    return level;
+}
+
+/**
+ * @brief   Checks if the envelope has finished its release.
+ *
+ * @param   env     Pointer to the envelope.
+ *
+ * @return  bool    true if the envelope is silent.
+ */
+bool env_is_idle(const struct Envelope *env) {
+    return env->stage == ENV_STAGE_IDLE;
+}
@@ -0,0 +1,50 @@
+#ifndef ENVELOPE_H
+#define ENVELOPE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ADSR amplitude envelope, advanced once per audio block.
+// Attack rises linearly, decay and release fall exponentially. Each segment costs one
+// add or one 32x32 bit multiply per block; all divisions happen when the parameters are set.
+// This module doesn't touch any peripherals, so it can also be compiled and tested on a PC.
+
+// Envelope level is in Q31, ENV_LEVEL_MAX means full scale.
+#define ENV_LEVEL_MAX           (1UL << 31)
+
+// Sustain level is in Q8 like the voice level, ENV_SUSTAIN_MAX means full scale.
+#define ENV_SUSTAIN_MAX         256
+
+// Segment times are clamped to this, so the conversion to blocks can't overflow.
+#define ENV_TIME_MAX_MS         10000
+
+enum EnvelopeStage {
+    ENV_STAGE_IDLE,
+    ENV_STAGE_ATTACK,
+    ENV_STAGE_DECAY,
+    ENV_STAGE_SUSTAIN,
+    ENV_STAGE_RELEASE,
+};
+
+// Precalculated segment rates, shared by all voices playing the same sound.
+struct EnvelopeParams {
+    uint32_t attack_step;       // Q31 level added every block.
+    uint32_t decay_factor;      // Q31 factor applied to the distance to sustain every block.
+    uint32_t sustain;           // Q31 level.
+    uint32_t release_factor;    // Q31 factor applied to the level every block.
+};
+
+struct Envelope {
+    enum EnvelopeStage stage;
+    uint32_t level;         // Q31 level at the end of the last block.
+};
+
+void env_set_params(struct EnvelopeParams *params, uint32_t attack_ms, uint32_t decay_ms,
+                    uint32_t sustain, uint32_t release_ms);
+void env_init(struct Envelope *env);
+void env_gate_on(struct Envelope *env);
+void env_gate_off(struct Envelope *env);
+uint32_t env_next_block(struct Envelope *env, const struct EnvelopeParams *params);
+bool env_is_idle(const struct Envelope *env);
+
+#endif
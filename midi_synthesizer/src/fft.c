@@ -0,0 +1,102 @@
+#include "fft.h"
+
+#include "wavetables.h"
+
+// wavetable_sine index of a quarter period, cos(x) = sin(x + pi / 2).
+#define QUARTER_PERIOD          (WAVE_SAMPLES_COUNT / 4)
+
+/**
+ * @brief   Reorders the points into bit-reversed index order.
+ *
+ * @param   re      Real parts.
+ * @param   im      Imaginary parts.
+ * @param   size    Number of points, a power of two.
+ *
+ * @return  None
+ */
+static void bit_reverse(int16_t *re, int16_t *im, uint32_t size) {
+    uint32_t j = 0;
+
+    for (uint32_t i = 0; i < size; i++) {
+        if (i < j) {
+            int16_t tmp = re[i];
+            re[i] = re[j];
+            re[j] = tmp;
+            tmp = im[i];
+            im[i] = im[j];
+            im[j] = tmp;
+        }
+
+        // Increment j with the bits in reverse order.
+        uint32_t bit = size >> 1;
+        while ((bit > 0U) && ((j & bit) != 0U)) {
+            j ^= bit;
+            bit >>= 1;
+        }
+        j |= bit;
+    }
+}
+
+/**
+ * @brief   Transforms Q15 points in place into their spectrum.
+ *
+ * @note    Every stage halves its outputs, so nothing can overflow and the result is the
+ *          spectrum divided by the number of points: a full scale sine gives 0.5 in its bin.
+ *
+ * @param   re          Real parts, replaced with the real parts of the spectrum.
+ * @param   im          Imaginary parts, replaced with the imaginary parts of the spectrum.
+ * @param   log2_size   Log2 of the number of points, at most WAVE_SAMPLES_COUNT_LOG2.
+ *
+ * @return  None
+ */
+void fft_q15(int16_t *re, int16_t *im, uint32_t log2_size) {
+    uint32_t size = 1UL << log2_size;
+
+    bit_reverse(re, im, size);
+
+    for (uint32_t stage = 1; stage <= log2_size; stage++) {
+        uint32_t half = 1UL << (stage - 1U);
+        // Twiddle k of this stage is e^(-2 pi i k / (2 * half)).
+        uint32_t step = (uint32_t)WAVE_SAMPLES_COUNT >> stage;
+
+        for (uint32_t k = 0; k < half; k++) {
+            uint32_t phase = k * step;
+            int32_t w_re = wavetable_sine[(phase + QUARTER_PERIOD) & (WAVE_SAMPLES_COUNT - 1U)];
+            int32_t w_im = -wavetable_sine[phase];
+
+            for (uint32_t i = k; i < size; i += half << 1) {
+                uint32_t j = i + half;
+                int32_t t_re = ((re[j] * w_re) - (im[j] * w_im)) >> 15;
+                int32_t t_im = ((re[j] * w_im) + (im[j] * w_re)) >> 15;
+
+                re[j] = (int16_t)((re[i] - t_re) >> 1);
+                im[j] = (int16_t)((im[i] - t_im) >> 1);
+                re[i] = (int16_t)((re[i] + t_re) >> 1);
+                im[i] = (int16_t)((im[i] + t_im) >> 1);
+            }
+        }
+    }
+}
+
+/**
+ * @brief   Computes the magnitudes of complex points.
+ *
+ * @note    Uses the max + 3/8 min approximation of the square root, which is within 7 %
+ *          and good enough for drawing.
+ *
+ * @param   re          Real parts.
+ * @param   im          Imaginary parts.
+ * @param   magnitudes  Buffer for the magnitudes.
+ * @param   count       Number of points.
+ *
+ * @return  None
+ */
+void fft_magnitudes(const int16_t *re, const int16_t *im, uint16_t *magnitudes, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t a = (uint32_t)((re[i] < 0) ? -re[i] : re[i]);
+        uint32_t b = (uint32_t)((im[i] < 0) ? -im[i] : im[i]);
+        uint32_t max = (a > b) ? a : b;
+        uint32_t min = (a > b) ? b : a;
+        magnitudes[i] = (uint16_t)(max + ((3U * min) >> 3));
+    }
+}
@@ -0,0 +1,13 @@
+#ifndef FFT_H
+#define FFT_H
+
+#include <stdint.h>
+
+// Fixed-point radix-2 FFT. The twiddle factors are taken from wavetable_sine, so the
+// size can be up to WAVE_SAMPLES_COUNT points. This module doesn't touch any peripherals,
+// so it can also be compiled and tested on a PC.
+
+void fft_q15(int16_t *re, int16_t *im, uint32_t log2_size);
+void fft_magnitudes(const int16_t *re, const int16_t *im, uint16_t *magnitudes, uint32_t count);
+
+#endif
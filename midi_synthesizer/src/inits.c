@@ -9,10 +9,22 @@
 #include "lpc17xx_ssp.h"
 #include "lpc17xx_timer.h"
 
+#include "i2cbus.h"
 #include "utils.h"
 
 #define UART_DEV LPC_UART3
 
+// All devices on the base board I2C bus support fast mode, define I2C_FAST_MODE to use it.
+#ifdef I2C_FAST_MODE
+#define I2C_CLOCK_HZ            400000
+#else
+#define I2C_CLOCK_HZ            100000
+#endif
+
+// The I2C transfers are queued and sent from the I2C2 interrupt (see i2cbus.c). They aren't
+// time critical, so this is below the audio and MIDI interrupts.
+#define I2C_IRQ_PRIORITY        3
+
 /**
  * @brief Initialize UART.
  *
@@ -42,7 +54,7 @@ void init_uart(void) {
 }
 
 /**
- * @brief Initialize I2C.
+ * @brief Initialize I2C and the queue the base board drivers share it through.
  *
  * @return None
  */
@@ -58,10 +70,13 @@ void init_i2c(void) {
     PINSEL_ConfigPin(&PinCfg);
 
     // Initialize I2C peripheral
-    I2C_Init(LPC_I2C2, 100000);
+    I2C_Init(LPC_I2C2, I2C_CLOCK_HZ);
 
     /* Enable I2C1 operation */
     I2C_Cmd(LPC_I2C2, ENABLE);
+
+    NVIC_SetPriority(I2C2_IRQn, I2C_IRQ_PRIORITY);
+    i2cbus_init();
 }
 
 /**
@@ -140,63 +155,3 @@ void init_amplifier(void) {
     GPIO_ClearValue(0, 1UL<<28); //LM4811-up/dn AMP digital control signal
     GPIO_ClearValue(2, 1UL<<13); //LM4811-shutdn AMP shutdown control signal
 }
-
-/**
- * @brief Initialize DMA with given parameters.
- *
- * @note This function sets up the channel 0 of DMA and sends the values from the sine wave array to DAC.
- *
- * @param DMA_LLI_Struct                    Pointer to a DMA_LLI_Type structure
- * @param GPDMACfg                          Pointer to a GPDMA_ChannelCFG_Type structure
- * @param DAC_ConverterConfigStruct         Pointer to a DAC_CONVERTER_CFG_Type structure
- * @param dac_wave_lut                      Pointer to an array of values
- * @param dma_size                          Size of the array
- * @param initial_wave_frequency            The default frequency of the sine wave
- *
- * @return None
- */
-void dac_dma_setup(GPDMA_LLI_Type* DMA_LLI_Struct, GPDMA_Channel_CFG_Type* GPDMACfg, DAC_CONVERTER_CFG_Type* DAC_ConverterConfigStruct, uint32_t* dac_wave_lut, uint32_t dma_size, uint32_t initial_wave_frequency) {
-    /* GPDMA block section -------------------------------------------- */
-    /* Initialize GPDMA controller */
-    GPDMA_Init();
-
-    //Prepare DMA link list item structure
-    DMA_LLI_Struct->SrcAddr= dac_wave_lut; // This line will either trigger warning from compiler or MISRA :(
-    DMA_LLI_Struct->DstAddr= (uint32_t)&(LPC_DAC->DACR);
-    DMA_LLI_Struct->NextLLI= (uint32_t)DMA_LLI_Struct;
-    DMA_LLI_Struct->Control= dma_size
-                            | (2UL<<18) //source width 32 bit
-                            | (2UL<<21) //dest. width 32 bit
-                            | (1UL<<26) //source increment
-                            ;
-
-    // Setup GPDMA channel --------------------------------
-    // channel 0
-    GPDMACfg->ChannelNum = 0;
-    // Source memory
-    GPDMACfg->SrcMemAddr = dac_wave_lut;
-    // Destination memory - unused
-    GPDMACfg->DstMemAddr = 0;
-    // Transfer size
-    GPDMACfg->TransferSize = dma_size;
-    // Transfer width - unused
-    GPDMACfg->TransferWidth = 0;
-    // Transfer type
-    GPDMACfg->TransferType = GPDMA_TRANSFERTYPE_M2P;
-    // Source connection - unused
-    GPDMACfg->SrcConn = 0;
-    // Destination connection
-    GPDMACfg->DstConn = GPDMA_CONN_DAC;
-    // Linker List Item - unused
-    GPDMACfg->DMALLI = (uint32_t)DMA_LLI_Struct;
-    // Setup channel with given parameter
-    GPDMA_Setup(GPDMACfg);
-
-    DAC_ConverterConfigStruct->CNT_ENA = SET;
-    DAC_ConverterConfigStruct->DMA_ENA = SET;
-    dac_update_frequency(initial_wave_frequency);
-    DAC_ConfigDAConverterControl(LPC_DAC, DAC_ConverterConfigStruct);
-
-    // Enable GPDMA channel 0
-    GPDMA_ChannelCmd(0, ENABLE);
-}
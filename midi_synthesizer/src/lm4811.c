@@ -0,0 +1,81 @@
+#include "lm4811.h"
+
+/**
+ * @brief   Resets the model to an unknown amplifier level.
+ *
+ * @note    Both pins are expected to be low, which is how init_amplifier() leaves them.
+ *
+ * @param   amp     Pointer to the model.
+ * @param   target  Level to go to after calibration, from 0 to LM4811_LEVEL_MAX.
+ *
+ * @return  None
+ */
+void lm4811_init(struct Lm4811 *amp, uint8_t target) {
+    // Counting down from the top guarantees level 0 wherever the amplifier really is.
+    amp->level = LM4811_LEVEL_MAX;
+    amp->calibrating = true;
+    amp->up = false;
+    amp->clock = false;
+    lm4811_set_target(amp, target);
+}
+
+/**
+ * @brief   Sets the level the amplifier should go to. Doesn't block.
+ *
+ * @param   amp     Pointer to the model.
+ * @param   target  Level from 0 to LM4811_LEVEL_MAX, higher levels are clamped.
+ *
+ * @return  None
+ */
+void lm4811_set_target(struct Lm4811 *amp, uint8_t target) {
+    amp->target = (target > (uint8_t)LM4811_LEVEL_MAX) ? (uint8_t)LM4811_LEVEL_MAX : target;
+}
+
+/**
+ * @brief   Advances the pulse sequence by one tick.
+ *
+ * @note    The caller copies `up` and `clock` to the pins after every call.
+ *
+ * @param   amp     Pointer to the model.
+ *
+ * @return  bool    true if the sequence is still running, false if the amplifier is at
+ *                  its target and both pins can stay as they are.
+ */
+bool lm4811_tick(struct Lm4811 *amp) {
+    uint8_t goal = amp->calibrating ? 0U : amp->target;
+
+    if (amp->clock) {
+        // The step happened on the rising edge, end the pulse.
+        amp->clock = false;
+    } else if (amp->level != goal) {
+        bool up = (amp->level < goal);
+        if (up != amp->up) {
+            // Direction has to be stable before the clock edge.
+            amp->up = up;
+        } else {
+            amp->clock = true;
+            if (up) {
+                amp->level++;
+            } else {
+                amp->level--;
+            }
+        }
+    } else if (amp->calibrating) {
+        amp->calibrating = false;
+    } else {
+        // At the target.
+    }
+
+    return !lm4811_is_settled(amp);
+}
+
+/**
+ * @brief   Checks if the amplifier has reached its target.
+ *
+ * @param   amp     Pointer to the model.
+ *
+ * @return  bool    true if no more pulses are needed.
+ */
+bool lm4811_is_settled(const struct Lm4811 *amp) {
+    return !amp->calibrating && !amp->clock && (amp->level == amp->target);
+}
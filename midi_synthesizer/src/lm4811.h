@@ -0,0 +1,32 @@
+#ifndef LM4811_H
+#define LM4811_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Pulse sequence for the LM4811 amplifier volume control.
+// The amplifier changes its gain by one step on every rising CLK edge, up or down depending
+// on the UP/DN pin, and stays at the end of its range if stepped further. There is no way
+// to read the gain back, so the level is tracked here and the first move after init goes
+// down through the whole range to reach a known level.
+// Every call of lm4811_tick() is one timer tick and changes at most one pin: UP/DN is set a
+// tick before the edge, CLK is high for one tick and low for at least one. Steps in the same
+// direction reuse UP/DN, so several level changes coalesce into one pulse train.
+// This module doesn't touch any peripherals, so it can also be compiled and tested on a PC.
+
+#define LM4811_LEVEL_MAX        15
+
+struct Lm4811 {
+    volatile uint8_t target;    // Written from the main loop.
+    uint8_t level;              // Level the amplifier is at, as far as we know.
+    bool calibrating;           // Going down to level 0 after init.
+    bool up;                    // State of the UP/DN pin, true is up.
+    bool clock;                 // State of the CLK pin.
+};
+
+void lm4811_init(struct Lm4811 *amp, uint8_t target);
+void lm4811_set_target(struct Lm4811 *amp, uint8_t target);
+bool lm4811_tick(struct Lm4811 *amp);
+bool lm4811_is_settled(const struct Lm4811 *amp);
+
+#endif
@@ -17,210 +17,440 @@
 
 #include "inits.h"
 #include "utils.h"
+#include "audio.h"
+#include "synth.h"
+#include "midi_uart.h"
+#include "amplifier.h"
+#include "sched.h"
+#include "sched_systick.h"
 #include "pca_leds.h"
+#include "display.h"
+#include "menu.h"
+#include "scope.h"
+#include "vu_meter.h"
+#include "settings.h"
 #include <stdbool.h>
 #include <stdint.h>
 
 // -------- AUDIO MACROS --------
-#define DMA_SIZE                60
 #define WAVE_FREQUENCY_INITIAL  440
 #define WAVE_FREQUENCY_MIN      10
 #define WAVE_FREQUENCY_MAX      800
 #define VOLUME_INITIAL          10
 #define VOLUME_MIN              0
-#define VOLUME_MAX              15
+#define VOLUME_MAX              (SYNTH_VOLUME_STEPS - 1)
 
 // -------- LIGHT MACROS --------
 #define LIGHT_MODE_THRESHOLD    200
 
+// -------- SCHEDULER MACROS --------
+// Periods of the main loop tasks in milliseconds.
+#define INPUT_PERIOD_MS         5
+#define LIGHT_PERIOD_MS         250
+#define STATS_PERIOD_MS         5000
+// Drawing changes are sent to the OLED at most 50 times per second.
+#define DISPLAY_PERIOD_MS       20
+// The scope view is redrawn about 20 times per second.
+#define SCOPE_PERIOD_MS         50
+// Changed settings are saved once they have been left alone for SETTINGS_QUIET_TICKS.
+#define SETTINGS_PERIOD_MS      100
+
 #define UART_DEV LPC_UART3
 
-// Structure containing parameteres saved and read from EEPROM.
-struct EepromData {
+// Settings of earlier firmware versions, a single copy at a fixed offset of the EEPROM.
+// Only read at boot when the settings log is empty, to take them over.
+struct LegacyEepromData {
     int wave_frequency;
     int volume_level;
 };
+#define LEGACY_EEPROM_OFFSET    240
+
+// State shared by the tasks below, they all run from the scheduler in the main loop.
+static struct Scheduler scheduler;
+static struct Settings settings;
+static int wave_frequency = WAVE_FREQUENCY_INITIAL;
+static int volume_level = VOLUME_INITIAL;
+static enum MenuEntry active_menu_entry = MENU_ENTRY_FREQUENCY;
+static bool is_dark_mode = false;
+// Last light sensor value, -1 before the first read and after a failed one. Written from the
+// I2C interrupt by light_read_done().
+static volatile int32_t light_value = -1;
+static uint32_t last_display_cycles = 0;
+static uint8_t last_joystick_value = 0;
+static bool is_scope_view = false;
+static int32_t scope_task_id = SCHED_TASK_NONE;
+// The LEDs show the output level, or the chase when switched with the joystick.
+static bool is_led_meter = true;
+static int32_t led_task_id = SCHED_TASK_NONE;
+
+/**
+ * @brief   Draws the last audio capture and starts the next one.
+ *
+ * @note    Only scheduled while the scope view is shown. The capture takes a few blocks,
+ *          so it has always completed by the next run.
+ *
+ * @return  None
+ */
+static void scope_task(void) {
+    if (scope_is_ready()) {
+        scope_analyze();
+        scope_draw(is_dark_mode);
+        scope_arm();
+    }
+}
 
-// -------- VARIABLES FOR PROGRAM STATE --------
-// These structs need to be global, if we put them inside main() they will not work.
-// MISRA will complain about this (rule 8.9), saying that we should put them inside
-// main(), but we can't do that.
-static GPDMA_Channel_CFG_Type GPDMACfg = {0};
-static GPDMA_LLI_Type DMA_LLI_Struct = {0};
-static DAC_CONVERTER_CFG_Type DAC_ConverterConfigStruct = {0};
+static void led_task(void);
+
+/**
+ * @brief   Switches the LEDs between the level meter and the chase.
+ *
+ * @note    The LED task runs again right away, the chase may be waiting for a slow step.
+ *
+ * @param   enable  Show the level meter.
+ *
+ * @return  None
+ */
+static void set_led_meter(bool enable) {
+    if (enable == is_led_meter) {
+        return;
+    }
+    is_led_meter = enable;
+    sched_cancel(&scheduler, led_task_id);
+    led_task_id = sched_add_once(&scheduler, led_task, sched_systick_now(), 0);
+}
 
-int main(void) {
-    // Lookup table for DAC.
-    uint32_t wave_lut[WAVE_SAMPLES_COUNT] = {0};
+/**
+ * @brief   Switches the screen between the menu and the scope view.
+ *
+ * @param   enable  Show the scope view.
+ *
+ * @return  None
+ */
+static void set_scope_view(bool enable) {
+    is_scope_view = enable;
+    if (enable) {
+        scope_arm();
+        scope_task_id = sched_add_periodic(&scheduler, scope_task, sched_systick_now(), SCOPE_PERIOD_MS);
+    } else {
+        sched_cancel(&scheduler, scope_task_id);
+        scope_task_id = SCHED_TASK_NONE;
+        // The scope has drawn over the whole menu.
+        menu_invalidate();
+    }
+}
 
-    // -------- INITIALIZE PERIPHERALS --------
-    init_i2c();
-    init_ssp();
-    init_uart();
-    // init_amplifier() needs to be called before init_dac().
-    init_amplifier();
-    init_dac();
+/**
+ * @brief   Reads joystick, rotary encoder and buttons and applies them to the menu and synth.
+ *
+ * @return  None
+ */
+static void input_task(void) {
+    bool frequency_changed = false;
+    bool volume_changed = false;
+
+    // Read input.
+    uint8_t joystick_value = joystick_read();
+    uint8_t rotary_value = rotary_read();
+
+    enum MenuEntry last_active_menu_entry = active_menu_entry;
+
+    // Check joystick input.
+    if (BITWISE_AND(joystick_value, JOYSTICK_UP)) {
+        active_menu_entry++;
+        active_menu_entry = (active_menu_entry) % MENU_ENTRY_COUNT;
+    }
+    if (BITWISE_AND(joystick_value, JOYSTICK_DOWN)) {
+        active_menu_entry--;
+        active_menu_entry = (active_menu_entry) % MENU_ENTRY_COUNT;
+    }
 
-    rotary_init();
-    oled_init();
-    pca9532_init();
-    joystick_init();
-    eeprom_init();
+    // Pressing the joystick toggles the scope view, holding it doesn't toggle again.
+    if (BITWISE_AND(joystick_value, JOYSTICK_CENTER) && !BITWISE_AND(last_joystick_value, JOYSTICK_CENTER)) {
+        set_scope_view(!is_scope_view);
+    }
+    last_joystick_value = joystick_value;
 
-    light_init();
-    light_enable();
-    light_setRange(LIGHT_RANGE_4000);
+    // Left shows the chase on the LEDs, right the level meter.
+    if (BITWISE_AND(joystick_value, JOYSTICK_LEFT)) {
+        set_led_meter(false);
+    }
+    if (BITWISE_AND(joystick_value, JOYSTICK_RIGHT)) {
+        set_led_meter(true);
+    }
 
-    lut_fill_with_sine(wave_lut);
-
-    // Read data from EEPROM
-    struct EepromData eeprom_data = {0};
-    int eeprom_offset = 240;
-    int len = eeprom_read((uint8_t*)&eeprom_data, eeprom_offset, sizeof(eeprom_data));
-    // If we didn't succesfully read data from EEPROM, or the read data is garbage - use default values.
-    if ((len != (int)sizeof(eeprom_data)) ||
-        (eeprom_data.wave_frequency < WAVE_FREQUENCY_MIN) || (eeprom_data.wave_frequency > WAVE_FREQUENCY_MAX) ||
-        (eeprom_data.volume_level < VOLUME_MIN) || (eeprom_data.volume_level > VOLUME_MAX))
-    {
-        UART_SendString(UART_DEV, (const uint8_t*)"EEPROM: Invalid data, using defaults\r\n");
-        eeprom_data.wave_frequency = WAVE_FREQUENCY_INITIAL;
-        eeprom_data.volume_level = VOLUME_INITIAL;
-    } else {
-        UART_SendString(UART_DEV, (const uint8_t*)"EEPROM: Data read succesfully\r\n");
+    // Only the rows of the old and the new selection are redrawn.
+    if (active_menu_entry != last_active_menu_entry) {
+        menu_select(active_menu_entry);
     }
 
-    int wave_frequency = eeprom_data.wave_frequency;
-    int volume_level = eeprom_data.volume_level;
+    // Depending on active menu entry, we check rotary input and change corresponding parameter.
+    switch (active_menu_entry) {
+        case MENU_ENTRY_FREQUENCY:
+            if (rotary_value == ROTARY_LEFT) {
+                if (wave_frequency > WAVE_FREQUENCY_MIN) {
+                    wave_frequency -= 10;
+                }
+                frequency_changed = true;
+            } else if (rotary_value == ROTARY_RIGHT) {
+                if (wave_frequency < WAVE_FREQUENCY_MAX) {
+                    wave_frequency += 10;
+                }
+                frequency_changed = true;
+            } else {
+                // If there was no rotary movement, we don't do anything.
+            }
+            break;
+        case MENU_ENTRY_VOLUME:
+            if (rotary_value == ROTARY_LEFT) {
+                if (volume_level > VOLUME_MIN) {
+                    volume_level -= 1;
+                }
+                volume_changed = true;
+            } else if (rotary_value == ROTARY_RIGHT) {
+                if (volume_level < VOLUME_MAX) {
+                    volume_level += 1;
+                }
+                volume_changed = true;
+            } else {
+                // If there was no rotary movement, we don't do anything.
+            }
+            break;
+        default:
+            break;
+    }
 
-    // -------- SETUP DAC - DMA TRANSFER --------
-    dac_dma_setup(&DMA_LLI_Struct, &GPDMACfg, &DAC_ConverterConfigStruct, wave_lut, DMA_SIZE, wave_frequency);
+    if (frequency_changed) {
+        menu_set_value(MENU_ENTRY_FREQUENCY, wave_frequency);
 
-    reset_volume(volume_level);
+        synth_voice_set_frequency(SYNTH_PANEL_VOICE, (uint32_t)wave_frequency);
 
-    // Variables used for animating LED lights.
-    int led_counter = 0;
-    unsigned int led_index = 0;
+        settings_set(&settings, SETTING_FREQUENCY, (int16_t)wave_frequency, sched_systick_now());
+    }
 
-    // Index of currently selected menu option
-    enum MenuEntry active_menu_entry = MENU_ENTRY_FREQUENCY;
+    if (volume_changed) {
+        menu_set_value(MENU_ENTRY_VOLUME, volume_level);
 
-    // -------- PREPARE DISPLAY --------
-    bool is_dark_mode = light_read() < LIGHT_MODE_THRESHOLD;
-    refresh_screen(is_dark_mode, true, wave_frequency, volume_level, active_menu_entry, REDRAW_ALL);
+        synth_set_volume((uint32_t)volume_level);
 
-    for (;;) {
-        bool frequency_changed = false;
-        bool volume_changed = false;
+        settings_set(&settings, SETTING_VOLUME, (int16_t)volume_level, sched_systick_now());
+    }
 
-        // Read input.
-        uint8_t joystick_value = joystick_read();
-        uint8_t rotary_value = rotary_read();
+    // Read button input and mute / play sound if necessary.
+    // Both fade over a few blocks, so they don't click.
+    if (button_left_is_pressed()) {
+        synth_set_mute(true);
+    }
+    if (button_right_is_pressed()) {
+        synth_set_mute(false);
+    }
+}
 
-        enum MenuEntry last_active_menu_entry = active_menu_entry;
+/**
+ * @brief   Stores the light sensor value, called from the I2C interrupt.
+ *
+ * @param   lux     Sensor value, -1 if it couldn't be read.
+ *
+ * @return  None
+ */
+static void light_read_done(int32_t lux) {
+    light_value = lux;
+}
 
-        // Check joystick input.
-        if (BITWISE_AND(joystick_value, JOYSTICK_UP)) {
-            active_menu_entry++;
-            active_menu_entry = (active_menu_entry) % MENU_ENTRY_COUNT;
-        }
-        if (BITWISE_AND(joystick_value, JOYSTICK_DOWN)) {
-            active_menu_entry--;
-            active_menu_entry = (active_menu_entry) % MENU_ENTRY_COUNT;
-        }
+/**
+ * @brief   Switches between dark and light mode depending on the ambient light.
+ *
+ * @note    Uses the value read in the background since the last run and starts the next
+ *          read, so the task never waits for the I2C bus.
+ *
+ * @return  None
+ */
+static void light_task(void) {
+    bool was_dark_mode = is_dark_mode;
+    int32_t lux = light_value;
+
+    (void)light_readAsync(light_read_done);
+    if (lux < 0) {
+        return;
+    }
+    is_dark_mode = lux < LIGHT_MODE_THRESHOLD;
 
-        // If active menu entry has changed - redraw screen.
-        if (active_menu_entry != last_active_menu_entry) {
-            refresh_screen(is_dark_mode, false, wave_frequency, volume_level, active_menu_entry, REDRAW_ALL);
-        }
+    // If light mode has changed, the whole screen is redrawn.
+    if (was_dark_mode != is_dark_mode) {
+        menu_set_dark_mode(is_dark_mode);
+    }
+}
 
-        // Depending on active menu entry, we check rotary input and change corresponding parameter.
-        switch (active_menu_entry) {
-            case MENU_ENTRY_FREQUENCY:
-                if (rotary_value == ROTARY_LEFT) {
-                    if (wave_frequency > WAVE_FREQUENCY_MIN) {
-                        wave_frequency -= 10;
-                    }
-                    frequency_changed = true;
-                } else if (rotary_value == ROTARY_RIGHT) {
-                    if (wave_frequency < WAVE_FREQUENCY_MAX) {
-                        wave_frequency += 10;
-                    }
-                    frequency_changed = true;
-                } else {
-                    // If there was no rotary movement, we don't do anything.
-                }
-                break;
-            case MENU_ENTRY_VOLUME:
-                if (rotary_value == ROTARY_LEFT) {
-                    if (volume_level > VOLUME_MIN) {
-                        volume_level -= 1;
-                        volume_down();
-                    }
-                    volume_changed = true;
-                } else if (rotary_value == ROTARY_RIGHT) {
-                    if (volume_level < VOLUME_MAX) {
-                        volume_level += 1;
-                        volume_up();
-                    }
-                    volume_changed = true;
-                } else {
-                    // If there was no rotary movement, we don't do anything.
-                }
-                break;
-            default:
-                break;
-        }
+/**
+ * @brief   Updates the LED level meter, or moves the LED chase by one step.
+ *
+ * @note    One-shot task that adds itself again. The meter is updated every
+ *          VU_METER_PERIOD_MS. The chase speed follows the frequency: from one step per
+ *          millisecond at the highest frequency to one step in about 0.8 s at the lowest.
+ *          At the top few frequencies the PCA9532 blink engines take the chase over and
+ *          the task only checks the frequency.
+ *
+ * @return  None
+ */
+static void led_task(void) {
+    uint32_t delay;
+
+    if (is_led_meter) {
+        struct VuLevels levels;
+        vu_meter_read(&levels);
+        set_leds_vu(levels.rms, levels.peak);
+        delay = VU_METER_PERIOD_MS;
+    } else {
+        uint32_t step_ms = (uint32_t)(WAVE_FREQUENCY_MAX + 1 - wave_frequency);
+        delay = leds_chase(step_ms);
+    }
+    led_task_id = sched_add_once(&scheduler, led_task, sched_systick_now(), delay);
+}
 
-        if (frequency_changed) {
-            refresh_screen(is_dark_mode, false, wave_frequency, volume_level, active_menu_entry, REDRAW_FREQUENCY);
+/**
+ * @brief   Draws the menu changes made since the last run and sends them to the screen.
+ *
+ * @note    Tasks only change the menu state, so several changes in one period are drawn
+ *          and sent once.
+ *
+ * @return  None
+ */
+static void display_task(void) {
+    // The scope view draws itself from scope_task().
+    if (!is_scope_view) {
+        (void)menu_render();
+    }
+    display_flush();
+}
 
-            dac_update_frequency(wave_frequency);
+/**
+ * @brief   Saves the settings to the EEPROM once they have stopped changing.
+ *
+ * @return  None
+ */
+static void settings_task(void) {
+    if (settings_poll(&settings, sched_systick_now()) == SETTINGS_POLL_FAILED) {
+        UART_SendString(UART_DEV, (const uint8_t*)"EEPROM: Failed to write data\r\n");
+    }
+}
 
-            eeprom_data.wave_frequency = wave_frequency;
-            len = eeprom_write((uint8_t*)&eeprom_data, eeprom_offset, sizeof(eeprom_data));
-            if (len != (int)sizeof(eeprom_data)) {
-                UART_SendString(UART_DEV, (const uint8_t*)"EEPROM: Failed to write data\r\n");
-            }
+/**
+ * @brief   Reads the settings from the EEPROM, falling back to the defaults.
+ *
+ * @note    If the settings log is empty, settings saved by an earlier firmware version are
+ *          taken over and written to the log by settings_task().
+ * @note    The reads block, about 23 ms at 100 kHz and up to 5 ms more if a write cycle
+ *          from before a reset is still running. This runs before the audio and the
+ *          scheduler are started; saving later on doesn't block (eeprom_writeAsync()).
+ *
+ * @return  None
+ */
+static void load_settings(void) {
+    static const int16_t defaults[SETTINGS_VALUE_COUNT] = {
+        [SETTING_FREQUENCY] = WAVE_FREQUENCY_INITIAL,
+        [SETTING_VOLUME] = VOLUME_INITIAL,
+    };
+
+    if (settings_init(&settings, eeprom_read, eeprom_writeAsync, defaults)) {
+        UART_SendString(UART_DEV, (const uint8_t*)"EEPROM: Data read succesfully\r\n");
+    } else {
+        struct LegacyEepromData legacy = {0};
+        int len = eeprom_read((uint8_t*)&legacy, LEGACY_EEPROM_OFFSET, sizeof(legacy));
+        if ((len == (int)sizeof(legacy)) &&
+            (legacy.wave_frequency >= WAVE_FREQUENCY_MIN) && (legacy.wave_frequency <= WAVE_FREQUENCY_MAX) &&
+            (legacy.volume_level >= VOLUME_MIN) && (legacy.volume_level <= VOLUME_MAX)) {
+            UART_SendString(UART_DEV, (const uint8_t*)"EEPROM: Taking over old data\r\n");
+            settings_set(&settings, SETTING_FREQUENCY, (int16_t)legacy.wave_frequency, sched_systick_now());
+            settings_set(&settings, SETTING_VOLUME, (int16_t)legacy.volume_level, sched_systick_now());
         }
+    }
 
-        if (volume_changed) {
-            refresh_screen(is_dark_mode, false, wave_frequency, volume_level, active_menu_entry, REDRAW_VOLUME);
+    wave_frequency = settings_get(&settings, SETTING_FREQUENCY);
+    volume_level = settings_get(&settings, SETTING_VOLUME);
 
-            eeprom_data.volume_level = volume_level;
-            len = eeprom_write((uint8_t*)&eeprom_data, eeprom_offset, sizeof(eeprom_data));
-            if (len != (int)sizeof(eeprom_data)) {
-                UART_SendString(UART_DEV, (const uint8_t*)"EEPROM: Failed to write data\r\n");
-            }
-        }
+    // A record with a valid CRC can still come from a firmware with other limits.
+    if ((wave_frequency < WAVE_FREQUENCY_MIN) || (wave_frequency > WAVE_FREQUENCY_MAX) ||
+        (volume_level < VOLUME_MIN) || (volume_level > VOLUME_MAX)) {
+        UART_SendString(UART_DEV, (const uint8_t*)"EEPROM: Invalid data, using defaults\r\n");
+        wave_frequency = WAVE_FREQUENCY_INITIAL;
+        volume_level = VOLUME_INITIAL;
+    }
+}
 
-        // Read button input and mute / play sound if necessary.
-        if (button_left_is_pressed()) {
-            lut_fill_with_zeroes(wave_lut);
-        }
-        if (button_right_is_pressed()) {
-            lut_fill_with_sine(wave_lut);
-        }
+/**
+ * @brief   Logs CPU usage to the UART.
+ *
+ * @return  None
+ */
+static void stats_task(void) {
+    uint8_t text[12] = {0};
+
+    int_to_string((int)sched_systick_idle_percent(), text, 12, 10);
+    UART_SendString(UART_DEV, (const uint8_t*)"CPU idle %: ");
+    UART_SendString(UART_DEV, text);
+    UART_SendString(UART_DEV, (const uint8_t*)"\r\n");
+
+    // Average CPU time of sending the screen, in core clock cycles per second.
+    uint32_t cycles = display_cycles();
+    uint32_t per_second = (cycles - last_display_cycles) / (STATS_PERIOD_MS / 1000);
+    last_display_cycles = cycles;
+    int_to_string((int)per_second, text, 12, 10);
+    UART_SendString(UART_DEV, (const uint8_t*)"Display cycles/s: ");
+    UART_SendString(UART_DEV, text);
+    UART_SendString(UART_DEV, (const uint8_t*)"\r\n");
+}
 
-        bool was_dark_mode = is_dark_mode;
+int main(void) {
+    // -------- INITIALIZE PERIPHERALS --------
+    init_i2c();
+    init_ssp();
+    init_uart();
+    midi_uart_init();
+    // init_amplifier() needs to be called before init_dac().
+    init_amplifier();
+    init_dac();
 
-        int light_value = light_read();
-        is_dark_mode = light_value < LIGHT_MODE_THRESHOLD;
+    rotary_init();
+    oled_init();
+    // Drawing only touches the framebuffer, display_task() sends the changes.
+    display_init();
+    pca9532_init();
+    joystick_init();
+    eeprom_init();
 
-        // If light mode has changed, we redraw the screen.
-        if (was_dark_mode != is_dark_mode) {
-            refresh_screen(is_dark_mode, true, wave_frequency, volume_level, active_menu_entry, REDRAW_ALL);
-        }
+    light_init();
+    light_enable();
+    light_setRange(LIGHT_RANGE_4000);
 
+    load_settings();
 
-        // Animate leds.
-        led_counter += 10;
-        if (led_counter % (WAVE_FREQUENCY_MAX + 1 - wave_frequency) == 0) {
-            led_index++;
-            set_leds_cyclic(led_index);
-        }
+    // -------- SETUP SYNTH AND DAC - DMA TRANSFER --------
+    synth_init();
+    synth_set_volume((uint32_t)volume_level);
+    synth_voice_start(SYNTH_PANEL_VOICE, (uint32_t)wave_frequency, SYNTH_LEVEL_MAX);
+    audio_init();
 
-        Timer0_Wait(1);
-    }
+    // Volume is controlled digitally, so it can change while audio plays without clicks.
+    // The amplifier goes to its highest level in the background and stays there, which
+    // keeps the loudness of every volume step unchanged.
+    amplifier_init(AMPLIFIER_LEVEL_MAX);
+
+    // -------- PREPARE DISPLAY --------
+    is_dark_mode = light_read() < LIGHT_MODE_THRESHOLD;
+    menu_init(is_dark_mode, wave_frequency, volume_level, active_menu_entry);
+
+    // -------- RUN TASKS --------
+    sched_init(&scheduler);
+    sched_systick_init();
+    uint32_t now = sched_systick_now();
+    (void)sched_add_periodic(&scheduler, input_task, now, INPUT_PERIOD_MS);
+    (void)sched_add_periodic(&scheduler, light_task, now, LIGHT_PERIOD_MS);
+    (void)sched_add_periodic(&scheduler, stats_task, now, STATS_PERIOD_MS);
+    (void)sched_add_periodic(&scheduler, display_task, now, DISPLAY_PERIOD_MS);
+    (void)sched_add_periodic(&scheduler, settings_task, now, SETTINGS_PERIOD_MS);
+    led_task_id = sched_add_once(&scheduler, led_task, now, 0);
+
+    // Never returns, the CPU sleeps whenever no task is due.
+    sched_systick_run(&scheduler);
 
     return 1;
 }
@@ -0,0 +1,102 @@
+#include "menu.h"
+
+#include "oled.h"
+
+#include "ui.h"
+#include "amplifier.h"
+
+// Menu rows start at the top of the display, one page each.
+#define MENU_LIST_X             0
+#define MENU_LIST_Y             0
+
+// The volume bar sits in the page below the menu rows.
+#define MENU_BAR_X              1
+#define MENU_BAR_Y              18
+#define MENU_BAR_HEIGHT         5
+
+static struct Ui ui;
+static int32_t list_id = UI_WIDGET_NONE;
+static int32_t bar_id = UI_WIDGET_NONE;
+
+// Indexed by enum MenuEntry.
+static struct UiListItem items[MENU_ENTRY_COUNT] = {
+    {"Freq", 0},
+    {"Vol", 0},
+};
+
+/**
+ * @brief   Creates the menu widgets, the whole screen is drawn by the next menu_render().
+ *
+ * @param   dark_mode       Is the dark mode enabled.
+ * @param   frequency       Wave frequency to be displayed.
+ * @param   volume          Volume level to be displayed, 0 - AMPLIFIER_LEVEL_MAX.
+ * @param   active_entry    Currently selected menu entry.
+ *
+ * @return  None
+ */
+void menu_init(bool dark_mode, int frequency, int volume, enum MenuEntry active_entry) {
+    items[MENU_ENTRY_FREQUENCY].value = frequency;
+    items[MENU_ENTRY_VOLUME].value = volume;
+
+    ui_init(&ui, dark_mode);
+    list_id = ui_add_list(&ui, MENU_LIST_X, MENU_LIST_Y, OLED_DISPLAY_WIDTH,
+                          MENU_ENTRY_COUNT, items, MENU_ENTRY_COUNT);
+    bar_id = ui_add_bar(&ui, MENU_BAR_X, MENU_BAR_Y, OLED_DISPLAY_WIDTH - (2 * MENU_BAR_X),
+                        MENU_BAR_HEIGHT, AMPLIFIER_LEVEL_MAX, volume);
+    ui_list_select(&ui, list_id, (uint8_t)active_entry);
+}
+
+/**
+ * @brief   Changes the value shown for a menu entry.
+ *
+ * @param   entry   Menu entry.
+ * @param   value   New value.
+ *
+ * @return  None
+ */
+void menu_set_value(enum MenuEntry entry, int value) {
+    ui_list_set_value(&ui, list_id, (uint8_t)entry, value);
+    if (entry == MENU_ENTRY_VOLUME) {
+        ui_set_value(&ui, bar_id, value);
+    }
+}
+
+/**
+ * @brief   Moves the selection to a menu entry.
+ *
+ * @param   entry   Menu entry.
+ *
+ * @return  None
+ */
+void menu_select(enum MenuEntry entry) {
+    ui_list_select(&ui, list_id, (uint8_t)entry);
+}
+
+/**
+ * @brief   Switches between dark and light mode.
+ *
+ * @param   dark_mode   Is the dark mode enabled.
+ *
+ * @return  None
+ */
+void menu_set_dark_mode(bool dark_mode) {
+    ui_set_dark_mode(&ui, dark_mode);
+}
+
+/**
+ * @brief   Marks the whole menu for redrawing, e.g. after something else used the screen.
+ *
+ * @return  None
+ */
+void menu_invalidate(void) {
+    ui_invalidate(&ui);
+}
+
+/**
+ * @brief   Draws the menu changes into the OLED framebuffer.
+ *
+ * @return  Number of widgets that were redrawn.
+ */
+uint32_t menu_render(void) {
+    return ui_render(&ui);
+}
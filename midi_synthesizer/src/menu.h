@@ -0,0 +1,20 @@
+#ifndef MENU_H
+#define MENU_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "utils.h"
+
+// The synthesizer screen: a list with one row per menu entry and a volume bar, built from
+// the widgets in ui.h. Changes only touch the OLED framebuffer, menu_render() draws them
+// and the display flush sends them.
+
+void menu_init(bool dark_mode, int frequency, int volume, enum MenuEntry active_entry);
+void menu_set_value(enum MenuEntry entry, int value);
+void menu_select(enum MenuEntry entry);
+void menu_set_dark_mode(bool dark_mode);
+void menu_invalidate(void);
+uint32_t menu_render(void);
+
+#endif
@@ -0,0 +1,214 @@
+#include "midi.h"
+
+#define MIDI_STATUS_BIT             0x80
+#define MIDI_QUEUE_MASK             (MIDI_QUEUE_SIZE - 1U)
+
+#if (MIDI_QUEUE_SIZE & (MIDI_QUEUE_SIZE - 1)) != 0
+#error "MIDI_QUEUE_SIZE must be a power of two"
+#endif
+
+/**
+ * @brief   Empties the queue.
+ *
+ * @param   queue   Pointer to the queue.
+ *
+ * @return  None
+ */
+void midi_queue_init(struct MidiQueue *queue) {
+    queue->head = 0;
+    queue->tail = 0;
+    queue->dropped = 0;
+}
+
+/**
+ * @brief   Adds an event to the queue. Must only be called by the producer.
+ *
+ * @param   queue   Pointer to the queue.
+ * @param   event   Event to copy into the queue.
+ *
+ * @return  bool    true if the event was added, false if the queue was full.
+ */
+bool midi_queue_push(struct MidiQueue *queue, const struct MidiEvent *event) {
+    uint32_t head = queue->head;
+
+    // Indices run freely and wrap around, so their difference is the fill level.
+    if ((head - queue->tail) >= (uint32_t)MIDI_QUEUE_SIZE) {
+        queue->dropped++;
+        return false;
+    }
+
+    queue->events[head & MIDI_QUEUE_MASK].status = event->status;
+    queue->events[head & MIDI_QUEUE_MASK].data1 = event->data1;
+    queue->events[head & MIDI_QUEUE_MASK].data2 = event->data2;
+    queue->events[head & MIDI_QUEUE_MASK].length = event->length;
+    // Publish the event only after it has been written.
+    queue->head = head + 1U;
+
+    return true;
+}
+
+/**
+ * @brief   Takes the oldest event from the queue. Must only be called by the consumer.
+ *
+ * @param   queue   Pointer to the queue.
+ * @param   event   Where to copy the event.
+ *
+ * @return  bool    true if an event was taken, false if the queue was empty.
+ */
+bool midi_queue_pop(struct MidiQueue *queue, struct MidiEvent *event) {
+    uint32_t tail = queue->tail;
+
+    if (tail == queue->head) {
+        return false;
+    }
+
+    event->status = queue->events[tail & MIDI_QUEUE_MASK].status;
+    event->data1 = queue->events[tail & MIDI_QUEUE_MASK].data1;
+    event->data2 = queue->events[tail & MIDI_QUEUE_MASK].data2;
+    event->length = queue->events[tail & MIDI_QUEUE_MASK].length;
+    // Free the slot only after it has been read.
+    queue->tail = tail + 1U;
+
+    return true;
+}
+
+/**
+ * @brief   Resets the parser, it will wait for a status byte.
+ *
+ * @param   parser  Pointer to the parser.
+ * @param   queue   Queue that will receive parsed events.
+ *
+ * @return  None
+ */
+void midi_parser_init(struct MidiParser *parser, struct MidiQueue *queue) {
+    parser->queue = queue;
+    parser->status = 0;
+    parser->expected = 0;
+    parser->count = 0;
+}
+
+/**
+ * @brief   Pushes a message made of the current status and received data bytes.
+ *
+ * @param   parser  Pointer to the parser.
+ *
+ * @return  None
+ */
+static void emit_message(struct MidiParser *parser) {
+    struct MidiEvent event;
+
+    event.status = parser->status;
+    event.data1 = (parser->count > 0U) ? parser->data[0] : 0U;
+    event.data2 = (parser->count > 1U) ? parser->data[1] : 0U;
+    event.length = parser->count;
+    (void)midi_queue_push(parser->queue, &event);
+    parser->count = 0;
+}
+
+/**
+ * @brief   Adds one byte to the SysEx chunk, sending the chunk when it is full.
+ *
+ * @param   parser  Pointer to the parser.
+ * @param   byte    SysEx data byte or MIDI_STATUS_SYSEX_END.
+ *
+ * @return  None
+ */
+static void add_sysex_byte(struct MidiParser *parser, uint8_t byte) {
+    parser->data[parser->count] = byte;
+    parser->count++;
+    if (parser->count == 2U) {
+        emit_message(parser);
+    }
+}
+
+/**
+ * @brief   Returns the number of data bytes that follow a status byte.
+ *
+ * @param   status  Status byte, except SysEx and realtime ones.
+ *
+ * @return  Number of data bytes.
+ */
+static uint8_t data_length(uint8_t status) {
+    uint8_t length = 2;
+
+    switch (MIDI_STATUS_TYPE(status)) {
+        case MIDI_STATUS_PROGRAM_CHANGE:
+        case MIDI_STATUS_CHANNEL_PRESSURE:
+            length = 1;
+            break;
+        case 0xF0:
+            // System common: MTC quarter frame and song select have one byte,
+            // song position has two, the rest have none.
+            if ((status == 0xF1U) || (status == 0xF3U)) {
+                length = 1;
+            } else if (status == 0xF2U) {
+                length = 2;
+            } else {
+                length = 0;
+            }
+            break;
+        default:
+            break;
+    }
+
+    return length;
+}
+
+/**
+ * @brief   Feeds one received byte to the parser.
+ *
+ * @note    Supports running status, realtime bytes interleaved anywhere (also inside
+ *          other messages and SysEx) and SysEx passthrough. Called from the UART interrupt.
+ *
+ * @param   parser  Pointer to the parser.
+ * @param   byte    Received byte.
+ *
+ * @return  None
+ */
+void midi_parse_byte(struct MidiParser *parser, uint8_t byte) {
+    if (byte >= (uint8_t)MIDI_STATUS_REALTIME_FIRST) {
+        // Realtime messages are single bytes and don't disturb the message in progress.
+        struct MidiEvent event = { byte, 0, 0, 0 };
+        (void)midi_queue_push(parser->queue, &event);
+    } else if ((byte & (uint8_t)MIDI_STATUS_BIT) != 0U) {
+        if (parser->status == (uint8_t)MIDI_STATUS_SYSEX) {
+            // Any status byte ends SysEx, MIDI_STATUS_SYSEX_END is passed through with it.
+            if (byte == (uint8_t)MIDI_STATUS_SYSEX_END) {
+                add_sysex_byte(parser, byte);
+            }
+            if (parser->count > 0U) {
+                emit_message(parser);
+            }
+            parser->status = 0;
+        }
+
+        if (byte == (uint8_t)MIDI_STATUS_SYSEX) {
+            parser->status = byte;
+            parser->count = 0;
+        } else if (byte != (uint8_t)MIDI_STATUS_SYSEX_END) {
+            parser->status = byte;
+            parser->expected = data_length(byte);
+            parser->count = 0;
+            if (parser->expected == 0U) {
+                emit_message(parser);
+                parser->status = 0;
+            }
+        } else {
+            // End of SysEx was handled above, a stray one is ignored.
+        }
+    } else if (parser->status == (uint8_t)MIDI_STATUS_SYSEX) {
+        add_sysex_byte(parser, byte);
+    } else if (parser->status != 0U) {
+        parser->data[parser->count] = byte;
+        parser->count++;
+        if (parser->count == parser->expected) {
+            emit_message(parser);
+            // Channel messages keep their status for running status, system common don't.
+            if (parser->status >= (uint8_t)MIDI_STATUS_SYSEX) {
+                parser->status = 0;
+            }
+        }
+    } else {
+        // Data byte without a status, ignore it.
+    }
+}
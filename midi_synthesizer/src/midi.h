@@ -0,0 +1,61 @@
+#ifndef MIDI_H
+#define MIDI_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// MIDI byte stream parser and the event queue between the UART interrupt and the audio
+// render callback. This module doesn't touch any peripherals, so it can also be compiled
+// and tested on a PC.
+
+// Must be a power of two.
+#define MIDI_QUEUE_SIZE             64
+
+#define MIDI_STATUS_NOTE_OFF        0x80
+#define MIDI_STATUS_NOTE_ON         0x90
+#define MIDI_STATUS_POLY_PRESSURE   0xA0
+#define MIDI_STATUS_CONTROL_CHANGE  0xB0
+#define MIDI_STATUS_PROGRAM_CHANGE  0xC0
+#define MIDI_STATUS_CHANNEL_PRESSURE 0xD0
+#define MIDI_STATUS_PITCH_BEND      0xE0
+#define MIDI_STATUS_SYSEX           0xF0
+#define MIDI_STATUS_SYSEX_END       0xF7
+#define MIDI_STATUS_REALTIME_FIRST  0xF8
+
+#define MIDI_STATUS_TYPE(status)    ((uint8_t)((status) & 0xF0U))
+#define MIDI_STATUS_CHANNEL(status) ((uint8_t)((status) & 0x0FU))
+
+// One parsed message. Channel, system common and realtime messages are stored whole.
+// SysEx is passed through in chunks with status MIDI_STATUS_SYSEX, each carrying up to two
+// bytes of the message; the chunk that contains MIDI_STATUS_SYSEX_END closes it.
+struct MidiEvent {
+    uint8_t status;
+    uint8_t data1;
+    uint8_t data2;
+    uint8_t length;     // Number of valid data bytes.
+};
+
+// Single-producer / single-consumer queue. The producer only writes `head` and the
+// consumer only writes `tail`, so no locking is needed between the two interrupts.
+struct MidiQueue {
+    volatile struct MidiEvent events[MIDI_QUEUE_SIZE];
+    volatile uint32_t head;
+    volatile uint32_t tail;
+    uint32_t dropped;   // Events lost because the queue was full.
+};
+
+struct MidiParser {
+    struct MidiQueue *queue;
+    uint8_t status;     // Status of the message being received, 0 if there is none.
+    uint8_t expected;   // Number of data bytes of the current message.
+    uint8_t count;      // Number of data bytes received so far.
+    uint8_t data[2];
+};
+
+void midi_queue_init(struct MidiQueue *queue);
+bool midi_queue_push(struct MidiQueue *queue, const struct MidiEvent *event);
+bool midi_queue_pop(struct MidiQueue *queue, struct MidiEvent *event);
+void midi_parser_init(struct MidiParser *parser, struct MidiQueue *queue);
+void midi_parse_byte(struct MidiParser *parser, uint8_t byte);
+
+#endif
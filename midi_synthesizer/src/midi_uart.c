@@ -0,0 +1,80 @@
+#include "midi_uart.h"
+
+#include "lpc17xx_pinsel.h"
+#include "lpc17xx_uart.h"
+
+// MIDI IN is connected to RXD0 (P0.3), UART3 stays free for the log output.
+#define MIDI_UART_DEV           ((LPC_UART_TypeDef *)LPC_UART0)
+#define MIDI_UART_IRQ           UART0_IRQn
+#define MIDI_BAUD_RATE          31250
+
+// Higher priority than the audio DMA interrupt, so bytes are parsed even while a block
+// is being rendered.
+#define MIDI_IRQ_PRIORITY       1
+
+static struct MidiQueue midi_queue;
+static struct MidiParser midi_parser;
+
+/**
+ * @brief   Initializes UART0 as MIDI IN, received bytes are parsed in the RX interrupt.
+ *
+ * @return  None
+ */
+void midi_uart_init(void) {
+    PINSEL_CFG_Type PinCfg;
+    UART_CFG_Type uartCfg;
+    UART_FIFO_CFG_Type fifoCfg;
+
+    midi_queue_init(&midi_queue);
+    midi_parser_init(&midi_parser, &midi_queue);
+
+    /* Initialize UART0 RX pin connect */
+    PinCfg.Funcnum = 1;
+    PinCfg.OpenDrain = 0;
+    PinCfg.Pinmode = 0;
+    PinCfg.Pinnum = 3;
+    PinCfg.Portnum = 0;
+    PINSEL_ConfigPin(&PinCfg);
+
+    uartCfg.Baud_rate = MIDI_BAUD_RATE;
+    uartCfg.Databits = UART_DATABIT_8;
+    uartCfg.Parity = UART_PARITY_NONE;
+    uartCfg.Stopbits = UART_STOPBIT_1;
+    UART_Init(MIDI_UART_DEV, &uartCfg);
+
+    // Interrupt on every byte, MIDI is slow enough (3125 bytes/s) for that.
+    UART_FIFOConfigStructInit(&fifoCfg);
+    fifoCfg.FIFO_Level = UART_FIFO_TRGLEV0;
+    UART_FIFOConfig(MIDI_UART_DEV, &fifoCfg);
+
+    UART_IntConfig(MIDI_UART_DEV, UART_INTCFG_RBR, ENABLE);
+    NVIC_SetPriority(MIDI_UART_IRQ, MIDI_IRQ_PRIORITY);
+    NVIC_EnableIRQ(MIDI_UART_IRQ);
+}
+
+/**
+ * @brief   Takes the oldest received MIDI event.
+ *
+ * @note    Meant to be called by the audio render callback only (single consumer).
+ *
+ * @param   event   Where to copy the event.
+ *
+ * @return  bool    true if an event was read, false if there was none.
+ */
+bool midi_uart_read_event(struct MidiEvent *event) {
+    return midi_queue_pop(&midi_queue, event);
+}
+
+/**
+ * @brief   UART0 interrupt handler, parses all received bytes into the event queue.
+ *
+ * @return  None
+ */
+void UART0_IRQHandler(void) {
+    // Reading IIR acknowledges the interrupt, the FIFO is drained below in any case.
+    (void)UART_GetIntId(MIDI_UART_DEV);
+
+    while ((UART_GetLineStatus(MIDI_UART_DEV) & UART_LSR_RDR) != 0U) {
+        midi_parse_byte(&midi_parser, UART_ReceiveByte(MIDI_UART_DEV));
+    }
+}
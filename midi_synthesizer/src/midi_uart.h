@@ -0,0 +1,11 @@
+#ifndef MIDI_UART_H
+#define MIDI_UART_H
+
+#include <stdbool.h>
+
+#include "midi.h"
+
+void midi_uart_init(void);
+bool midi_uart_read_event(struct MidiEvent *event);
+
+#endif
@@ -0,0 +1,114 @@
+#include "oscillator.h"
+
+#include "audio.h"
+#include "wavetables.h"
+
+// Tables below were calculated offline for this sample rate.
+#if AUDIO_SAMPLE_RATE != 32000
+#error "Recalculate top_octave_phase_steps for the new AUDIO_SAMPLE_RATE"
+#endif
+
+#define TOP_OCTAVE_FIRST_NOTE   116
+#define SEMITONES_PER_OCTAVE    12
+#define CENTS_TABLE_STEP        10
+
+// Phase steps of MIDI notes 116 - 127 (equal temperament, A4 = 440 Hz), rounded.
+// Lower notes are obtained by shifting right by the number of octaves, which keeps
+// the relative error under 1e-6 even for note 0.
+static const uint32_t top_octave_phase_steps[SEMITONES_PER_OCTAVE] = {
+    891860047,  944892805,  1001079055, 1060606313,
+    1123673247, 1190490335, 1261280574, 1336280220,
+    1415739577, 1499923833, 1589113945, 1683607578,
+};
+
+// 2^(cents / 1200) in Q30 for every 10 cents from 0 to 100. Values in between are linearly
+// interpolated, the error of that is below 0.01 cent.
+static const uint32_t cents_factors_q30[(OSC_CENTS_PER_SEMITONE / CENTS_TABLE_STEP) + 1] = {
+    1073741824, 1079961947, 1086218103, 1092510500,
+    1098839349, 1105204861, 1111607248, 1118046723,
+    1124523502, 1131037800, 1137589835,
+};
+
+/**
+ * @brief   Converts frequency to the phase step of an oscillator.
+ *
+ * @param   frequency   Frequency in Hz.
+ *
+ * @return  Phase step per sample at AUDIO_SAMPLE_RATE.
+ */
+uint32_t osc_phase_step_from_frequency(uint32_t frequency) {
+    return (uint32_t)(((uint64_t)frequency << 32) / (uint64_t)AUDIO_SAMPLE_RATE);
+}
+
+/**
+ * @brief   Converts MIDI note with fine tuning to the phase step of an oscillator.
+ *
+ * @note    Pitches outside of notes 0 - 127 are clamped. Only integer math is used and
+ *          the division happens on note changes, never per sample.
+ *
+ * @param   note    MIDI note number, 69 is A4 (440 Hz).
+ * @param   cents   Detune in cents, can be negative and larger than a semitone.
+ *
+ * @return  Phase step per sample at AUDIO_SAMPLE_RATE.
+ */
+uint32_t osc_phase_step_from_note(uint32_t note, int32_t cents) {
+    int32_t pitch = ((int32_t)note * OSC_CENTS_PER_SEMITONE) + cents;
+
+    if (note > (uint32_t)OSC_NOTE_MAX) {
+        pitch = OSC_NOTE_MAX * OSC_CENTS_PER_SEMITONE;
+    }
+    if (pitch < 0) {
+        pitch = 0;
+    } else if (pitch > (OSC_NOTE_MAX * OSC_CENTS_PER_SEMITONE)) {
+        pitch = OSC_NOTE_MAX * OSC_CENTS_PER_SEMITONE;
+    } else {
+        // Pitch is in range.
+    }
+
+    uint32_t semitone = (uint32_t)pitch / (uint32_t)OSC_CENTS_PER_SEMITONE;
+    uint32_t cent = (uint32_t)pitch % (uint32_t)OSC_CENTS_PER_SEMITONE;
+
+    // Position of the note relative to the top octave.
+    uint32_t octaves_down = ((uint32_t)OSC_NOTE_MAX - semitone) / (uint32_t)SEMITONES_PER_OCTAVE;
+    uint32_t index = (semitone + ((octaves_down * (uint32_t)SEMITONES_PER_OCTAVE)) - (uint32_t)TOP_OCTAVE_FIRST_NOTE);
+
+    uint32_t factor_index = cent / (uint32_t)CENTS_TABLE_STEP;
+    uint32_t factor_fraction = cent % (uint32_t)CENTS_TABLE_STEP;
+    uint32_t factor = cents_factors_q30[factor_index];
+    if (factor_fraction > 0U) {
+        factor += ((cents_factors_q30[factor_index + 1U] - factor) * factor_fraction) / (uint32_t)CENTS_TABLE_STEP;
+    }
+
+    uint64_t step = ((uint64_t)top_octave_phase_steps[index] * (uint64_t)factor) >> 30;
+    if (octaves_down > 0U) {
+        // Round to nearest instead of truncating.
+        step = (step + ((uint64_t)1 << (octaves_down - 1U))) >> octaves_down;
+    }
+
+    return (uint32_t)step;
+}
+
+/**
+ * @brief   Picks the band-limited wavetable level for the given pitch.
+ *
+ * @note    Level L covers phase steps below 2^(WAVE_MIPMAP_FIRST_STEP_LOG2 + L), so the level
+ *          is the bit length of the step above that threshold. Meant to be called once per
+ *          block, since the pitch doesn't change within a block.
+ *
+ * @param   phase_step  Phase step of the oscillator.
+ *
+ * @return  Level from 0 (lowest notes, most harmonics) to WAVE_MIPMAP_LEVELS - 1.
+ */
+uint32_t osc_mipmap_level(uint32_t phase_step) {
+    uint32_t octaves = phase_step >> WAVE_MIPMAP_FIRST_STEP_LOG2;
+    uint32_t level = 0;
+
+    if (octaves != 0U) {
+        level = 32U - (uint32_t)__builtin_clz(octaves);
+    }
+    if (level >= (uint32_t)WAVE_MIPMAP_LEVELS) {
+        level = (uint32_t)WAVE_MIPMAP_LEVELS - 1U;
+    }
+
+    return level;
+}
@@ -0,0 +1,23 @@
+#ifndef OSCILLATOR_H
+#define OSCILLATOR_H
+
+#include <stdint.h>
+
+// Phase-accumulator (DDS) oscillator running at AUDIO_SAMPLE_RATE.
+// The whole 32 bit phase range is one period of the wave, so the phase wraps by itself
+// and every oscillator can have its own pitch while the DAC rate stays constant.
+// This module doesn't touch any peripherals, so it can also be compiled and tested on a PC.
+
+#define OSC_NOTE_MAX            127
+#define OSC_CENTS_PER_SEMITONE  100
+
+struct Oscillator {
+    uint32_t phase;         // Position in the wave, full 32 bit range is one period.
+    uint32_t phase_step;    // Phase added every sample.
+};
+
+uint32_t osc_phase_step_from_frequency(uint32_t frequency);
+uint32_t osc_phase_step_from_note(uint32_t note, int32_t cents);
+uint32_t osc_mipmap_level(uint32_t phase_step);
+
+#endif
@@ -2,8 +2,46 @@
 
 #include "pca9532.h"
 
+#include <stdbool.h>
+
+// The chase moves through 16 positions and back. A sweep shorter than this is too fast for
+// the eye to follow and looks like all LEDs glowing dimly, so the PCA9532 blink engines
+// show it instead of one I2C write per step.
+#define CHASE_STEPS             16U
+#define CHASE_BLUR_SWEEP_MS     50U
+// Every LED is lit in 2 of the 16 steps.
+#define CHASE_DUTY_PERCENT      13U
+// While the blink engines run the chase, how often the step period is checked again.
+#define CHASE_BLINK_RECHECK_MS  100U
+
+// The blink period is (PSC + 1) / 152 s.
+#define PCA9532_BLINK_HZ        152U
+
+#define LEDS_RED                (uint16_t)0x00FF
+#define LEDS_GREEN              (uint16_t)0xFF00
+
+// Level meter: 8 LEDs per bar, 6 dB per LED, the top LED lights from half scale on.
+#define METER_LEDS              8U
+
 static uint16_t ledOn = 0;
 static uint16_t ledOff = (uint16_t)0xFFFF;
+static unsigned int chase_iteration = 0;
+static bool is_chase_blinking = false;
+
+/**
+ * @brief   Converts a blink period to the PCA9532 prescaler value.
+ *
+ * @param   period_ms   Blink period in milliseconds.
+ *
+ * @return  uint8_t     PSC0/PSC1 value, the nearest period the device has.
+ */
+static uint8_t blink_prescaler(uint32_t period_ms) {
+    uint32_t psc = ((period_ms * PCA9532_BLINK_HZ) + 500U) / 1000U;
+    if (psc > 0U) {
+        psc--;
+    }
+    return (uint8_t)((psc > 255U) ? 255U : psc);
+}
 
 /**
  * @brief Set led states based on current iteration to create cyclicaly moving single led pattern
@@ -50,3 +88,112 @@ void set_leds_wave(uint8_t wave) {
     ledOn += wave_to_led(wave_height);
     pca9532_setLeds(ledOn, ledOff);
 }
+
+/**
+ * @brief   Converts an amplitude to the number of LEDs of a meter bar, one per octave.
+ *
+ * @param   amplitude   Amplitude in DAC steps, 0 - 511.
+ *
+ * @return  uint8_t     LEDs to light, 0 - METER_LEDS.
+ */
+static uint8_t meter_leds(uint16_t amplitude) {
+    uint8_t count = 0;
+
+    while (amplitude > 1U) {
+        amplitude >>= 1;
+        count++;
+    }
+    return (count > METER_LEDS) ? (uint8_t)METER_LEDS : count;
+}
+
+/**
+ * @brief   Shows the output level: the red LEDs as an RMS bar, the green LEDs as a peak bar.
+ *
+ * @note    An unchanged meter writes nothing, so the I2C traffic is bounded by the update
+ *          rate and is zero for a steady tone.
+ *
+ * @param   rms     RMS amplitude in DAC steps.
+ * @param   peak    Peak amplitude in DAC steps.
+ *
+ * @return  None
+ */
+void set_leds_vu(uint16_t rms, uint16_t peak) {
+    uint16_t red = (uint16_t)((1U << meter_leds(rms)) - 1U);
+    uint16_t green = (uint16_t)((1U << meter_leds(peak)) - 1U);
+    uint16_t on = (uint16_t)(red | (uint16_t)(green << 8));
+
+    // Everything off first stops blinking left by the chase, in the same write.
+    pca9532_beginUpdate();
+    pca9532_setLeds(0, (uint16_t)0xFFFF);
+    pca9532_setLeds(on, 0);
+    pca9532_endUpdate();
+
+    // set_leds_cyclic() turns these off when the chase takes over again.
+    ledOn = on;
+    is_chase_blinking = false;
+}
+
+/**
+ * @brief   Lets a group of LEDs blink on one of the two PCA9532 blink engines, which keep
+ *          it going without any I2C traffic.
+ *
+ * @param   engine          0 for PSC0/PWM0, 1 for PSC1/PWM1.
+ * @param   leds            LEDs to blink, the others keep their state.
+ * @param   period_ms       Blink period, 7 ms to 1.7 s.
+ * @param   duty_percent    Part of the period the LEDs are on.
+ *
+ * @return  None
+ */
+void set_leds_blink(uint8_t engine, uint16_t leds, uint32_t period_ms, uint8_t duty_percent) {
+    // The period, duty cycle and LED selectors go out in one write, skipping what is
+    // unchanged. The LEDs are turned off first, the driver would otherwise combine their
+    // on state with the blink selector.
+    pca9532_beginUpdate();
+    pca9532_setLeds(0, leds);
+    if (engine == 0U) {
+        pca9532_setBlink0Period(blink_prescaler(period_ms));
+        pca9532_setBlink0Duty(duty_percent);
+        pca9532_setBlink0Leds(leds);
+    } else {
+        pca9532_setBlink1Period(blink_prescaler(period_ms));
+        pca9532_setBlink1Duty(duty_percent);
+        pca9532_setBlink1Leds(leds);
+    }
+    pca9532_endUpdate();
+}
+
+/**
+ * @brief   Moves the chase of set_leds_cyclic() by one step, or hands it to the blink
+ *          engines when it is too fast to follow.
+ *
+ * @param   step_ms     Time per step the chase should run at.
+ *
+ * @return  uint32_t    Milliseconds until the next call.
+ */
+uint32_t leds_chase(uint32_t step_ms) {
+    uint32_t sweep_ms = step_ms * CHASE_STEPS;
+
+    if (sweep_ms < CHASE_BLUR_SWEEP_MS) {
+        // Red and green LEDs sweep in opposite directions, each group on its own engine.
+        // Calling this again with the same period writes nothing.
+        pca9532_beginUpdate();
+        set_leds_blink(0, LEDS_RED, sweep_ms, CHASE_DUTY_PERCENT);
+        set_leds_blink(1, LEDS_GREEN, sweep_ms, CHASE_DUTY_PERCENT);
+        pca9532_endUpdate();
+        ledOn = 0;
+        is_chase_blinking = true;
+        return CHASE_BLINK_RECHECK_MS;
+    }
+
+    pca9532_beginUpdate();
+    if (is_chase_blinking) {
+        // Turning the LEDs off also stops them blinking.
+        pca9532_setLeds(0, (uint16_t)0xFFFF);
+        ledOn = 0;
+        is_chase_blinking = false;
+    }
+    chase_iteration++;
+    set_leds_cyclic(chase_iteration);
+    pca9532_endUpdate();
+    return step_ms;
+}
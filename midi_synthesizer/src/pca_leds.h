@@ -3,7 +3,12 @@
 
 #include <stdint.h>
 
+// The LED register writes skip registers that already hold the value, so calling these
+// with an unchanged pattern costs no I2C traffic.
 void set_leds_cyclic(unsigned int iteration);
 void set_leds_wave(uint8_t wave);
+void set_leds_vu(uint16_t rms, uint16_t peak);
+void set_leds_blink(uint8_t engine, uint16_t leds, uint32_t period_ms, uint8_t duty_percent);
+uint32_t leds_chase(uint32_t step_ms);
 
 #endif
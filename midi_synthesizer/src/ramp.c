@@ -0,0 +1,51 @@
+#include "ramp.h"
+
+/**
+ * @brief   Sets the ramp to a value with no movement pending.
+ *
+ * @param   ramp        Pointer to the ramp.
+ * @param   value       Initial value.
+ * @param   max_step    Largest change per block, must be positive.
+ *
+ * @return  None
+ */
+void ramp_init(struct Ramp *ramp, int32_t value, int32_t max_step) {
+    ramp->target = value;
+    ramp->current = value;
+    ramp->max_step = (max_step > 0) ? max_step : 1;
+}
+
+/**
+ * @brief   Sets the value the ramp moves to. Doesn't block, the move happens while rendering.
+ *
+ * @param   ramp    Pointer to the ramp.
+ * @param   target  New value.
+ *
+ * @return  None
+ */
+void ramp_set_target(struct Ramp *ramp, int32_t target) {
+    ramp->target = target;
+}
+
+/**
+ * @brief   Moves the current value one block towards the target.
+ *
+ * @param   ramp    Pointer to the ramp.
+ *
+ * @return  Value at the end of the block.
+ */
+int32_t ramp_next_block(struct Ramp *ramp) {
+    int32_t target = ramp->target;
+    int32_t current = ramp->current;
+
+    if (target > current) {
+        current = ((target - current) > ramp->max_step) ? (current + ramp->max_step) : target;
+    } else if (target < current) {
+        current = ((current - target) > ramp->max_step) ? (current - ramp->max_step) : target;
+    } else {
+        // Already at the target.
+    }
+
+    ramp->current = current;
+    return current;
+}
@@ -0,0 +1,22 @@
+#ifndef RAMP_H
+#define RAMP_H
+
+#include <stdint.h>
+
+// Smoothed parameter for values that change while audio is playing.
+// The main loop sets a target and the audio render callback moves the current value
+// towards it once per block, by at most `max_step`. The renderer then ramps linearly
+// between the old and the new value over the block, so the output never jumps.
+// This module doesn't touch any peripherals, so it can also be compiled and tested on a PC.
+
+struct Ramp {
+    volatile int32_t target;    // Written from the main loop.
+    int32_t current;            // Only used from the audio render callback.
+    int32_t max_step;           // Largest change per block.
+};
+
+void ramp_init(struct Ramp *ramp, int32_t value, int32_t max_step);
+void ramp_set_target(struct Ramp *ramp, int32_t target);
+int32_t ramp_next_block(struct Ramp *ramp);
+
+#endif
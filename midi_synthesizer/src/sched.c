@@ -0,0 +1,172 @@
+#include "sched.h"
+
+#include <stddef.h>
+
+/**
+ * @brief   Checks if a tick is at or after a deadline, also across the tick counter wrap.
+ *
+ * @param   now         Current tick.
+ * @param   deadline    Deadline tick.
+ *
+ * @return  bool    true if the deadline has been reached.
+ */
+static bool deadline_reached(uint32_t now, uint32_t deadline) {
+    return (int32_t)(now - deadline) >= 0;
+}
+
+/**
+ * @brief   Puts a task into a free slot.
+ *
+ * @param   sched       Pointer to the scheduler.
+ * @param   function    Task function.
+ * @param   deadline    Tick of the first run.
+ * @param   period      Ticks between runs, 0 for a one-shot task.
+ *
+ * @return  Task id, SCHED_TASK_NONE if all slots are used.
+ */
+static int32_t add_task(struct Scheduler *sched, SchedTaskFunction function, uint32_t deadline,
+                        uint32_t period) {
+    int32_t id = SCHED_TASK_NONE;
+
+    for (uint32_t i = 0; i < (uint32_t)SCHED_TASK_COUNT; i++) {
+        if (sched->tasks[i].function == NULL) {
+            sched->tasks[i].deadline = deadline;
+            sched->tasks[i].period = period;
+            sched->tasks[i].function = function;
+            id = (int32_t)i;
+            break;
+        }
+    }
+
+    return id;
+}
+
+/**
+ * @brief   Removes all tasks.
+ *
+ * @param   sched   Pointer to the scheduler.
+ *
+ * @return  None
+ */
+void sched_init(struct Scheduler *sched) {
+    for (uint32_t i = 0; i < (uint32_t)SCHED_TASK_COUNT; i++) {
+        sched->tasks[i].function = NULL;
+        sched->tasks[i].deadline = 0;
+        sched->tasks[i].period = 0;
+    }
+    sched->missed = 0;
+}
+
+/**
+ * @brief   Adds a task that runs every `period` ticks, the first time one period from now.
+ *
+ * @param   sched       Pointer to the scheduler.
+ * @param   function    Task function.
+ * @param   now         Current tick.
+ * @param   period      Ticks between runs, at least 1.
+ *
+ * @return  Task id, SCHED_TASK_NONE if all slots are used.
+ */
+int32_t sched_add_periodic(struct Scheduler *sched, SchedTaskFunction function, uint32_t now,
+                           uint32_t period) {
+    uint32_t ticks = (period == 0U) ? 1U : period;
+    return add_task(sched, function, now + ticks, ticks);
+}
+
+/**
+ * @brief   Adds a task that runs once after `delay` ticks and then frees its slot.
+ *
+ * @note    A one-shot task may add itself again to run with a varying interval.
+ *
+ * @param   sched       Pointer to the scheduler.
+ * @param   function    Task function.
+ * @param   now         Current tick.
+ * @param   delay       Ticks until the run, 0 runs it as soon as possible.
+ *
+ * @return  Task id, SCHED_TASK_NONE if all slots are used.
+ */
+int32_t sched_add_once(struct Scheduler *sched, SchedTaskFunction function, uint32_t now,
+                       uint32_t delay) {
+    return add_task(sched, function, now + delay, 0);
+}
+
+/**
+ * @brief   Removes a task, it won't run again.
+ *
+ * @param   sched   Pointer to the scheduler.
+ * @param   task    Task id returned when the task was added.
+ *
+ * @return  None
+ */
+void sched_cancel(struct Scheduler *sched, int32_t task) {
+    if ((task >= 0) && (task < SCHED_TASK_COUNT)) {
+        sched->tasks[task].function = NULL;
+    }
+}
+
+/**
+ * @brief   Runs the due task with the earliest deadline.
+ *
+ * @note    Only one task is run per call, so the caller can check for new work in between.
+ *          A periodic task keeps its phase: its next deadline is one period after the
+ *          previous one, unless that is already in the past, in which case the missed
+ *          periods are skipped instead of run in a burst.
+ *
+ * @param   sched   Pointer to the scheduler.
+ * @param   now     Current tick.
+ *
+ * @return  bool    true if a task was run, false if none was due.
+ */
+bool sched_run_next(struct Scheduler *sched, uint32_t now) {
+    struct SchedTask *next = NULL;
+
+    for (uint32_t i = 0; i < (uint32_t)SCHED_TASK_COUNT; i++) {
+        struct SchedTask *task = &sched->tasks[i];
+        // On equal deadlines the task in the lower slot wins.
+        if ((task->function != NULL) && deadline_reached(now, task->deadline)) {
+            if ((next == NULL) || ((int32_t)(task->deadline - next->deadline) < 0)) {
+                next = task;
+            }
+        }
+    }
+
+    if (next == NULL) {
+        return false;
+    }
+
+    SchedTaskFunction function = next->function;
+    if (next->period == 0U) {
+        // Free the slot first, so the task can add itself again.
+        next->function = NULL;
+    } else {
+        next->deadline += next->period;
+        if (deadline_reached(now, next->deadline)) {
+            sched->missed += ((now - next->deadline) / next->period) + 1U;
+            next->deadline = now + next->period;
+        }
+    }
+    function();
+
+    return true;
+}
+
+/**
+ * @brief   Checks if any task is due.
+ *
+ * @param   sched   Pointer to the scheduler.
+ * @param   now     Current tick.
+ *
+ * @return  bool    true if sched_run_next() would run a task.
+ */
+bool sched_is_due(const struct Scheduler *sched, uint32_t now) {
+    bool due = false;
+
+    for (uint32_t i = 0; i < (uint32_t)SCHED_TASK_COUNT; i++) {
+        if ((sched->tasks[i].function != NULL) && deadline_reached(now, sched->tasks[i].deadline)) {
+            due = true;
+            break;
+        }
+    }
+
+    return due;
+}
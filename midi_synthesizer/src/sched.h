@@ -0,0 +1,39 @@
+#ifndef SCHED_H
+#define SCHED_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Cooperative scheduler core. Tasks are plain functions that run to completion from the
+// main loop, each with a deadline (the tick it should run at) and an optional period.
+// Time is given by the caller in ticks, so this module doesn't touch any peripherals and
+// can also be compiled and tested on a PC. See sched_systick.c for the time base.
+
+#define SCHED_TASK_COUNT        8
+
+// Returned instead of a task id when no task slot is free.
+#define SCHED_TASK_NONE         (-1)
+
+typedef void (*SchedTaskFunction)(void);
+
+struct SchedTask {
+    SchedTaskFunction function;     // NULL if the slot is free.
+    uint32_t deadline;              // Tick the task should run at.
+    uint32_t period;                // Ticks between runs, 0 for one-shot tasks.
+};
+
+struct Scheduler {
+    struct SchedTask tasks[SCHED_TASK_COUNT];
+    uint32_t missed;    // Periods skipped because a periodic task ran too late.
+};
+
+void sched_init(struct Scheduler *sched);
+int32_t sched_add_periodic(struct Scheduler *sched, SchedTaskFunction function, uint32_t now,
+                           uint32_t period);
+int32_t sched_add_once(struct Scheduler *sched, SchedTaskFunction function, uint32_t now,
+                       uint32_t delay);
+void sched_cancel(struct Scheduler *sched, int32_t task);
+bool sched_run_next(struct Scheduler *sched, uint32_t now);
+bool sched_is_due(const struct Scheduler *sched, uint32_t now);
+
+#endif
@@ -0,0 +1,87 @@
+#include "sched_systick.h"
+
+#include "LPC17xx.h"
+#include "system_LPC17xx.h"
+
+// Idle time is averaged over this many ticks (one second).
+#define IDLE_WINDOW_TICKS       SCHED_TICK_HZ
+
+static volatile uint32_t ticks = 0;
+static uint32_t cycles_per_tick = 0;
+
+// Core clock cycles spent sleeping in the current window. Only changed with interrupts
+// masked in the main loop and reset from the SysTick interrupt.
+static volatile uint32_t idle_cycles = 0;
+static volatile uint32_t idle_percent = 0;
+
+/**
+ * @brief   Starts SysTick as the scheduler time base.
+ *
+ * @return  None
+ */
+void sched_systick_init(void) {
+    SystemCoreClockUpdate();
+    cycles_per_tick = SystemCoreClock / (uint32_t)SCHED_TICK_HZ;
+    // SysTick gets the lowest priority, the scheduler is never in a hurry.
+    (void)SysTick_Config(cycles_per_tick);
+}
+
+/**
+ * @brief   Returns the current scheduler tick.
+ *
+ * @return  Milliseconds since sched_systick_init(), wraps around after about 49 days.
+ */
+uint32_t sched_systick_now(void) {
+    return ticks;
+}
+
+/**
+ * @brief   Runs tasks forever, sleeping whenever none is due.
+ *
+ * @note    Interrupts are masked while checking for work, so one that makes a task due
+ *          can't slip in between the check and WFI. WFI still wakes up on it and the handler
+ *          runs as soon as interrupts are unmasked. Sleep is measured with the SysTick
+ *          counter while the handlers are held off; it can't be longer than one tick,
+ *          because SysTick itself ends it.
+ *
+ * @param   sched   Scheduler with the tasks to run.
+ *
+ * @return  Doesn't return.
+ */
+void sched_systick_run(struct Scheduler *sched) {
+    for (;;) {
+        if (!sched_run_next(sched, ticks)) {
+            __disable_irq();
+            if (!sched_is_due(sched, ticks)) {
+                uint32_t start = SysTick->VAL;
+                __WFI();
+                uint32_t end = SysTick->VAL;
+                // SysTick counts down and reloads once per tick.
+                idle_cycles += (start >= end) ? (start - end) : (start + cycles_per_tick - end);
+            }
+            __enable_irq();
+        }
+    }
+}
+
+/**
+ * @brief   Returns how much of the last second the CPU spent sleeping.
+ *
+ * @return  Idle time in percent, 0 - 100.
+ */
+uint32_t sched_systick_idle_percent(void) {
+    return idle_percent;
+}
+
+/**
+ * @brief   SysTick interrupt handler, advances the scheduler time.
+ *
+ * @return  None
+ */
+void SysTick_Handler(void) {
+    ticks++;
+    if ((ticks % (uint32_t)IDLE_WINDOW_TICKS) == 0U) {
+        idle_percent = idle_cycles / ((cycles_per_tick * (uint32_t)IDLE_WINDOW_TICKS) / 100U);
+        idle_cycles = 0;
+    }
+}
@@ -0,0 +1,16 @@
+#ifndef SCHED_SYSTICK_H
+#define SCHED_SYSTICK_H
+
+#include <stdint.h>
+
+#include "sched.h"
+
+// One scheduler tick is one millisecond.
+#define SCHED_TICK_HZ           1000
+
+void sched_systick_init(void);
+uint32_t sched_systick_now(void);
+void sched_systick_run(struct Scheduler *sched);
+uint32_t sched_systick_idle_percent(void);
+
+#endif
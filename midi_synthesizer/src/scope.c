@@ -0,0 +1,202 @@
+#include "scope.h"
+
+#include "oled.h"
+
+#include "fft.h"
+#include "synth.h"
+#include "wavetables.h"
+
+// The trace uses the upper half of the display, the spectrum the lower half.
+#define TRACE_TOP               0
+#define TRACE_HEIGHT            32
+#define SPECTRUM_TOP            33
+#define SPECTRUM_HEIGHT         (OLED_DISPLAY_HEIGHT - SPECTRUM_TOP)
+
+// Trace samples shown, one per column. The trace starts at a rising zero crossing in
+// the first SCOPE_SAMPLE_COUNT - TRACE_WIDTH samples, so periodic waves stand still.
+#define TRACE_WIDTH             OLED_DISPLAY_WIDTH
+
+// One column per bin, centred.
+#define SPECTRUM_LEFT           ((OLED_DISPLAY_WIDTH - SCOPE_BIN_COUNT) / 2)
+
+// Spectrum scale, see bar_height().
+#define BAR_PIXELS_PER_OCTAVE   3U
+#define BAR_FLOOR_OCTAVES       3U
+
+// Sum of two centred 10 bit DAC values is 11 bits, shifted up to Q15 (half scale).
+#define SAMPLE_SHIFT            (15 - 11)
+
+// Written by the audio interrupt while capturing, read by the main loop once ready.
+static int16_t samples[SCOPE_SAMPLE_COUNT];
+static volatile uint32_t captured = 0;
+static volatile bool capturing = false;
+static volatile bool ready = false;
+
+// Spectrum of the last capture.
+static uint16_t bins[SCOPE_BIN_COUNT];
+
+/**
+ * @brief   Starts a new capture, the previous one is dropped.
+ *
+ * @return  None
+ */
+void scope_arm(void) {
+    ready = false;
+    captured = 0;
+    // Set last: the audio interrupt only touches the buffer while this is true.
+    capturing = true;
+}
+
+/**
+ * @brief   Copies a rendered block into the capture buffer if a capture is running.
+ *
+ * @note    Called from the audio interrupt after every block. The capture ends once the
+ *          buffer is full, later blocks are ignored until scope_arm().
+ *
+ * @param   dac_buffer  Block in the DACR format written by synth_render_block().
+ * @param   count       Number of samples in the block, must be even.
+ *
+ * @return  None
+ */
+void scope_capture(const uint32_t *dac_buffer, uint32_t count) {
+    if (!capturing) {
+        return;
+    }
+
+    uint32_t n = captured;
+    for (uint32_t i = 0; (i < count) && (n < (uint32_t)SCOPE_SAMPLE_COUNT); i += 2U) {
+        int32_t a = (int32_t)((dac_buffer[i] >> DAC_VALUE_SHIFT) & DAC_VALUE_MAX) - DAC_VALUE_CENTER;
+        int32_t b = (int32_t)((dac_buffer[i + 1U] >> DAC_VALUE_SHIFT) & DAC_VALUE_MAX) - DAC_VALUE_CENTER;
+        samples[n] = (int16_t)((a + b) * (1 << SAMPLE_SHIFT));
+        n++;
+    }
+    captured = n;
+
+    if (n == (uint32_t)SCOPE_SAMPLE_COUNT) {
+        capturing = false;
+        ready = true;
+    }
+}
+
+/**
+ * @brief   Checks if a capture has been completed.
+ *
+ * @return  bool    true if scope_analyze() and scope_draw() can be called.
+ */
+bool scope_is_ready(void) {
+    return ready;
+}
+
+/**
+ * @brief   Computes the spectrum of the completed capture.
+ *
+ * @note    The capture is Hann windowed, sin^2(pi n / N), so the wave not fitting the
+ *          capture length doesn't smear over the whole spectrum.
+ *
+ * @return  None
+ */
+void scope_analyze(void) {
+    int16_t re[SCOPE_SAMPLE_COUNT];
+    int16_t im[SCOPE_SAMPLE_COUNT];
+
+    for (uint32_t i = 0; i < (uint32_t)SCOPE_SAMPLE_COUNT; i++) {
+        // sin(pi n / N) is index n * WAVE_SAMPLES_COUNT / (2 N) of the sine table.
+        int32_t s = wavetable_sine[i << (WAVE_SAMPLES_COUNT_LOG2 - SCOPE_SAMPLE_COUNT_LOG2 - 1)];
+        int32_t window = (s * s) >> 15;
+        re[i] = (int16_t)((samples[i] * window) >> 15);
+        im[i] = 0;
+    }
+
+    fft_q15(re, im, SCOPE_SAMPLE_COUNT_LOG2);
+    fft_magnitudes(re, im, bins, SCOPE_BIN_COUNT);
+}
+
+/**
+ * @brief   Converts a magnitude to a bar height on a logarithmic scale, about 2 dB per pixel.
+ *
+ * @note    The largest possible magnitude, a full scale sine, reaches the top. The lowest
+ *          BAR_FLOOR_OCTAVES octaves are rounding noise and aren't shown.
+ *
+ * @param   magnitude   Bin magnitude.
+ *
+ * @return  Height in pixels, 0 - SPECTRUM_HEIGHT.
+ */
+static uint8_t bar_height(uint32_t magnitude) {
+    uint32_t height = 0;
+
+    // BAR_PIXELS_PER_OCTAVE per octave, the bit below the top one adds a third of that.
+    while (magnitude >= 4U) {
+        magnitude >>= 1;
+        height += BAR_PIXELS_PER_OCTAVE;
+    }
+    if (magnitude == 3U) {
+        height++;
+    }
+
+    if (height <= (BAR_PIXELS_PER_OCTAVE * BAR_FLOOR_OCTAVES)) {
+        return 0;
+    }
+    height -= BAR_PIXELS_PER_OCTAVE * BAR_FLOOR_OCTAVES;
+    return (height > (uint32_t)SPECTRUM_HEIGHT) ? (uint8_t)SPECTRUM_HEIGHT : (uint8_t)height;
+}
+
+/**
+ * @brief   Returns the trace row of a sample.
+ *
+ * @param   sample  Captured sample.
+ *
+ * @return  Row, TRACE_TOP for the highest level.
+ */
+static uint8_t trace_row(int32_t sample) {
+    // Samples are at most half scale, 2^14.
+    int32_t row = (TRACE_HEIGHT / 2) - ((sample * (TRACE_HEIGHT / 2)) >> 14);
+
+    if (row < 0) {
+        row = 0;
+    } else if (row > (TRACE_HEIGHT - 1)) {
+        row = TRACE_HEIGHT - 1;
+    } else {
+        // Row is on the trace.
+    }
+    return (uint8_t)(TRACE_TOP + row);
+}
+
+/**
+ * @brief   Draws the completed capture and its spectrum into the OLED framebuffer.
+ *
+ * @note    scope_analyze() needs to be called first. Both halves are cleared and drawn
+ *          again, the display flush sends them.
+ *
+ * @param   dark_mode   Draw white on black instead of black on white.
+ *
+ * @return  None
+ */
+void scope_draw(bool dark_mode) {
+    oled_color_t fg = dark_mode ? OLED_COLOR_WHITE : OLED_COLOR_BLACK;
+    oled_color_t bg = dark_mode ? OLED_COLOR_BLACK : OLED_COLOR_WHITE;
+    uint32_t start = 0;
+
+    for (uint32_t i = 1; i <= (uint32_t)(SCOPE_SAMPLE_COUNT - TRACE_WIDTH); i++) {
+        if ((samples[i - 1U] < 0) && (samples[i] >= 0)) {
+            start = i;
+            break;
+        }
+    }
+
+    oled_fillRect(0, TRACE_TOP, OLED_DISPLAY_WIDTH - 1, OLED_DISPLAY_HEIGHT - 1, bg);
+
+    uint8_t last = trace_row(samples[start]);
+    for (uint32_t x = 1; x < (uint32_t)TRACE_WIDTH; x++) {
+        uint8_t row = trace_row(samples[start + x]);
+        oled_line((uint8_t)(x - 1U), last, (uint8_t)x, row, fg);
+        last = row;
+    }
+
+    for (uint32_t i = 0; i < (uint32_t)SCOPE_BIN_COUNT; i++) {
+        uint8_t height = bar_height(bins[i]);
+        if (height > 0U) {
+            uint8_t x = (uint8_t)(SPECTRUM_LEFT + i);
+            oled_line(x, OLED_DISPLAY_HEIGHT - 1, x, OLED_DISPLAY_HEIGHT - height, fg);
+        }
+    }
+}
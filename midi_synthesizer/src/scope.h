@@ -0,0 +1,26 @@
+#ifndef SCOPE_H
+#define SCOPE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Oscilloscope and spectrum view of the synth output. The audio interrupt copies rendered
+// blocks into a capture buffer while a capture is armed, so the audio path only pays for a
+// few dozen additions per block. The main loop then analyzes the capture and draws it
+// into the OLED framebuffer: the trace in the upper half and a 64 bin magnitude spectrum
+// in the lower half.
+
+// Captured samples, every two DAC samples are averaged into one (16 kHz, 8 ms).
+#define SCOPE_SAMPLE_COUNT_LOG2 7
+#define SCOPE_SAMPLE_COUNT      (1 << SCOPE_SAMPLE_COUNT_LOG2)
+
+// Spectrum bins from 0 Hz up to half the decimated rate, 125 Hz each.
+#define SCOPE_BIN_COUNT         (SCOPE_SAMPLE_COUNT / 2)
+
+void scope_arm(void);
+void scope_capture(const uint32_t *dac_buffer, uint32_t count);
+bool scope_is_ready(void);
+void scope_analyze(void);
+void scope_draw(bool dark_mode);
+
+#endif
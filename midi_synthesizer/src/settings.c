@@ -0,0 +1,281 @@
+#include "settings.h"
+
+#include <stddef.h>
+
+// Record layout, multi-byte fields are little endian.
+#define RECORD_SEQUENCE         0
+#define RECORD_VALUES           4
+#define RECORD_CRC              (RECORD_VALUES + (SETTINGS_VALUE_COUNT * 2))
+
+#if (RECORD_CRC + 2) != SETTINGS_RECORD_SIZE
+#error "The settings values must fill a record"
+#endif
+
+// CRC-16/CCITT-FALSE. An erased page (all 0xFF) doesn't pass.
+#define CRC_POLYNOMIAL          0x1021U
+#define CRC_INITIAL             0xFFFFU
+
+// Settings whose record is being written, the completion callback has no other way to find
+// them. The EEPROM driver only runs one write at a time anyway.
+static struct Settings *volatile saving = NULL;
+
+/**
+ * @brief   Calculates the CRC of a record.
+ *
+ * @param   data    Record bytes.
+ * @param   len     Number of bytes.
+ *
+ * @return  CRC-16 of the bytes.
+ */
+static uint16_t crc16(const uint8_t *data, uint32_t len) {
+    uint16_t crc = CRC_INITIAL;
+
+    for (uint32_t i = 0; i < len; i++) {
+        crc ^= (uint16_t)((uint16_t)data[i] << 8);
+        for (uint32_t bit = 0; bit < 8U; bit++) {
+            if ((crc & 0x8000U) != 0U) {
+                crc = (uint16_t)((uint16_t)(crc << 1) ^ CRC_POLYNOMIAL);
+            } else {
+                crc = (uint16_t)(crc << 1);
+            }
+        }
+    }
+
+    return crc;
+}
+
+/**
+ * @brief   Returns the EEPROM offset of a log slot.
+ *
+ * @param   slot    Slot from 0 to SETTINGS_LOG_RECORDS - 1.
+ *
+ * @return  Offset in the EEPROM.
+ */
+static uint16_t slot_offset(uint8_t slot) {
+    return (uint16_t)(SETTINGS_LOG_OFFSET + ((uint32_t)slot * SETTINGS_RECORD_SIZE));
+}
+
+/**
+ * @brief   Checks the CRC of a record.
+ *
+ * @param   record      Record bytes.
+ *
+ * @return  bool    true if the CRC matches.
+ */
+static bool record_valid(const uint8_t record[SETTINGS_RECORD_SIZE]) {
+    uint16_t crc = (uint16_t)record[RECORD_CRC] | (uint16_t)((uint16_t)record[RECORD_CRC + 1] << 8);
+    return crc16(record, RECORD_CRC) == crc;
+}
+
+/**
+ * @brief   Finds the newest valid record in the log region and loads its values.
+ *
+ * @note    The whole log region is read at once. If that fails the slots are read one by
+ *          one, and a slot that can't be read counts as empty. Sequence numbers are
+ *          compared across the wrap around. Without any valid record the defaults are
+ *          used and the log starts at the first slot.
+ *
+ * @param   settings    Pointer to the settings.
+ * @param   read        Function reading from the EEPROM.
+ * @param   write       Function starting a write to the EEPROM.
+ * @param   defaults    Values to use if no valid record is found.
+ *
+ * @return  bool    true if a valid record was found.
+ */
+bool settings_init(struct Settings *settings, SettingsReadFunction read,
+                   SettingsWriteFunction write, const int16_t defaults[SETTINGS_VALUE_COUNT]) {
+    uint8_t log[SETTINGS_LOG_RECORDS * SETTINGS_RECORD_SIZE];
+    const uint8_t *newest = NULL;
+
+    settings->read = read;
+    settings->write = write;
+    settings->sequence = 0;
+    settings->next_slot = 0;
+    settings->dirty = false;
+    settings->changed_at = 0;
+    settings->changes = 0;
+    settings->saved_changes = 0;
+    settings->save_state = SETTINGS_SAVE_IDLE;
+
+    bool whole = read(log, SETTINGS_LOG_OFFSET, (uint16_t)sizeof(log)) == (int16_t)sizeof(log);
+
+    for (uint8_t slot = 0; slot < (uint8_t)SETTINGS_LOG_RECORDS; slot++) {
+        uint8_t *record = &log[(uint32_t)slot * SETTINGS_RECORD_SIZE];
+        if (!whole && (read(record, slot_offset(slot), SETTINGS_RECORD_SIZE) !=
+                       (int16_t)SETTINGS_RECORD_SIZE)) {
+            continue;
+        }
+        if (!record_valid(record)) {
+            continue;
+        }
+
+        uint32_t sequence = (uint32_t)record[RECORD_SEQUENCE] |
+                            ((uint32_t)record[RECORD_SEQUENCE + 1] << 8) |
+                            ((uint32_t)record[RECORD_SEQUENCE + 2] << 16) |
+                            ((uint32_t)record[RECORD_SEQUENCE + 3] << 24);
+        if ((newest == NULL) || ((int32_t)(sequence - settings->sequence) > 0)) {
+            newest = record;
+            settings->sequence = sequence;
+            settings->next_slot = (uint8_t)((slot + 1U) % (uint8_t)SETTINGS_LOG_RECORDS);
+        }
+    }
+
+    for (uint32_t i = 0; i < (uint32_t)SETTINGS_VALUE_COUNT; i++) {
+        if (newest != NULL) {
+            uint32_t pos = RECORD_VALUES + (i * 2U);
+            settings->values[i] = (int16_t)((uint16_t)newest[pos] |
+                                            (uint16_t)((uint16_t)newest[pos + 1U] << 8));
+        } else {
+            settings->values[i] = defaults[i];
+        }
+    }
+
+    return newest != NULL;
+}
+
+/**
+ * @brief   Returns a setting.
+ *
+ * @param   settings    Pointer to the settings.
+ * @param   id          Setting id.
+ *
+ * @return  Current value.
+ */
+int16_t settings_get(const struct Settings *settings, enum SettingId id) {
+    return settings->values[id];
+}
+
+/**
+ * @brief   Changes a setting in RAM, it is saved by settings_poll() later.
+ *
+ * @note    Every change restarts the quiet period, setting the same value doesn't. The change
+ *          is counted before the settings are marked dirty, so a save finishing in between
+ *          can't take it for saved.
+ *
+ * @param   settings    Pointer to the settings.
+ * @param   id          Setting id.
+ * @param   value       New value.
+ * @param   now         Current tick.
+ *
+ * @return  None
+ */
+void settings_set(struct Settings *settings, enum SettingId id, int16_t value, uint32_t now) {
+    if (settings->values[id] != value) {
+        settings->values[id] = value;
+        settings->changes++;
+        settings->dirty = true;
+        settings->changed_at = now;
+    }
+}
+
+/**
+ * @brief   Completion callback of the record write, called from the EEPROM driver.
+ *
+ * @note    Runs in the I2C interrupt on the target. The settings are only marked clean if
+ *          nothing has changed since the record was made.
+ *
+ * @param   result  Number of bytes written, anything else is an error.
+ *
+ * @return  None
+ */
+static void save_done(int16_t result) {
+    struct Settings *settings = saving;
+
+    if (result == (int16_t)SETTINGS_RECORD_SIZE) {
+        if (settings->changes == settings->saved_changes) {
+            settings->dirty = false;
+        }
+        settings->save_state = SETTINGS_SAVE_DONE;
+    } else {
+        settings->save_state = SETTINGS_SAVE_FAILED;
+    }
+}
+
+/**
+ * @brief   Starts saving the settings if they have changed and then been left alone for
+ *          SETTINGS_QUIET_TICKS, and reports how the last save went.
+ *
+ * @note    Meant to be called periodically from the main loop. It doesn't wait for the
+ *          EEPROM, the result of a save is returned by the first call after it is done.
+ *
+ * @param   settings    Pointer to the settings.
+ * @param   now         Current tick.
+ *
+ * @return  What was done, see enum SettingsPollResult.
+ */
+enum SettingsPollResult settings_poll(struct Settings *settings, uint32_t now) {
+    switch (settings->save_state) {
+        case SETTINGS_SAVE_WRITING:
+            return SETTINGS_POLL_IDLE;
+        case SETTINGS_SAVE_DONE:
+            settings->save_state = SETTINGS_SAVE_IDLE;
+            return SETTINGS_POLL_SAVED;
+        case SETTINGS_SAVE_FAILED:
+            settings->save_state = SETTINGS_SAVE_IDLE;
+            settings->changed_at = now;
+            return SETTINGS_POLL_FAILED;
+        default:
+            break;
+    }
+
+    if (!settings->dirty || ((int32_t)(now - settings->changed_at) < (int32_t)SETTINGS_QUIET_TICKS)) {
+        return SETTINGS_POLL_IDLE;
+    }
+
+    if (!settings_save(settings)) {
+        settings->changed_at = now;
+        return SETTINGS_POLL_FAILED;
+    }
+
+    return SETTINGS_POLL_STARTED;
+}
+
+/**
+ * @brief   Starts writing the settings to the next log slot right away.
+ *
+ * @note    A failed write still uses up its slot, the next try goes to the following one in
+ *          case the page is worn out. The settings stay dirty until the write is done, then
+ *          settings_poll() returns SETTINGS_POLL_SAVED or SETTINGS_POLL_FAILED.
+ *
+ * @param   settings    Pointer to the settings.
+ *
+ * @return  bool    true if the write was started, false if it couldn't be or another save
+ *                  is still running.
+ */
+bool settings_save(struct Settings *settings) {
+    uint8_t *record = settings->record;
+    uint32_t sequence = settings->sequence + 1U;
+
+    if ((saving != NULL) && (saving->save_state == SETTINGS_SAVE_WRITING)) {
+        return false;
+    }
+
+    record[RECORD_SEQUENCE] = (uint8_t)sequence;
+    record[RECORD_SEQUENCE + 1] = (uint8_t)(sequence >> 8);
+    record[RECORD_SEQUENCE + 2] = (uint8_t)(sequence >> 16);
+    record[RECORD_SEQUENCE + 3] = (uint8_t)(sequence >> 24);
+    for (uint32_t i = 0; i < (uint32_t)SETTINGS_VALUE_COUNT; i++) {
+        uint16_t value = (uint16_t)settings->values[i];
+        record[RECORD_VALUES + (i * 2U)] = (uint8_t)value;
+        record[RECORD_VALUES + (i * 2U) + 1U] = (uint8_t)(value >> 8);
+    }
+    uint16_t crc = crc16(record, RECORD_CRC);
+    record[RECORD_CRC] = (uint8_t)crc;
+    record[RECORD_CRC + 1] = (uint8_t)(crc >> 8);
+
+    uint8_t slot = settings->next_slot;
+    settings->sequence = sequence;
+    settings->next_slot = (uint8_t)((slot + 1U) % (uint8_t)SETTINGS_LOG_RECORDS);
+
+    // Set up before the write starts, the callback can come right away.
+    settings->saved_changes = settings->changes;
+    settings->save_state = SETTINGS_SAVE_WRITING;
+    saving = settings;
+    if (settings->write(record, slot_offset(slot), SETTINGS_RECORD_SIZE, save_done) !=
+        (int16_t)SETTINGS_RECORD_SIZE) {
+        settings->save_state = SETTINGS_SAVE_IDLE;
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,86 @@
+#ifndef SETTINGS_H
+#define SETTINGS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Settings kept in RAM and saved to the EEPROM in the background. A change only marks the
+// settings dirty, settings_poll() starts saving them once they have been left alone for
+// SETTINGS_QUIET_TICKS, so turning the rotary encoder quickly costs a single write. The
+// write runs on its own, like eeprom_writeAsync(), and the settings stay dirty until its
+// completion callback reports the record written without any change made in the meantime.
+// Only one save can be running at a time.
+// Every save is a new record of one EEPROM page with a sequence number and a CRC, written
+// to the next slot of a log region. The writes are spread over all pages of the region,
+// and a write cut short by a power loss only loses that record: at boot the valid record
+// with the highest sequence number wins.
+// The EEPROM is accessed through the functions given to settings_init(), so this module
+// doesn't touch any peripherals and can also be compiled and tested on a PC.
+
+// Values in a record, the ones without an id in enum SettingId are spare.
+#define SETTINGS_VALUE_COUNT    5
+
+// A record is one EEPROM page: sequence number, values and CRC.
+#define SETTINGS_RECORD_SIZE    16
+
+// Log region, the second 256 byte block of the 24LC08.
+#define SETTINGS_LOG_OFFSET     256
+#define SETTINGS_LOG_RECORDS    16
+
+// Ticks without a change before dirty settings are saved.
+#define SETTINGS_QUIET_TICKS    2000
+
+enum SettingId {
+    SETTING_FREQUENCY,
+    SETTING_VOLUME,
+};
+
+enum SettingsPollResult {
+    SETTINGS_POLL_IDLE,     // Nothing to save yet, or a record is still being written.
+    SETTINGS_POLL_STARTED,  // Writing a record has started.
+    SETTINGS_POLL_SAVED,    // A record was written.
+    SETTINGS_POLL_FAILED,   // Writing failed, it is tried again after another quiet period.
+};
+
+// Progress of a save, the last two are set by the completion callback of the write.
+enum SettingsSaveState {
+    SETTINGS_SAVE_IDLE,
+    SETTINGS_SAVE_WRITING,
+    SETTINGS_SAVE_DONE,
+    SETTINGS_SAVE_FAILED,
+};
+
+// Called when a write is done with the number of bytes written, anything else is an error.
+typedef void (*SettingsWriteDone)(int16_t result);
+
+// Reads `len` bytes at `offset`, like eeprom_read().
+// Returns the number of bytes read, anything else is an error.
+typedef int16_t (*SettingsReadFunction)(uint8_t *buf, uint16_t offset, uint16_t len);
+
+// Starts writing `len` bytes at `offset` and calls `done` once they are written, like
+// eeprom_writeAsync(). Returns `len` if the write was started, `done` isn't called otherwise.
+typedef int16_t (*SettingsWriteFunction)(uint8_t *buf, uint16_t offset, uint16_t len,
+                                         SettingsWriteDone done);
+
+struct Settings {
+    SettingsReadFunction read;
+    SettingsWriteFunction write;
+    int16_t values[SETTINGS_VALUE_COUNT];
+    uint32_t sequence;      // Sequence number of the newest record, written or found.
+    uint8_t next_slot;      // Slot of the log region the next record goes to.
+    volatile bool dirty;    // Values have changed since the last completed save.
+    uint32_t changed_at;    // Tick of the last change.
+    volatile uint32_t changes;      // Count of changes, to find the ones made during a save.
+    uint32_t saved_changes;         // Value of `changes` when the record being written was made.
+    volatile enum SettingsSaveState save_state;
+    uint8_t record[SETTINGS_RECORD_SIZE];   // Record being written, the write reads it later.
+};
+
+bool settings_init(struct Settings *settings, SettingsReadFunction read,
+                   SettingsWriteFunction write, const int16_t defaults[SETTINGS_VALUE_COUNT]);
+int16_t settings_get(const struct Settings *settings, enum SettingId id);
+void settings_set(struct Settings *settings, enum SettingId id, int16_t value, uint32_t now);
+enum SettingsPollResult settings_poll(struct Settings *settings, uint32_t now);
+bool settings_save(struct Settings *settings);
+
+#endif
@@ -0,0 +1,380 @@
+#include "synth.h"
+
+#include "audio.h"
+#include "oscillator.h"
+#include "wavetables.h"
+#include "voice_alloc.h"
+#include "envelope.h"
+#include "ramp.h"
+
+// Every voice adds its Q15 samples multiplied by its Q15 gain, reduced to Q23.
+#define VOICE_GAIN_SHIFT        7
+
+// Q23 mix is scaled down to the 10 bit DAC range and then by 4, so four voices at full
+// level reach full scale. Louder mixes are clipped.
+#define SYNTH_MIX_SHIFT         ((23 - 9) + 2)
+
+// Master gain is in Q15, unity passes the mix through unchanged.
+#define MASTER_GAIN_SHIFT       15
+#define MASTER_GAIN_UNITY       (1L << MASTER_GAIN_SHIFT)
+
+// Master gain moves from silence to unity in 10 blocks (20 ms), fast enough to feel
+// immediate and slow enough not to click.
+#define MASTER_GAIN_STEP        (MASTER_GAIN_UNITY / 10)
+
+// Envelope of all voices.
+#define DEFAULT_ATTACK_MS       5
+#define DEFAULT_DECAY_MS        300
+#define DEFAULT_SUSTAIN         192
+#define DEFAULT_RELEASE_MS      200
+
+// Phase bits below the table index used for linear interpolation between two samples.
+// 15 bits keep the interpolation product within int32_t.
+#define PHASE_INDEX_SHIFT       (32 - WAVE_SAMPLES_COUNT_LOG2)
+#define PHASE_FRACTION_BITS     15
+#define PHASE_FRACTION_SHIFT    (PHASE_INDEX_SHIFT - PHASE_FRACTION_BITS)
+#define PHASE_FRACTION_MASK     ((1UL << PHASE_FRACTION_BITS) - 1UL)
+
+// State of a single voice. Voices are changed from the main loop and read from the
+// DMA interrupt, so `active` is always written last when starting a voice.
+struct SynthVoice {
+    struct Oscillator osc;
+    enum SynthWaveform waveform;
+    uint32_t level;         // Q8 amplitude.
+    bool gate;              // Note is held, the envelope follows this at the next block.
+    bool active;            // Voice is sounding, cleared when its release has finished.
+};
+
+// Parts of a voice that are only used from the audio render callback.
+struct SynthVoiceRender {
+    struct Envelope env;
+    int32_t gain;           // Q15 gain at the end of the last block.
+};
+
+static volatile struct SynthVoice voices[SYNTH_VOICE_COUNT];
+static struct SynthVoiceRender voice_render[SYNTH_VOICE_COUNT];
+static struct EnvelopeParams envelope_params;
+
+// Gain applied to the whole mix, it is the volume or zero when muted.
+static struct Ramp master_gain;
+static uint32_t master_volume = SYNTH_VOLUME_STEPS - 1U;
+static bool is_muted = false;
+
+// Q15 gain of every volume step, 3 dB apart from -45 dB to 0 dB like the LM4811 steps.
+static const int32_t volume_gains[SYNTH_VOLUME_STEPS] = {
+    184,   260,   368,   519,   734,   1036,  1464,  2068,
+    2920,  4125,  5827,  8231,  11627, 16423, 23198, 32768,
+};
+
+// Decides which MIDI voice plays which note. Only used from the audio render callback.
+static struct VoiceAllocator allocator;
+
+// Wave of every MIDI channel, set by program change. Only used from the audio render callback.
+static enum SynthWaveform channel_waveforms[VOICE_ALLOC_CHANNEL_COUNT];
+
+/**
+ * @brief   Picks the wavetable to play for a waveform at a given pitch.
+ *
+ * @note    Band-limited waves switch to a table with fewer harmonics every octave,
+ *          so harmonics never go above Nyquist and don't alias.
+ *
+ * @param   waveform    Waveform of the voice.
+ * @param   phase_step  Phase step of the voice.
+ *
+ * @return  Wavetable with WAVE_SAMPLES_COUNT + 1 samples.
+ */
+static const int16_t *select_wavetable(enum SynthWaveform waveform, uint32_t phase_step) {
+    const int16_t *wave = wavetable_sine;
+
+    switch (waveform) {
+        case SYNTH_WAVE_SAW:
+            wave = wavetable_saw[osc_mipmap_level(phase_step)];
+            break;
+        case SYNTH_WAVE_SQUARE:
+            wave = wavetable_square[osc_mipmap_level(phase_step)];
+            break;
+        case SYNTH_WAVE_TRIANGLE:
+            wave = wavetable_triangle[osc_mipmap_level(phase_step)];
+            break;
+        default:
+            // Sine has no harmonics, so it doesn't need other levels.
+            break;
+    }
+
+    return wave;
+}
+
+/**
+ * @brief   Initializes voices, all of them are stopped and set to play a sine wave.
+ *
+ * @return  None
+ */
+void synth_init(void) {
+    for (uint32_t i = 0; i < (uint32_t)SYNTH_VOICE_COUNT; i++) {
+        voices[i].active = false;
+        voices[i].gate = false;
+        voices[i].waveform = SYNTH_WAVE_SINE;
+        voices[i].osc.phase = 0;
+        voices[i].osc.phase_step = 0;
+        voices[i].level = 0;
+        env_init(&voice_render[i].env);
+        voice_render[i].gain = 0;
+    }
+    for (uint32_t i = 0; i < (uint32_t)VOICE_ALLOC_CHANNEL_COUNT; i++) {
+        channel_waveforms[i] = SYNTH_WAVE_SINE;
+    }
+    voice_alloc_init(&allocator);
+    env_set_params(&envelope_params, DEFAULT_ATTACK_MS, DEFAULT_DECAY_MS, DEFAULT_SUSTAIN, DEFAULT_RELEASE_MS);
+    master_volume = SYNTH_VOLUME_STEPS - 1U;
+    is_muted = false;
+    ramp_init(&master_gain, volume_gains[master_volume], MASTER_GAIN_STEP);
+}
+
+/**
+ * @brief   Sets the master gain target from the current volume and mute state.
+ *
+ * @return  None
+ */
+static void update_master_gain(void) {
+    ramp_set_target(&master_gain, is_muted ? 0 : volume_gains[master_volume]);
+}
+
+/**
+ * @brief   Changes the volume of the whole synth.
+ *
+ * @note    Returns right away, the gain glides to the new value over a few blocks.
+ *
+ * @param   volume  Volume step, from 0 (-45 dB) to SYNTH_VOLUME_STEPS - 1 (0 dB), 3 dB apart.
+ *
+ * @return  None
+ */
+void synth_set_volume(uint32_t volume) {
+    master_volume = (volume >= (uint32_t)SYNTH_VOLUME_STEPS) ? ((uint32_t)SYNTH_VOLUME_STEPS - 1U) : volume;
+    update_master_gain();
+}
+
+/**
+ * @brief   Fades the whole synth out or back in, voices keep playing meanwhile.
+ *
+ * @param   mute    true to mute, false to unmute.
+ *
+ * @return  None
+ */
+void synth_set_mute(bool mute) {
+    is_muted = mute;
+    update_master_gain();
+}
+
+/**
+ * @brief   Starts playing a voice, the envelope starts its attack at the next block.
+ *
+ * @note    A voice that is still sounding keeps its phase, so restarting it doesn't click.
+ *
+ * @param   voice       Index of the voice, from 0 to SYNTH_VOICE_COUNT - 1.
+ * @param   frequency   Frequency in Hz.
+ * @param   level       Q8 amplitude, from 0 to SYNTH_LEVEL_MAX.
+ *
+ * @return  None
+ */
+void synth_voice_start(uint32_t voice, uint32_t frequency, uint32_t level) {
+    if (voice < (uint32_t)SYNTH_VOICE_COUNT) {
+        // Setting the gate first keeps the interrupt from deactivating the voice meanwhile.
+        voices[voice].gate = true;
+        if (!voices[voice].active) {
+            voices[voice].osc.phase = 0;
+        }
+        voices[voice].osc.phase_step = osc_phase_step_from_frequency(frequency);
+        voices[voice].level = (level > (uint32_t)SYNTH_LEVEL_MAX) ? (uint32_t)SYNTH_LEVEL_MAX : level;
+        voices[voice].active = true;
+    }
+}
+
+/**
+ * @brief   Changes frequency of a voice without resetting its phase.
+ *
+ * @param   voice       Index of the voice, from 0 to SYNTH_VOICE_COUNT - 1.
+ * @param   frequency   Frequency in Hz.
+ *
+ * @return  None
+ */
+void synth_voice_set_frequency(uint32_t voice, uint32_t frequency) {
+    if (voice < (uint32_t)SYNTH_VOICE_COUNT) {
+        voices[voice].osc.phase_step = osc_phase_step_from_frequency(frequency);
+    }
+}
+
+/**
+ * @brief   Starts a MIDI voice for a note, stealing one if all of them are busy.
+ *
+ * @note    The attack of a stolen voice starts from the level of the note it cuts off.
+ *
+ * @param   channel     MIDI channel.
+ * @param   note        MIDI note number.
+ * @param   velocity    MIDI velocity, from 1 to 127.
+ *
+ * @return  None
+ */
+static void note_on(uint8_t channel, uint8_t note, uint8_t velocity) {
+    uint8_t v = voice_alloc_note_on(&allocator, channel, note);
+
+    if (v != VOICE_ALLOC_NONE) {
+        // A voice that is still sounding (retriggered, releasing or stolen) keeps its phase
+        // and its envelope level, restarting either would step the output and click.
+        if (!voices[v].active) {
+            voices[v].osc.phase = 0;
+        }
+        voices[v].osc.phase_step = osc_phase_step_from_note(note, 0);
+        voices[v].waveform = channel_waveforms[channel];
+        voices[v].level = (uint32_t)velocity * 2U;
+        voices[v].gate = true;
+        voices[v].active = true;
+        // Restart the attack even if the voice was already held (retrigger or steal).
+        env_gate_on(&voice_render[v].env);
+    }
+}
+
+/**
+ * @brief   Stops the MIDI voice playing a note.
+ *
+ * @param   channel     MIDI channel.
+ * @param   note        MIDI note number.
+ *
+ * @return  None
+ */
+static void note_off(uint8_t channel, uint8_t note) {
+    uint8_t v = voice_alloc_note_off(&allocator, channel, note);
+
+    if (v != VOICE_ALLOC_NONE) {
+        // The voice is returned to the allocator when its release has finished.
+        voices[v].gate = false;
+    }
+}
+
+/**
+ * @brief   Applies a MIDI event to the voices.
+ *
+ * @note    Called from the audio render callback before rendering a block, so the
+ *          latency of an event is at most one block. Events that don't affect the sound
+ *          are ignored.
+ *
+ * @param   event   Event to apply.
+ *
+ * @return  None
+ */
+void synth_handle_midi_event(const struct MidiEvent *event) {
+    uint8_t channel = MIDI_STATUS_CHANNEL(event->status);
+
+    switch (MIDI_STATUS_TYPE(event->status)) {
+        case MIDI_STATUS_NOTE_ON:
+            // Note on with zero velocity means note off.
+            if (event->data2 == 0U) {
+                note_off(channel, event->data1);
+            } else {
+                note_on(channel, event->data1, event->data2);
+            }
+            break;
+        case MIDI_STATUS_NOTE_OFF:
+            note_off(channel, event->data1);
+            break;
+        case MIDI_STATUS_PROGRAM_CHANGE:
+            // Notes that are already playing keep their wave.
+            channel_waveforms[channel] = (enum SynthWaveform)(event->data1 % (uint8_t)SYNTH_WAVE_COUNT);
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief   Advances the envelope of a voice by one block.
+ *
+ * @note    Gate changes made from the main loop are picked up here, so the envelope is
+ *          only ever changed from the audio render callback.
+ *
+ * @param   voice   Index of the voice, from 0 to SYNTH_VOICE_COUNT - 1.
+ *
+ * @return  Q15 gain at the end of the block, including the voice level.
+ */
+static int32_t next_voice_gain(uint32_t voice) {
+    struct Envelope *env = &voice_render[voice].env;
+    bool releasing = (env->stage == ENV_STAGE_IDLE) || (env->stage == ENV_STAGE_RELEASE);
+
+    if (voices[voice].gate && releasing) {
+        env_gate_on(env);
+    } else if (!voices[voice].gate && !releasing) {
+        env_gate_off(env);
+    } else {
+        // Envelope already follows the gate.
+    }
+
+    uint32_t level = env_next_block(env, &envelope_params) >> 16;
+    return (int32_t)((level * voices[voice].level) >> 8);
+}
+
+/**
+ * @brief   Renders a block of samples by summing all active voices.
+ *
+ * @note    Called from the DMA interrupt for the buffer that is not being played.
+ *
+ * @param   dac_buffer      Buffer to fill with values ready to be written to DACR.
+ * @param   sample_count    Number of samples to render, at most AUDIO_BLOCK_SIZE.
+ *
+ * @return  None
+ */
+void synth_render_block(uint32_t *dac_buffer, uint32_t sample_count) {
+    int32_t mix[AUDIO_BLOCK_SIZE] = {0};
+    uint32_t count = (sample_count > (uint32_t)AUDIO_BLOCK_SIZE) ? (uint32_t)AUDIO_BLOCK_SIZE : sample_count;
+    int32_t master_start = master_gain.current;
+    int32_t master_step = ramp_next_block(&master_gain) - master_start;
+    int32_t master = master_start << AUDIO_BLOCK_SIZE_LOG2;
+
+    for (uint32_t v = 0; v < (uint32_t)SYNTH_VOICE_COUNT; v++) {
+        if (voices[v].active) {
+            uint32_t phase = voices[v].osc.phase;
+            uint32_t phase_step = voices[v].osc.phase_step;
+            const int16_t *wave = select_wavetable(voices[v].waveform, phase_step);
+            // Gain is ramped linearly over the block from the last envelope level to the
+            // new one. It is kept multiplied by the block size, so no division is needed.
+            int32_t gain_end = next_voice_gain(v);
+            int32_t gain_step = gain_end - voice_render[v].gain;
+            int32_t gain = voice_render[v].gain << AUDIO_BLOCK_SIZE_LOG2;
+
+            for (uint32_t i = 0; i < count; i++) {
+                // Upper bits of the phase are the table index, the next ones are the fraction
+                // between this sample and the next one (the guard sample covers the last index).
+                uint32_t index = phase >> PHASE_INDEX_SHIFT;
+                int32_t fraction = (int32_t)((phase >> PHASE_FRACTION_SHIFT) & PHASE_FRACTION_MASK);
+                int32_t a = wave[index];
+                int32_t b = wave[index + 1U];
+                int32_t sample = a + (((b - a) * fraction) >> PHASE_FRACTION_BITS);
+                gain += gain_step;
+                mix[i] += (sample * (gain >> AUDIO_BLOCK_SIZE_LOG2)) >> VOICE_GAIN_SHIFT;
+                phase += phase_step;
+            }
+
+            voices[v].osc.phase = phase;
+            voice_render[v].gain = gain_end;
+            if (env_is_idle(&voice_render[v].env)) {
+                voices[v].active = false;
+                if (v < (uint32_t)SYNTH_MIDI_VOICE_COUNT) {
+                    voice_alloc_free(&allocator, (uint8_t)v);
+                }
+            }
+        }
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        // Master gain is ramped over the block the same way as voice gains.
+        master += master_step;
+        int64_t scaled = (int64_t)mix[i] * (int64_t)(master >> AUDIO_BLOCK_SIZE_LOG2);
+        int32_t value = (int32_t)(scaled >> (SYNTH_MIX_SHIFT + MASTER_GAIN_SHIFT)) + DAC_VALUE_CENTER;
+        if (value < 0) {
+            value = 0;
+        } else if (value > DAC_VALUE_MAX) {
+            value = DAC_VALUE_MAX;
+        } else {
+            // Value already fits in the DAC range.
+        }
+        dac_buffer[i] = (uint32_t)value << DAC_VALUE_SHIFT;
+    }
+}
@@ -0,0 +1,48 @@
+#ifndef SYNTH_H
+#define SYNTH_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "midi.h"
+#include "voice_alloc.h"
+
+// This module doesn't touch any peripherals, so it can also be compiled and tested on a PC.
+
+// Voices 0 - 15 are played from MIDI, the last one is the test tone set from the panel.
+#define SYNTH_MIDI_VOICE_COUNT  VOICE_ALLOC_VOICE_COUNT
+#define SYNTH_PANEL_VOICE       SYNTH_MIDI_VOICE_COUNT
+#define SYNTH_VOICE_COUNT       (SYNTH_MIDI_VOICE_COUNT + 1)
+
+// DAC takes 10 bit unsigned samples, placed in bits 15:6 of the DACR register.
+// synth_render_block() writes them in this format.
+#define DAC_VALUE_SHIFT         6
+#define DAC_VALUE_CENTER        512
+#define DAC_VALUE_MAX           1023
+
+// Voice level is in Q8, SYNTH_LEVEL_MAX means full scale.
+#define SYNTH_LEVEL_MAX         256
+
+// Number of master volume steps, see synth_set_volume().
+#define SYNTH_VOLUME_STEPS      16
+
+// Waves that can be played by a voice, stored as const tables in flash (see wavetables.h).
+// All of them except sine are band-limited per octave. MIDI program change picks the wave
+// of a channel: programs 0 - 3 in this order, higher programs repeat them.
+enum SynthWaveform {
+    SYNTH_WAVE_SINE,
+    SYNTH_WAVE_SAW,
+    SYNTH_WAVE_SQUARE,
+    SYNTH_WAVE_TRIANGLE,
+    SYNTH_WAVE_COUNT,
+};
+
+void synth_init(void);
+void synth_set_volume(uint32_t volume);
+void synth_set_mute(bool mute);
+void synth_voice_start(uint32_t voice, uint32_t frequency, uint32_t level);
+void synth_voice_set_frequency(uint32_t voice, uint32_t frequency);
+void synth_handle_midi_event(const struct MidiEvent *event);
+void synth_render_block(uint32_t *dac_buffer, uint32_t sample_count);
+
+#endif
@@ -0,0 +1,551 @@
+#include "ui.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "oled.h"
+
+#include "utils.h"
+
+// Marks every part of a widget for redrawing.
+#define DIRTY_ALL               0xFFU
+
+// Space left between the widget edge and its text.
+#define TEXT_MARGIN             1
+
+/**
+ * @brief   Returns the text colour of a widget.
+ *
+ * @note    Dark mode draws white on black, highlighted widgets swap the colours.
+ *
+ * @param   ui          Pointer to the UI.
+ * @param   highlighted Is the widget highlighted.
+ *
+ * @return  Foreground colour, the background is the other one.
+ */
+static oled_color_t foreground(const struct Ui *ui, bool highlighted) {
+    return (ui->dark_mode != highlighted) ? OLED_COLOR_WHITE : OLED_COLOR_BLACK;
+}
+
+/**
+ * @brief   Returns the other colour.
+ *
+ * @param   color   Colour.
+ *
+ * @return  Inverse of `color`.
+ */
+static oled_color_t other(oled_color_t color) {
+    return (color == OLED_COLOR_WHITE) ? OLED_COLOR_BLACK : OLED_COLOR_WHITE;
+}
+
+/**
+ * @brief   Returns a widget by id, or NULL if the id is not valid.
+ *
+ * @param   ui  Pointer to the UI.
+ * @param   id  Widget id.
+ *
+ * @return  Pointer to the widget.
+ */
+static struct UiWidget *widget(struct Ui *ui, int32_t id) {
+    struct UiWidget *w = NULL;
+
+    if ((id >= 0) && (id < (int32_t)ui->count)) {
+        w = &ui->widgets[id];
+    }
+
+    return w;
+}
+
+/**
+ * @brief   Takes the next free widget and gives it its bounds.
+ *
+ * @param   ui      Pointer to the UI.
+ * @param   type    Widget type.
+ * @param   x       Left edge.
+ * @param   y       Top edge.
+ * @param   width   Width in pixels.
+ * @param   height  Height in pixels.
+ *
+ * @return  Widget id, UI_WIDGET_NONE if all widgets are used.
+ */
+static int32_t add_widget(struct Ui *ui, enum UiWidgetType type, uint8_t x, uint8_t y,
+                          uint8_t width, uint8_t height) {
+    if (ui->count >= (uint8_t)UI_WIDGET_COUNT) {
+        return UI_WIDGET_NONE;
+    }
+
+    struct UiWidget *w = &ui->widgets[ui->count];
+    (void)memset(w, 0, sizeof(*w));
+    w->type = type;
+    w->x = x;
+    w->y = y;
+    w->width = width;
+    w->height = height;
+    w->dirty = DIRTY_ALL;
+    ui->count++;
+
+    return (int32_t)ui->count - 1;
+}
+
+/**
+ * @brief   Fills a rectangle, doing nothing if it is empty.
+ *
+ * @param   x0      Left edge.
+ * @param   y0      Top edge.
+ * @param   x1      Right edge, included.
+ * @param   y1      Bottom edge, included.
+ * @param   color   Fill colour.
+ *
+ * @return  None
+ */
+static void fill(int32_t x0, int32_t y0, int32_t x1, int32_t y1, oled_color_t color) {
+    if ((x0 <= x1) && (y0 <= y1)) {
+        oled_fillRect((uint8_t)x0, (uint8_t)y0, (uint8_t)x1, (uint8_t)y1, color);
+    }
+}
+
+/**
+ * @brief   Draws a value right aligned in the value field of a row.
+ *
+ * @note    This is the most frequent UI update, so the field is drawn in one go with
+ *          oled_putNumber(). A value too wide for the field runs into the caption.
+ *
+ * @param   right   Right edge of the field, included.
+ * @param   y       Top of the row.
+ * @param   value   Value to draw.
+ * @param   fg      Text colour.
+ *
+ * @return  None
+ */
+static void draw_value(int32_t right, uint8_t y, int32_t value, oled_color_t fg) {
+    int32_t field_x = right + 1 - (UI_VALUE_CHARS * UI_CHAR_WIDTH);
+
+    if ((field_x >= 0) &&
+        (oled_putNumber((uint8_t)field_x, y, value, UI_VALUE_CHARS, fg, other(fg)) != 0U)) {
+        return;
+    }
+
+    uint8_t text[12] = {0};
+
+    int_to_string((int)value, text, sizeof(text), 10);
+    int32_t text_x = right + 1 - ((int32_t)strlen((const char*)text) * UI_CHAR_WIDTH);
+
+    fill(field_x, y, text_x - 1, y + UI_ROW_HEIGHT - 1, other(fg));
+    oled_putString((uint8_t)text_x, y, text, fg, other(fg));
+}
+
+/**
+ * @brief   Draws a row with a caption on the left and a value on the right.
+ *
+ * @param   x           Left edge.
+ * @param   y           Top edge.
+ * @param   width       Width of the row.
+ * @param   caption     Caption, may be NULL.
+ * @param   value       Value.
+ * @param   value_only  Only redraw the value field.
+ * @param   fg          Text colour.
+ *
+ * @return  None
+ */
+static void draw_row(uint8_t x, uint8_t y, uint8_t width, const char *caption, int32_t value,
+                     bool value_only, oled_color_t fg) {
+    int32_t right = (int32_t)x + width - 1 - TEXT_MARGIN;
+
+    if (!value_only) {
+        // The value field is cleared by draw_value().
+        fill(x, y, right - (UI_VALUE_CHARS * UI_CHAR_WIDTH), y + UI_ROW_HEIGHT - 1, other(fg));
+        fill(right + 1, y, x + width - 1, y + UI_ROW_HEIGHT - 1, other(fg));
+        if (caption != NULL) {
+            oled_putString(x + TEXT_MARGIN, y, (uint8_t*)caption, fg, other(fg));
+        }
+    }
+    draw_value(right, y, value, fg);
+}
+
+/**
+ * @brief   Draws the invalidated parts of a label.
+ *
+ * @param   ui  Pointer to the UI.
+ * @param   w   Widget to draw.
+ *
+ * @return  None
+ */
+static void render_label(const struct Ui *ui, const struct UiWidget *w) {
+    oled_color_t fg = foreground(ui, w->highlighted);
+
+    fill(w->x, w->y, w->x + w->width - 1, w->y + w->height - 1, other(fg));
+    if (w->text != NULL) {
+        oled_putString(w->x + TEXT_MARGIN, w->y, (uint8_t*)w->text, fg, other(fg));
+    }
+}
+
+/**
+ * @brief   Draws the invalidated parts of a bar.
+ *
+ * @note    When only the value has changed, just the strip between the old and the new end
+ *          of the fill is redrawn.
+ *
+ * @param   ui  Pointer to the UI.
+ * @param   w   Widget to draw.
+ *
+ * @return  None
+ */
+static void render_bar(const struct Ui *ui, struct UiWidget *w) {
+    oled_color_t fg = foreground(ui, w->highlighted);
+    int32_t x0 = (int32_t)w->x + 1;
+    int32_t y0 = (int32_t)w->y + 1;
+    int32_t y1 = (int32_t)w->y + w->height - 2;
+    int32_t inner = (int32_t)w->width - 2;
+    int32_t value = w->value;
+
+    if (value < 0) {
+        value = 0;
+    } else if (value > w->max) {
+        value = w->max;
+    } else {
+        // Value is within range.
+    }
+    int32_t filled = (w->max > 0) ? ((value * inner) / w->max) : 0;
+
+    if (w->dirty != 0U) {
+        oled_rect(w->x, w->y, w->x + w->width - 1, w->y + w->height - 1, fg);
+        fill(x0, y0, x0 + filled - 1, y1, fg);
+        fill(x0 + filled, y0, x0 + inner - 1, y1, other(fg));
+    } else if (filled > w->drawn) {
+        fill(x0 + w->drawn, y0, x0 + filled - 1, y1, fg);
+    } else {
+        fill(x0 + filled, y0, x0 + w->drawn - 1, y1, other(fg));
+    }
+    w->drawn = filled;
+}
+
+/**
+ * @brief   Draws the invalidated rows of a list.
+ *
+ * @param   ui  Pointer to the UI.
+ * @param   w   Widget to draw.
+ *
+ * @return  None
+ */
+static void render_list(const struct Ui *ui, const struct UiWidget *w) {
+    uint8_t rows = w->height / UI_ROW_HEIGHT;
+
+    for (uint8_t row = 0; row < rows; row++) {
+        uint8_t mask = (uint8_t)(1U << row);
+        if (((w->dirty | w->dirty_values) & mask) == 0U) {
+            continue;
+        }
+
+        uint8_t y = w->y + (row * UI_ROW_HEIGHT);
+        uint8_t item = w->first_visible + row;
+        if (item < w->item_count) {
+            oled_color_t fg = foreground(ui, item == w->selected);
+            draw_row(w->x, y, w->width, w->items[item].caption, w->items[item].value,
+                     (w->dirty & mask) == 0U, fg);
+        } else {
+            fill(w->x, y, w->x + w->width - 1, y + UI_ROW_HEIGHT - 1,
+                 other(foreground(ui, false)));
+        }
+    }
+}
+
+/**
+ * @brief   Removes all widgets.
+ *
+ * @param   ui          Pointer to the UI.
+ * @param   dark_mode   Draw white on black instead of black on white.
+ *
+ * @return  None
+ */
+void ui_init(struct Ui *ui, bool dark_mode) {
+    ui->count = 0;
+    ui->dark_mode = dark_mode;
+    ui->clear_screen = true;
+}
+
+/**
+ * @brief   Adds a line of static text, one row high.
+ *
+ * @param   ui      Pointer to the UI.
+ * @param   x       Left edge.
+ * @param   y       Top edge, preferably a multiple of UI_ROW_HEIGHT.
+ * @param   width   Width in pixels.
+ * @param   text    Text, must stay valid while the widget is used.
+ *
+ * @return  Widget id, UI_WIDGET_NONE if all widgets are used.
+ */
+int32_t ui_add_label(struct Ui *ui, uint8_t x, uint8_t y, uint8_t width, const char *text) {
+    int32_t id = add_widget(ui, UI_WIDGET_LABEL, x, y, width, UI_ROW_HEIGHT);
+
+    if (id != UI_WIDGET_NONE) {
+        ui->widgets[id].text = text;
+    }
+    return id;
+}
+
+/**
+ * @brief   Adds a caption with a number, one row high.
+ *
+ * @param   ui      Pointer to the UI.
+ * @param   x       Left edge.
+ * @param   y       Top edge, preferably a multiple of UI_ROW_HEIGHT.
+ * @param   width   Width in pixels.
+ * @param   caption Caption, must stay valid while the widget is used.
+ * @param   value   Initial value.
+ *
+ * @return  Widget id, UI_WIDGET_NONE if all widgets are used.
+ */
+int32_t ui_add_number(struct Ui *ui, uint8_t x, uint8_t y, uint8_t width, const char *caption,
+                      int32_t value) {
+    int32_t id = add_widget(ui, UI_WIDGET_NUMBER, x, y, width, UI_ROW_HEIGHT);
+
+    if (id != UI_WIDGET_NONE) {
+        ui->widgets[id].text = caption;
+        ui->widgets[id].value = value;
+    }
+    return id;
+}
+
+/**
+ * @brief   Adds a horizontal bar with an outline.
+ *
+ * @param   ui      Pointer to the UI.
+ * @param   x       Left edge.
+ * @param   y       Top edge.
+ * @param   width   Width in pixels, at least 3.
+ * @param   height  Height in pixels, at least 3.
+ * @param   max     Value shown as a full bar.
+ * @param   value   Initial value.
+ *
+ * @return  Widget id, UI_WIDGET_NONE if all widgets are used.
+ */
+int32_t ui_add_bar(struct Ui *ui, uint8_t x, uint8_t y, uint8_t width, uint8_t height,
+                   int32_t max, int32_t value) {
+    int32_t id = add_widget(ui, UI_WIDGET_BAR, x, y, width, height);
+
+    if (id != UI_WIDGET_NONE) {
+        ui->widgets[id].max = max;
+        ui->widgets[id].value = value;
+    }
+    return id;
+}
+
+/**
+ * @brief   Adds a scrolling list, each item shows a caption and a value in its own row.
+ *
+ * @param   ui          Pointer to the UI.
+ * @param   x           Left edge.
+ * @param   y           Top edge, preferably a multiple of UI_ROW_HEIGHT.
+ * @param   width       Width in pixels.
+ * @param   rows        Number of visible rows, at most UI_LIST_ROWS_MAX.
+ * @param   items       Items, must stay valid while the widget is used. The values are
+ *                      changed with ui_list_set_value().
+ * @param   item_count  Number of items.
+ *
+ * @return  Widget id, UI_WIDGET_NONE if all widgets are used.
+ */
+int32_t ui_add_list(struct Ui *ui, uint8_t x, uint8_t y, uint8_t width, uint8_t rows,
+                    struct UiListItem *items, uint8_t item_count) {
+    uint8_t visible = (rows > (uint8_t)UI_LIST_ROWS_MAX) ? (uint8_t)UI_LIST_ROWS_MAX : rows;
+    int32_t id = add_widget(ui, UI_WIDGET_LIST, x, y, width, visible * UI_ROW_HEIGHT);
+
+    if (id != UI_WIDGET_NONE) {
+        ui->widgets[id].items = items;
+        ui->widgets[id].item_count = item_count;
+    }
+    return id;
+}
+
+/**
+ * @brief   Changes the text of a label or the caption of a number.
+ *
+ * @param   ui      Pointer to the UI.
+ * @param   id      Widget id.
+ * @param   text    New text, must stay valid while the widget is used.
+ *
+ * @return  None
+ */
+void ui_set_text(struct Ui *ui, int32_t id, const char *text) {
+    struct UiWidget *w = widget(ui, id);
+
+    if ((w != NULL) && (w->text != text)) {
+        w->text = text;
+        w->dirty = DIRTY_ALL;
+    }
+}
+
+/**
+ * @brief   Changes the value of a number or a bar. Nothing is redrawn if it is the same.
+ *
+ * @param   ui      Pointer to the UI.
+ * @param   id      Widget id.
+ * @param   value   New value.
+ *
+ * @return  None
+ */
+void ui_set_value(struct Ui *ui, int32_t id, int32_t value) {
+    struct UiWidget *w = widget(ui, id);
+
+    if ((w != NULL) && (w->value != value)) {
+        w->value = value;
+        w->dirty_values = DIRTY_ALL;
+    }
+}
+
+/**
+ * @brief   Draws a widget with inverted colours or back with normal ones.
+ *
+ * @param   ui          Pointer to the UI.
+ * @param   id          Widget id.
+ * @param   highlighted Invert the colours.
+ *
+ * @return  None
+ */
+void ui_set_highlighted(struct Ui *ui, int32_t id, bool highlighted) {
+    struct UiWidget *w = widget(ui, id);
+
+    if ((w != NULL) && (w->highlighted != highlighted)) {
+        w->highlighted = highlighted;
+        w->dirty = DIRTY_ALL;
+    }
+}
+
+/**
+ * @brief   Changes the value of a list item, only its value field is redrawn.
+ *
+ * @param   ui      Pointer to the UI.
+ * @param   id      Widget id of the list.
+ * @param   item    Item index.
+ * @param   value   New value.
+ *
+ * @return  None
+ */
+void ui_list_set_value(struct Ui *ui, int32_t id, uint8_t item, int32_t value) {
+    struct UiWidget *w = widget(ui, id);
+
+    if ((w == NULL) || (w->type != UI_WIDGET_LIST) || (item >= w->item_count) ||
+        (w->items[item].value == value)) {
+        return;
+    }
+
+    w->items[item].value = value;
+    uint8_t rows = w->height / UI_ROW_HEIGHT;
+    if ((item >= w->first_visible) && (item < (w->first_visible + rows))) {
+        w->dirty_values |= (uint8_t)(1U << (item - w->first_visible));
+    }
+}
+
+/**
+ * @brief   Selects a list item, scrolling the list if it isn't visible.
+ *
+ * @note    Without scrolling only the rows of the old and the new selection are redrawn.
+ *
+ * @param   ui      Pointer to the UI.
+ * @param   id      Widget id of the list.
+ * @param   item    Item index.
+ *
+ * @return  None
+ */
+void ui_list_select(struct Ui *ui, int32_t id, uint8_t item) {
+    struct UiWidget *w = widget(ui, id);
+
+    if ((w == NULL) || (w->type != UI_WIDGET_LIST) || (item >= w->item_count) ||
+        (item == w->selected)) {
+        return;
+    }
+
+    uint8_t rows = w->height / UI_ROW_HEIGHT;
+    uint8_t old = w->selected;
+    w->selected = item;
+
+    if (item < w->first_visible) {
+        w->first_visible = item;
+        w->dirty = DIRTY_ALL;
+    } else if (item >= (w->first_visible + rows)) {
+        w->first_visible = item + 1U - rows;
+        w->dirty = DIRTY_ALL;
+    } else {
+        if (old >= w->first_visible) {
+            w->dirty |= (uint8_t)(1U << (old - w->first_visible));
+        }
+        w->dirty |= (uint8_t)(1U << (item - w->first_visible));
+    }
+}
+
+/**
+ * @brief   Switches between dark and light mode, everything is redrawn.
+ *
+ * @param   ui          Pointer to the UI.
+ * @param   dark_mode   Draw white on black instead of black on white.
+ *
+ * @return  None
+ */
+void ui_set_dark_mode(struct Ui *ui, bool dark_mode) {
+    if (ui->dark_mode != dark_mode) {
+        ui->dark_mode = dark_mode;
+        ui_invalidate(ui);
+    }
+}
+
+/**
+ * @brief   Marks the whole screen for redrawing.
+ *
+ * @param   ui  Pointer to the UI.
+ *
+ * @return  None
+ */
+void ui_invalidate(struct Ui *ui) {
+    ui->clear_screen = true;
+    for (uint8_t i = 0; i < ui->count; i++) {
+        ui->widgets[i].dirty = DIRTY_ALL;
+    }
+}
+
+/**
+ * @brief   Redraws the invalidated parts of all widgets into the OLED framebuffer.
+ *
+ * @note    This only draws, the changes are sent by the next OLED flush.
+ *
+ * @param   ui  Pointer to the UI.
+ *
+ * @return  Number of widgets that were redrawn.
+ */
+uint32_t ui_render(struct Ui *ui) {
+    uint32_t rendered = 0;
+
+    if (ui->clear_screen) {
+        oled_clearScreen(other(foreground(ui, false)));
+        ui->clear_screen = false;
+    }
+
+    for (uint8_t i = 0; i < ui->count; i++) {
+        struct UiWidget *w = &ui->widgets[i];
+        if ((w->dirty | w->dirty_values) == 0U) {
+            continue;
+        }
+
+        switch (w->type) {
+            case UI_WIDGET_LABEL:
+                render_label(ui, w);
+                break;
+            case UI_WIDGET_NUMBER:
+                draw_row(w->x, w->y, w->width, w->text, w->value, w->dirty == 0U,
+                         foreground(ui, w->highlighted));
+                break;
+            case UI_WIDGET_BAR:
+                render_bar(ui, w);
+                break;
+            case UI_WIDGET_LIST:
+                render_list(ui, w);
+                break;
+            default:
+                break;
+        }
+
+        w->dirty = 0;
+        w->dirty_values = 0;
+        rendered++;
+    }
+
+    return rendered;
+}
@@ -0,0 +1,92 @@
+#ifndef UI_H
+#define UI_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Retained-mode widgets for the OLED. The application creates its widgets once and then
+// only changes their state (values, selection, colours). Every change invalidates just the
+// part of a widget it affects, and ui_render() redraws those parts into the OLED
+// framebuffer, so the next flush sends only what has really changed.
+// Rows of text are one display page (8 pixels) high; placing them on page boundaries lets
+// the text be blitted without masking and keeps each row in a single page.
+
+#define UI_WIDGET_COUNT         16
+
+// Height of a text row and of a list row.
+#define UI_ROW_HEIGHT           8
+
+// Width of a character cell.
+#define UI_CHAR_WIDTH           6
+
+// Numbers are right aligned in a field this many characters wide, so changing one
+// only redraws the field.
+#define UI_VALUE_CHARS          5
+
+// Lists invalidate rows with a bitmask, so they can't show more rows than this.
+#define UI_LIST_ROWS_MAX        8
+
+// Returned instead of a widget id when all widgets are used.
+#define UI_WIDGET_NONE          (-1)
+
+enum UiWidgetType {
+    UI_WIDGET_LABEL,    // Static text.
+    UI_WIDGET_NUMBER,   // Caption and a right aligned value.
+    UI_WIDGET_BAR,      // Horizontal bar filled in proportion to its value.
+    UI_WIDGET_LIST,     // Scrolling list of captions and values with one selected item.
+};
+
+// One entry of a list widget. The array is owned by the application.
+struct UiListItem {
+    const char *caption;
+    int32_t value;
+};
+
+struct UiWidget {
+    enum UiWidgetType type;
+    uint8_t x;
+    uint8_t y;
+    uint8_t width;
+    uint8_t height;
+    bool highlighted;           // Drawn with inverted colours.
+
+    // Parts that need to be redrawn. For lists there is one bit per visible row.
+    uint8_t dirty;
+    uint8_t dirty_values;       // Only the value field needs to be redrawn.
+
+    const char *text;           // Label text, number caption.
+    int32_t value;              // Number value, bar level.
+    int32_t max;                // Bar level shown as a full bar.
+    int32_t drawn;              // Bar level currently in the framebuffer.
+
+    struct UiListItem *items;
+    uint8_t item_count;
+    uint8_t selected;
+    uint8_t first_visible;
+};
+
+struct Ui {
+    struct UiWidget widgets[UI_WIDGET_COUNT];
+    uint8_t count;
+    bool dark_mode;
+    bool clear_screen;          // The background outside the widgets needs to be redrawn too.
+};
+
+void ui_init(struct Ui *ui, bool dark_mode);
+int32_t ui_add_label(struct Ui *ui, uint8_t x, uint8_t y, uint8_t width, const char *text);
+int32_t ui_add_number(struct Ui *ui, uint8_t x, uint8_t y, uint8_t width, const char *caption,
+                      int32_t value);
+int32_t ui_add_bar(struct Ui *ui, uint8_t x, uint8_t y, uint8_t width, uint8_t height,
+                   int32_t max, int32_t value);
+int32_t ui_add_list(struct Ui *ui, uint8_t x, uint8_t y, uint8_t width, uint8_t rows,
+                    struct UiListItem *items, uint8_t item_count);
+void ui_set_text(struct Ui *ui, int32_t id, const char *text);
+void ui_set_value(struct Ui *ui, int32_t id, int32_t value);
+void ui_set_highlighted(struct Ui *ui, int32_t id, bool highlighted);
+void ui_list_set_value(struct Ui *ui, int32_t id, uint8_t item, int32_t value);
+void ui_list_select(struct Ui *ui, int32_t id, uint8_t item);
+void ui_set_dark_mode(struct Ui *ui, bool dark_mode);
+void ui_invalidate(struct Ui *ui);
+uint32_t ui_render(struct Ui *ui);
+
+#endif
@@ -0,0 +1,196 @@
+#include "voice_alloc.h"
+
+#if VOICE_ALLOC_VOICE_COUNT >= VOICE_ALLOC_NONE
+#error "VOICE_ALLOC_VOICE_COUNT must leave room for VOICE_ALLOC_NONE in uint8_t"
+#endif
+
+/**
+ * @brief   Removes a voice from the list it is in.
+ *
+ * @param   alloc   Pointer to the allocator.
+ * @param   voice   Voice index.
+ *
+ * @return  None
+ */
+static void list_remove(struct VoiceAllocator *alloc, uint8_t voice) {
+    struct VoiceAllocList *list = &alloc->lists[alloc->state[voice]];
+    uint8_t prev = alloc->prev[voice];
+    uint8_t next = alloc->next[voice];
+
+    if (prev != VOICE_ALLOC_NONE) {
+        alloc->next[prev] = next;
+    } else {
+        list->head = next;
+    }
+    if (next != VOICE_ALLOC_NONE) {
+        alloc->prev[next] = prev;
+    } else {
+        list->tail = prev;
+    }
+}
+
+/**
+ * @brief   Appends a voice to the end (newest side) of a list and sets its state.
+ *
+ * @param   alloc   Pointer to the allocator.
+ * @param   voice   Voice index, must not be in any list.
+ * @param   state   List to add the voice to.
+ *
+ * @return  None
+ */
+static void list_append(struct VoiceAllocator *alloc, uint8_t voice, enum VoiceAllocState state) {
+    struct VoiceAllocList *list = &alloc->lists[state];
+
+    alloc->state[voice] = (uint8_t)state;
+    alloc->prev[voice] = list->tail;
+    alloc->next[voice] = VOICE_ALLOC_NONE;
+    if (list->tail != VOICE_ALLOC_NONE) {
+        alloc->next[list->tail] = voice;
+    } else {
+        list->head = voice;
+    }
+    list->tail = voice;
+}
+
+/**
+ * @brief   Moves a voice to the end of another list, or of its own list.
+ *
+ * @param   alloc   Pointer to the allocator.
+ * @param   voice   Voice index.
+ * @param   state   List to move the voice to.
+ *
+ * @return  None
+ */
+static void list_move(struct VoiceAllocator *alloc, uint8_t voice, enum VoiceAllocState state) {
+    list_remove(alloc, voice);
+    list_append(alloc, voice, state);
+}
+
+/**
+ * @brief   Frees all voices and clears the note map.
+ *
+ * @param   alloc   Pointer to the allocator.
+ *
+ * @return  None
+ */
+void voice_alloc_init(struct VoiceAllocator *alloc) {
+    for (uint32_t s = 0; s < (uint32_t)VOICE_ALLOC_STATE_COUNT; s++) {
+        alloc->lists[s].head = VOICE_ALLOC_NONE;
+        alloc->lists[s].tail = VOICE_ALLOC_NONE;
+    }
+    for (uint32_t c = 0; c < (uint32_t)VOICE_ALLOC_CHANNEL_COUNT; c++) {
+        for (uint32_t n = 0; n < (uint32_t)VOICE_ALLOC_NOTE_COUNT; n++) {
+            alloc->voice_of_note[c][n] = VOICE_ALLOC_NONE;
+        }
+    }
+    for (uint32_t v = 0; v < (uint32_t)VOICE_ALLOC_VOICE_COUNT; v++) {
+        alloc->channel[v] = 0;
+        alloc->note[v] = 0;
+        list_append(alloc, (uint8_t)v, VOICE_ALLOC_FREE);
+    }
+    alloc->stolen = 0;
+}
+
+/**
+ * @brief   Picks a voice for a new note and marks it as held.
+ *
+ * @note    A note that is already sounding on the channel keeps its voice. Otherwise a free
+ *          voice is used, then the oldest released one (it has been fading out the longest,
+ *          so it is the quietest) and as a last resort the oldest held note is stolen.
+ *          Every case takes constant time.
+ *
+ * @param   alloc   Pointer to the allocator.
+ * @param   channel MIDI channel, 0 - 15.
+ * @param   note    MIDI note number, 0 - 127.
+ *
+ * @return  Voice index, VOICE_ALLOC_NONE if channel or note is out of range.
+ */
+uint8_t voice_alloc_note_on(struct VoiceAllocator *alloc, uint8_t channel, uint8_t note) {
+    uint8_t voice;
+
+    if ((channel >= (uint8_t)VOICE_ALLOC_CHANNEL_COUNT) || (note >= (uint8_t)VOICE_ALLOC_NOTE_COUNT)) {
+        return VOICE_ALLOC_NONE;
+    }
+
+    voice = alloc->voice_of_note[channel][note];
+    if (voice == VOICE_ALLOC_NONE) {
+        if (alloc->lists[VOICE_ALLOC_FREE].head != VOICE_ALLOC_NONE) {
+            voice = alloc->lists[VOICE_ALLOC_FREE].head;
+        } else {
+            if (alloc->lists[VOICE_ALLOC_RELEASED].head != VOICE_ALLOC_NONE) {
+                voice = alloc->lists[VOICE_ALLOC_RELEASED].head;
+            } else {
+                voice = alloc->lists[VOICE_ALLOC_HELD].head;
+                alloc->stolen++;
+            }
+            // The previous note of the voice no longer has one.
+            alloc->voice_of_note[alloc->channel[voice]][alloc->note[voice]] = VOICE_ALLOC_NONE;
+        }
+        alloc->channel[voice] = channel;
+        alloc->note[voice] = note;
+        alloc->voice_of_note[channel][note] = voice;
+    }
+
+    // A retriggered note counts as the newest one.
+    list_move(alloc, voice, VOICE_ALLOC_HELD);
+
+    return voice;
+}
+
+/**
+ * @brief   Marks the voice playing a note as released.
+ *
+ * @note    The voice keeps its note, so it can be retriggered until it is reused or freed
+ *          with voice_alloc_free() once it has faded out.
+ *
+ * @param   alloc   Pointer to the allocator.
+ * @param   channel MIDI channel, 0 - 15.
+ * @param   note    MIDI note number, 0 - 127.
+ *
+ * @return  Voice index, VOICE_ALLOC_NONE if the note wasn't held.
+ */
+uint8_t voice_alloc_note_off(struct VoiceAllocator *alloc, uint8_t channel, uint8_t note) {
+    uint8_t voice = voice_alloc_find(alloc, channel, note);
+
+    if ((voice != VOICE_ALLOC_NONE) && (alloc->state[voice] == (uint8_t)VOICE_ALLOC_HELD)) {
+        list_move(alloc, voice, VOICE_ALLOC_RELEASED);
+    } else {
+        voice = VOICE_ALLOC_NONE;
+    }
+
+    return voice;
+}
+
+/**
+ * @brief   Finds the voice playing a note.
+ *
+ * @param   alloc   Pointer to the allocator.
+ * @param   channel MIDI channel, 0 - 15.
+ * @param   note    MIDI note number, 0 - 127.
+ *
+ * @return  Voice index, VOICE_ALLOC_NONE if no voice plays the note.
+ */
+uint8_t voice_alloc_find(const struct VoiceAllocator *alloc, uint8_t channel, uint8_t note) {
+    uint8_t voice = VOICE_ALLOC_NONE;
+
+    if ((channel < (uint8_t)VOICE_ALLOC_CHANNEL_COUNT) && (note < (uint8_t)VOICE_ALLOC_NOTE_COUNT)) {
+        voice = alloc->voice_of_note[channel][note];
+    }
+
+    return voice;
+}
+
+/**
+ * @brief   Returns a voice to the free list, e.g. when its release has finished.
+ *
+ * @param   alloc   Pointer to the allocator.
+ * @param   voice   Voice index.
+ *
+ * @return  None
+ */
+void voice_alloc_free(struct VoiceAllocator *alloc, uint8_t voice) {
+    if ((voice < (uint8_t)VOICE_ALLOC_VOICE_COUNT) && (alloc->state[voice] != (uint8_t)VOICE_ALLOC_FREE)) {
+        alloc->voice_of_note[alloc->channel[voice]][alloc->note[voice]] = VOICE_ALLOC_NONE;
+        list_move(alloc, voice, VOICE_ALLOC_FREE);
+    }
+}
@@ -0,0 +1,52 @@
+#ifndef VOICE_ALLOC_H
+#define VOICE_ALLOC_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Maps MIDI (channel, note) pairs to synth voices in constant time.
+// Every voice is in exactly one of three lists: free, released (note off received, the
+// voice is fading out) and held. The released and held lists are kept in the order the
+// voices entered them, so the head of each list is its oldest voice and stealing never
+// has to scan the voices.
+// This module doesn't touch any peripherals, so it can also be compiled and tested on a PC.
+
+#define VOICE_ALLOC_VOICE_COUNT     16
+#define VOICE_ALLOC_CHANNEL_COUNT   16
+#define VOICE_ALLOC_NOTE_COUNT      128
+
+// Returned instead of a voice index when there is no voice.
+#define VOICE_ALLOC_NONE            0xFFU
+
+enum VoiceAllocState {
+    VOICE_ALLOC_FREE,
+    VOICE_ALLOC_RELEASED,
+    VOICE_ALLOC_HELD,
+    VOICE_ALLOC_STATE_COUNT,
+};
+
+// Doubly linked list of voice indices, VOICE_ALLOC_NONE marks the ends.
+struct VoiceAllocList {
+    uint8_t head;   // Oldest voice.
+    uint8_t tail;   // Newest voice.
+};
+
+struct VoiceAllocator {
+    struct VoiceAllocList lists[VOICE_ALLOC_STATE_COUNT];
+    uint8_t prev[VOICE_ALLOC_VOICE_COUNT];
+    uint8_t next[VOICE_ALLOC_VOICE_COUNT];
+    uint8_t state[VOICE_ALLOC_VOICE_COUNT];     // enum VoiceAllocState
+    uint8_t channel[VOICE_ALLOC_VOICE_COUNT];   // Note and channel of a used voice.
+    uint8_t note[VOICE_ALLOC_VOICE_COUNT];
+    // Voice playing each note, VOICE_ALLOC_NONE if there is none.
+    uint8_t voice_of_note[VOICE_ALLOC_CHANNEL_COUNT][VOICE_ALLOC_NOTE_COUNT];
+    uint32_t stolen;    // Number of notes cut off to make room for new ones.
+};
+
+void voice_alloc_init(struct VoiceAllocator *alloc);
+uint8_t voice_alloc_note_on(struct VoiceAllocator *alloc, uint8_t channel, uint8_t note);
+uint8_t voice_alloc_note_off(struct VoiceAllocator *alloc, uint8_t channel, uint8_t note);
+uint8_t voice_alloc_find(const struct VoiceAllocator *alloc, uint8_t channel, uint8_t note);
+void voice_alloc_free(struct VoiceAllocator *alloc, uint8_t voice);
+
+#endif
@@ -0,0 +1,103 @@
+#include "vu_meter.h"
+
+#include "synth.h"
+
+// The envelopes are updated once per block, every 2 ms.
+// The peak follows rises at once, is held for PEAK_HOLD_BLOCKS (0.5 s) and then falls by 1/256 of
+// itself per block, about 17 dB per second.
+#define PEAK_HOLD_BLOCKS        250U
+#define PEAK_DECAY_SHIFT        8
+// The mean square is smoothed over 2^RMS_SMOOTH_SHIFT blocks (128 ms), about the
+// integration time of an analog VU meter.
+#define RMS_SMOOTH_SHIFT        6
+
+// Both envelopes have 8 fraction bits, so small levels still rise and fall smoothly.
+#define ENVELOPE_SHIFT          8
+
+// Written by the audio interrupt, read by the main loop. Single words, so a read always
+// sees a whole value.
+static volatile uint32_t peak_envelope = 0;
+static volatile uint32_t square_envelope = 0;
+static uint32_t peak_hold = 0;
+
+/**
+ * @brief   Integer square root, rounded down.
+ *
+ * @param   value   Number to take the root of.
+ *
+ * @return  uint32_t    The root.
+ */
+static uint32_t isqrt(uint32_t value) {
+    uint32_t root = 0;
+    uint32_t bit = 1UL << 30;
+
+    while (bit > value) {
+        bit >>= 2;
+    }
+    while (bit != 0U) {
+        if (value >= (root + bit)) {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+/**
+ * @brief   Updates the peak and RMS envelopes with a rendered block.
+ *
+ * @note    Called from the audio interrupt after every block.
+ *
+ * @param   dac_buffer  Block in the DACR format written by synth_render_block().
+ * @param   count       Number of samples in the block, a multiple of VU_METER_STRIDE.
+ *
+ * @return  None
+ */
+void vu_meter_capture(const uint32_t *dac_buffer, uint32_t count) {
+    uint32_t peak = 0;
+    uint32_t sum = 0;
+
+    for (uint32_t i = 0; i < count; i += VU_METER_STRIDE) {
+        int32_t value = (int32_t)((dac_buffer[i] >> DAC_VALUE_SHIFT) & DAC_VALUE_MAX) - DAC_VALUE_CENTER;
+        uint32_t magnitude = (uint32_t)((value < 0) ? -value : value);
+        if (magnitude > peak) {
+            peak = magnitude;
+        }
+        sum += magnitude * magnitude;
+    }
+
+    uint32_t square = (sum / (count / VU_METER_STRIDE)) << ENVELOPE_SHIFT;
+    uint32_t envelope = peak_envelope;
+    peak <<= ENVELOPE_SHIFT;
+    if (peak >= envelope) {
+        envelope = peak;
+        peak_hold = PEAK_HOLD_BLOCKS;
+    } else if (peak_hold > 0U) {
+        peak_hold--;
+    } else {
+        envelope -= envelope >> PEAK_DECAY_SHIFT;
+    }
+    peak_envelope = envelope;
+
+    // One pole low pass, done in signed arithmetic because the square may be below it.
+    int32_t smoothed = (int32_t)square_envelope;
+    smoothed += ((int32_t)square - smoothed) / (1 << RMS_SMOOTH_SHIFT);
+    square_envelope = (uint32_t)smoothed;
+}
+
+/**
+ * @brief   Reads the current levels.
+ *
+ * @note    Called from the main loop, at any rate.
+ *
+ * @param   levels  Filled with the RMS and peak amplitude in DAC steps.
+ *
+ * @return  None
+ */
+void vu_meter_read(struct VuLevels *levels) {
+    levels->peak = (uint16_t)(peak_envelope >> ENVELOPE_SHIFT);
+    levels->rms = (uint16_t)(isqrt(square_envelope) >> (ENVELOPE_SHIFT / 2));
+}
@@ -0,0 +1,27 @@
+#ifndef VU_METER_H
+#define VU_METER_H
+
+#include <stdint.h>
+
+// Level meter of the synth output. The audio interrupt folds every rendered block into a
+// peak and an RMS envelope, looking at every VU_METER_STRIDE-th sample only, so the audio
+// path pays a few dozen operations per block. The main loop reads the envelopes at the
+// much lower rate the LEDs are updated with; the peak is held long enough that peaks
+// between two reads aren't lost.
+
+// Samples looked at per block: one in four, 8 kHz.
+#define VU_METER_STRIDE         4
+
+// The LED meter is updated about 30 times per second.
+#define VU_METER_PERIOD_MS      33
+
+// Levels are amplitudes in DAC steps, 0 - 511 for a full scale wave.
+struct VuLevels {
+    uint16_t rms;
+    uint16_t peak;
+};
+
+void vu_meter_capture(const uint32_t *dac_buffer, uint32_t count);
+void vu_meter_read(struct VuLevels *levels);
+
+#endif
@@ -0,0 +1,2771 @@
+// This file is generated by tools/gen_wavetables.py, do not edit it by hand.
+
+#include "wavetables.h"
+
+const int16_t wavetable_sine[WAVE_SAMPLES_COUNT + 1] = {
+         0,    201,    402,    603,    804,   1005,   1206,   1407,   1608,   1809,   2009,   2210,
+      2410,   2611,   2811,   3012,   3212,   3412,   3612,   3811,   4011,   4210,   4410,   4609,
+      4808,   5007,   5205,   5404,   5602,   5800,   5998,   6195,   6393,   6590,   6786,   6983,
+      7179,   7375,   7571,   7767,   7962,   8157,   8351,   8545,   8739,   8933,   9126,   9319,
+      9512,   9704,   9896,  10087,  10278,  10469,  10659,  10849,  11039,  11228,  11417,  11605,
+     11793,  11980,  12167,  12353,  12539,  12725,  12910,  13094,  13279,  13462,  13645,  13828,
+     14010,  14191,  14372,  14553,  14732,  14912,  15090,  15269,  15446,  15623,  15800,  15976,
+     16151,  16325,  16499,  16673,  16846,  17018,  17189,  17360,  17530,  17700,  17869,  18037,
+     18204,  18371,  18537,  18703,  18868,  19032,  19195,  19357,  19519,  19680,  19841,  20000,
+     20159,  20317,  20475,  20631,  20787,  20942,  21096,  21250,  21403,  21554,  21705,  21856,
+     22005,  22154,  22301,  22448,  22594,  22739,  22884,  23027,  23170,  23311,  23452,  23592,
+     23731,  23870,  24007,  24143,  24279,  24413,  24547,  24680,  24811,  24942,  25072,  25201,
+     25329,  25456,  25582,  25708,  25832,  25955,  26077,  26198,  26319,  26438,  26556,  26674,
+     26790,  26905,  27019,  27133,  27245,  27356,  27466,  27575,  27683,  27790,  27896,  28001,
+     28105,  28208,  28310,  28411,  28510,  28609,  28706,  28803,  28898,  28992,  29085,  29177,
+     29268,  29358,  29447,  29534,  29621,  29706,  29791,  29874,  29956,  30037,  30117,  30195,
+     30273,  30349,  30424,  30498,  30571,  30643,  30714,  30783,  30852,  30919,  30985,  31050,
+     31113,  31176,  31237,  31297,  31356,  31414,  31470,  31526,  31580,  31633,  31685,  31736,
+     31785,  31833,  31880,  31926,  31971,  32014,  32057,  32098,  32137,  32176,  32213,  32250,
+     32285,  32318,  32351,  32382,  32412,  32441,  32469,  32495,  32521,  32545,  32567,  32589,
+     32609,  32628,  32646,  32663,  32678,  32692,  32705,  32717,  32728,  32737,  32745,  32752,
+     32757,  32761,  32765,  32766,  32767,  32766,  32765,  32761,  32757,  32752,  32745,  32737,
+     32728,  32717,  32705,  32692,  32678,  32663,  32646,  32628,  32609,  32589,  32567,  32545,
+     32521,  32495,  32469,  32441,  32412,  32382,  32351,  32318,  32285,  32250,  32213,  32176,
+     32137,  32098,  32057,  32014,  31971,  31926,  31880,  31833,  31785,  31736,  31685,  31633,
+     31580,  31526,  31470,  31414,  31356,  31297,  31237,  31176,  31113,  31050,  30985,  30919,
+     30852,  30783,  30714,  30643,  30571,  30498,  30424,  30349,  30273,  30195,  30117,  30037,
+     29956,  29874,  29791,  29706,  29621,  29534,  29447,  29358,  29268,  29177,  29085,  28992,
+     28898,  28803,  28706,  28609,  28510,  28411,  28310,  28208,  28105,  28001,  27896,  27790,
+     27683,  27575,  27466,  27356,  27245,  27133,  27019,  26905,  26790,  26674,  26556,  26438,
+     26319,  26198,  26077,  25955,  25832,  25708,  25582,  25456,  25329,  25201,  25072,  24942,
+     24811,  24680,  24547,  24413,  24279,  24143,  24007,  23870,  23731,  23592,  23452,  23311,
+     23170,  23027,  22884,  22739,  22594,  22448,  22301,  22154,  22005,  21856,  21705,  21554,
+     21403,  21250,  21096,  20942,  20787,  20631,  20475,  20317,  20159,  20000,  19841,  19680,
+     19519,  19357,  19195,  19032,  18868,  18703,  18537,  18371,  18204,  18037,  17869,  17700,
+     17530,  17360,  17189,  17018,  16846,  16673,  16499,  16325,  16151,  15976,  15800,  15623,
+     15446,  15269,  15090,  14912,  14732,  14553,  14372,  14191,  14010,  13828,  13645,  13462,
+     13279,  13094,  12910,  12725,  12539,  12353,  12167,  11980,  11793,  11605,  11417,  11228,
+     11039,  10849,  10659,  10469,  10278,  10087,   9896,   9704,   9512,   9319,   9126,   8933,
+      8739,   8545,   8351,   8157,   7962,   7767,   7571,   7375,   7179,   6983,   6786,   6590,
+      6393,   6195,   5998,   5800,   5602,   5404,   5205,   5007,   4808,   4609,   4410,   4210,
+      4011,   3811,   3612,   3412,   3212,   3012,   2811,   2611,   2410,   2210,   2009,   1809,
+      1608,   1407,   1206,   1005,    804,    603,    402,    201,      0,   -201,   -402,   -603,
+      -804,  -1005,  -1206,  -1407,  -1608,  -1809,  -2009,  -2210,  -2410,  -2611,  -2811,  -3012,
+     -3212,  -3412,  -3612,  -3811,  -4011,  -4210,  -4410,  -4609,  -4808,  -5007,  -5205,  -5404,
+     -5602,  -5800,  -5998,  -6195,  -6393,  -6590,  -6786,  -6983,  -7179,  -7375,  -7571,  -7767,
+     -7962,  -8157,  -8351,  -8545,  -8739,  -8933,  -9126,  -9319,  -9512,  -9704,  -9896, -10087,
+    -10278, -10469, -10659, -10849, -11039, -11228, -11417, -11605, -11793, -11980, -12167, -12353,
+    -12539, -12725, -12910, -13094, -13279, -13462, -13645, -13828, -14010, -14191, -14372, -14553,
+    -14732, -14912, -15090, -15269, -15446, -15623, -15800, -15976, -16151, -16325, -16499, -16673,
+    -16846, -17018, -17189, -17360, -17530, -17700, -17869, -18037, -18204, -18371, -18537, -18703,
+    -18868, -19032, -19195, -19357, -19519, -19680, -19841, -20000, -20159, -20317, -20475, -20631,
+    -20787, -20942, -21096, -21250, -21403, -21554, -21705, -21856, -22005, -22154, -22301, -22448,
+    -22594, -22739, -22884, -23027, -23170, -23311, -23452, -23592, -23731, -23870, -24007, -24143,
+    -24279, -24413, -24547, -24680, -24811, -24942, -25072, -25201, -25329, -25456, -25582, -25708,
+    -25832, -25955, -26077, -26198, -26319, -26438, -26556, -26674, -26790, -26905, -27019, -27133,
+    -27245, -27356, -27466, -27575, -27683, -27790, -27896, -28001, -28105, -28208, -28310, -28411,
+    -28510, -28609, -28706, -28803, -28898, -28992, -29085, -29177, -29268, -29358, -29447, -29534,
+    -29621, -29706, -29791, -29874, -29956, -30037, -30117, -30195, -30273, -30349, -30424, -30498,
+    -30571, -30643, -30714, -30783, -30852, -30919, -30985, -31050, -31113, -31176, -31237, -31297,
+    -31356, -31414, -31470, -31526, -31580, -31633, -31685, -31736, -31785, -31833, -31880, -31926,
+    -31971, -32014, -32057, -32098, -32137, -32176, -32213, -32250, -32285, -32318, -32351, -32382,
+    -32412, -32441, -32469, -32495, -32521, -32545, -32567, -32589, -32609, -32628, -32646, -32663,
+    -32678, -32692, -32705, -32717, -32728, -32737, -32745, -32752, -32757, -32761, -32765, -32766,
+    -32767, -32766, -32765, -32761, -32757, -32752, -32745, -32737, -32728, -32717, -32705, -32692,
+    -32678, -32663, -32646, -32628, -32609, -32589, -32567, -32545, -32521, -32495, -32469, -32441,
+    -32412, -32382, -32351, -32318, -32285, -32250, -32213, -32176, -32137, -32098, -32057, -32014,
+    -31971, -31926, -31880, -31833, -31785, -31736, -31685, -31633, -31580, -31526, -31470, -31414,
+    -31356, -31297, -31237, -31176, -31113, -31050, -30985, -30919, -30852, -30783, -30714, -30643,
+    -30571, -30498, -30424, -30349, -30273, -30195, -30117, -30037, -29956, -29874, -29791, -29706,
+    -29621, -29534, -29447, -29358, -29268, -29177, -29085, -28992, -28898, -28803, -28706, -28609,
+    -28510, -28411, -28310, -28208, -28105, -28001, -27896, -27790, -27683, -27575, -27466, -27356,
+    -27245, -27133, -27019, -26905, -26790, -26674, -26556, -26438, -26319, -26198, -26077, -25955,
+    -25832, -25708, -25582, -25456, -25329, -25201, -25072, -24942, -24811, -24680, -24547, -24413,
+    -24279, -24143, -24007, -23870, -23731, -23592, -23452, -23311, -23170, -23027, -22884, -22739,
+    -22594, -22448, -22301, -22154, -22005, -21856, -21705, -21554, -21403, -21250, -21096, -20942,
+    -20787, -20631, -20475, -20317, -20159, -20000, -19841, -19680, -19519, -19357, -19195, -19032,
+    -18868, -18703, -18537, -18371, -18204, -18037, -17869, -17700, -17530, -17360, -17189, -17018,
+    -16846, -16673, -16499, -16325, -16151, -15976, -15800, -15623, -15446, -15269, -15090, -14912,
+    -14732, -14553, -14372, -14191, -14010, -13828, -13645, -13462, -13279, -13094, -12910, -12725,
+    -12539, -12353, -12167, -11980, -11793, -11605, -11417, -11228, -11039, -10849, -10659, -10469,
+    -10278, -10087,  -9896,  -9704,  -9512,  -9319,  -9126,  -8933,  -8739,  -8545,  -8351,  -8157,
+     -7962,  -7767,  -7571,  -7375,  -7179,  -6983,  -6786,  -6590,  -6393,  -6195,  -5998,  -5800,
+     -5602,  -5404,  -5205,  -5007,  -4808,  -4609,  -4410,  -4210,  -4011,  -3811,  -3612,  -3412,
+     -3212,  -3012,  -2811,  -2611,  -2410,  -2210,  -2009,  -1809,  -1608,  -1407,  -1206,  -1005,
+      -804,   -603,   -402,   -201,      0,
+};
+
+const int16_t wavetable_saw[WAVE_MIPMAP_LEVELS][WAVE_SAMPLES_COUNT + 1] = {
+    // Level 0, harmonics 1 - 511
+    {
+             0, -32767, -25025, -29518, -26228, -28686, -26578, -28261, -26701, -27975, -26732, -27753,
+        -26717, -27565, -26675, -27399, -26617, -27246, -26547, -27102, -26470, -26965, -26387, -26833,
+        -26299, -26705, -26209, -26579, -26115, -26456, -26020, -26335, -25923, -26215, -25825, -26096,
+        -25725, -25979, -25625, -25862, -25524, -25746, -25422, -25631, -25319, -25517, -25216, -25402,
+        -25112, -25289, -25008, -25176, -24904, -25063, -24799, -24950, -24694, -24838, -24589, -24725,
+        -24483, -24613, -24378, -24502, -24272, -24390, -24166, -24279, -24060, -24168, -23953, -24057,
+        -23847, -23946, -23740, -23835, -23634, -23724, -23527, -23613, -23420, -23503, -23313, -23392,
+        -23206, -23282, -23099, -23172, -22991, -23061, -22884, -22951, -22777, -22841, -22669, -22731,
+        -22562, -22621, -22454, -22511, -22347, -22401, -22239, -22291, -22132, -22182, -22024, -22072,
+        -21916, -21962, -21808, -21852, -21701, -21743, -21593, -21633, -21485, -21523, -21377, -21414,
+        -21269, -21304, -21161, -21195, -21053, -21085, -20945, -20976, -20837, -20866, -20729, -20757,
+        -20621, -20647, -20513, -20538, -20405, -20428, -20297, -20319, -20189, -20210, -20081, -20100,
+        -19973, -19991, -19864, -19882, -19756, -19772, -19648, -19663, -19540, -19554, -19432, -19445,
+        -19323, -19335, -19215, -19226, -19107, -19117, -18999, -19008, -18890, -18899, -18782, -18789,
+        -18674, -18680, -18565, -18571, -18457, -18462, -18349, -18353, -18240, -18244, -18132, -18134,
+        -18024, -18025, -17915, -17916, -17807, -17807, -17699, -17698, -17590, -17589, -17482, -17480,
+        -17373, -17371, -17265, -17262, -17157, -17152, -17048, -17043, -16940, -16934, -16831, -16825,
+        -16723, -16716, -16614, -16607, -16506, -16498, -16398, -16389, -16289, -16280, -16181, -16171,
+        -16072, -16062, -15964, -15953, -15855, -15844, -15747, -15735, -15638, -15626, -15530, -15517,
+        -15421, -15408, -15313, -15299, -15204, -15190, -15096, -15081, -14987, -14972, -14879, -14863,
+        -14770, -14754, -14662, -14645, -14553, -14536, -14445, -14427, -14336, -14318, -14228, -14209,
+        -14119, -14100, -14011, -13991, -13902, -13882, -13794, -13773, -13685, -13664, -13576, -13555,
+        -13468, -13446, -13359, -13337, -13251, -13229, -13142, -13120, -13034, -13011, -12925, -12902,
+        -12817, -12793, -12708, -12684, -12600, -12575, -12491, -12466, -12382, -12357, -12274, -12248,
+        -12165, -12139, -12057, -12030, -11948, -11921, -11840, -11812, -11731, -11704, -11622, -11595,
+        -11514, -11486, -11405, -11377, -11297, -11268, -11188, -11159, -11080, -11050, -10971, -10941,
+        -10862, -10832, -10754, -10723, -10645, -10614, -10537, -10506, -10428, -10397, -10319, -10288,
+        -10211, -10179, -10102, -10070,  -9994,  -9961,  -9885,  -9852,  -9776,  -9743,  -9668,  -9634,
+         -9559,  -9526,  -9451,  -9417,  -9342,  -9308,  -9233,  -9199,  -9125,  -9090,  -9016,  -8981,
+         -8908,  -8872,  -8799,  -8763,  -8690,  -8654,  -8582,  -8546,  -8473,  -8437,  -8365,  -8328,
+         -8256,  -8219,  -8147,  -8110,  -8039,  -8001,  -7930,  -7892,  -7821,  -7783,  -7713,  -7675,
+         -7604,  -7566,  -7496,  -7457,  -7387,  -7348,  -7278,  -7239,  -7170,  -7130,  -7061,  -7021,
+         -6953,  -6912,  -6844,  -6804,  -6735,  -6695,  -6627,  -6586,  -6518,  -6477,  -6409,  -6368,
+         -6301,  -6259,  -6192,  -6150,  -6084,  -6041,  -5975,  -5933,  -5866,  -5824,  -5758,  -5715,
+         -5649,  -5606,  -5540,  -5497,  -5432,  -5388,  -5323,  -5279,  -5215,  -5171,  -5106,  -5062,
+         -4997,  -4953,  -4889,  -4844,  -4780,  -4735,  -4671,  -4626,  -4563,  -4517,  -4454,  -4409,
+         -4345,  -4300,  -4237,  -4191,  -4128,  -4082,  -4020,  -3973,  -3911,  -3864,  -3802,  -3755,
+         -3694,  -3647,  -3585,  -3538,  -3476,  -3429,  -3368,  -3320,  -3259,  -3211,  -3151,  -3102,
+         -3042,  -2993,  -2933,  -2885,  -2825,  -2776,  -2716,  -2667,  -2607,  -2558,  -2499,  -2449,
+         -2390,  -2340,  -2281,  -2231,  -2173,  -2123,  -2064,  -2014,  -1955,  -1905,  -1847,  -1796,
+         -1738,  -1687,  -1630,  -1578,  -1521,  -1469,  -1412,  -1361,  -1304,  -1252,  -1195,  -1143,
+         -1086,  -1034,   -978,   -925,   -869,   -816,   -760,   -708,   -652,   -599,   -543,   -490,
+          -435,   -381,   -326,   -272,   -217,   -163,   -109,    -54,      0,     54,    109,    163,
+           217,    272,    326,    381,    435,    490,    543,    599,    652,    708,    760,    816,
+           869,    925,    978,   1034,   1086,   1143,   1195,   1252,   1304,   1361,   1412,   1469,
+          1521,   1578,   1630,   1687,   1738,   1796,   1847,   1905,   1955,   2014,   2064,   2123,
+          2173,   2231,   2281,   2340,   2390,   2449,   2499,   2558,   2607,   2667,   2716,   2776,
+          2825,   2885,   2933,   2993,   3042,   3102,   3151,   3211,   3259,   3320,   3368,   3429,
+          3476,   3538,   3585,   3647,   3694,   3755,   3802,   3864,   3911,   3973,   4020,   4082,
+          4128,   4191,   4237,   4300,   4345,   4409,   4454,   4517,   4563,   4626,   4671,   4735,
+          4780,   4844,   4889,   4953,   4997,   5062,   5106,   5171,   5215,   5279,   5323,   5388,
+          5432,   5497,   5540,   5606,   5649,   5715,   5758,   5824,   5866,   5933,   5975,   6041,
+          6084,   6150,   6192,   6259,   6301,   6368,   6409,   6477,   6518,   6586,   6627,   6695,
+          6735,   6804,   6844,   6912,   6953,   7021,   7061,   7130,   7170,   7239,   7278,   7348,
+          7387,   7457,   7496,   7566,   7604,   7675,   7713,   7783,   7821,   7892,   7930,   8001,
+          8039,   8110,   8147,   8219,   8256,   8328,   8365,   8437,   8473,   8546,   8582,   8654,
+          8690,   8763,   8799,   8872,   8908,   8981,   9016,   9090,   9125,   9199,   9233,   9308,
+          9342,   9417,   9451,   9526,   9559,   9634,   9668,   9743,   9776,   9852,   9885,   9961,
+          9994,  10070,  10102,  10179,  10211,  10288,  10319,  10397,  10428,  10506,  10537,  10614,
+         10645,  10723,  10754,  10832,  10862,  10941,  10971,  11050,  11080,  11159,  11188,  11268,
+         11297,  11377,  11405,  11486,  11514,  11595,  11622,  11704,  11731,  11812,  11840,  11921,
+         11948,  12030,  12057,  12139,  12165,  12248,  12274,  12357,  12382,  12466,  12491,  12575,
+         12600,  12684,  12708,  12793,  12817,  12902,  12925,  13011,  13034,  13120,  13142,  13229,
+         13251,  13337,  13359,  13446,  13468,  13555,  13576,  13664,  13685,  13773,  13794,  13882,
+         13902,  13991,  14011,  14100,  14119,  14209,  14228,  14318,  14336,  14427,  14445,  14536,
+         14553,  14645,  14662,  14754,  14770,  14863,  14879,  14972,  14987,  15081,  15096,  15190,
+         15204,  15299,  15313,  15408,  15421,  15517,  15530,  15626,  15638,  15735,  15747,  15844,
+         15855,  15953,  15964,  16062,  16072,  16171,  16181,  16280,  16289,  16389,  16398,  16498,
+         16506,  16607,  16614,  16716,  16723,  16825,  16831,  16934,  16940,  17043,  17048,  17152,
+         17157,  17262,  17265,  17371,  17373,  17480,  17482,  17589,  17590,  17698,  17699,  17807,
+         17807,  17916,  17915,  18025,  18024,  18134,  18132,  18244,  18240,  18353,  18349,  18462,
+         18457,  18571,  18565,  18680,  18674,  18789,  18782,  18899,  18890,  19008,  18999,  19117,
+         19107,  19226,  19215,  19335,  19323,  19445,  19432,  19554,  19540,  19663,  19648,  19772,
+         19756,  19882,  19864,  19991,  19973,  20100,  20081,  20210,  20189,  20319,  20297,  20428,
+         20405,  20538,  20513,  20647,  20621,  20757,  20729,  20866,  20837,  20976,  20945,  21085,
+         21053,  21195,  21161,  21304,  21269,  21414,  21377,  21523,  21485,  21633,  21593,  21743,
+         21701,  21852,  21808,  21962,  21916,  22072,  22024,  22182,  22132,  22291,  22239,  22401,
+         22347,  22511,  22454,  22621,  22562,  22731,  22669,  22841,  22777,  22951,  22884,  23061,
+         22991,  23172,  23099,  23282,  23206,  23392,  23313,  23503,  23420,  23613,  23527,  23724,
+         23634,  23835,  23740,  23946,  23847,  24057,  23953,  24168,  24060,  24279,  24166,  24390,
+         24272,  24502,  24378,  24613,  24483,  24725,  24589,  24838,  24694,  24950,  24799,  25063,
+         24904,  25176,  25008,  25289,  25112,  25402,  25216,  25517,  25319,  25631,  25422,  25746,
+         25524,  25862,  25625,  25979,  25725,  26096,  25825,  26215,  25923,  26335,  26020,  26456,
+         26115,  26579,  26209,  26705,  26299,  26833,  26387,  26965,  26470,  27102,  26547,  27246,
+         26617,  27399,  26675,  27565,  26717,  27753,  26732,  27975,  26701,  28261,  26578,  28686,
+         26228,  29518,  25025,  32767,      0,
+    },
+    // Level 1, harmonics 1 - 256
+    {
+             0, -24274, -32713, -28307, -24916, -27336, -29355, -27564, -26010, -27298, -28414, -27264,
+        -26252, -27125, -27880, -27020, -26266, -26924, -27485, -26791, -26189, -26715, -27154, -26567,
+        -26065, -26503, -26858, -26346, -25915, -26288, -26582, -26126, -25748, -26073, -26321, -25907,
+        -25569, -25856, -26068, -25688, -25383, -25640, -25822, -25470, -25192, -25423, -25581, -25252,
+        -24996, -25206, -25344, -25034, -24796, -24989, -25110, -24816, -24595, -24772, -24878, -24598,
+        -24391, -24555, -24647, -24381, -24185, -24337, -24419, -24163, -23978, -24120, -24191, -23945,
+        -23770, -23903, -23965, -23728, -23561, -23685, -23740, -23510, -23351, -23468, -23515, -23292,
+        -23140, -23251, -23291, -23075, -22929, -23033, -23067, -22857, -22717, -22816, -22844, -22640,
+        -22505, -22598, -22622, -22422, -22292, -22381, -22400, -22205, -22079, -22164, -22178, -21987,
+        -21866, -21946, -21956, -21769, -21652, -21729, -21735, -21552, -21438, -21511, -21514, -21334,
+        -21224, -21294, -21293, -21117, -21010, -21076, -21073, -20899, -20796, -20859, -20852, -20682,
+        -20581, -20641, -20632, -20464, -20366, -20424, -20412, -20247, -20151, -20206, -20192, -20029,
+        -19936, -19989, -19972, -19812, -19721, -19772, -19753, -19594, -19505, -19554, -19533, -19377,
+        -19290, -19337, -19314, -19159, -19074, -19119, -19094, -18942, -18859, -18902, -18875, -18724,
+        -18643, -18684, -18656, -18507, -18427, -18467, -18437, -18289, -18211, -18249, -18217, -18072,
+        -17996, -18032, -17998, -17854, -17780, -17814, -17779, -17637, -17564, -17597, -17560, -17419,
+        -17347, -17379, -17342, -17202, -17131, -17162, -17123, -16984, -16915, -16944, -16904, -16767,
+        -16699, -16727, -16685, -16549, -16483, -16509, -16467, -16332, -16266, -16292, -16248, -16114,
+        -16050, -16074, -16029, -15897, -15834, -15857, -15811, -15679, -15617, -15639, -15592, -15462,
+        -15401, -15422, -15374, -15244, -15184, -15204, -15155, -15027, -14968, -14987, -14937, -14809,
+        -14751, -14769, -14718, -14592, -14535, -14552, -14500, -14374, -14318, -14334, -14282, -14157,
+        -14101, -14117, -14063, -13939, -13885, -13900, -13845, -13722, -13668, -13682, -13627, -13504,
+        -13451, -13465, -13408, -13287, -13235, -13247, -13190, -13069, -13018, -13030, -12972, -12852,
+        -12801, -12812, -12753, -12634, -12585, -12595, -12535, -12417, -12368, -12377, -12317, -12199,
+        -12151, -12160, -12099, -11982, -11934, -11942, -11881, -11764, -11717, -11725, -11662, -11547,
+        -11501, -11507, -11444, -11329, -11284, -11290, -11226, -11112, -11067, -11072, -11008, -10894,
+        -10850, -10855, -10790, -10677, -10633, -10637, -10572, -10459, -10416, -10420, -10354, -10242,
+        -10200, -10202, -10136, -10024,  -9983,  -9985,  -9917,  -9807,  -9766,  -9767,  -9699,  -9589,
+         -9549,  -9550,  -9481,  -9372,  -9332,  -9332,  -9263,  -9154,  -9115,  -9115,  -9045,  -8937,
+         -8898,  -8897,  -8827,  -8719,  -8681,  -8680,  -8609,  -8502,  -8464,  -8462,  -8391,  -8284,
+         -8247,  -8245,  -8173,  -8067,  -8030,  -8027,  -7955,  -7850,  -7813,  -7810,  -7737,  -7632,
+         -7596,  -7592,  -7519,  -7415,  -7379,  -7375,  -7301,  -7197,  -7162,  -7157,  -7083,  -6980,
+         -6945,  -6940,  -6865,  -6762,  -6728,  -6722,  -6647,  -6545,  -6511,  -6505,  -6429,  -6327,
+         -6294,  -6287,  -6211,  -6110,  -6077,  -6070,  -5993,  -5892,  -5860,  -5852,  -5775,  -5675,
+         -5643,  -5635,  -5557,  -5457,  -5426,  -5417,  -5339,  -5240,  -5209,  -5200,  -5121,  -5022,
+         -4992,  -4982,  -4903,  -4805,  -4775,  -4765,  -4685,  -4587,  -4558,  -4547,  -4467,  -4370,
+         -4341,  -4330,  -4250,  -4152,  -4124,  -4112,  -4032,  -3935,  -3907,  -3895,  -3814,  -3717,
+         -3690,  -3678,  -3596,  -3500,  -3473,  -3460,  -3378,  -3282,  -3256,  -3243,  -3160,  -3065,
+         -3039,  -3025,  -2942,  -2847,  -2822,  -2808,  -2724,  -2630,  -2605,  -2590,  -2506,  -2412,
+         -2388,  -2373,  -2288,  -2195,  -2171,  -2155,  -2070,  -1977,  -1954,  -1938,  -1852,  -1760,
+         -1737,  -1720,  -1634,  -1542,  -1519,  -1503,  -1416,  -1325,  -1302,  -1285,  -1199,  -1107,
+         -1085,  -1068,   -981,   -890,   -868,   -850,   -763,   -672,   -651,   -633,   -545,   -455,
+          -434,   -415,   -327,   -237,   -217,   -198,   -109,    -20,      0,     20,    109,    198,
+           217,    237,    327,    415,    434,    455,    545,    633,    651,    672,    763,    850,
+           868,    890,    981,   1068,   1085,   1107,   1199,   1285,   1302,   1325,   1416,   1503,
+          1519,   1542,   1634,   1720,   1737,   1760,   1852,   1938,   1954,   1977,   2070,   2155,
+          2171,   2195,   2288,   2373,   2388,   2412,   2506,   2590,   2605,   2630,   2724,   2808,
+          2822,   2847,   2942,   3025,   3039,   3065,   3160,   3243,   3256,   3282,   3378,   3460,
+          3473,   3500,   3596,   3678,   3690,   3717,   3814,   3895,   3907,   3935,   4032,   4112,
+          4124,   4152,   4250,   4330,   4341,   4370,   4467,   4547,   4558,   4587,   4685,   4765,
+          4775,   4805,   4903,   4982,   4992,   5022,   5121,   5200,   5209,   5240,   5339,   5417,
+          5426,   5457,   5557,   5635,   5643,   5675,   5775,   5852,   5860,   5892,   5993,   6070,
+          6077,   6110,   6211,   6287,   6294,   6327,   6429,   6505,   6511,   6545,   6647,   6722,
+          6728,   6762,   6865,   6940,   6945,   6980,   7083,   7157,   7162,   7197,   7301,   7375,
+          7379,   7415,   7519,   7592,   7596,   7632,   7737,   7810,   7813,   7850,   7955,   8027,
+          8030,   8067,   8173,   8245,   8247,   8284,   8391,   8462,   8464,   8502,   8609,   8680,
+          8681,   8719,   8827,   8897,   8898,   8937,   9045,   9115,   9115,   9154,   9263,   9332,
+          9332,   9372,   9481,   9550,   9549,   9589,   9699,   9767,   9766,   9807,   9917,   9985,
+          9983,  10024,  10136,  10202,  10200,  10242,  10354,  10420,  10416,  10459,  10572,  10637,
+         10633,  10677,  10790,  10855,  10850,  10894,  11008,  11072,  11067,  11112,  11226,  11290,
+         11284,  11329,  11444,  11507,  11501,  11547,  11662,  11725,  11717,  11764,  11881,  11942,
+         11934,  11982,  12099,  12160,  12151,  12199,  12317,  12377,  12368,  12417,  12535,  12595,
+         12585,  12634,  12753,  12812,  12801,  12852,  12972,  13030,  13018,  13069,  13190,  13247,
+         13235,  13287,  13408,  13465,  13451,  13504,  13627,  13682,  13668,  13722,  13845,  13900,
+         13885,  13939,  14063,  14117,  14101,  14157,  14282,  14334,  14318,  14374,  14500,  14552,
+         14535,  14592,  14718,  14769,  14751,  14809,  14937,  14987,  14968,  15027,  15155,  15204,
+         15184,  15244,  15374,  15422,  15401,  15462,  15592,  15639,  15617,  15679,  15811,  15857,
+         15834,  15897,  16029,  16074,  16050,  16114,  16248,  16292,  16266,  16332,  16467,  16509,
+         16483,  16549,  16685,  16727,  16699,  16767,  16904,  16944,  16915,  16984,  17123,  17162,
+         17131,  17202,  17342,  17379,  17347,  17419,  17560,  17597,  17564,  17637,  17779,  17814,
+         17780,  17854,  17998,  18032,  17996,  18072,  18217,  18249,  18211,  18289,  18437,  18467,
+         18427,  18507,  18656,  18684,  18643,  18724,  18875,  18902,  18859,  18942,  19094,  19119,
+         19074,  19159,  19314,  19337,  19290,  19377,  19533,  19554,  19505,  19594,  19753,  19772,
+         19721,  19812,  19972,  19989,  19936,  20029,  20192,  20206,  20151,  20247,  20412,  20424,
+         20366,  20464,  20632,  20641,  20581,  20682,  20852,  20859,  20796,  20899,  21073,  21076,
+         21010,  21117,  21293,  21294,  21224,  21334,  21514,  21511,  21438,  21552,  21735,  21729,
+         21652,  21769,  21956,  21946,  21866,  21987,  22178,  22164,  22079,  22205,  22400,  22381,
+         22292,  22422,  22622,  22598,  22505,  22640,  22844,  22816,  22717,  22857,  23067,  23033,
+         22929,  23075,  23291,  23251,  23140,  23292,  23515,  23468,  23351,  23510,  23740,  23685,
+         23561,  23728,  23965,  23903,  23770,  23945,  24191,  24120,  23978,  24163,  24419,  24337,
+         24185,  24381,  24647,  24555,  24391,  24598,  24878,  24772,  24595,  24816,  25110,  24989,
+         24796,  25034,  25344,  25206,  24996,  25252,  25581,  25423,  25192,  25470,  25822,  25640,
+         25383,  25688,  26068,  25856,  25569,  25907,  26321,  26073,  25748,  26126,  26582,  26288,
+         25915,  26346,  26858,  26503,  26065,  26567,  27154,  26715,  26189,  26791,  27485,  26924,
+         26266,  27020,  27880,  27125,  26252,  27264,  28414,  27298,  26010,  27564,  29355,  27336,
+         24916,  28307,  32713,  24274,      0,
+    },
+    // Level 2, harmonics 1 - 128
+    {
+             0, -13446, -24254, -30719, -32604, -31078, -28109, -25606, -24699, -25457, -27099, -28549,
+        -29028, -28403, -27149, -26012, -25576, -25967, -26843, -27631, -27869, -27447, -26632, -25889,
+        -25600, -25863, -26452, -26979, -27117, -26784, -26170, -25614, -25398, -25594, -26035, -26421,
+        -26504, -26221, -25723, -25276, -25104, -25260, -25608, -25907, -25955, -25705, -25282, -24907,
+        -24763, -24892, -25178, -25417, -25441, -25213, -24843, -24519, -24395, -24505, -24746, -24941,
+        -24948, -24737, -24406, -24120, -24011, -24107, -24313, -24475, -24468, -24270, -23969, -23712,
+        -23616, -23700, -23879, -24015, -23998, -23810, -23533, -23300, -23213, -23288, -23445, -23560,
+        -23534, -23354, -23097, -22883, -22804, -22871, -23011, -23108, -23075, -22902, -22662, -22464,
+        -22391, -22452, -22576, -22659, -22620, -22453, -22226, -22042, -21975, -22030, -22142, -22212,
+        -22168, -22006, -21791, -21618, -21556, -21607, -21707, -21766, -21718, -21560, -21356, -21193,
+        -21135, -21181, -21273, -21322, -21270, -21116, -20921, -20767, -20712, -20755, -20838, -20879,
+        -20823, -20673, -20485, -20339, -20288, -20328, -20403, -20437, -20378, -20230, -20050, -19911,
+        -19863, -19900, -19968, -19995, -19933, -19789, -19615, -19483, -19437, -19471, -19533, -19554,
+        -19490, -19348, -19180, -19053, -19010, -19042, -19098, -19114, -19047, -18907, -18745, -18623,
+        -18582, -18612, -18664, -18674, -18605, -18468, -18310, -18193, -18154, -18182, -18229, -18234,
+        -18164, -18028, -17875, -17763, -17725, -17751, -17794, -17795, -17723, -17589, -17440, -17332,
+        -17296, -17320, -17359, -17356, -17283, -17150, -17005, -16900, -16866, -16889, -16924, -16918,
+        -16843, -16711, -16570, -16469, -16436, -16458, -16489, -16479, -16403, -16273, -16135, -16037,
+        -16006, -16026, -16054, -16041, -15963, -15835, -15700, -15605, -15575, -15594, -15619, -15603,
+        -15524, -15397, -15265, -15173, -15144, -15162, -15184, -15165, -15085, -14959, -14829, -14741,
+        -14713, -14730, -14749, -14728, -14646, -14521, -14394, -14308, -14282, -14297, -14314, -14290,
+        -14208, -14084, -13959, -13876, -13850, -13865, -13879, -13853, -13769, -13646, -13524, -13443,
+        -13419, -13432, -13444, -13416, -13331, -13209, -13089, -13011, -12987, -13000, -13009, -12978,
+        -12893, -12772, -12654, -12578, -12555, -12567, -12574, -12541, -12455, -12335, -12219, -12145,
+        -12123, -12134, -12140, -12104, -12017, -11898, -11784, -11712, -11690, -11701, -11705, -11668,
+        -11580, -11461, -11349, -11279, -11258, -11268, -11270, -11231, -11142, -11024, -10914, -10846,
+        -10826, -10835, -10835, -10794, -10705, -10587, -10479, -10412, -10393, -10401, -10400, -10357,
+        -10267, -10151, -10044,  -9979,  -9961,  -9968,  -9965,  -9921,  -9830,  -9714,  -9609,  -9546,
+         -9528,  -9535,  -9530,  -9484,  -9392,  -9277,  -9174,  -9112,  -9095,  -9101,  -9095,  -9047,
+         -8955,  -8841,  -8739,  -8679,  -8663,  -8668,  -8660,  -8611,  -8518,  -8404,  -8305,  -8245,
+         -8230,  -8235,  -8225,  -8174,  -8081,  -7968,  -7870,  -7812,  -7797,  -7801,  -7790,  -7738,
+         -7644,  -7531,  -7435,  -7378,  -7364,  -7368,  -7355,  -7301,  -7207,  -7095,  -7000,  -6945,
+         -6931,  -6934,  -6920,  -6865,  -6770,  -6659,  -6565,  -6511,  -6498,  -6500,  -6485,  -6429,
+         -6333,  -6222,  -6130,  -6078,  -6065,  -6067,  -6050,  -5992,  -5896,  -5786,  -5695,  -5644,
+         -5632,  -5633,  -5615,  -5556,  -5459,  -5349,  -5260,  -5210,  -5199,  -5199,  -5180,  -5120,
+         -5022,  -4913,  -4825,  -4777,  -4766,  -4766,  -4745,  -4683,  -4586,  -4477,  -4390,  -4343,
+         -4332,  -4332,  -4310,  -4247,  -4149,  -4041,  -3955,  -3909,  -3899,  -3898,  -3875,  -3811,
+         -3712,  -3604,  -3520,  -3476,  -3466,  -3465,  -3440,  -3375,  -3275,  -3168,  -3085,  -3042,
+         -3033,  -3031,  -3005,  -2939,  -2839,  -2732,  -2650,  -2608,  -2600,  -2597,  -2570,  -2502,
+         -2402,  -2296,  -2215,  -2174,  -2166,  -2163,  -2135,  -2066,  -1965,  -1860,  -1780,  -1741,
+         -1733,  -1730,  -1700,  -1630,  -1528,  -1423,  -1345,  -1307,  -1300,  -1296,  -1265,  -1194,
+         -1092,   -987,   -910,   -873,   -867,   -862,   -830,   -758,   -655,   -551,   -475,   -439,
+          -433,   -428,   -395,   -321,   -218,   -115,    -40,     -5,      0,      5,     40,    115,
+           218,    321,    395,    428,    433,    439,    475,    551,    655,    758,    830,    862,
+           867,    873,    910,    987,   1092,   1194,   1265,   1296,   1300,   1307,   1345,   1423,
+          1528,   1630,   1700,   1730,   1733,   1741,   1780,   1860,   1965,   2066,   2135,   2163,
+          2166,   2174,   2215,   2296,   2402,   2502,   2570,   2597,   2600,   2608,   2650,   2732,
+          2839,   2939,   3005,   3031,   3033,   3042,   3085,   3168,   3275,   3375,   3440,   3465,
+          3466,   3476,   3520,   3604,   3712,   3811,   3875,   3898,   3899,   3909,   3955,   4041,
+          4149,   4247,   4310,   4332,   4332,   4343,   4390,   4477,   4586,   4683,   4745,   4766,
+          4766,   4777,   4825,   4913,   5022,   5120,   5180,   5199,   5199,   5210,   5260,   5349,
+          5459,   5556,   5615,   5633,   5632,   5644,   5695,   5786,   5896,   5992,   6050,   6067,
+          6065,   6078,   6130,   6222,   6333,   6429,   6485,   6500,   6498,   6511,   6565,   6659,
+          6770,   6865,   6920,   6934,   6931,   6945,   7000,   7095,   7207,   7301,   7355,   7368,
+          7364,   7378,   7435,   7531,   7644,   7738,   7790,   7801,   7797,   7812,   7870,   7968,
+          8081,   8174,   8225,   8235,   8230,   8245,   8305,   8404,   8518,   8611,   8660,   8668,
+          8663,   8679,   8739,   8841,   8955,   9047,   9095,   9101,   9095,   9112,   9174,   9277,
+          9392,   9484,   9530,   9535,   9528,   9546,   9609,   9714,   9830,   9921,   9965,   9968,
+          9961,   9979,  10044,  10151,  10267,  10357,  10400,  10401,  10393,  10412,  10479,  10587,
+         10705,  10794,  10835,  10835,  10826,  10846,  10914,  11024,  11142,  11231,  11270,  11268,
+         11258,  11279,  11349,  11461,  11580,  11668,  11705,  11701,  11690,  11712,  11784,  11898,
+         12017,  12104,  12140,  12134,  12123,  12145,  12219,  12335,  12455,  12541,  12574,  12567,
+         12555,  12578,  12654,  12772,  12893,  12978,  13009,  13000,  12987,  13011,  13089,  13209,
+         13331,  13416,  13444,  13432,  13419,  13443,  13524,  13646,  13769,  13853,  13879,  13865,
+         13850,  13876,  13959,  14084,  14208,  14290,  14314,  14297,  14282,  14308,  14394,  14521,
+         14646,  14728,  14749,  14730,  14713,  14741,  14829,  14959,  15085,  15165,  15184,  15162,
+         15144,  15173,  15265,  15397,  15524,  15603,  15619,  15594,  15575,  15605,  15700,  15835,
+         15963,  16041,  16054,  16026,  16006,  16037,  16135,  16273,  16403,  16479,  16489,  16458,
+         16436,  16469,  16570,  16711,  16843,  16918,  16924,  16889,  16866,  16900,  17005,  17150,
+         17283,  17356,  17359,  17320,  17296,  17332,  17440,  17589,  17723,  17795,  17794,  17751,
+         17725,  17763,  17875,  18028,  18164,  18234,  18229,  18182,  18154,  18193,  18310,  18468,
+         18605,  18674,  18664,  18612,  18582,  18623,  18745,  18907,  19047,  19114,  19098,  19042,
+         19010,  19053,  19180,  19348,  19490,  19554,  19533,  19471,  19437,  19483,  19615,  19789,
+         19933,  19995,  19968,  19900,  19863,  19911,  20050,  20230,  20378,  20437,  20403,  20328,
+         20288,  20339,  20485,  20673,  20823,  20879,  20838,  20755,  20712,  20767,  20921,  21116,
+         21270,  21322,  21273,  21181,  21135,  21193,  21356,  21560,  21718,  21766,  21707,  21607,
+         21556,  21618,  21791,  22006,  22168,  22212,  22142,  22030,  21975,  22042,  22226,  22453,
+         22620,  22659,  22576,  22452,  22391,  22464,  22662,  22902,  23075,  23108,  23011,  22871,
+         22804,  22883,  23097,  23354,  23534,  23560,  23445,  23288,  23213,  23300,  23533,  23810,
+         23998,  24015,  23879,  23700,  23616,  23712,  23969,  24270,  24468,  24475,  24313,  24107,
+         24011,  24120,  24406,  24737,  24948,  24941,  24746,  24505,  24395,  24519,  24843,  25213,
+         25441,  25417,  25178,  24892,  24763,  24907,  25282,  25705,  25955,  25907,  25608,  25260,
+         25104,  25276,  25723,  26221,  26504,  26421,  26035,  25594,  25398,  25614,  26170,  26784,
+         27117,  26979,  26452,  25863,  25600,  25889,  26632,  27447,  27869,  27631,  26843,  25967,
+         25576,  26012,  27149,  28403,  29028,  28549,  27099,  25457,  24699,  25606,  28109,  31078,
+         32604,  30719,  24254,  13446,      0,
+    },
+    // Level 3, harmonics 1 - 64
+    {
+             0,  -6899, -13440, -19299, -24214, -28008, -30604, -32024, -32385, -31881, -30757, -29280,
+        -27714, -26288, -25177, -24491, -24266, -24470, -25018, -25784, -26624, -27401, -27998, -28333,
+        -28373, -28127, -27645, -27010, -26319, -25670, -25150, -24820, -24710, -24813, -25094, -25493,
+        -25933, -26340, -26644, -26798, -26778, -26586, -26253, -25826, -25367, -24937, -24593, -24374,
+        -24301, -24369, -24556, -24819, -25108, -25369, -25556, -25635, -25589, -25421, -25154, -24822,
+        -24470, -24144, -23884, -23720, -23665, -23716, -23854, -24047, -24255, -24438, -24562, -24599,
+        -24539, -24385, -24155, -23878, -23588, -23323, -23113, -22981, -22937, -22978, -23086, -23235,
+        -23393, -23528, -23611, -23622, -23553, -23408, -23203, -22961, -22712, -22486, -22310, -22200,
+        -22163, -22196, -22284, -22404, -22528, -22630, -22685, -22678, -22603, -22464, -22275, -22058,
+        -21838, -21641, -21488, -21394, -21363, -21390, -21464, -21562, -21661, -21738, -21773, -21753,
+        -21673, -21538, -21362, -21164, -20966, -20790, -20655, -20572, -20545, -20569, -20631, -20713,
+        -20793, -20851, -20870, -20840, -20756, -20625, -20459, -20275, -20094, -19935, -19814, -19740,
+        -19717, -19737, -19791, -19859, -19924, -19968, -19974, -19935, -19849, -19721, -19563, -19391,
+        -19223, -19078, -18968, -18901, -18880, -18899, -18945, -19003, -19056, -19087, -19083, -19037,
+        -18948, -18823, -18671, -18509, -18353, -18218, -18117, -18057, -18038, -18054, -18095, -18144,
+        -18186, -18207, -18195, -18143, -18053, -17929, -17783, -17629, -17482, -17357, -17264, -17209,
+        -17192, -17206, -17241, -17283, -17317, -17329, -17309, -17253, -17161, -17039, -16897, -16750,
+        -16611, -16495, -16409, -16358, -16343, -16355, -16386, -16421, -16447, -16452, -16426, -16365,
+        -16272, -16151, -16013, -15872, -15741, -15631, -15551, -15505, -15491, -15502, -15529, -15558,
+        -15578, -15576, -15544, -15480, -15385, -15265, -15132, -14996, -14871, -14767, -14693, -14650,
+        -14637, -14647, -14670, -14695, -14708, -14700, -14663, -14596, -14500, -14381, -14251, -14120,
+        -14001, -13903, -13833, -13793, -13781, -13790, -13810, -13830, -13838, -13825, -13784, -13713,
+        -13616, -13499, -13371, -13245, -13130, -13038, -12972, -12935, -12924, -12932, -12950, -12965,
+        -12968, -12950, -12905, -12832, -12734, -12617, -12493, -12370, -12260, -12172, -12110, -12076,
+        -12066, -12073, -12088, -12100, -12099, -12076, -12027, -11952, -11853, -11737, -11614, -11496,
+        -11390, -11306, -11248, -11216, -11207, -11213, -11226, -11234, -11229, -11202, -11150, -11072,
+        -10972, -10857, -10737, -10622, -10520, -10440, -10385, -10356, -10347, -10353, -10363, -10368,
+        -10359, -10328, -10273, -10193, -10092,  -9978,  -9860,  -9748,  -9650,  -9574,  -9522,  -9494,
+         -9487,  -9492,  -9500,  -9502,  -9489,  -9455,  -9396,  -9314,  -9213,  -9100,  -8984,  -8874,
+         -8780,  -8707,  -8658,  -8633,  -8626,  -8630,  -8636,  -8635,  -8619,  -8582,  -8520,  -8436,
+         -8334,  -8222,  -8107,  -8001,  -7910,  -7840,  -7794,  -7771,  -7764,  -7768,  -7772,  -7769,
+         -7749,  -7709,  -7645,  -7559,  -7456,  -7344,  -7232,  -7128,  -7040,  -6974,  -6930,  -6908,
+         -6902,  -6905,  -6908,  -6902,  -6879,  -6836,  -6769,  -6681,  -6578,  -6467,  -6356,  -6255,
+         -6170,  -6107,  -6066,  -6045,  -6040,  -6043,  -6044,  -6035,  -6009,  -5963,  -5894,  -5804,
+         -5700,  -5590,  -5481,  -5382,  -5300,  -5239,  -5201,  -5182,  -5178,  -5180,  -5179,  -5168,
+         -5140,  -5090,  -5018,  -4928,  -4823,  -4713,  -4605,  -4509,  -4430,  -4372,  -4336,  -4319,
+         -4315,  -4316,  -4314,  -4301,  -4270,  -4217,  -4143,  -4051,  -3946,  -3836,  -3730,  -3636,
+         -3560,  -3505,  -3471,  -3456,  -3452,  -3453,  -3449,  -3434,  -3400,  -3345,  -3268,  -3174,
+         -3069,  -2960,  -2855,  -2764,  -2690,  -2638,  -2606,  -2592,  -2589,  -2590,  -2584,  -2566,
+         -2530,  -2472,  -2393,  -2298,  -2192,  -2083,  -1980,  -1891,  -1820,  -1770,  -1741,  -1729,
+         -1726,  -1726,  -1719,  -1699,  -1660,  -1599,  -1519,  -1422,  -1315,  -1207,  -1106,  -1018,
+          -950,   -903,   -876,   -865,   -863,   -862,   -854,   -832,   -790,   -727,   -644,   -545,
+          -438,   -331,   -231,   -146,    -80,    -36,    -11,     -1,      0,      1,     11,     36,
+            80,    146,    231,    331,    438,    545,    644,    727,    790,    832,    854,    862,
+           863,    865,    876,    903,    950,   1018,   1106,   1207,   1315,   1422,   1519,   1599,
+          1660,   1699,   1719,   1726,   1726,   1729,   1741,   1770,   1820,   1891,   1980,   2083,
+          2192,   2298,   2393,   2472,   2530,   2566,   2584,   2590,   2589,   2592,   2606,   2638,
+          2690,   2764,   2855,   2960,   3069,   3174,   3268,   3345,   3400,   3434,   3449,   3453,
+          3452,   3456,   3471,   3505,   3560,   3636,   3730,   3836,   3946,   4051,   4143,   4217,
+          4270,   4301,   4314,   4316,   4315,   4319,   4336,   4372,   4430,   4509,   4605,   4713,
+          4823,   4928,   5018,   5090,   5140,   5168,   5179,   5180,   5178,   5182,   5201,   5239,
+          5300,   5382,   5481,   5590,   5700,   5804,   5894,   5963,   6009,   6035,   6044,   6043,
+          6040,   6045,   6066,   6107,   6170,   6255,   6356,   6467,   6578,   6681,   6769,   6836,
+          6879,   6902,   6908,   6905,   6902,   6908,   6930,   6974,   7040,   7128,   7232,   7344,
+          7456,   7559,   7645,   7709,   7749,   7769,   7772,   7768,   7764,   7771,   7794,   7840,
+          7910,   8001,   8107,   8222,   8334,   8436,   8520,   8582,   8619,   8635,   8636,   8630,
+          8626,   8633,   8658,   8707,   8780,   8874,   8984,   9100,   9213,   9314,   9396,   9455,
+          9489,   9502,   9500,   9492,   9487,   9494,   9522,   9574,   9650,   9748,   9860,   9978,
+         10092,  10193,  10273,  10328,  10359,  10368,  10363,  10353,  10347,  10356,  10385,  10440,
+         10520,  10622,  10737,  10857,  10972,  11072,  11150,  11202,  11229,  11234,  11226,  11213,
+         11207,  11216,  11248,  11306,  11390,  11496,  11614,  11737,  11853,  11952,  12027,  12076,
+         12099,  12100,  12088,  12073,  12066,  12076,  12110,  12172,  12260,  12370,  12493,  12617,
+         12734,  12832,  12905,  12950,  12968,  12965,  12950,  12932,  12924,  12935,  12972,  13038,
+         13130,  13245,  13371,  13499,  13616,  13713,  13784,  13825,  13838,  13830,  13810,  13790,
+         13781,  13793,  13833,  13903,  14001,  14120,  14251,  14381,  14500,  14596,  14663,  14700,
+         14708,  14695,  14670,  14647,  14637,  14650,  14693,  14767,  14871,  14996,  15132,  15265,
+         15385,  15480,  15544,  15576,  15578,  15558,  15529,  15502,  15491,  15505,  15551,  15631,
+         15741,  15872,  16013,  16151,  16272,  16365,  16426,  16452,  16447,  16421,  16386,  16355,
+         16343,  16358,  16409,  16495,  16611,  16750,  16897,  17039,  17161,  17253,  17309,  17329,
+         17317,  17283,  17241,  17206,  17192,  17209,  17264,  17357,  17482,  17629,  17783,  17929,
+         18053,  18143,  18195,  18207,  18186,  18144,  18095,  18054,  18038,  18057,  18117,  18218,
+         18353,  18509,  18671,  18823,  18948,  19037,  19083,  19087,  19056,  19003,  18945,  18899,
+         18880,  18901,  18968,  19078,  19223,  19391,  19563,  19721,  19849,  19935,  19974,  19968,
+         19924,  19859,  19791,  19737,  19717,  19740,  19814,  19935,  20094,  20275,  20459,  20625,
+         20756,  20840,  20870,  20851,  20793,  20713,  20631,  20569,  20545,  20572,  20655,  20790,
+         20966,  21164,  21362,  21538,  21673,  21753,  21773,  21738,  21661,  21562,  21464,  21390,
+         21363,  21394,  21488,  21641,  21838,  22058,  22275,  22464,  22603,  22678,  22685,  22630,
+         22528,  22404,  22284,  22196,  22163,  22200,  22310,  22486,  22712,  22961,  23203,  23408,
+         23553,  23622,  23611,  23528,  23393,  23235,  23086,  22978,  22937,  22981,  23113,  23323,
+         23588,  23878,  24155,  24385,  24539,  24599,  24562,  24438,  24255,  24047,  23854,  23716,
+         23665,  23720,  23884,  24144,  24470,  24822,  25154,  25421,  25589,  25635,  25556,  25369,
+         25108,  24819,  24556,  24369,  24301,  24374,  24593,  24937,  25367,  25826,  26253,  26586,
+         26778,  26798,  26644,  26340,  25933,  25493,  25094,  24813,  24710,  24820,  25150,  25670,
+         26319,  27010,  27645,  28127,  28373,  28333,  27998,  27401,  26624,  25784,  25018,  24470,
+         24266,  24491,  25177,  26288,  27714,  29280,  30757,  31881,  32385,  32024,  30604,  28008,
+         24214,  19299,  13440,   6899,      0,
+    },
+    // Level 4, harmonics 1 - 32
+    {
+             0,  -3472,  -6898, -10231, -13429, -16452, -19264, -21833, -24134, -26148, -27863, -29271,
+        -30373, -31176, -31693, -31942, -31947, -31735, -31336, -30784, -30113, -29358, -28554, -27732,
+        -26924, -26158, -25456, -24840, -24323, -23918, -23629, -23458, -23403, -23455, -23605, -23840,
+        -24142, -24495, -24880, -25280, -25674, -26047, -26383, -26668, -26892, -27046, -27126, -27130,
+        -27058, -26914, -26705, -26439, -26127, -25779, -25411, -25033, -24659, -24301, -23971, -23678,
+        -23431, -23235, -23095, -23011, -22983, -23010, -23084, -23202, -23353, -23530, -23722, -23920,
+        -24113, -24292, -24449, -24575, -24664, -24711, -24715, -24673, -24586, -24456, -24288, -24087,
+        -23859, -23612, -23354, -23093, -22837, -22594, -22371, -22174, -22008, -21878, -21785, -21729,
+        -21711, -21728, -21777, -21853, -21949, -22061, -22181, -22302, -22418, -22521, -22605, -22667,
+        -22700, -22704, -22675, -22613, -22520, -22397, -22247, -22075, -21885, -21684, -21477, -21271,
+        -21070, -20882, -20710, -20560, -20435, -20337, -20267, -20226, -20213, -20225, -20260, -20314,
+        -20382, -20460, -20542, -20622, -20695, -20757, -20802, -20828, -20831, -20810, -20763, -20690,
+        -20593, -20474, -20334, -20179, -20012, -19837, -19660, -19486, -19319, -19163, -19022, -18900,
+        -18799, -18720, -18665, -18633, -18622, -18632, -18659, -18699, -18749, -18805, -18863, -18917,
+        -18963, -18999, -19019, -19022, -19006, -18968, -18910, -18830, -18730, -18613, -18481, -18337,
+        -18184, -18028, -17871, -17718, -17572, -17438, -17318, -17215, -17131, -17066, -17020, -16994,
+        -16985, -16993, -17014, -17045, -17083, -17124, -17164, -17200, -17228, -17245, -17248, -17235,
+        -17204, -17155, -17088, -17003, -16902, -16787, -16659, -16523, -16381, -16238, -16095, -15958,
+        -15829, -15711, -15606, -15517, -15444, -15389, -15351, -15329, -15322, -15328, -15345, -15369,
+        -15398, -15428, -15455, -15477, -15491, -15494, -15483, -15458, -15417, -15359, -15286, -15197,
+        -15095, -14980, -14857, -14727, -14593, -14459, -14328, -14203, -14087, -13981, -13888, -13810,
+        -13747, -13699, -13667, -13648, -13643, -13648, -13661, -13680, -13701, -13722, -13739, -13751,
+        -13753, -13745, -13724, -13688, -13639, -13574, -13496, -13404, -13300, -13187, -13067, -12941,
+        -12815, -12689, -12567, -12452, -12345, -12250, -12167, -12097, -12042, -12000, -11973, -11957,
+        -11952, -11956, -11967, -11981, -11996, -12010, -12019, -12021, -12014, -11997, -11967, -11924,
+        -11867, -11797, -11714, -11619, -11515, -11402, -11285, -11164, -11042, -10923, -10809, -10702,
+        -10604, -10517, -10442, -10380, -10331, -10296, -10272, -10259, -10255, -10258, -10266, -10276,
+        -10286, -10293, -10296, -10290, -10275, -10250, -10212, -10162, -10099, -10024,  -9937,  -9841,
+         -9735,  -9624,  -9508,  -9391,  -9274,  -9161,  -9054,  -8954,  -8863,  -8784,  -8716,  -8661,
+         -8618,  -8586,  -8566,  -8555,  -8552,  -8554,  -8560,  -8567,  -8573,  -8574,  -8570,  -8558,
+         -8536,  -8504,  -8459,  -8403,  -8335,  -8255,  -8165,  -8066,  -7961,  -7850,  -7736,  -7622,
+         -7510,  -7402,  -7300,  -7207,  -7123,  -7050,  -6989,  -6939,  -6901,  -6874,  -6857,  -6848,
+         -6845,  -6847,  -6851,  -6855,  -6856,  -6853,  -6843,  -6825,  -6797,  -6758,  -6707,  -6645,
+         -6572,  -6489,  -6396,  -6295,  -6189,  -6078,  -5967,  -5855,  -5747,  -5644,  -5548,  -5460,
+         -5383,  -5316,  -5260,  -5216,  -5183,  -5160,  -5145,  -5138,  -5136,  -5137,  -5139,  -5140,
+         -5138,  -5130,  -5115,  -5091,  -5057,  -5012,  -4956,  -4889,  -4811,  -4724,  -4628,  -4526,
+         -4419,  -4309,  -4199,  -4091,  -3986,  -3888,  -3796,  -3714,  -3642,  -3581,  -3531,  -3492,
+         -3463,  -3444,  -3432,  -3426,  -3425,  -3425,  -3426,  -3425,  -3419,  -3406,  -3386,  -3357,
+         -3317,  -3267,  -3206,  -3134,  -3052,  -2961,  -2862,  -2759,  -2651,  -2542,  -2433,  -2327,
+         -2226,  -2132,  -2046,  -1969,  -1902,  -1847,  -1802,  -1768,  -1743,  -1727,  -1718,  -1714,
+         -1713,  -1713,  -1712,  -1708,  -1698,  -1682,  -1657,  -1622,  -1578,  -1522,  -1455,  -1378,
+         -1292,  -1198,  -1097,   -992,   -884,   -775,   -668,   -565,   -467,   -377,   -295,   -223,
+          -162,   -112,    -72,    -43,    -22,    -10,     -3,      0,      0,      0,      3,     10,
+            22,     43,     72,    112,    162,    223,    295,    377,    467,    565,    668,    775,
+           884,    992,   1097,   1198,   1292,   1378,   1455,   1522,   1578,   1622,   1657,   1682,
+          1698,   1708,   1712,   1713,   1713,   1714,   1718,   1727,   1743,   1768,   1802,   1847,
+          1902,   1969,   2046,   2132,   2226,   2327,   2433,   2542,   2651,   2759,   2862,   2961,
+          3052,   3134,   3206,   3267,   3317,   3357,   3386,   3406,   3419,   3425,   3426,   3425,
+          3425,   3426,   3432,   3444,   3463,   3492,   3531,   3581,   3642,   3714,   3796,   3888,
+          3986,   4091,   4199,   4309,   4419,   4526,   4628,   4724,   4811,   4889,   4956,   5012,
+          5057,   5091,   5115,   5130,   5138,   5140,   5139,   5137,   5136,   5138,   5145,   5160,
+          5183,   5216,   5260,   5316,   5383,   5460,   5548,   5644,   5747,   5855,   5967,   6078,
+          6189,   6295,   6396,   6489,   6572,   6645,   6707,   6758,   6797,   6825,   6843,   6853,
+          6856,   6855,   6851,   6847,   6845,   6848,   6857,   6874,   6901,   6939,   6989,   7050,
+          7123,   7207,   7300,   7402,   7510,   7622,   7736,   7850,   7961,   8066,   8165,   8255,
+          8335,   8403,   8459,   8504,   8536,   8558,   8570,   8574,   8573,   8567,   8560,   8554,
+          8552,   8555,   8566,   8586,   8618,   8661,   8716,   8784,   8863,   8954,   9054,   9161,
+          9274,   9391,   9508,   9624,   9735,   9841,   9937,  10024,  10099,  10162,  10212,  10250,
+         10275,  10290,  10296,  10293,  10286,  10276,  10266,  10258,  10255,  10259,  10272,  10296,
+         10331,  10380,  10442,  10517,  10604,  10702,  10809,  10923,  11042,  11164,  11285,  11402,
+         11515,  11619,  11714,  11797,  11867,  11924,  11967,  11997,  12014,  12021,  12019,  12010,
+         11996,  11981,  11967,  11956,  11952,  11957,  11973,  12000,  12042,  12097,  12167,  12250,
+         12345,  12452,  12567,  12689,  12815,  12941,  13067,  13187,  13300,  13404,  13496,  13574,
+         13639,  13688,  13724,  13745,  13753,  13751,  13739,  13722,  13701,  13680,  13661,  13648,
+         13643,  13648,  13667,  13699,  13747,  13810,  13888,  13981,  14087,  14203,  14328,  14459,
+         14593,  14727,  14857,  14980,  15095,  15197,  15286,  15359,  15417,  15458,  15483,  15494,
+         15491,  15477,  15455,  15428,  15398,  15369,  15345,  15328,  15322,  15329,  15351,  15389,
+         15444,  15517,  15606,  15711,  15829,  15958,  16095,  16238,  16381,  16523,  16659,  16787,
+         16902,  17003,  17088,  17155,  17204,  17235,  17248,  17245,  17228,  17200,  17164,  17124,
+         17083,  17045,  17014,  16993,  16985,  16994,  17020,  17066,  17131,  17215,  17318,  17438,
+         17572,  17718,  17871,  18028,  18184,  18337,  18481,  18613,  18730,  18830,  18910,  18968,
+         19006,  19022,  19019,  18999,  18963,  18917,  18863,  18805,  18749,  18699,  18659,  18632,
+         18622,  18633,  18665,  18720,  18799,  18900,  19022,  19163,  19319,  19486,  19660,  19837,
+         20012,  20179,  20334,  20474,  20593,  20690,  20763,  20810,  20831,  20828,  20802,  20757,
+         20695,  20622,  20542,  20460,  20382,  20314,  20260,  20225,  20213,  20226,  20267,  20337,
+         20435,  20560,  20710,  20882,  21070,  21271,  21477,  21684,  21885,  22075,  22247,  22397,
+         22520,  22613,  22675,  22704,  22700,  22667,  22605,  22521,  22418,  22302,  22181,  22061,
+         21949,  21853,  21777,  21728,  21711,  21729,  21785,  21878,  22008,  22174,  22371,  22594,
+         22837,  23093,  23354,  23612,  23859,  24087,  24288,  24456,  24586,  24673,  24715,  24711,
+         24664,  24575,  24449,  24292,  24113,  23920,  23722,  23530,  23353,  23202,  23084,  23010,
+         22983,  23011,  23095,  23235,  23431,  23678,  23971,  24301,  24659,  25033,  25411,  25779,
+         26127,  26439,  26705,  26914,  27058,  27130,  27126,  27046,  26892,  26668,  26383,  26047,
+         25674,  25280,  24880,  24495,  24142,  23840,  23605,  23455,  23403,  23458,  23629,  23918,
+         24323,  24840,  25456,  26158,  26924,  27732,  28554,  29358,  30113,  30784,  31336,  31735,
+         31947,  31942,  31693,  31176,  30373,  29271,  27863,  26148,  24134,  21833,  19264,  16452,
+         13429,  10231,   6898,   3472,      0,
+    },
+    // Level 5, harmonics 1 - 16
+    {
+             0,  -1739,  -3472,  -5192,  -6895,  -8573, -10221, -11835, -13407, -14933, -16409, -17830,
+        -19191, -20489, -21721, -22882, -23972, -24987, -25925, -26786, -27568, -28270, -28894, -29439,
+        -29906, -30296, -30612, -30854, -31025, -31129, -31167, -31144, -31063, -30928, -30743, -30512,
+        -30239, -29929, -29586, -29215, -28821, -28407, -27980, -27542, -27098, -26653, -26210, -25774,
+        -25347, -24933, -24535, -24157, -23799, -23466, -23158, -22877, -22625, -22402, -22210, -22048,
+        -21917, -21816, -21745, -21704, -21690, -21703, -21742, -21804, -21888, -21991, -22113, -22249,
+        -22399, -22559, -22727, -22901, -23079, -23256, -23433, -23605, -23772, -23930, -24078, -24214,
+        -24337, -24445, -24536, -24610, -24666, -24702, -24719, -24716, -24693, -24650, -24588, -24507,
+        -24407, -24290, -24156, -24006, -23842, -23666, -23478, -23281, -23075, -22863, -22646, -22426,
+        -22205, -21984, -21766, -21551, -21341, -21139, -20944, -20759, -20585, -20422, -20272, -20135,
+        -20012, -19904, -19811, -19732, -19668, -19620, -19585, -19565, -19559, -19565, -19583, -19613,
+        -19653, -19701, -19758, -19821, -19890, -19962, -20038, -20114, -20191, -20266, -20339, -20407,
+        -20471, -20528, -20578, -20620, -20652, -20675, -20687, -20688, -20678, -20655, -20621, -20574,
+        -20516, -20445, -20363, -20270, -20167, -20053, -19930, -19799, -19660, -19514, -19363, -19207,
+        -19048, -18886, -18723, -18560, -18398, -18238, -18081, -17928, -17780, -17638, -17503, -17375,
+        -17256, -17145, -17044, -16952, -16870, -16799, -16737, -16686, -16645, -16614, -16592, -16580,
+        -16575, -16579, -16591, -16608, -16632, -16660, -16693, -16729, -16767, -16806, -16845, -16884,
+        -16921, -16955, -16986, -17013, -17035, -17051, -17060, -17063, -17057, -17044, -17023, -16992,
+        -16953, -16905, -16848, -16783, -16708, -16625, -16535, -16436, -16331, -16219, -16101, -15978,
+        -15851, -15720, -15586, -15450, -15313, -15176, -15039, -14903, -14770, -14640, -14513, -14391,
+        -14274, -14162, -14057, -13959, -13867, -13783, -13707, -13639, -13579, -13526, -13482, -13445,
+        -13416, -13394, -13379, -13370, -13368, -13370, -13378, -13389, -13404, -13421, -13440, -13461,
+        -13481, -13502, -13521, -13538, -13553, -13564, -13572, -13574, -13572, -13564, -13550, -13529,
+        -13502, -13468, -13426, -13378, -13322, -13258, -13188, -13111, -13027, -12937, -12841, -12739,
+        -12633, -12522, -12407, -12289, -12169, -12047, -11924, -11800, -11677, -11555, -11434, -11316,
+        -11201, -11090, -10982, -10880, -10782, -10691, -10605, -10525, -10452, -10385, -10325, -10272,
+        -10226, -10186, -10153, -10126, -10105, -10089, -10078, -10072, -10071, -10072, -10077, -10084,
+        -10093, -10102, -10113, -10123, -10132, -10139, -10145, -10147, -10147, -10142, -10133, -10119,
+        -10100, -10075, -10045, -10008,  -9966,  -9917,  -9861,  -9799,  -9731,  -9657,  -9577,  -9492,
+         -9401,  -9306,  -9206,  -9102,  -8995,  -8885,  -8772,  -8658,  -8543,  -8428,  -8313,  -8198,
+         -8085,  -7974,  -7865,  -7760,  -7658,  -7561,  -7468,  -7380,  -7297,  -7220,  -7148,  -7083,
+         -7023,  -6969,  -6922,  -6880,  -6844,  -6814,  -6789,  -6769,  -6754,  -6743,  -6736,  -6732,
+         -6731,  -6732,  -6734,  -6738,  -6742,  -6746,  -6750,  -6752,  -6752,  -6749,  -6744,  -6735,
+         -6722,  -6705,  -6683,  -6656,  -6624,  -6586,  -6543,  -6494,  -6439,  -6378,  -6312,  -6239,
+         -6162,  -6079,  -5992,  -5900,  -5804,  -5704,  -5601,  -5495,  -5387,  -5278,  -5167,  -5056,
+         -4946,  -4835,  -4726,  -4619,  -4514,  -4413,  -4314,  -4219,  -4128,  -4042,  -3961,  -3885,
+         -3814,  -3749,  -3690,  -3636,  -3587,  -3545,  -3507,  -3475,  -3448,  -3426,  -3408,  -3394,
+         -3384,  -3377,  -3373,  -3371,  -3370,  -3370,  -3371,  -3372,  -3372,  -3371,  -3369,  -3364,
+         -3356,  -3345,  -3331,  -3312,  -3289,  -3261,  -3228,  -3190,  -3146,  -3097,  -3042,  -2982,
+         -2917,  -2846,  -2769,  -2688,  -2602,  -2512,  -2418,  -2320,  -2219,  -2116,  -2010,  -1903,
+         -1794,  -1685,  -1577,  -1468,  -1361,  -1256,  -1152,  -1052,   -954,   -861,   -771,   -685,
+          -605,   -529,   -458,   -393,   -333,   -279,   -230,   -187,   -149,   -116,    -88,    -65,
+           -46,    -31,    -20,    -11,     -6,     -2,     -1,      0,      0,      0,      1,      2,
+             6,     11,     20,     31,     46,     65,     88,    116,    149,    187,    230,    279,
+           333,    393,    458,    529,    605,    685,    771,    861,    954,   1052,   1152,   1256,
+          1361,   1468,   1577,   1685,   1794,   1903,   2010,   2116,   2219,   2320,   2418,   2512,
+          2602,   2688,   2769,   2846,   2917,   2982,   3042,   3097,   3146,   3190,   3228,   3261,
+          3289,   3312,   3331,   3345,   3356,   3364,   3369,   3371,   3372,   3372,   3371,   3370,
+          3370,   3371,   3373,   3377,   3384,   3394,   3408,   3426,   3448,   3475,   3507,   3545,
+          3587,   3636,   3690,   3749,   3814,   3885,   3961,   4042,   4128,   4219,   4314,   4413,
+          4514,   4619,   4726,   4835,   4946,   5056,   5167,   5278,   5387,   5495,   5601,   5704,
+          5804,   5900,   5992,   6079,   6162,   6239,   6312,   6378,   6439,   6494,   6543,   6586,
+          6624,   6656,   6683,   6705,   6722,   6735,   6744,   6749,   6752,   6752,   6750,   6746,
+          6742,   6738,   6734,   6732,   6731,   6732,   6736,   6743,   6754,   6769,   6789,   6814,
+          6844,   6880,   6922,   6969,   7023,   7083,   7148,   7220,   7297,   7380,   7468,   7561,
+          7658,   7760,   7865,   7974,   8085,   8198,   8313,   8428,   8543,   8658,   8772,   8885,
+          8995,   9102,   9206,   9306,   9401,   9492,   9577,   9657,   9731,   9799,   9861,   9917,
+          9966,  10008,  10045,  10075,  10100,  10119,  10133,  10142,  10147,  10147,  10145,  10139,
+         10132,  10123,  10113,  10102,  10093,  10084,  10077,  10072,  10071,  10072,  10078,  10089,
+         10105,  10126,  10153,  10186,  10226,  10272,  10325,  10385,  10452,  10525,  10605,  10691,
+         10782,  10880,  10982,  11090,  11201,  11316,  11434,  11555,  11677,  11800,  11924,  12047,
+         12169,  12289,  12407,  12522,  12633,  12739,  12841,  12937,  13027,  13111,  13188,  13258,
+         13322,  13378,  13426,  13468,  13502,  13529,  13550,  13564,  13572,  13574,  13572,  13564,
+         13553,  13538,  13521,  13502,  13481,  13461,  13440,  13421,  13404,  13389,  13378,  13370,
+         13368,  13370,  13379,  13394,  13416,  13445,  13482,  13526,  13579,  13639,  13707,  13783,
+         13867,  13959,  14057,  14162,  14274,  14391,  14513,  14640,  14770,  14903,  15039,  15176,
+         15313,  15450,  15586,  15720,  15851,  15978,  16101,  16219,  16331,  16436,  16535,  16625,
+         16708,  16783,  16848,  16905,  16953,  16992,  17023,  17044,  17057,  17063,  17060,  17051,
+         17035,  17013,  16986,  16955,  16921,  16884,  16845,  16806,  16767,  16729,  16693,  16660,
+         16632,  16608,  16591,  16579,  16575,  16580,  16592,  16614,  16645,  16686,  16737,  16799,
+         16870,  16952,  17044,  17145,  17256,  17375,  17503,  17638,  17780,  17928,  18081,  18238,
+         18398,  18560,  18723,  18886,  19048,  19207,  19363,  19514,  19660,  19799,  19930,  20053,
+         20167,  20270,  20363,  20445,  20516,  20574,  20621,  20655,  20678,  20688,  20687,  20675,
+         20652,  20620,  20578,  20528,  20471,  20407,  20339,  20266,  20191,  20114,  20038,  19962,
+         19890,  19821,  19758,  19701,  19653,  19613,  19583,  19565,  19559,  19565,  19585,  19620,
+         19668,  19732,  19811,  19904,  20012,  20135,  20272,  20422,  20585,  20759,  20944,  21139,
+         21341,  21551,  21766,  21984,  22205,  22426,  22646,  22863,  23075,  23281,  23478,  23666,
+         23842,  24006,  24156,  24290,  24407,  24507,  24588,  24650,  24693,  24716,  24719,  24702,
+         24666,  24610,  24536,  24445,  24337,  24214,  24078,  23930,  23772,  23605,  23433,  23256,
+         23079,  22901,  22727,  22559,  22399,  22249,  22113,  21991,  21888,  21804,  21742,  21703,
+         21690,  21704,  21745,  21816,  21917,  22048,  22210,  22402,  22625,  22877,  23158,  23466,
+         23799,  24157,  24535,  24933,  25347,  25774,  26210,  26653,  27098,  27542,  27980,  28407,
+         28821,  29215,  29586,  29929,  30239,  30512,  30743,  30928,  31063,  31144,  31167,  31129,
+         31025,  30854,  30612,  30296,  29906,  29439,  28894,  28270,  27568,  26786,  25925,  24987,
+         23972,  22882,  21721,  20489,  19191,  17830,  16409,  14933,  13407,  11835,  10221,   8573,
+          6895,   5192,   3472,   1739,      0,
+    },
+    // Level 6, harmonics 1 - 8
+    {
+             0,   -870,  -1739,  -2606,  -3471,  -4332,  -5190,  -6042,  -6889,  -7729,  -8562,  -9386,
+        -10202, -11008, -11804, -12588, -13361, -14121, -14868, -15602, -16321, -17025, -17714, -18386,
+        -19042, -19681, -20302, -20905, -21490, -22056, -22603, -23131, -23638, -24126, -24593, -25040,
+        -25466, -25872, -26257, -26620, -26963, -27284, -27585, -27865, -28123, -28361, -28578, -28775,
+        -28952, -29108, -29245, -29361, -29459, -29538, -29598, -29640, -29664, -29671, -29660, -29634,
+        -29591, -29532, -29459, -29371, -29269, -29154, -29025, -28885, -28733, -28570, -28396, -28212,
+        -28019, -27818, -27608, -27392, -27168, -26938, -26703, -26463, -26218, -25970, -25719, -25466,
+        -25210, -24954, -24696, -24439, -24182, -23926, -23671, -23418, -23168, -22921, -22677, -22437,
+        -22201, -21970, -21743, -21523, -21307, -21098, -20896, -20700, -20511, -20329, -20154, -19987,
+        -19827, -19676, -19532, -19396, -19269, -19150, -19039, -18936, -18841, -18755, -18677, -18607,
+        -18545, -18490, -18444, -18405, -18374, -18350, -18333, -18323, -18320, -18323, -18333, -18348,
+        -18369, -18395, -18427, -18463, -18504, -18548, -18597, -18649, -18705, -18763, -18823, -18886,
+        -18951, -19017, -19084, -19152, -19220, -19289, -19357, -19424, -19491, -19557, -19621, -19683,
+        -19743, -19801, -19856, -19908, -19957, -20003, -20045, -20083, -20117, -20147, -20172, -20193,
+        -20209, -20220, -20226, -20227, -20222, -20213, -20198, -20177, -20151, -20120, -20083, -20040,
+        -19993, -19939, -19881, -19817, -19748, -19673, -19594, -19510, -19421, -19327, -19229, -19126,
+        -19019, -18909, -18794, -18676, -18555, -18430, -18302, -18172, -18039, -17904, -17766, -17627,
+        -17486, -17344, -17201, -17057, -16913, -16768, -16623, -16479, -16334, -16191, -16048, -15906,
+        -15766, -15627, -15490, -15355, -15223, -15092, -14964, -14839, -14717, -14598, -14482, -14370,
+        -14261, -14156, -14054, -13956, -13863, -13773, -13687, -13606, -13528, -13455, -13386, -13321,
+        -13261, -13205, -13153, -13105, -13061, -13021, -12986, -12954, -12926, -12902, -12881, -12864,
+        -12851, -12841, -12833, -12829, -12828, -12829, -12833, -12839, -12847, -12858, -12870, -12883,
+        -12898, -12915, -12932, -12950, -12969, -12988, -13007, -13026, -13045, -13064, -13082, -13099,
+        -13116, -13131, -13145, -13157, -13168, -13177, -13183, -13188, -13190, -13190, -13188, -13182,
+        -13174, -13163, -13148, -13131, -13110, -13086, -13059, -13028, -12994, -12956, -12915, -12870,
+        -12822, -12770, -12714, -12655, -12593, -12527, -12457, -12384, -12308, -12229, -12146, -12061,
+        -11972, -11881, -11787, -11690, -11591, -11489, -11385, -11280, -11172, -11062, -10951, -10838,
+        -10724, -10609, -10493, -10376, -10258, -10140, -10022,  -9904,  -9786,  -9668,  -9550,  -9433,
+         -9317,  -9201,  -9087,  -8974,  -8862,  -8752,  -8644,  -8537,  -8432,  -8330,  -8229,  -8131,
+         -8036,  -7943,  -7852,  -7765,  -7680,  -7598,  -7519,  -7443,  -7370,  -7300,  -7233,  -7169,
+         -7109,  -7052,  -6998,  -6947,  -6899,  -6854,  -6813,  -6774,  -6739,  -6706,  -6676,  -6649,
+         -6625,  -6603,  -6584,  -6567,  -6553,  -6540,  -6530,  -6522,  -6515,  -6511,  -6507,  -6506,
+         -6505,  -6505,  -6507,  -6509,  -6512,  -6516,  -6519,  -6523,  -6527,  -6531,  -6534,  -6537,
+         -6540,  -6542,  -6542,  -6542,  -6540,  -6538,  -6533,  -6527,  -6520,  -6510,  -6498,  -6485,
+         -6469,  -6451,  -6430,  -6407,  -6382,  -6354,  -6323,  -6289,  -6253,  -6213,  -6171,  -6126,
+         -6078,  -6027,  -5973,  -5916,  -5856,  -5794,  -5728,  -5659,  -5588,  -5514,  -5437,  -5358,
+         -5276,  -5192,  -5105,  -5016,  -4924,  -4831,  -4736,  -4638,  -4539,  -4438,  -4336,  -4232,
+         -4128,  -4022,  -3915,  -3807,  -3698,  -3589,  -3480,  -3370,  -3261,  -3151,  -3042,  -2933,
+         -2824,  -2716,  -2609,  -2503,  -2398,  -2294,  -2192,  -2091,  -1992,  -1894,  -1798,  -1704,
+         -1612,  -1523,  -1435,  -1350,  -1268,  -1188,  -1110,  -1035,   -963,   -893,   -827,   -763,
+          -702,   -643,   -588,   -535,   -485,   -439,   -394,   -353,   -314,   -278,   -245,   -214,
+          -186,   -161,   -137,   -116,    -97,    -80,    -66,    -53,    -42,    -32,    -24,    -18,
+           -12,     -8,     -5,     -3,     -2,     -1,      0,      0,      0,      0,      0,      1,
+             2,      3,      5,      8,     12,     18,     24,     32,     42,     53,     66,     80,
+            97,    116,    137,    161,    186,    214,    245,    278,    314,    353,    394,    439,
+           485,    535,    588,    643,    702,    763,    827,    893,    963,   1035,   1110,   1188,
+          1268,   1350,   1435,   1523,   1612,   1704,   1798,   1894,   1992,   2091,   2192,   2294,
+          2398,   2503,   2609,   2716,   2824,   2933,   3042,   3151,   3261,   3370,   3480,   3589,
+          3698,   3807,   3915,   4022,   4128,   4232,   4336,   4438,   4539,   4638,   4736,   4831,
+          4924,   5016,   5105,   5192,   5276,   5358,   5437,   5514,   5588,   5659,   5728,   5794,
+          5856,   5916,   5973,   6027,   6078,   6126,   6171,   6213,   6253,   6289,   6323,   6354,
+          6382,   6407,   6430,   6451,   6469,   6485,   6498,   6510,   6520,   6527,   6533,   6538,
+          6540,   6542,   6542,   6542,   6540,   6537,   6534,   6531,   6527,   6523,   6519,   6516,
+          6512,   6509,   6507,   6505,   6505,   6506,   6507,   6511,   6515,   6522,   6530,   6540,
+          6553,   6567,   6584,   6603,   6625,   6649,   6676,   6706,   6739,   6774,   6813,   6854,
+          6899,   6947,   6998,   7052,   7109,   7169,   7233,   7300,   7370,   7443,   7519,   7598,
+          7680,   7765,   7852,   7943,   8036,   8131,   8229,   8330,   8432,   8537,   8644,   8752,
+          8862,   8974,   9087,   9201,   9317,   9433,   9550,   9668,   9786,   9904,  10022,  10140,
+         10258,  10376,  10493,  10609,  10724,  10838,  10951,  11062,  11172,  11280,  11385,  11489,
+         11591,  11690,  11787,  11881,  11972,  12061,  12146,  12229,  12308,  12384,  12457,  12527,
+         12593,  12655,  12714,  12770,  12822,  12870,  12915,  12956,  12994,  13028,  13059,  13086,
+         13110,  13131,  13148,  13163,  13174,  13182,  13188,  13190,  13190,  13188,  13183,  13177,
+         13168,  13157,  13145,  13131,  13116,  13099,  13082,  13064,  13045,  13026,  13007,  12988,
+         12969,  12950,  12932,  12915,  12898,  12883,  12870,  12858,  12847,  12839,  12833,  12829,
+         12828,  12829,  12833,  12841,  12851,  12864,  12881,  12902,  12926,  12954,  12986,  13021,
+         13061,  13105,  13153,  13205,  13261,  13321,  13386,  13455,  13528,  13606,  13687,  13773,
+         13863,  13956,  14054,  14156,  14261,  14370,  14482,  14598,  14717,  14839,  14964,  15092,
+         15223,  15355,  15490,  15627,  15766,  15906,  16048,  16191,  16334,  16479,  16623,  16768,
+         16913,  17057,  17201,  17344,  17486,  17627,  17766,  17904,  18039,  18172,  18302,  18430,
+         18555,  18676,  18794,  18909,  19019,  19126,  19229,  19327,  19421,  19510,  19594,  19673,
+         19748,  19817,  19881,  19939,  19993,  20040,  20083,  20120,  20151,  20177,  20198,  20213,
+         20222,  20227,  20226,  20220,  20209,  20193,  20172,  20147,  20117,  20083,  20045,  20003,
+         19957,  19908,  19856,  19801,  19743,  19683,  19621,  19557,  19491,  19424,  19357,  19289,
+         19220,  19152,  19084,  19017,  18951,  18886,  18823,  18763,  18705,  18649,  18597,  18548,
+         18504,  18463,  18427,  18395,  18369,  18348,  18333,  18323,  18320,  18323,  18333,  18350,
+         18374,  18405,  18444,  18490,  18545,  18607,  18677,  18755,  18841,  18936,  19039,  19150,
+         19269,  19396,  19532,  19676,  19827,  19987,  20154,  20329,  20511,  20700,  20896,  21098,
+         21307,  21523,  21743,  21970,  22201,  22437,  22677,  22921,  23168,  23418,  23671,  23926,
+         24182,  24439,  24696,  24954,  25210,  25466,  25719,  25970,  26218,  26463,  26703,  26938,
+         27168,  27392,  27608,  27818,  28019,  28212,  28396,  28570,  28733,  28885,  29025,  29154,
+         29269,  29371,  29459,  29532,  29591,  29634,  29660,  29671,  29664,  29640,  29598,  29538,
+         29459,  29361,  29245,  29108,  28952,  28775,  28578,  28361,  28123,  27865,  27585,  27284,
+         26963,  26620,  26257,  25872,  25466,  25040,  24593,  24126,  23638,  23131,  22603,  22056,
+         21490,  20905,  20302,  19681,  19042,  18386,  17714,  17025,  16321,  15602,  14868,  14121,
+         13361,  12588,  11804,  11008,  10202,   9386,   8562,   7729,   6889,   6042,   5190,   4332,
+          3471,   2606,   1739,    870,      0,
+    },
+    // Level 7, harmonics 1 - 4
+    {
+             0,   -435,   -870,  -1304,  -1739,  -2172,  -2605,  -3038,  -3469,  -3900,  -4329,  -4758,
+         -5185,  -5610,  -6034,  -6456,  -6876,  -7295,  -7711,  -8125,  -8537,  -8947,  -9354,  -9758,
+        -10160, -10559, -10955, -11348, -11738, -12124, -12508, -12887, -13264, -13636, -14005, -14370,
+        -14731, -15088, -15441, -15790, -16135, -16475, -16811, -17142, -17469, -17791, -18108, -18420,
+        -18728, -19030, -19328, -19620, -19908, -20190, -20467, -20739, -21005, -21266, -21521, -21771,
+        -22015, -22254, -22487, -22715, -22937, -23153, -23363, -23568, -23767, -23960, -24147, -24328,
+        -24503, -24673, -24837, -24994, -25146, -25292, -25432, -25567, -25695, -25817, -25934, -26045,
+        -26149, -26248, -26342, -26429, -26511, -26587, -26657, -26721, -26780, -26834, -26881, -26923,
+        -26960, -26991, -27017, -27038, -27053, -27062, -27067, -27067, -27061, -27050, -27035, -27014,
+        -26989, -26959, -26924, -26884, -26840, -26791, -26738, -26680, -26619, -26553, -26482, -26408,
+        -26330, -26248, -26162, -26072, -25979, -25882, -25781, -25678, -25571, -25460, -25347, -25230,
+        -25111, -24988, -24863, -24736, -24605, -24472, -24337, -24199, -24060, -23918, -23774, -23628,
+        -23480, -23331, -23180, -23027, -22873, -22717, -22561, -22403, -22243, -22083, -21922, -21761,
+        -21598, -21435, -21271, -21107, -20942, -20777, -20612, -20447, -20282, -20117, -19952, -19787,
+        -19622, -19458, -19294, -19131, -18968, -18807, -18645, -18485, -18326, -18167, -18010, -17853,
+        -17698, -17544, -17391, -17240, -17090, -16942, -16795, -16649, -16506, -16364, -16223, -16085,
+        -15948, -15813, -15681, -15550, -15421, -15294, -15169, -15046, -14926, -14807, -14691, -14577,
+        -14465, -14356, -14249, -14144, -14042, -13941, -13844, -13748, -13655, -13565, -13477, -13391,
+        -13308, -13227, -13148, -13072, -12999, -12927, -12859, -12792, -12728, -12667, -12608, -12551,
+        -12496, -12444, -12394, -12347, -12301, -12258, -12217, -12179, -12142, -12108, -12076, -12046,
+        -12017, -11991, -11967, -11945, -11925, -11906, -11890, -11875, -11862, -11851, -11841, -11833,
+        -11826, -11821, -11818, -11816, -11815, -11816, -11818, -11821, -11825, -11831, -11837, -11845,
+        -11854, -11863, -11873, -11885, -11897, -11909, -11923, -11937, -11951, -11966, -11981, -11997,
+        -12013, -12030, -12046, -12063, -12080, -12097, -12114, -12130, -12147, -12164, -12180, -12196,
+        -12212, -12228, -12243, -12257, -12271, -12285, -12297, -12310, -12321, -12332, -12342, -12351,
+        -12359, -12366, -12373, -12378, -12382, -12385, -12387, -12388, -12388, -12386, -12383, -12379,
+        -12374, -12367, -12358, -12349, -12337, -12325, -12311, -12295, -12278, -12259, -12238, -12216,
+        -12193, -12167, -12140, -12112, -12081, -12049, -12016, -11980, -11943, -11904, -11863, -11821,
+        -11776, -11731, -11683, -11633, -11582, -11529, -11475, -11418, -11360, -11300, -11239, -11176,
+        -11111, -11044, -10976, -10906, -10835, -10761, -10687, -10611, -10533, -10454, -10373, -10291,
+        -10207, -10122, -10035,  -9948,  -9858,  -9768,  -9676,  -9583,  -9489,  -9394,  -9297,  -9200,
+         -9101,  -9001,  -8901,  -8799,  -8697,  -8593,  -8489,  -8384,  -8278,  -8171,  -8064,  -7956,
+         -7848,  -7739,  -7629,  -7519,  -7409,  -7298,  -7187,  -7075,  -6964,  -6852,  -6740,  -6628,
+         -6515,  -6403,  -6291,  -6179,  -6067,  -5955,  -5843,  -5731,  -5620,  -5509,  -5398,  -5288,
+         -5178,  -5069,  -4960,  -4852,  -4744,  -4637,  -4531,  -4425,  -4320,  -4216,  -4113,  -4011,
+         -3909,  -3809,  -3709,  -3610,  -3513,  -3416,  -3321,  -3226,  -3133,  -3041,  -2950,  -2861,
+         -2772,  -2685,  -2599,  -2515,  -2432,  -2350,  -2269,  -2190,  -2113,  -2036,  -1961,  -1888,
+         -1816,  -1746,  -1677,  -1609,  -1543,  -1479,  -1416,  -1355,  -1295,  -1236,  -1180,  -1124,
+         -1071,  -1018,   -968,   -918,   -871,   -824,   -780,   -736,   -695,   -654,   -616,   -578,
+          -542,   -508,   -475,   -443,   -412,   -383,   -356,   -329,   -304,   -280,   -257,   -236,
+          -216,   -196,   -178,   -161,   -146,   -131,   -117,   -104,    -92,    -81,    -71,    -62,
+           -54,    -46,    -39,    -33,    -28,    -23,    -19,    -15,    -12,     -9,     -7,     -5,
+            -3,     -2,     -1,     -1,      0,      0,      0,      0,      0,      0,      0,      0,
+             0,      1,      1,      2,      3,      5,      7,      9,     12,     15,     19,     23,
+            28,     33,     39,     46,     54,     62,     71,     81,     92,    104,    117,    131,
+           146,    161,    178,    196,    216,    236,    257,    280,    304,    329,    356,    383,
+           412,    443,    475,    508,    542,    578,    616,    654,    695,    736,    780,    824,
+           871,    918,    968,   1018,   1071,   1124,   1180,   1236,   1295,   1355,   1416,   1479,
+          1543,   1609,   1677,   1746,   1816,   1888,   1961,   2036,   2113,   2190,   2269,   2350,
+          2432,   2515,   2599,   2685,   2772,   2861,   2950,   3041,   3133,   3226,   3321,   3416,
+          3513,   3610,   3709,   3809,   3909,   4011,   4113,   4216,   4320,   4425,   4531,   4637,
+          4744,   4852,   4960,   5069,   5178,   5288,   5398,   5509,   5620,   5731,   5843,   5955,
+          6067,   6179,   6291,   6403,   6515,   6628,   6740,   6852,   6964,   7075,   7187,   7298,
+          7409,   7519,   7629,   7739,   7848,   7956,   8064,   8171,   8278,   8384,   8489,   8593,
+          8697,   8799,   8901,   9001,   9101,   9200,   9297,   9394,   9489,   9583,   9676,   9768,
+          9858,   9948,  10035,  10122,  10207,  10291,  10373,  10454,  10533,  10611,  10687,  10761,
+         10835,  10906,  10976,  11044,  11111,  11176,  11239,  11300,  11360,  11418,  11475,  11529,
+         11582,  11633,  11683,  11731,  11776,  11821,  11863,  11904,  11943,  11980,  12016,  12049,
+         12081,  12112,  12140,  12167,  12193,  12216,  12238,  12259,  12278,  12295,  12311,  12325,
+         12337,  12349,  12358,  12367,  12374,  12379,  12383,  12386,  12388,  12388,  12387,  12385,
+         12382,  12378,  12373,  12366,  12359,  12351,  12342,  12332,  12321,  12310,  12297,  12285,
+         12271,  12257,  12243,  12228,  12212,  12196,  12180,  12164,  12147,  12130,  12114,  12097,
+         12080,  12063,  12046,  12030,  12013,  11997,  11981,  11966,  11951,  11937,  11923,  11909,
+         11897,  11885,  11873,  11863,  11854,  11845,  11837,  11831,  11825,  11821,  11818,  11816,
+         11815,  11816,  11818,  11821,  11826,  11833,  11841,  11851,  11862,  11875,  11890,  11906,
+         11925,  11945,  11967,  11991,  12017,  12046,  12076,  12108,  12142,  12179,  12217,  12258,
+         12301,  12347,  12394,  12444,  12496,  12551,  12608,  12667,  12728,  12792,  12859,  12927,
+         12999,  13072,  13148,  13227,  13308,  13391,  13477,  13565,  13655,  13748,  13844,  13941,
+         14042,  14144,  14249,  14356,  14465,  14577,  14691,  14807,  14926,  15046,  15169,  15294,
+         15421,  15550,  15681,  15813,  15948,  16085,  16223,  16364,  16506,  16649,  16795,  16942,
+         17090,  17240,  17391,  17544,  17698,  17853,  18010,  18167,  18326,  18485,  18645,  18807,
+         18968,  19131,  19294,  19458,  19622,  19787,  19952,  20117,  20282,  20447,  20612,  20777,
+         20942,  21107,  21271,  21435,  21598,  21761,  21922,  22083,  22243,  22403,  22561,  22717,
+         22873,  23027,  23180,  23331,  23480,  23628,  23774,  23918,  24060,  24199,  24337,  24472,
+         24605,  24736,  24863,  24988,  25111,  25230,  25347,  25460,  25571,  25678,  25781,  25882,
+         25979,  26072,  26162,  26248,  26330,  26408,  26482,  26553,  26619,  26680,  26738,  26791,
+         26840,  26884,  26924,  26959,  26989,  27014,  27035,  27050,  27061,  27067,  27067,  27062,
+         27053,  27038,  27017,  26991,  26960,  26923,  26881,  26834,  26780,  26721,  26657,  26587,
+         26511,  26429,  26342,  26248,  26149,  26045,  25934,  25817,  25695,  25567,  25432,  25292,
+         25146,  24994,  24837,  24673,  24503,  24328,  24147,  23960,  23767,  23568,  23363,  23153,
+         22937,  22715,  22487,  22254,  22015,  21771,  21521,  21266,  21005,  20739,  20467,  20190,
+         19908,  19620,  19328,  19030,  18728,  18420,  18108,  17791,  17469,  17142,  16811,  16475,
+         16135,  15790,  15441,  15088,  14731,  14370,  14005,  13636,  13264,  12887,  12508,  12124,
+         11738,  11348,  10955,  10559,  10160,   9758,   9354,   8947,   8537,   8125,   7711,   7295,
+          6876,   6456,   6034,   5610,   5185,   4758,   4329,   3900,   3469,   3038,   2605,   2172,
+          1739,   1304,    870,    435,      0,
+    },
+    // Level 8, harmonics 1 - 2
+    {
+             0,   -217,   -435,   -652,   -870,  -1087,  -1304,  -1521,  -1738,  -1955,  -2171,  -2388,
+         -2604,  -2820,  -3036,  -3251,  -3466,  -3681,  -3895,  -4109,  -4323,  -4536,  -4749,  -4961,
+         -5173,  -5384,  -5595,  -5805,  -6015,  -6224,  -6433,  -6641,  -6849,  -7055,  -7262,  -7467,
+         -7672,  -7876,  -8079,  -8282,  -8483,  -8684,  -8885,  -9084,  -9283,  -9480,  -9677,  -9873,
+        -10068, -10262, -10455, -10647, -10838, -11028, -11217, -11405, -11592, -11778, -11963, -12147,
+        -12329, -12511, -12691, -12870, -13048, -13225, -13400, -13575, -13748, -13920, -14090, -14259,
+        -14427, -14594, -14759, -14923, -15086, -15247, -15407, -15565, -15722, -15878, -16032, -16185,
+        -16336, -16486, -16634, -16781, -16926, -17070, -17212, -17353, -17492, -17630, -17766, -17900,
+        -18033, -18164, -18294, -18422, -18548, -18673, -18796, -18917, -19037, -19155, -19272, -19386,
+        -19499, -19611, -19720, -19828, -19934, -20039, -20141, -20242, -20341, -20439, -20535, -20628,
+        -20721, -20811, -20899, -20986, -21071, -21154, -21236, -21315, -21393, -21469, -21543, -21616,
+        -21686, -21755, -21822, -21887, -21950, -22012, -22071, -22129, -22185, -22239, -22292, -22342,
+        -22391, -22438, -22483, -22526, -22567, -22607, -22645, -22681, -22715, -22747, -22778, -22806,
+        -22833, -22858, -22882, -22903, -22923, -22941, -22957, -22971, -22984, -22994, -23004, -23011,
+        -23016, -23020, -23022, -23022, -23021, -23018, -23013, -23006, -22998, -22988, -22976, -22963,
+        -22948, -22931, -22913, -22893, -22871, -22848, -22823, -22796, -22768, -22738, -22707, -22674,
+        -22640, -22604, -22566, -22527, -22486, -22444, -22400, -22355, -22308, -22260, -22211, -22159,
+        -22107, -22053, -21998, -21941, -21883, -21823, -21762, -21700, -21636, -21571, -21505, -21438,
+        -21369, -21299, -21227, -21155, -21081, -21006, -20929, -20852, -20773, -20693, -20612, -20530,
+        -20447, -20363, -20277, -20191, -20103, -20015, -19925, -19834, -19743, -19650, -19556, -19462,
+        -19366, -19270, -19172, -19074, -18975, -18875, -18774, -18672, -18570, -18467, -18363, -18258,
+        -18152, -18046, -17939, -17831, -17723, -17614, -17504, -17394, -17283, -17171, -17059, -16946,
+        -16833, -16719, -16605, -16490, -16374, -16259, -16142, -16026, -15909, -15791, -15673, -15555,
+        -15436, -15317, -15198, -15078, -14959, -14838, -14718, -14597, -14477, -14355, -14234, -14113,
+        -13991, -13869, -13747, -13625, -13503, -13381, -13259, -13137, -13014, -12892, -12770, -12647,
+        -12525, -12403, -12281, -12159, -12036, -11915, -11793, -11671, -11550, -11428, -11307, -11186,
+        -11065, -10945, -10824, -10704, -10584, -10465, -10345, -10226, -10108,  -9989,  -9871,  -9754,
+         -9636,  -9520,  -9403,  -9287,  -9171,  -9056,  -8941,  -8827,  -8713,  -8599,  -8486,  -8374,
+         -8262,  -8151,  -8040,  -7929,  -7820,  -7710,  -7602,  -7494,  -7386,  -7279,  -7173,  -7068,
+         -6963,  -6858,  -6754,  -6651,  -6549,  -6447,  -6346,  -6246,  -6146,  -6048,  -5949,  -5852,
+         -5755,  -5659,  -5564,  -5470,  -5376,  -5283,  -5191,  -5099,  -5009,  -4919,  -4830,  -4742,
+         -4654,  -4568,  -4482,  -4397,  -4313,  -4230,  -4147,  -4066,  -3985,  -3905,  -3826,  -3748,
+         -3670,  -3594,  -3518,  -3444,  -3370,  -3297,  -3225,  -3154,  -3083,  -3014,  -2945,  -2877,
+         -2811,  -2745,  -2680,  -2615,  -2552,  -2490,  -2428,  -2368,  -2308,  -2249,  -2191,  -2134,
+         -2078,  -2022,  -1968,  -1914,  -1862,  -1810,  -1759,  -1709,  -1659,  -1611,  -1564,  -1517,
+         -1471,  -1426,  -1382,  -1339,  -1296,  -1255,  -1214,  -1174,  -1135,  -1097,  -1059,  -1022,
+          -986,   -951,   -917,   -884,   -851,   -819,   -788,   -757,   -728,   -699,   -670,   -643,
+          -616,   -590,   -565,   -540,   -516,   -493,   -470,   -449,   -427,   -407,   -387,   -368,
+          -349,   -331,   -314,   -297,   -281,   -265,   -250,   -235,   -222,   -208,   -195,   -183,
+          -171,   -160,   -149,   -139,   -129,   -120,   -111,   -102,    -94,    -87,    -80,    -73,
+           -66,    -60,    -55,    -50,    -45,    -40,    -36,    -32,    -28,    -25,    -22,    -19,
+           -16,    -14,    -12,    -10,     -8,     -7,     -6,     -4,     -4,     -3,     -2,     -1,
+            -1,     -1,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,
+             0,      0,      0,      1,      1,      1,      2,      3,      4,      4,      6,      7,
+             8,     10,     12,     14,     16,     19,     22,     25,     28,     32,     36,     40,
+            45,     50,     55,     60,     66,     73,     80,     87,     94,    102,    111,    120,
+           129,    139,    149,    160,    171,    183,    195,    208,    222,    235,    250,    265,
+           281,    297,    314,    331,    349,    368,    387,    407,    427,    449,    470,    493,
+           516,    540,    565,    590,    616,    643,    670,    699,    728,    757,    788,    819,
+           851,    884,    917,    951,    986,   1022,   1059,   1097,   1135,   1174,   1214,   1255,
+          1296,   1339,   1382,   1426,   1471,   1517,   1564,   1611,   1659,   1709,   1759,   1810,
+          1862,   1914,   1968,   2022,   2078,   2134,   2191,   2249,   2308,   2368,   2428,   2490,
+          2552,   2615,   2680,   2745,   2811,   2877,   2945,   3014,   3083,   3154,   3225,   3297,
+          3370,   3444,   3518,   3594,   3670,   3748,   3826,   3905,   3985,   4066,   4147,   4230,
+          4313,   4397,   4482,   4568,   4654,   4742,   4830,   4919,   5009,   5099,   5191,   5283,
+          5376,   5470,   5564,   5659,   5755,   5852,   5949,   6048,   6146,   6246,   6346,   6447,
+          6549,   6651,   6754,   6858,   6963,   7068,   7173,   7279,   7386,   7494,   7602,   7710,
+          7820,   7929,   8040,   8151,   8262,   8374,   8486,   8599,   8713,   8827,   8941,   9056,
+          9171,   9287,   9403,   9520,   9636,   9754,   9871,   9989,  10108,  10226,  10345,  10465,
+         10584,  10704,  10824,  10945,  11065,  11186,  11307,  11428,  11550,  11671,  11793,  11915,
+         12036,  12159,  12281,  12403,  12525,  12647,  12770,  12892,  13014,  13137,  13259,  13381,
+         13503,  13625,  13747,  13869,  13991,  14113,  14234,  14355,  14477,  14597,  14718,  14838,
+         14959,  15078,  15198,  15317,  15436,  15555,  15673,  15791,  15909,  16026,  16142,  16259,
+         16374,  16490,  16605,  16719,  16833,  16946,  17059,  17171,  17283,  17394,  17504,  17614,
+         17723,  17831,  17939,  18046,  18152,  18258,  18363,  18467,  18570,  18672,  18774,  18875,
+         18975,  19074,  19172,  19270,  19366,  19462,  19556,  19650,  19743,  19834,  19925,  20015,
+         20103,  20191,  20277,  20363,  20447,  20530,  20612,  20693,  20773,  20852,  20929,  21006,
+         21081,  21155,  21227,  21299,  21369,  21438,  21505,  21571,  21636,  21700,  21762,  21823,
+         21883,  21941,  21998,  22053,  22107,  22159,  22211,  22260,  22308,  22355,  22400,  22444,
+         22486,  22527,  22566,  22604,  22640,  22674,  22707,  22738,  22768,  22796,  22823,  22848,
+         22871,  22893,  22913,  22931,  22948,  22963,  22976,  22988,  22998,  23006,  23013,  23018,
+         23021,  23022,  23022,  23020,  23016,  23011,  23004,  22994,  22984,  22971,  22957,  22941,
+         22923,  22903,  22882,  22858,  22833,  22806,  22778,  22747,  22715,  22681,  22645,  22607,
+         22567,  22526,  22483,  22438,  22391,  22342,  22292,  22239,  22185,  22129,  22071,  22012,
+         21950,  21887,  21822,  21755,  21686,  21616,  21543,  21469,  21393,  21315,  21236,  21154,
+         21071,  20986,  20899,  20811,  20721,  20628,  20535,  20439,  20341,  20242,  20141,  20039,
+         19934,  19828,  19720,  19611,  19499,  19386,  19272,  19155,  19037,  18917,  18796,  18673,
+         18548,  18422,  18294,  18164,  18033,  17900,  17766,  17630,  17492,  17353,  17212,  17070,
+         16926,  16781,  16634,  16486,  16336,  16185,  16032,  15878,  15722,  15565,  15407,  15247,
+         15086,  14923,  14759,  14594,  14427,  14259,  14090,  13920,  13748,  13575,  13400,  13225,
+         13048,  12870,  12691,  12511,  12329,  12147,  11963,  11778,  11592,  11405,  11217,  11028,
+         10838,  10647,  10455,  10262,  10068,   9873,   9677,   9480,   9283,   9084,   8885,   8684,
+          8483,   8282,   8079,   7876,   7672,   7467,   7262,   7055,   6849,   6641,   6433,   6224,
+          6015,   5805,   5595,   5384,   5173,   4961,   4749,   4536,   4323,   4109,   3895,   3681,
+          3466,   3251,   3036,   2820,   2604,   2388,   2171,   1955,   1738,   1521,   1304,   1087,
+           870,    652,    435,    217,      0,
+    },
+    // Level 9, harmonics 1 - 1
+    {
+             0,   -109,   -217,   -326,   -435,   -544,   -652,   -761,   -870,   -978,  -1087,  -1195,
+         -1304,  -1412,  -1521,  -1629,  -1737,  -1845,  -1953,  -2061,  -2169,  -2277,  -2385,  -2493,
+         -2600,  -2708,  -2815,  -2923,  -3030,  -3137,  -3244,  -3351,  -3458,  -3564,  -3671,  -3777,
+         -3883,  -3989,  -4095,  -4201,  -4306,  -4412,  -4517,  -4622,  -4727,  -4832,  -4936,  -5040,
+         -5145,  -5249,  -5352,  -5456,  -5559,  -5662,  -5765,  -5868,  -5971,  -6073,  -6175,  -6277,
+         -6378,  -6480,  -6581,  -6682,  -6782,  -6883,  -6983,  -7082,  -7182,  -7281,  -7380,  -7479,
+         -7577,  -7676,  -7773,  -7871,  -7968,  -8065,  -8162,  -8258,  -8354,  -8450,  -8546,  -8641,
+         -8736,  -8830,  -8924,  -9018,  -9111,  -9204,  -9297,  -9390,  -9482,  -9573,  -9665,  -9756,
+         -9846,  -9936, -10026, -10116, -10205, -10294, -10382, -10470, -10557, -10645, -10731, -10818,
+        -10904, -10989, -11074, -11159, -11243, -11327, -11410, -11493, -11576, -11658, -11740, -11821,
+        -11902, -11982, -12062, -12142, -12221, -12299, -12377, -12455, -12532, -12609, -12685, -12760,
+        -12836, -12910, -12985, -13058, -13132, -13204, -13277, -13349, -13420, -13491, -13561, -13631,
+        -13700, -13769, -13837, -13904, -13972, -14038, -14104, -14170, -14235, -14300, -14364, -14427,
+        -14490, -14552, -14614, -14675, -14736, -14796, -14856, -14915, -14973, -15031, -15088, -15145,
+        -15201, -15257, -15312, -15366, -15420, -15474, -15526, -15579, -15630, -15681, -15731, -15781,
+        -15830, -15879, -15927, -15974, -16021, -16067, -16113, -16158, -16202, -16246, -16289, -16332,
+        -16374, -16415, -16456, -16496, -16535, -16574, -16612, -16650, -16687, -16723, -16759, -16794,
+        -16828, -16862, -16895, -16928, -16960, -16991, -17021, -17051, -17081, -17109, -17137, -17165,
+        -17192, -17218, -17243, -17268, -17292, -17316, -17338, -17361, -17382, -17403, -17423, -17443,
+        -17462, -17480, -17498, -17515, -17531, -17547, -17562, -17576, -17589, -17602, -17615, -17626,
+        -17637, -17648, -17657, -17666, -17675, -17682, -17689, -17696, -17701, -17706, -17711, -17714,
+        -17717, -17720, -17721, -17722, -17723, -17722, -17721, -17720, -17717, -17714, -17711, -17706,
+        -17701, -17696, -17689, -17682, -17675, -17666, -17657, -17648, -17637, -17626, -17615, -17602,
+        -17589, -17576, -17562, -17547, -17531, -17515, -17498, -17480, -17462, -17443, -17423, -17403,
+        -17382, -17361, -17338, -17316, -17292, -17268, -17243, -17218, -17192, -17165, -17137, -17109,
+        -17081, -17051, -17021, -16991, -16960, -16928, -16895, -16862, -16828, -16794, -16759, -16723,
+        -16687, -16650, -16612, -16574, -16535, -16496, -16456, -16415, -16374, -16332, -16289, -16246,
+        -16202, -16158, -16113, -16067, -16021, -15974, -15927, -15879, -15830, -15781, -15731, -15681,
+        -15630, -15579, -15526, -15474, -15420, -15366, -15312, -15257, -15201, -15145, -15088, -15031,
+        -14973, -14915, -14856, -14796, -14736, -14675, -14614, -14552, -14490, -14427, -14364, -14300,
+        -14235, -14170, -14104, -14038, -13972, -13904, -13837, -13769, -13700, -13631, -13561, -13491,
+        -13420, -13349, -13277, -13204, -13132, -13058, -12985, -12910, -12836, -12760, -12685, -12609,
+        -12532, -12455, -12377, -12299, -12221, -12142, -12062, -11982, -11902, -11821, -11740, -11658,
+        -11576, -11493, -11410, -11327, -11243, -11159, -11074, -10989, -10904, -10818, -10731, -10645,
+        -10557, -10470, -10382, -10294, -10205, -10116, -10026,  -9936,  -9846,  -9756,  -9665,  -9573,
+         -9482,  -9390,  -9297,  -9204,  -9111,  -9018,  -8924,  -8830,  -8736,  -8641,  -8546,  -8450,
+         -8354,  -8258,  -8162,  -8065,  -7968,  -7871,  -7773,  -7676,  -7577,  -7479,  -7380,  -7281,
+         -7182,  -7082,  -6983,  -6883,  -6782,  -6682,  -6581,  -6480,  -6378,  -6277,  -6175,  -6073,
+         -5971,  -5868,  -5765,  -5662,  -5559,  -5456,  -5352,  -5249,  -5145,  -5040,  -4936,  -4832,
+         -4727,  -4622,  -4517,  -4412,  -4306,  -4201,  -4095,  -3989,  -3883,  -3777,  -3671,  -3564,
+         -3458,  -3351,  -3244,  -3137,  -3030,  -2923,  -2815,  -2708,  -2600,  -2493,  -2385,  -2277,
+         -2169,  -2061,  -1953,  -1845,  -1737,  -1629,  -1521,  -1412,  -1304,  -1195,  -1087,   -978,
+          -870,   -761,   -652,   -544,   -435,   -326,   -217,   -109,      0,    109,    217,    326,
+           435,    544,    652,    761,    870,    978,   1087,   1195,   1304,   1412,   1521,   1629,
+          1737,   1845,   1953,   2061,   2169,   2277,   2385,   2493,   2600,   2708,   2815,   2923,
+          3030,   3137,   3244,   3351,   3458,   3564,   3671,   3777,   3883,   3989,   4095,   4201,
+          4306,   4412,   4517,   4622,   4727,   4832,   4936,   5040,   5145,   5249,   5352,   5456,
+          5559,   5662,   5765,   5868,   5971,   6073,   6175,   6277,   6378,   6480,   6581,   6682,
+          6782,   6883,   6983,   7082,   7182,   7281,   7380,   7479,   7577,   7676,   7773,   7871,
+          7968,   8065,   8162,   8258,   8354,   8450,   8546,   8641,   8736,   8830,   8924,   9018,
+          9111,   9204,   9297,   9390,   9482,   9573,   9665,   9756,   9846,   9936,  10026,  10116,
+         10205,  10294,  10382,  10470,  10557,  10645,  10731,  10818,  10904,  10989,  11074,  11159,
+         11243,  11327,  11410,  11493,  11576,  11658,  11740,  11821,  11902,  11982,  12062,  12142,
+         12221,  12299,  12377,  12455,  12532,  12609,  12685,  12760,  12836,  12910,  12985,  13058,
+         13132,  13204,  13277,  13349,  13420,  13491,  13561,  13631,  13700,  13769,  13837,  13904,
+         13972,  14038,  14104,  14170,  14235,  14300,  14364,  14427,  14490,  14552,  14614,  14675,
+         14736,  14796,  14856,  14915,  14973,  15031,  15088,  15145,  15201,  15257,  15312,  15366,
+         15420,  15474,  15526,  15579,  15630,  15681,  15731,  15781,  15830,  15879,  15927,  15974,
+         16021,  16067,  16113,  16158,  16202,  16246,  16289,  16332,  16374,  16415,  16456,  16496,
+         16535,  16574,  16612,  16650,  16687,  16723,  16759,  16794,  16828,  16862,  16895,  16928,
+         16960,  16991,  17021,  17051,  17081,  17109,  17137,  17165,  17192,  17218,  17243,  17268,
+         17292,  17316,  17338,  17361,  17382,  17403,  17423,  17443,  17462,  17480,  17498,  17515,
+         17531,  17547,  17562,  17576,  17589,  17602,  17615,  17626,  17637,  17648,  17657,  17666,
+         17675,  17682,  17689,  17696,  17701,  17706,  17711,  17714,  17717,  17720,  17721,  17722,
+         17723,  17722,  17721,  17720,  17717,  17714,  17711,  17706,  17701,  17696,  17689,  17682,
+         17675,  17666,  17657,  17648,  17637,  17626,  17615,  17602,  17589,  17576,  17562,  17547,
+         17531,  17515,  17498,  17480,  17462,  17443,  17423,  17403,  17382,  17361,  17338,  17316,
+         17292,  17268,  17243,  17218,  17192,  17165,  17137,  17109,  17081,  17051,  17021,  16991,
+         16960,  16928,  16895,  16862,  16828,  16794,  16759,  16723,  16687,  16650,  16612,  16574,
+         16535,  16496,  16456,  16415,  16374,  16332,  16289,  16246,  16202,  16158,  16113,  16067,
+         16021,  15974,  15927,  15879,  15830,  15781,  15731,  15681,  15630,  15579,  15526,  15474,
+         15420,  15366,  15312,  15257,  15201,  15145,  15088,  15031,  14973,  14915,  14856,  14796,
+         14736,  14675,  14614,  14552,  14490,  14427,  14364,  14300,  14235,  14170,  14104,  14038,
+         13972,  13904,  13837,  13769,  13700,  13631,  13561,  13491,  13420,  13349,  13277,  13204,
+         13132,  13058,  12985,  12910,  12836,  12760,  12685,  12609,  12532,  12455,  12377,  12299,
+         12221,  12142,  12062,  11982,  11902,  11821,  11740,  11658,  11576,  11493,  11410,  11327,
+         11243,  11159,  11074,  10989,  10904,  10818,  10731,  10645,  10557,  10470,  10382,  10294,
+         10205,  10116,  10026,   9936,   9846,   9756,   9665,   9573,   9482,   9390,   9297,   9204,
+          9111,   9018,   8924,   8830,   8736,   8641,   8546,   8450,   8354,   8258,   8162,   8065,
+          7968,   7871,   7773,   7676,   7577,   7479,   7380,   7281,   7182,   7082,   6983,   6883,
+          6782,   6682,   6581,   6480,   6378,   6277,   6175,   6073,   5971,   5868,   5765,   5662,
+          5559,   5456,   5352,   5249,   5145,   5040,   4936,   4832,   4727,   4622,   4517,   4412,
+          4306,   4201,   4095,   3989,   3883,   3777,   3671,   3564,   3458,   3351,   3244,   3137,
+          3030,   2923,   2815,   2708,   2600,   2493,   2385,   2277,   2169,   2061,   1953,   1845,
+          1737,   1629,   1521,   1412,   1304,   1195,   1087,    978,    870,    761,    652,    544,
+           435,    326,    217,    109,      0,
+    },
+};
+
+const int16_t wavetable_square[WAVE_MIPMAP_LEVELS][WAVE_SAMPLES_COUNT + 1] = {
+    // Level 0, harmonics 1 - 511
+    {
+             0,  30341,  23234,  27439,  24447,  26770,  24871,  26477,  25085,  26313,  25214,  26209,
+         25301,  26136,  25363,  26083,  25409,  26042,  25445,  26010,  25474,  25984,  25497,  25963,
+         25517,  25944,  25534,  25929,  25548,  25916,  25560,  25904,  25571,  25894,  25581,  25885,
+         25589,  25877,  25597,  25870,  25603,  25864,  25610,  25858,  25615,  25853,  25620,  25848,
+         25625,  25843,  25629,  25839,  25633,  25835,  25637,  25832,  25640,  25829,  25643,  25825,
+         25646,  25823,  25649,  25820,  25652,  25818,  25654,  25815,  25656,  25813,  25658,  25811,
+         25660,  25809,  25662,  25807,  25664,  25805,  25666,  25804,  25667,  25802,  25669,  25801,
+         25670,  25799,  25672,  25798,  25673,  25797,  25674,  25796,  25675,  25794,  25676,  25793,
+         25678,  25792,  25679,  25791,  25680,  25790,  25681,  25789,  25681,  25788,  25682,  25788,
+         25683,  25787,  25684,  25786,  25685,  25785,  25685,  25784,  25686,  25784,  25687,  25783,
+         25687,  25782,  25688,  25782,  25689,  25781,  25689,  25781,  25690,  25780,  25690,  25780,
+         25691,  25779,  25691,  25779,  25692,  25778,  25692,  25778,  25693,  25777,  25693,  25777,
+         25694,  25776,  25694,  25776,  25695,  25776,  25695,  25775,  25695,  25775,  25696,  25774,
+         25696,  25774,  25696,  25774,  25697,  25773,  25697,  25773,  25697,  25773,  25698,  25773,
+         25698,  25772,  25698,  25772,  25698,  25772,  25699,  25772,  25699,  25771,  25699,  25771,
+         25699,  25771,  25700,  25771,  25700,  25770,  25700,  25770,  25700,  25770,  25700,  25770,
+         25701,  25770,  25701,  25770,  25701,  25769,  25701,  25769,  25701,  25769,  25701,  25769,
+         25701,  25769,  25702,  25769,  25702,  25769,  25702,  25768,  25702,  25768,  25702,  25768,
+         25702,  25768,  25702,  25768,  25702,  25768,  25702,  25768,  25703,  25768,  25703,  25768,
+         25703,  25768,  25703,  25768,  25703,  25767,  25703,  25767,  25703,  25767,  25703,  25767,
+         25703,  25767,  25703,  25767,  25703,  25767,  25703,  25767,  25703,  25767,  25703,  25767,
+         25703,  25767,  25703,  25767,  25703,  25767,  25703,  25767,  25703,  25767,  25703,  25767,
+         25703,  25767,  25703,  25767,  25703,  25767,  25703,  25767,  25703,  25767,  25703,  25767,
+         25703,  25767,  25703,  25767,  25703,  25768,  25703,  25768,  25703,  25768,  25703,  25768,
+         25703,  25768,  25702,  25768,  25702,  25768,  25702,  25768,  25702,  25768,  25702,  25768,
+         25702,  25768,  25702,  25769,  25702,  25769,  25702,  25769,  25701,  25769,  25701,  25769,
+         25701,  25769,  25701,  25769,  25701,  25770,  25701,  25770,  25701,  25770,  25700,  25770,
+         25700,  25770,  25700,  25770,  25700,  25771,  25700,  25771,  25699,  25771,  25699,  25771,
+         25699,  25772,  25699,  25772,  25698,  25772,  25698,  25772,  25698,  25773,  25698,  25773,
+         25697,  25773,  25697,  25773,  25697,  25774,  25696,  25774,  25696,  25774,  25696,  25775,
+         25695,  25775,  25695,  25776,  25695,  25776,  25694,  25776,  25694,  25777,  25693,  25777,
+         25693,  25778,  25692,  25778,  25692,  25779,  25691,  25779,  25691,  25780,  25690,  25780,
+         25690,  25781,  25689,  25781,  25689,  25782,  25688,  25782,  25687,  25783,  25687,  25784,
+         25686,  25784,  25685,  25785,  25685,  25786,  25684,  25787,  25683,  25788,  25682,  25788,
+         25681,  25789,  25681,  25790,  25680,  25791,  25679,  25792,  25678,  25793,  25676,  25794,
+         25675,  25796,  25674,  25797,  25673,  25798,  25672,  25799,  25670,  25801,  25669,  25802,
+         25667,  25804,  25666,  25805,  25664,  25807,  25662,  25809,  25660,  25811,  25658,  25813,
+         25656,  25815,  25654,  25818,  25652,  25820,  25649,  25823,  25646,  25825,  25643,  25829,
+         25640,  25832,  25637,  25835,  25633,  25839,  25629,  25843,  25625,  25848,  25620,  25853,
+         25615,  25858,  25610,  25864,  25603,  25870,  25597,  25877,  25589,  25885,  25581,  25894,
+         25571,  25904,  25560,  25916,  25548,  25929,  25534,  25944,  25517,  25963,  25497,  25984,
+         25474,  26010,  25445,  26042,  25409,  26083,  25363,  26136,  25301,  26209,  25214,  26313,
+         25085,  26477,  24871,  26770,  24447,  27439,  23234,  30341,      0, -30341, -23234, -27439,
+        -24447, -26770, -24871, -26477, -25085, -26313, -25214, -26209, -25301, -26136, -25363, -26083,
+        -25409, -26042, -25445, -26010, -25474, -25984, -25497, -25963, -25517, -25944, -25534, -25929,
+        -25548, -25916, -25560, -25904, -25571, -25894, -25581, -25885, -25589, -25877, -25597, -25870,
+        -25603, -25864, -25610, -25858, -25615, -25853, -25620, -25848, -25625, -25843, -25629, -25839,
+        -25633, -25835, -25637, -25832, -25640, -25829, -25643, -25825, -25646, -25823, -25649, -25820,
+        -25652, -25818, -25654, -25815, -25656, -25813, -25658, -25811, -25660, -25809, -25662, -25807,
+        -25664, -25805, -25666, -25804, -25667, -25802, -25669, -25801, -25670, -25799, -25672, -25798,
+        -25673, -25797, -25674, -25796, -25675, -25794, -25676, -25793, -25678, -25792, -25679, -25791,
+        -25680, -25790, -25681, -25789, -25681, -25788, -25682, -25788, -25683, -25787, -25684, -25786,
+        -25685, -25785, -25685, -25784, -25686, -25784, -25687, -25783, -25687, -25782, -25688, -25782,
+        -25689, -25781, -25689, -25781, -25690, -25780, -25690, -25780, -25691, -25779, -25691, -25779,
+        -25692, -25778, -25692, -25778, -25693, -25777, -25693, -25777, -25694, -25776, -25694, -25776,
+        -25695, -25776, -25695, -25775, -25695, -25775, -25696, -25774, -25696, -25774, -25696, -25774,
+        -25697, -25773, -25697, -25773, -25697, -25773, -25698, -25773, -25698, -25772, -25698, -25772,
+        -25698, -25772, -25699, -25772, -25699, -25771, -25699, -25771, -25699, -25771, -25700, -25771,
+        -25700, -25770, -25700, -25770, -25700, -25770, -25700, -25770, -25701, -25770, -25701, -25770,
+        -25701, -25769, -25701, -25769, -25701, -25769, -25701, -25769, -25701, -25769, -25702, -25769,
+        -25702, -25769, -25702, -25768, -25702, -25768, -25702, -25768, -25702, -25768, -25702, -25768,
+        -25702, -25768, -25702, -25768, -25703, -25768, -25703, -25768, -25703, -25768, -25703, -25768,
+        -25703, -25767, -25703, -25767, -25703, -25767, -25703, -25767, -25703, -25767, -25703, -25767,
+        -25703, -25767, -25703, -25767, -25703, -25767, -25703, -25767, -25703, -25767, -25703, -25767,
+        -25703, -25767, -25703, -25767, -25703, -25767, -25703, -25767, -25703, -25767, -25703, -25767,
+        -25703, -25767, -25703, -25767, -25703, -25767, -25703, -25767, -25703, -25767, -25703, -25767,
+        -25703, -25768, -25703, -25768, -25703, -25768, -25703, -25768, -25703, -25768, -25702, -25768,
+        -25702, -25768, -25702, -25768, -25702, -25768, -25702, -25768, -25702, -25768, -25702, -25769,
+        -25702, -25769, -25702, -25769, -25701, -25769, -25701, -25769, -25701, -25769, -25701, -25769,
+        -25701, -25770, -25701, -25770, -25701, -25770, -25700, -25770, -25700, -25770, -25700, -25770,
+        -25700, -25771, -25700, -25771, -25699, -25771, -25699, -25771, -25699, -25772, -25699, -25772,
+        -25698, -25772, -25698, -25772, -25698, -25773, -25698, -25773, -25697, -25773, -25697, -25773,
+        -25697, -25774, -25696, -25774, -25696, -25774, -25696, -25775, -25695, -25775, -25695, -25776,
+        -25695, -25776, -25694, -25776, -25694, -25777, -25693, -25777, -25693, -25778, -25692, -25778,
+        -25692, -25779, -25691, -25779, -25691, -25780, -25690, -25780, -25690, -25781, -25689, -25781,
+        -25689, -25782, -25688, -25782, -25687, -25783, -25687, -25784, -25686, -25784, -25685, -25785,
+        -25685, -25786, -25684, -25787, -25683, -25788, -25682, -25788, -25681, -25789, -25681, -25790,
+        -25680, -25791, -25679, -25792, -25678, -25793, -25676, -25794, -25675, -25796, -25674, -25797,
+        -25673, -25798, -25672, -25799, -25670, -25801, -25669, -25802, -25667, -25804, -25666, -25805,
+        -25664, -25807, -25662, -25809, -25660, -25811, -25658, -25813, -25656, -25815, -25654, -25818,
+        -25652, -25820, -25649, -25823, -25646, -25825, -25643, -25829, -25640, -25832, -25637, -25835,
+        -25633, -25839, -25629, -25843, -25625, -25848, -25620, -25853, -25615, -25858, -25610, -25864,
+        -25603, -25870, -25597, -25877, -25589, -25885, -25581, -25894, -25571, -25904, -25560, -25916,
+        -25548, -25929, -25534, -25944, -25517, -25963, -25497, -25984, -25474, -26010, -25445, -26042,
+        -25409, -26083, -25363, -26136, -25301, -26209, -25214, -26313, -25085, -26477, -24871, -26770,
+        -24447, -27439, -23234, -30341,      0,
+    },
+    // Level 1, harmonics 1 - 256
+    {
+             0,  22458,  30341,  26351,  23234,  25490,  27439,  25865,  24446,  25655,  26771,  25789,
+         24870,  25696,  26478,  25764,  25084,  25712,  26314,  25753,  25213,  25720,  26210,  25748,
+         25300,  25725,  26138,  25744,  25361,  25727,  26084,  25742,  25407,  25729,  26044,  25741,
+         25443,  25730,  26012,  25739,  25472,  25731,  25986,  25739,  25495,  25732,  25965,  25738,
+         25515,  25732,  25947,  25738,  25531,  25733,  25932,  25737,  25545,  25733,  25919,  25737,
+         25557,  25733,  25907,  25737,  25568,  25734,  25898,  25737,  25577,  25734,  25889,  25736,
+         25585,  25734,  25881,  25736,  25593,  25734,  25874,  25736,  25599,  25734,  25868,  25736,
+         25605,  25734,  25862,  25736,  25611,  25734,  25857,  25736,  25616,  25734,  25852,  25736,
+         25620,  25734,  25848,  25736,  25624,  25735,  25844,  25736,  25628,  25735,  25841,  25736,
+         25631,  25735,  25838,  25736,  25634,  25735,  25835,  25736,  25637,  25735,  25832,  25736,
+         25640,  25735,  25829,  25736,  25642,  25735,  25827,  25736,  25645,  25735,  25825,  25735,
+         25647,  25735,  25822,  25735,  25649,  25735,  25821,  25735,  25651,  25735,  25819,  25735,
+         25652,  25735,  25817,  25735,  25654,  25735,  25816,  25735,  25655,  25735,  25814,  25735,
+         25657,  25735,  25813,  25735,  25658,  25735,  25811,  25735,  25659,  25735,  25810,  25735,
+         25661,  25735,  25809,  25735,  25662,  25735,  25808,  25735,  25663,  25735,  25807,  25735,
+         25663,  25735,  25806,  25735,  25664,  25735,  25806,  25735,  25665,  25735,  25805,  25735,
+         25666,  25735,  25804,  25735,  25667,  25735,  25803,  25735,  25667,  25735,  25803,  25735,
+         25668,  25735,  25802,  25735,  25668,  25735,  25802,  25735,  25669,  25735,  25801,  25735,
+         25669,  25735,  25801,  25735,  25670,  25735,  25801,  25735,  25670,  25735,  25800,  25735,
+         25670,  25735,  25800,  25735,  25670,  25735,  25800,  25735,  25671,  25735,  25800,  25735,
+         25671,  25735,  25799,  25735,  25671,  25735,  25799,  25735,  25671,  25735,  25799,  25735,
+         25671,  25735,  25799,  25735,  25671,  25735,  25799,  25735,  25671,  25735,  25799,  25735,
+         25671,  25735,  25799,  25735,  25671,  25735,  25799,  25735,  25671,  25735,  25800,  25735,
+         25671,  25735,  25800,  25735,  25670,  25735,  25800,  25735,  25670,  25735,  25800,  25735,
+         25670,  25735,  25801,  25735,  25670,  25735,  25801,  25735,  25669,  25735,  25801,  25735,
+         25669,  25735,  25802,  25735,  25668,  25735,  25802,  25735,  25668,  25735,  25803,  25735,
+         25667,  25735,  25803,  25735,  25667,  25735,  25804,  25735,  25666,  25735,  25805,  25735,
+         25665,  25735,  25806,  25735,  25664,  25735,  25806,  25735,  25663,  25735,  25807,  25735,
+         25663,  25735,  25808,  25735,  25662,  25735,  25809,  25735,  25661,  25735,  25810,  25735,
+         25659,  25735,  25811,  25735,  25658,  25735,  25813,  25735,  25657,  25735,  25814,  25735,
+         25655,  25735,  25816,  25735,  25654,  25735,  25817,  25735,  25652,  25735,  25819,  25735,
+         25651,  25735,  25821,  25735,  25649,  25735,  25822,  25735,  25647,  25735,  25825,  25735,
+         25645,  25736,  25827,  25735,  25642,  25736,  25829,  25735,  25640,  25736,  25832,  25735,
+         25637,  25736,  25835,  25735,  25634,  25736,  25838,  25735,  25631,  25736,  25841,  25735,
+         25628,  25736,  25844,  25735,  25624,  25736,  25848,  25734,  25620,  25736,  25852,  25734,
+         25616,  25736,  25857,  25734,  25611,  25736,  25862,  25734,  25605,  25736,  25868,  25734,
+         25599,  25736,  25874,  25734,  25593,  25736,  25881,  25734,  25585,  25736,  25889,  25734,
+         25577,  25737,  25898,  25734,  25568,  25737,  25907,  25733,  25557,  25737,  25919,  25733,
+         25545,  25737,  25932,  25733,  25531,  25738,  25947,  25732,  25515,  25738,  25965,  25732,
+         25495,  25739,  25986,  25731,  25472,  25739,  26012,  25730,  25443,  25741,  26044,  25729,
+         25407,  25742,  26084,  25727,  25361,  25744,  26138,  25725,  25300,  25748,  26210,  25720,
+         25213,  25753,  26314,  25712,  25084,  25764,  26478,  25696,  24870,  25789,  26771,  25655,
+         24446,  25865,  27439,  25490,  23234,  26351,  30341,  22458,      0, -22458, -30341, -26351,
+        -23234, -25490, -27439, -25865, -24446, -25655, -26771, -25789, -24870, -25696, -26478, -25764,
+        -25084, -25712, -26314, -25753, -25213, -25720, -26210, -25748, -25300, -25725, -26138, -25744,
+        -25361, -25727, -26084, -25742, -25407, -25729, -26044, -25741, -25443, -25730, -26012, -25739,
+        -25472, -25731, -25986, -25739, -25495, -25732, -25965, -25738, -25515, -25732, -25947, -25738,
+        -25531, -25733, -25932, -25737, -25545, -25733, -25919, -25737, -25557, -25733, -25907, -25737,
+        -25568, -25734, -25898, -25737, -25577, -25734, -25889, -25736, -25585, -25734, -25881, -25736,
+        -25593, -25734, -25874, -25736, -25599, -25734, -25868, -25736, -25605, -25734, -25862, -25736,
+        -25611, -25734, -25857, -25736, -25616, -25734, -25852, -25736, -25620, -25734, -25848, -25736,
+        -25624, -25735, -25844, -25736, -25628, -25735, -25841, -25736, -25631, -25735, -25838, -25736,
+        -25634, -25735, -25835, -25736, -25637, -25735, -25832, -25736, -25640, -25735, -25829, -25736,
+        -25642, -25735, -25827, -25736, -25645, -25735, -25825, -25735, -25647, -25735, -25822, -25735,
+        -25649, -25735, -25821, -25735, -25651, -25735, -25819, -25735, -25652, -25735, -25817, -25735,
+        -25654, -25735, -25816, -25735, -25655, -25735, -25814, -25735, -25657, -25735, -25813, -25735,
+        -25658, -25735, -25811, -25735, -25659, -25735, -25810, -25735, -25661, -25735, -25809, -25735,
+        -25662, -25735, -25808, -25735, -25663, -25735, -25807, -25735, -25663, -25735, -25806, -25735,
+        -25664, -25735, -25806, -25735, -25665, -25735, -25805, -25735, -25666, -25735, -25804, -25735,
+        -25667, -25735, -25803, -25735, -25667, -25735, -25803, -25735, -25668, -25735, -25802, -25735,
+        -25668, -25735, -25802, -25735, -25669, -25735, -25801, -25735, -25669, -25735, -25801, -25735,
+        -25670, -25735, -25801, -25735, -25670, -25735, -25800, -25735, -25670, -25735, -25800, -25735,
+        -25670, -25735, -25800, -25735, -25671, -25735, -25800, -25735, -25671, -25735, -25799, -25735,
+        -25671, -25735, -25799, -25735, -25671, -25735, -25799, -25735, -25671, -25735, -25799, -25735,
+        -25671, -25735, -25799, -25735, -25671, -25735, -25799, -25735, -25671, -25735, -25799, -25735,
+        -25671, -25735, -25799, -25735, -25671, -25735, -25800, -25735, -25671, -25735, -25800, -25735,
+        -25670, -25735, -25800, -25735, -25670, -25735, -25800, -25735, -25670, -25735, -25801, -25735,
+        -25670, -25735, -25801, -25735, -25669, -25735, -25801, -25735, -25669, -25735, -25802, -25735,
+        -25668, -25735, -25802, -25735, -25668, -25735, -25803, -25735, -25667, -25735, -25803, -25735,
+        -25667, -25735, -25804, -25735, -25666, -25735, -25805, -25735, -25665, -25735, -25806, -25735,
+        -25664, -25735, -25806, -25735, -25663, -25735, -25807, -25735, -25663, -25735, -25808, -25735,
+        -25662, -25735, -25809, -25735, -25661, -25735, -25810, -25735, -25659, -25735, -25811, -25735,
+        -25658, -25735, -25813, -25735, -25657, -25735, -25814, -25735, -25655, -25735, -25816, -25735,
+        -25654, -25735, -25817, -25735, -25652, -25735, -25819, -25735, -25651, -25735, -25821, -25735,
+        -25649, -25735, -25822, -25735, -25647, -25735, -25825, -25735, -25645, -25736, -25827, -25735,
+        -25642, -25736, -25829, -25735, -25640, -25736, -25832, -25735, -25637, -25736, -25835, -25735,
+        -25634, -25736, -25838, -25735, -25631, -25736, -25841, -25735, -25628, -25736, -25844, -25735,
+        -25624, -25736, -25848, -25734, -25620, -25736, -25852, -25734, -25616, -25736, -25857, -25734,
+        -25611, -25736, -25862, -25734, -25605, -25736, -25868, -25734, -25599, -25736, -25874, -25734,
+        -25593, -25736, -25881, -25734, -25585, -25736, -25889, -25734, -25577, -25737, -25898, -25734,
+        -25568, -25737, -25907, -25733, -25557, -25737, -25919, -25733, -25545, -25737, -25932, -25733,
+        -25531, -25738, -25947, -25732, -25515, -25738, -25965, -25732, -25495, -25739, -25986, -25731,
+        -25472, -25739, -26012, -25730, -25443, -25741, -26044, -25729, -25407, -25742, -26084, -25727,
+        -25361, -25744, -26138, -25725, -25300, -25748, -26210, -25720, -25213, -25753, -26314, -25712,
+        -25084, -25764, -26478, -25696, -24870, -25789, -26771, -25655, -24446, -25865, -27439, -25490,
+        -23234, -26351, -30341, -22458,      0,
+    },
+    // Level 2, harmonics 1 - 128
+    {
+             0,  12435,  22458,  28504,  30342,  29027,  26351,  24067,  23233,  23940,  25490,  26901,
+         27440,  26957,  25865,  24844,  24445,  24812,  25656,  26456,  26773,  26476,  25789,  25130,
+         24868,  25116,  25697,  26256,  26481,  26267,  25764,  25277,  25081,  25269,  25713,  26144,
+         26318,  26150,  25753,  25366,  25209,  25361,  25720,  26072,  26214,  26076,  25747,  25426,
+         25295,  25422,  25725,  26022,  26143,  26025,  25744,  25468,  25356,  25466,  25727,  25985,
+         26090,  25987,  25742,  25500,  25401,  25498,  25729,  25957,  26051,  25959,  25740,  25524,
+         25436,  25523,  25730,  25936,  26020,  25937,  25739,  25544,  25464,  25543,  25731,  25918,
+         25995,  25919,  25739,  25560,  25486,  25559,  25732,  25904,  25974,  25905,  25738,  25573,
+         25505,  25572,  25733,  25892,  25957,  25893,  25738,  25584,  25520,  25583,  25733,  25882,
+         25943,  25883,  25737,  25593,  25533,  25592,  25733,  25873,  25931,  25874,  25737,  25601,
+         25545,  25600,  25734,  25866,  25921,  25867,  25737,  25607,  25554,  25607,  25734,  25860,
+         25912,  25860,  25736,  25613,  25562,  25613,  25734,  25854,  25904,  25855,  25736,  25618,
+         25570,  25618,  25734,  25850,  25897,  25850,  25736,  25623,  25576,  25622,  25734,  25846,
+         25892,  25846,  25736,  25626,  25581,  25626,  25734,  25842,  25887,  25842,  25736,  25630,
+         25586,  25630,  25734,  25839,  25882,  25839,  25736,  25633,  25590,  25632,  25735,  25836,
+         25878,  25837,  25736,  25635,  25594,  25635,  25735,  25834,  25875,  25834,  25736,  25637,
+         25597,  25637,  25735,  25832,  25872,  25832,  25736,  25639,  25599,  25639,  25735,  25830,
+         25870,  25831,  25735,  25641,  25601,  25641,  25735,  25829,  25868,  25829,  25735,  25642,
+         25603,  25642,  25735,  25828,  25866,  25828,  25735,  25643,  25605,  25643,  25735,  25827,
+         25865,  25827,  25735,  25644,  25606,  25644,  25735,  25826,  25864,  25826,  25735,  25644,
+         25607,  25644,  25735,  25826,  25863,  25826,  25735,  25645,  25607,  25645,  25735,  25826,
+         25863,  25826,  25735,  25645,  25607,  25645,  25735,  25826,  25863,  25826,  25735,  25645,
+         25607,  25645,  25735,  25826,  25863,  25826,  25735,  25644,  25607,  25644,  25735,  25826,
+         25864,  25826,  25735,  25644,  25606,  25644,  25735,  25827,  25865,  25827,  25735,  25643,
+         25605,  25643,  25735,  25828,  25866,  25828,  25735,  25642,  25603,  25642,  25735,  25829,
+         25868,  25829,  25735,  25641,  25601,  25641,  25735,  25831,  25870,  25830,  25735,  25639,
+         25599,  25639,  25736,  25832,  25872,  25832,  25735,  25637,  25597,  25637,  25736,  25834,
+         25875,  25834,  25735,  25635,  25594,  25635,  25736,  25837,  25878,  25836,  25735,  25632,
+         25590,  25633,  25736,  25839,  25882,  25839,  25734,  25630,  25586,  25630,  25736,  25842,
+         25887,  25842,  25734,  25626,  25581,  25626,  25736,  25846,  25892,  25846,  25734,  25622,
+         25576,  25623,  25736,  25850,  25897,  25850,  25734,  25618,  25570,  25618,  25736,  25855,
+         25904,  25854,  25734,  25613,  25562,  25613,  25736,  25860,  25912,  25860,  25734,  25607,
+         25554,  25607,  25737,  25867,  25921,  25866,  25734,  25600,  25545,  25601,  25737,  25874,
+         25931,  25873,  25733,  25592,  25533,  25593,  25737,  25883,  25943,  25882,  25733,  25583,
+         25520,  25584,  25738,  25893,  25957,  25892,  25733,  25572,  25505,  25573,  25738,  25905,
+         25974,  25904,  25732,  25559,  25486,  25560,  25739,  25919,  25995,  25918,  25731,  25543,
+         25464,  25544,  25739,  25937,  26020,  25936,  25730,  25523,  25436,  25524,  25740,  25959,
+         26051,  25957,  25729,  25498,  25401,  25500,  25742,  25987,  26090,  25985,  25727,  25466,
+         25356,  25468,  25744,  26025,  26143,  26022,  25725,  25422,  25295,  25426,  25747,  26076,
+         26214,  26072,  25720,  25361,  25209,  25366,  25753,  26150,  26318,  26144,  25713,  25269,
+         25081,  25277,  25764,  26267,  26481,  26256,  25697,  25116,  24868,  25130,  25789,  26476,
+         26773,  26456,  25656,  24812,  24445,  24844,  25865,  26957,  27440,  26901,  25490,  23940,
+         23233,  24067,  26351,  29027,  30342,  28504,  22458,  12435,      0, -12435, -22458, -28504,
+        -30342, -29027, -26351, -24067, -23233, -23940, -25490, -26901, -27440, -26957, -25865, -24844,
+        -24445, -24812, -25656, -26456, -26773, -26476, -25789, -25130, -24868, -25116, -25697, -26256,
+        -26481, -26267, -25764, -25277, -25081, -25269, -25713, -26144, -26318, -26150, -25753, -25366,
+        -25209, -25361, -25720, -26072, -26214, -26076, -25747, -25426, -25295, -25422, -25725, -26022,
+        -26143, -26025, -25744, -25468, -25356, -25466, -25727, -25985, -26090, -25987, -25742, -25500,
+        -25401, -25498, -25729, -25957, -26051, -25959, -25740, -25524, -25436, -25523, -25730, -25936,
+        -26020, -25937, -25739, -25544, -25464, -25543, -25731, -25918, -25995, -25919, -25739, -25560,
+        -25486, -25559, -25732, -25904, -25974, -25905, -25738, -25573, -25505, -25572, -25733, -25892,
+        -25957, -25893, -25738, -25584, -25520, -25583, -25733, -25882, -25943, -25883, -25737, -25593,
+        -25533, -25592, -25733, -25873, -25931, -25874, -25737, -25601, -25545, -25600, -25734, -25866,
+        -25921, -25867, -25737, -25607, -25554, -25607, -25734, -25860, -25912, -25860, -25736, -25613,
+        -25562, -25613, -25734, -25854, -25904, -25855, -25736, -25618, -25570, -25618, -25734, -25850,
+        -25897, -25850, -25736, -25623, -25576, -25622, -25734, -25846, -25892, -25846, -25736, -25626,
+        -25581, -25626, -25734, -25842, -25887, -25842, -25736, -25630, -25586, -25630, -25734, -25839,
+        -25882, -25839, -25736, -25633, -25590, -25632, -25735, -25836, -25878, -25837, -25736, -25635,
+        -25594, -25635, -25735, -25834, -25875, -25834, -25736, -25637, -25597, -25637, -25735, -25832,
+        -25872, -25832, -25736, -25639, -25599, -25639, -25735, -25830, -25870, -25831, -25735, -25641,
+        -25601, -25641, -25735, -25829, -25868, -25829, -25735, -25642, -25603, -25642, -25735, -25828,
+        -25866, -25828, -25735, -25643, -25605, -25643, -25735, -25827, -25865, -25827, -25735, -25644,
+        -25606, -25644, -25735, -25826, -25864, -25826, -25735, -25644, -25607, -25644, -25735, -25826,
+        -25863, -25826, -25735, -25645, -25607, -25645, -25735, -25826, -25863, -25826, -25735, -25645,
+        -25607, -25645, -25735, -25826, -25863, -25826, -25735, -25645, -25607, -25645, -25735, -25826,
+        -25863, -25826, -25735, -25644, -25607, -25644, -25735, -25826, -25864, -25826, -25735, -25644,
+        -25606, -25644, -25735, -25827, -25865, -25827, -25735, -25643, -25605, -25643, -25735, -25828,
+        -25866, -25828, -25735, -25642, -25603, -25642, -25735, -25829, -25868, -25829, -25735, -25641,
+        -25601, -25641, -25735, -25831, -25870, -25830, -25735, -25639, -25599, -25639, -25736, -25832,
+        -25872, -25832, -25735, -25637, -25597, -25637, -25736, -25834, -25875, -25834, -25735, -25635,
+        -25594, -25635, -25736, -25837, -25878, -25836, -25735, -25632, -25590, -25633, -25736, -25839,
+        -25882, -25839, -25734, -25630, -25586, -25630, -25736, -25842, -25887, -25842, -25734, -25626,
+        -25581, -25626, -25736, -25846, -25892, -25846, -25734, -25622, -25576, -25623, -25736, -25850,
+        -25897, -25850, -25734, -25618, -25570, -25618, -25736, -25855, -25904, -25854, -25734, -25613,
+        -25562, -25613, -25736, -25860, -25912, -25860, -25734, -25607, -25554, -25607, -25737, -25867,
+        -25921, -25866, -25734, -25600, -25545, -25601, -25737, -25874, -25931, -25873, -25733, -25592,
+        -25533, -25593, -25737, -25883, -25943, -25882, -25733, -25583, -25520, -25584, -25738, -25893,
+        -25957, -25892, -25733, -25572, -25505, -25573, -25738, -25905, -25974, -25904, -25732, -25559,
+        -25486, -25560, -25739, -25919, -25995, -25918, -25731, -25543, -25464, -25544, -25739, -25937,
+        -26020, -25936, -25730, -25523, -25436, -25524, -25740, -25959, -26051, -25957, -25729, -25498,
+        -25401, -25500, -25742, -25987, -26090, -25985, -25727, -25466, -25356, -25468, -25744, -26025,
+        -26143, -26022, -25725, -25422, -25295, -25426, -25747, -26076, -26214, -26072, -25720, -25361,
+        -25209, -25366, -25753, -26150, -26318, -26144, -25713, -25269, -25081, -25277, -25764, -26267,
+        -26481, -26256, -25697, -25116, -24868, -25130, -25789, -26476, -26773, -26456, -25656, -24812,
+        -24445, -24844, -25865, -26957, -27440, -26901, -25490, -23940, -23233, -24067, -26351, -29027,
+        -30342, -28504, -22458, -12435,      0,
+    },
+    // Level 3, harmonics 1 - 64
+    {
+             0,   6379,  12435,  17874,  22459,  26027,  28505,  29910,  30343,  29976,  29028,  27740,
+         26350,  25070,  24064,  23438,  23230,  23421,  23938,  24670,  25491,  26272,  26904,  27308,
+         27445,  27315,  26960,  26447,  25864,  25301,  24839,  24540,  24438,  24536,  24808,  25203,
+         25656,  26097,  26462,  26699,  26781,  26702,  26482,  26160,  25788,  25425,  25123,  24926,
+         24858,  24924,  25110,  25382,  25697,  26007,  26264,  26433,  26492,  26435,  26274,  26038,
+         25764,  25494,  25268,  25120,  25068,  25119,  25260,  25470,  25713,  25953,  26154,  26286,
+         26332,  26287,  26160,  25972,  25753,  25536,  25355,  25235,  25193,  25234,  25350,  25521,
+         25721,  25919,  26084,  26194,  26232,  26195,  26088,  25931,  25747,  25565,  25412,  25310,
+         25275,  25310,  25408,  25554,  25725,  25895,  26037,  26131,  26164,  26132,  26040,  25903,
+         25743,  25585,  25451,  25363,  25332,  25363,  25449,  25578,  25728,  25878,  26003,  26087,
+         26116,  26087,  26005,  25884,  25741,  25600,  25480,  25401,  25373,  25401,  25479,  25594,
+         25730,  25865,  25978,  26054,  26080,  26054,  25980,  25869,  25740,  25611,  25502,  25429,
+         25404,  25429,  25501,  25607,  25731,  25855,  25960,  26029,  26054,  26030,  25961,  25859,
+         25739,  25619,  25518,  25451,  25427,  25451,  25517,  25616,  25732,  25848,  25946,  26011,
+         26033,  26011,  25946,  25851,  25738,  25625,  25530,  25467,  25445,  25467,  25530,  25623,
+         25733,  25842,  25935,  25997,  26018,  25997,  25936,  25844,  25737,  25630,  25540,  25479,
+         25458,  25479,  25539,  25628,  25733,  25838,  25927,  25986,  26007,  25986,  25928,  25840,
+         25737,  25633,  25546,  25488,  25468,  25488,  25546,  25632,  25734,  25836,  25922,  25979,
+         25999,  25979,  25922,  25837,  25736,  25636,  25551,  25494,  25474,  25494,  25551,  25635,
+         25734,  25834,  25918,  25974,  25994,  25974,  25918,  25834,  25736,  25637,  25553,  25498,
+         25478,  25498,  25553,  25637,  25735,  25833,  25916,  25972,  25991,  25972,  25916,  25833,
+         25735,  25637,  25554,  25499,  25479,  25499,  25554,  25637,  25735,  25833,  25916,  25972,
+         25991,  25972,  25916,  25833,  25735,  25637,  25553,  25498,  25478,  25498,  25553,  25637,
+         25736,  25834,  25918,  25974,  25994,  25974,  25918,  25834,  25734,  25635,  25551,  25494,
+         25474,  25494,  25551,  25636,  25736,  25837,  25922,  25979,  25999,  25979,  25922,  25836,
+         25734,  25632,  25546,  25488,  25468,  25488,  25546,  25633,  25737,  25840,  25928,  25986,
+         26007,  25986,  25927,  25838,  25733,  25628,  25539,  25479,  25458,  25479,  25540,  25630,
+         25737,  25844,  25936,  25997,  26018,  25997,  25935,  25842,  25733,  25623,  25530,  25467,
+         25445,  25467,  25530,  25625,  25738,  25851,  25946,  26011,  26033,  26011,  25946,  25848,
+         25732,  25616,  25517,  25451,  25427,  25451,  25518,  25619,  25739,  25859,  25961,  26030,
+         26054,  26029,  25960,  25855,  25731,  25607,  25501,  25429,  25404,  25429,  25502,  25611,
+         25740,  25869,  25980,  26054,  26080,  26054,  25978,  25865,  25730,  25594,  25479,  25401,
+         25373,  25401,  25480,  25600,  25741,  25884,  26005,  26087,  26116,  26087,  26003,  25878,
+         25728,  25578,  25449,  25363,  25332,  25363,  25451,  25585,  25743,  25903,  26040,  26132,
+         26164,  26131,  26037,  25895,  25725,  25554,  25408,  25310,  25275,  25310,  25412,  25565,
+         25747,  25931,  26088,  26195,  26232,  26194,  26084,  25919,  25721,  25521,  25350,  25234,
+         25193,  25235,  25355,  25536,  25753,  25972,  26160,  26287,  26332,  26286,  26154,  25953,
+         25713,  25470,  25260,  25119,  25068,  25120,  25268,  25494,  25764,  26038,  26274,  26435,
+         26492,  26433,  26264,  26007,  25697,  25382,  25110,  24924,  24858,  24926,  25123,  25425,
+         25788,  26160,  26482,  26702,  26781,  26699,  26462,  26097,  25656,  25203,  24808,  24536,
+         24438,  24540,  24839,  25301,  25864,  26447,  26960,  27315,  27445,  27308,  26904,  26272,
+         25491,  24670,  23938,  23421,  23230,  23438,  24064,  25070,  26350,  27740,  29028,  29976,
+         30343,  29910,  28505,  26027,  22459,  17874,  12435,   6379,      0,  -6379, -12435, -17874,
+        -22459, -26027, -28505, -29910, -30343, -29976, -29028, -27740, -26350, -25070, -24064, -23438,
+        -23230, -23421, -23938, -24670, -25491, -26272, -26904, -27308, -27445, -27315, -26960, -26447,
+        -25864, -25301, -24839, -24540, -24438, -24536, -24808, -25203, -25656, -26097, -26462, -26699,
+        -26781, -26702, -26482, -26160, -25788, -25425, -25123, -24926, -24858, -24924, -25110, -25382,
+        -25697, -26007, -26264, -26433, -26492, -26435, -26274, -26038, -25764, -25494, -25268, -25120,
+        -25068, -25119, -25260, -25470, -25713, -25953, -26154, -26286, -26332, -26287, -26160, -25972,
+        -25753, -25536, -25355, -25235, -25193, -25234, -25350, -25521, -25721, -25919, -26084, -26194,
+        -26232, -26195, -26088, -25931, -25747, -25565, -25412, -25310, -25275, -25310, -25408, -25554,
+        -25725, -25895, -26037, -26131, -26164, -26132, -26040, -25903, -25743, -25585, -25451, -25363,
+        -25332, -25363, -25449, -25578, -25728, -25878, -26003, -26087, -26116, -26087, -26005, -25884,
+        -25741, -25600, -25480, -25401, -25373, -25401, -25479, -25594, -25730, -25865, -25978, -26054,
+        -26080, -26054, -25980, -25869, -25740, -25611, -25502, -25429, -25404, -25429, -25501, -25607,
+        -25731, -25855, -25960, -26029, -26054, -26030, -25961, -25859, -25739, -25619, -25518, -25451,
+        -25427, -25451, -25517, -25616, -25732, -25848, -25946, -26011, -26033, -26011, -25946, -25851,
+        -25738, -25625, -25530, -25467, -25445, -25467, -25530, -25623, -25733, -25842, -25935, -25997,
+        -26018, -25997, -25936, -25844, -25737, -25630, -25540, -25479, -25458, -25479, -25539, -25628,
+        -25733, -25838, -25927, -25986, -26007, -25986, -25928, -25840, -25737, -25633, -25546, -25488,
+        -25468, -25488, -25546, -25632, -25734, -25836, -25922, -25979, -25999, -25979, -25922, -25837,
+        -25736, -25636, -25551, -25494, -25474, -25494, -25551, -25635, -25734, -25834, -25918, -25974,
+        -25994, -25974, -25918, -25834, -25736, -25637, -25553, -25498, -25478, -25498, -25553, -25637,
+        -25735, -25833, -25916, -25972, -25991, -25972, -25916, -25833, -25735, -25637, -25554, -25499,
+        -25479, -25499, -25554, -25637, -25735, -25833, -25916, -25972, -25991, -25972, -25916, -25833,
+        -25735, -25637, -25553, -25498, -25478, -25498, -25553, -25637, -25736, -25834, -25918, -25974,
+        -25994, -25974, -25918, -25834, -25734, -25635, -25551, -25494, -25474, -25494, -25551, -25636,
+        -25736, -25837, -25922, -25979, -25999, -25979, -25922, -25836, -25734, -25632, -25546, -25488,
+        -25468, -25488, -25546, -25633, -25737, -25840, -25928, -25986, -26007, -25986, -25927, -25838,
+        -25733, -25628, -25539, -25479, -25458, -25479, -25540, -25630, -25737, -25844, -25936, -25997,
+        -26018, -25997, -25935, -25842, -25733, -25623, -25530, -25467, -25445, -25467, -25530, -25625,
+        -25738, -25851, -25946, -26011, -26033, -26011, -25946, -25848, -25732, -25616, -25517, -25451,
+        -25427, -25451, -25518, -25619, -25739, -25859, -25961, -26030, -26054, -26029, -25960, -25855,
+        -25731, -25607, -25501, -25429, -25404, -25429, -25502, -25611, -25740, -25869, -25980, -26054,
+        -26080, -26054, -25978, -25865, -25730, -25594, -25479, -25401, -25373, -25401, -25480, -25600,
+        -25741, -25884, -26005, -26087, -26116, -26087, -26003, -25878, -25728, -25578, -25449, -25363,
+        -25332, -25363, -25451, -25585, -25743, -25903, -26040, -26132, -26164, -26131, -26037, -25895,
+        -25725, -25554, -25408, -25310, -25275, -25310, -25412, -25565, -25747, -25931, -26088, -26195,
+        -26232, -26194, -26084, -25919, -25721, -25521, -25350, -25234, -25193, -25235, -25355, -25536,
+        -25753, -25972, -26160, -26287, -26332, -26286, -26154, -25953, -25713, -25470, -25260, -25119,
+        -25068, -25120, -25268, -25494, -25764, -26038, -26274, -26435, -26492, -26433, -26264, -26007,
+        -25697, -25382, -25110, -24924, -24858, -24926, -25123, -25425, -25788, -26160, -26482, -26702,
+        -26781, -26699, -26462, -26097, -25656, -25203, -24808, -24536, -24438, -24540, -24839, -25301,
+        -25864, -26447, -26960, -27315, -27445, -27308, -26904, -26272, -25491, -24670, -23938, -23421,
+        -23230, -23438, -24064, -25070, -26350, -27740, -29028, -29976, -30343, -29910, -28505, -26027,
+        -22459, -17874, -12435,  -6379,      0,
+    },
+    // Level 4, harmonics 1 - 32
+    {
+             0,   3210,   6379,   9467,  12435,  15248,  17875,  20287,  22461,  24379,  26030,  27407,
+         28509,  29342,  29916,  30245,  30350,  30253,  29982,  29565,  29032,  28414,  27741,  27043,
+         26348,  25681,  25064,  24517,  24055,  23689,  23426,  23269,  23217,  23267,  23409,  23634,
+         23929,  24278,  24666,  25076,  25493,  25899,  26280,  26624,  26918,  27154,  27326,  27429,
+         27464,  27430,  27333,  27178,  26973,  26728,  26454,  26161,  25862,  25568,  25290,  25038,
+         24821,  24645,  24517,  24439,  24413,  24438,  24513,  24632,  24790,  24980,  25194,  25423,
+         25658,  25890,  26111,  26311,  26485,  26626,  26729,  26792,  26813,  26792,  26732,  26634,
+         26504,  26348,  26171,  25981,  25786,  25593,  25409,  25241,  25095,  24977,  24889,  24836,
+         24818,  24836,  24888,  24971,  25082,  25216,  25368,  25531,  25699,  25866,  26026,  26171,
+         26298,  26401,  26477,  26524,  26539,  26524,  26478,  26405,  26307,  26189,  26055,  25910,
+         25761,  25613,  25471,  25342,  25229,  25137,  25069,  25027,  25013,  25027,  25068,  25134,
+         25222,  25329,  25450,  25581,  25716,  25850,  25979,  26097,  26199,  26283,  26345,  26383,
+         26396,  26383,  26346,  26285,  26204,  26106,  25995,  25874,  25750,  25626,  25507,  25398,
+         25303,  25225,  25168,  25132,  25121,  25132,  25167,  25223,  25299,  25391,  25495,  25607,
+         25724,  25840,  25952,  26054,  26143,  26216,  26270,  26304,  26315,  26304,  26271,  26218,
+         26146,  26059,  25961,  25854,  25743,  25633,  25527,  25430,  25345,  25276,  25224,  25192,
+         25182,  25192,  25224,  25275,  25343,  25426,  25521,  25623,  25729,  25835,  25937,  26030,
+         26112,  26179,  26229,  26259,  26270,  26259,  26229,  26180,  26114,  26033,  25942,  25842,
+         25739,  25636,  25538,  25447,  25367,  25302,  25253,  25224,  25214,  25224,  25253,  25301,
+         25366,  25445,  25534,  25632,  25733,  25834,  25931,  26020,  26098,  26162,  26210,  26239,
+         26249,  26239,  26210,  26162,  26099,  26021,  25932,  25836,  25736,  25636,  25540,  25451,
+         25374,  25310,  25263,  25233,  25224,  25233,  25263,  25310,  25374,  25451,  25540,  25636,
+         25736,  25836,  25932,  26021,  26099,  26162,  26210,  26239,  26249,  26239,  26210,  26162,
+         26098,  26020,  25931,  25834,  25733,  25632,  25534,  25445,  25366,  25301,  25253,  25224,
+         25214,  25224,  25253,  25302,  25367,  25447,  25538,  25636,  25739,  25842,  25942,  26033,
+         26114,  26180,  26229,  26259,  26270,  26259,  26229,  26179,  26112,  26030,  25937,  25835,
+         25729,  25623,  25521,  25426,  25343,  25275,  25224,  25192,  25182,  25192,  25224,  25276,
+         25345,  25430,  25527,  25633,  25743,  25854,  25961,  26059,  26146,  26218,  26271,  26304,
+         26315,  26304,  26270,  26216,  26143,  26054,  25952,  25840,  25724,  25607,  25495,  25391,
+         25299,  25223,  25167,  25132,  25121,  25132,  25168,  25225,  25303,  25398,  25507,  25626,
+         25750,  25874,  25995,  26106,  26204,  26285,  26346,  26383,  26396,  26383,  26345,  26283,
+         26199,  26097,  25979,  25850,  25716,  25581,  25450,  25329,  25222,  25134,  25068,  25027,
+         25013,  25027,  25069,  25137,  25229,  25342,  25471,  25613,  25761,  25910,  26055,  26189,
+         26307,  26405,  26478,  26524,  26539,  26524,  26477,  26401,  26298,  26171,  26026,  25866,
+         25699,  25531,  25368,  25216,  25082,  24971,  24888,  24836,  24818,  24836,  24889,  24977,
+         25095,  25241,  25409,  25593,  25786,  25981,  26171,  26348,  26504,  26634,  26732,  26792,
+         26813,  26792,  26729,  26626,  26485,  26311,  26111,  25890,  25658,  25423,  25194,  24980,
+         24790,  24632,  24513,  24438,  24413,  24439,  24517,  24645,  24821,  25038,  25290,  25568,
+         25862,  26161,  26454,  26728,  26973,  27178,  27333,  27430,  27464,  27429,  27326,  27154,
+         26918,  26624,  26280,  25899,  25493,  25076,  24666,  24278,  23929,  23634,  23409,  23267,
+         23217,  23269,  23426,  23689,  24055,  24517,  25064,  25681,  26348,  27043,  27741,  28414,
+         29032,  29565,  29982,  30253,  30350,  30245,  29916,  29342,  28509,  27407,  26030,  24379,
+         22461,  20287,  17875,  15248,  12435,   9467,   6379,   3210,      0,  -3210,  -6379,  -9467,
+        -12435, -15248, -17875, -20287, -22461, -24379, -26030, -27407, -28509, -29342, -29916, -30245,
+        -30350, -30253, -29982, -29565, -29032, -28414, -27741, -27043, -26348, -25681, -25064, -24517,
+        -24055, -23689, -23426, -23269, -23217, -23267, -23409, -23634, -23929, -24278, -24666, -25076,
+        -25493, -25899, -26280, -26624, -26918, -27154, -27326, -27429, -27464, -27430, -27333, -27178,
+        -26973, -26728, -26454, -26161, -25862, -25568, -25290, -25038, -24821, -24645, -24517, -24439,
+        -24413, -24438, -24513, -24632, -24790, -24980, -25194, -25423, -25658, -25890, -26111, -26311,
+        -26485, -26626, -26729, -26792, -26813, -26792, -26732, -26634, -26504, -26348, -26171, -25981,
+        -25786, -25593, -25409, -25241, -25095, -24977, -24889, -24836, -24818, -24836, -24888, -24971,
+        -25082, -25216, -25368, -25531, -25699, -25866, -26026, -26171, -26298, -26401, -26477, -26524,
+        -26539, -26524, -26478, -26405, -26307, -26189, -26055, -25910, -25761, -25613, -25471, -25342,
+        -25229, -25137, -25069, -25027, -25013, -25027, -25068, -25134, -25222, -25329, -25450, -25581,
+        -25716, -25850, -25979, -26097, -26199, -26283, -26345, -26383, -26396, -26383, -26346, -26285,
+        -26204, -26106, -25995, -25874, -25750, -25626, -25507, -25398, -25303, -25225, -25168, -25132,
+        -25121, -25132, -25167, -25223, -25299, -25391, -25495, -25607, -25724, -25840, -25952, -26054,
+        -26143, -26216, -26270, -26304, -26315, -26304, -26271, -26218, -26146, -26059, -25961, -25854,
+        -25743, -25633, -25527, -25430, -25345, -25276, -25224, -25192, -25182, -25192, -25224, -25275,
+        -25343, -25426, -25521, -25623, -25729, -25835, -25937, -26030, -26112, -26179, -26229, -26259,
+        -26270, -26259, -26229, -26180, -26114, -26033, -25942, -25842, -25739, -25636, -25538, -25447,
+        -25367, -25302, -25253, -25224, -25214, -25224, -25253, -25301, -25366, -25445, -25534, -25632,
+        -25733, -25834, -25931, -26020, -26098, -26162, -26210, -26239, -26249, -26239, -26210, -26162,
+        -26099, -26021, -25932, -25836, -25736, -25636, -25540, -25451, -25374, -25310, -25263, -25233,
+        -25224, -25233, -25263, -25310, -25374, -25451, -25540, -25636, -25736, -25836, -25932, -26021,
+        -26099, -26162, -26210, -26239, -26249, -26239, -26210, -26162, -26098, -26020, -25931, -25834,
+        -25733, -25632, -25534, -25445, -25366, -25301, -25253, -25224, -25214, -25224, -25253, -25302,
+        -25367, -25447, -25538, -25636, -25739, -25842, -25942, -26033, -26114, -26180, -26229, -26259,
+        -26270, -26259, -26229, -26179, -26112, -26030, -25937, -25835, -25729, -25623, -25521, -25426,
+        -25343, -25275, -25224, -25192, -25182, -25192, -25224, -25276, -25345, -25430, -25527, -25633,
+        -25743, -25854, -25961, -26059, -26146, -26218, -26271, -26304, -26315, -26304, -26270, -26216,
+        -26143, -26054, -25952, -25840, -25724, -25607, -25495, -25391, -25299, -25223, -25167, -25132,
+        -25121, -25132, -25168, -25225, -25303, -25398, -25507, -25626, -25750, -25874, -25995, -26106,
+        -26204, -26285, -26346, -26383, -26396, -26383, -26345, -26283, -26199, -26097, -25979, -25850,
+        -25716, -25581, -25450, -25329, -25222, -25134, -25068, -25027, -25013, -25027, -25069, -25137,
+        -25229, -25342, -25471, -25613, -25761, -25910, -26055, -26189, -26307, -26405, -26478, -26524,
+        -26539, -26524, -26477, -26401, -26298, -26171, -26026, -25866, -25699, -25531, -25368, -25216,
+        -25082, -24971, -24888, -24836, -24818, -24836, -24889, -24977, -25095, -25241, -25409, -25593,
+        -25786, -25981, -26171, -26348, -26504, -26634, -26732, -26792, -26813, -26792, -26729, -26626,
+        -26485, -26311, -26111, -25890, -25658, -25423, -25194, -24980, -24790, -24632, -24513, -24438,
+        -24413, -24439, -24517, -24645, -24821, -25038, -25290, -25568, -25862, -26161, -26454, -26728,
+        -26973, -27178, -27333, -27430, -27464, -27429, -27326, -27154, -26918, -26624, -26280, -25899,
+        -25493, -25076, -24666, -24278, -23929, -23634, -23409, -23267, -23217, -23269, -23426, -23689,
+        -24055, -24517, -25064, -25681, -26348, -27043, -27741, -28414, -29032, -29565, -29982, -30253,
+        -30350, -30245, -29916, -29342, -28509, -27407, -26030, -24379, -22461, -20287, -17875, -15248,
+        -12435,  -9467,  -6379,  -3210,      0,
+    },
+    // Level 5, harmonics 1 - 16
+    {
+             0,   1608,   3210,   4802,   6379,   7936,   9467,  10969,  12436,  13865,  15251,  16590,
+         17879,  19114,  20292,  21411,  22469,  23462,  24390,  25251,  26044,  26768,  27423,  28010,
+         28529,  28979,  29364,  29683,  29939,  30134,  30270,  30349,  30375,  30350,  30278,  30162,
+         30005,  29812,  29585,  29330,  29049,  28746,  28425,  28091,  27747,  27396,  27042,  26689,
+         26340,  25998,  25665,  25345,  25041,  24754,  24487,  24241,  24018,  23819,  23646,  23499,
+         23378,  23285,  23219,  23179,  23166,  23179,  23217,  23278,  23362,  23468,  23592,  23735,
+         23894,  24067,  24252,  24447,  24651,  24860,  25073,  25287,  25502,  25713,  25921,  26122,
+         26315,  26498,  26670,  26829,  26975,  27106,  27220,  27318,  27399,  27462,  27507,  27534,
+         27543,  27534,  27508,  27465,  27406,  27332,  27243,  27141,  27028,  26903,  26769,  26628,
+         26479,  26326,  26170,  26011,  25852,  25695,  25540,  25389,  25243,  25105,  24974,  24853,
+         24742,  24641,  24553,  24478,  24415,  24366,  24331,  24310,  24303,  24310,  24331,  24365,
+         24411,  24471,  24541,  24623,  24714,  24814,  24922,  25037,  25157,  25282,  25410,  25539,
+         25669,  25799,  25927,  26051,  26171,  26286,  26395,  26496,  26589,  26673,  26747,  26810,
+         26863,  26904,  26934,  26952,  26958,  26952,  26934,  26905,  26865,  26814,  26754,  26683,
+         26605,  26518,  26424,  26325,  26220,  26112,  26000,  25887,  25773,  25659,  25547,  25438,
+         25331,  25230,  25134,  25044,  24962,  24887,  24821,  24764,  24717,  24680,  24654,  24638,
+         24632,  24638,  24654,  24680,  24716,  24762,  24817,  24881,  24953,  25032,  25117,  25208,
+         25304,  25404,  25506,  25610,  25715,  25820,  25924,  26025,  26123,  26217,  26307,  26390,
+         26467,  26536,  26598,  26651,  26695,  26730,  26755,  26770,  26775,  26770,  26755,  26730,
+         26696,  26652,  26600,  26539,  26471,  26396,  26314,  26227,  26136,  26040,  25942,  25842,
+         25741,  25641,  25541,  25443,  25348,  25257,  25171,  25090,  25015,  24948,  24888,  24836,
+         24793,  24759,  24735,  24720,  24715,  24720,  24735,  24759,  24793,  24836,  24888,  24948,
+         25015,  25090,  25171,  25257,  25348,  25443,  25541,  25641,  25741,  25842,  25942,  26040,
+         26136,  26227,  26314,  26396,  26471,  26539,  26600,  26652,  26696,  26730,  26755,  26770,
+         26775,  26770,  26755,  26730,  26695,  26651,  26598,  26536,  26467,  26390,  26307,  26217,
+         26123,  26025,  25924,  25820,  25715,  25610,  25506,  25404,  25304,  25208,  25117,  25032,
+         24953,  24881,  24817,  24762,  24716,  24680,  24654,  24638,  24632,  24638,  24654,  24680,
+         24717,  24764,  24821,  24887,  24962,  25044,  25134,  25230,  25331,  25438,  25547,  25659,
+         25773,  25887,  26000,  26112,  26220,  26325,  26424,  26518,  26605,  26683,  26754,  26814,
+         26865,  26905,  26934,  26952,  26958,  26952,  26934,  26904,  26863,  26810,  26747,  26673,
+         26589,  26496,  26395,  26286,  26171,  26051,  25927,  25799,  25669,  25539,  25410,  25282,
+         25157,  25037,  24922,  24814,  24714,  24623,  24541,  24471,  24411,  24365,  24331,  24310,
+         24303,  24310,  24331,  24366,  24415,  24478,  24553,  24641,  24742,  24853,  24974,  25105,
+         25243,  25389,  25540,  25695,  25852,  26011,  26170,  26326,  26479,  26628,  26769,  26903,
+         27028,  27141,  27243,  27332,  27406,  27465,  27508,  27534,  27543,  27534,  27507,  27462,
+         27399,  27318,  27220,  27106,  26975,  26829,  26670,  26498,  26315,  26122,  25921,  25713,
+         25502,  25287,  25073,  24860,  24651,  24447,  24252,  24067,  23894,  23735,  23592,  23468,
+         23362,  23278,  23217,  23179,  23166,  23179,  23219,  23285,  23378,  23499,  23646,  23819,
+         24018,  24241,  24487,  24754,  25041,  25345,  25665,  25998,  26340,  26689,  27042,  27396,
+         27747,  28091,  28425,  28746,  29049,  29330,  29585,  29812,  30005,  30162,  30278,  30350,
+         30375,  30349,  30270,  30134,  29939,  29683,  29364,  28979,  28529,  28010,  27423,  26768,
+         26044,  25251,  24390,  23462,  22469,  21411,  20292,  19114,  17879,  16590,  15251,  13865,
+         12436,  10969,   9467,   7936,   6379,   4802,   3210,   1608,      0,  -1608,  -3210,  -4802,
+         -6379,  -7936,  -9467, -10969, -12436, -13865, -15251, -16590, -17879, -19114, -20292, -21411,
+        -22469, -23462, -24390, -25251, -26044, -26768, -27423, -28010, -28529, -28979, -29364, -29683,
+        -29939, -30134, -30270, -30349, -30375, -30350, -30278, -30162, -30005, -29812, -29585, -29330,
+        -29049, -28746, -28425, -28091, -27747, -27396, -27042, -26689, -26340, -25998, -25665, -25345,
+        -25041, -24754, -24487, -24241, -24018, -23819, -23646, -23499, -23378, -23285, -23219, -23179,
+        -23166, -23179, -23217, -23278, -23362, -23468, -23592, -23735, -23894, -24067, -24252, -24447,
+        -24651, -24860, -25073, -25287, -25502, -25713, -25921, -26122, -26315, -26498, -26670, -26829,
+        -26975, -27106, -27220, -27318, -27399, -27462, -27507, -27534, -27543, -27534, -27508, -27465,
+        -27406, -27332, -27243, -27141, -27028, -26903, -26769, -26628, -26479, -26326, -26170, -26011,
+        -25852, -25695, -25540, -25389, -25243, -25105, -24974, -24853, -24742, -24641, -24553, -24478,
+        -24415, -24366, -24331, -24310, -24303, -24310, -24331, -24365, -24411, -24471, -24541, -24623,
+        -24714, -24814, -24922, -25037, -25157, -25282, -25410, -25539, -25669, -25799, -25927, -26051,
+        -26171, -26286, -26395, -26496, -26589, -26673, -26747, -26810, -26863, -26904, -26934, -26952,
+        -26958, -26952, -26934, -26905, -26865, -26814, -26754, -26683, -26605, -26518, -26424, -26325,
+        -26220, -26112, -26000, -25887, -25773, -25659, -25547, -25438, -25331, -25230, -25134, -25044,
+        -24962, -24887, -24821, -24764, -24717, -24680, -24654, -24638, -24632, -24638, -24654, -24680,
+        -24716, -24762, -24817, -24881, -24953, -25032, -25117, -25208, -25304, -25404, -25506, -25610,
+        -25715, -25820, -25924, -26025, -26123, -26217, -26307, -26390, -26467, -26536, -26598, -26651,
+        -26695, -26730, -26755, -26770, -26775, -26770, -26755, -26730, -26696, -26652, -26600, -26539,
+        -26471, -26396, -26314, -26227, -26136, -26040, -25942, -25842, -25741, -25641, -25541, -25443,
+        -25348, -25257, -25171, -25090, -25015, -24948, -24888, -24836, -24793, -24759, -24735, -24720,
+        -24715, -24720, -24735, -24759, -24793, -24836, -24888, -24948, -25015, -25090, -25171, -25257,
+        -25348, -25443, -25541, -25641, -25741, -25842, -25942, -26040, -26136, -26227, -26314, -26396,
+        -26471, -26539, -26600, -26652, -26696, -26730, -26755, -26770, -26775, -26770, -26755, -26730,
+        -26695, -26651, -26598, -26536, -26467, -26390, -26307, -26217, -26123, -26025, -25924, -25820,
+        -25715, -25610, -25506, -25404, -25304, -25208, -25117, -25032, -24953, -24881, -24817, -24762,
+        -24716, -24680, -24654, -24638, -24632, -24638, -24654, -24680, -24717, -24764, -24821, -24887,
+        -24962, -25044, -25134, -25230, -25331, -25438, -25547, -25659, -25773, -25887, -26000, -26112,
+        -26220, -26325, -26424, -26518, -26605, -26683, -26754, -26814, -26865, -26905, -26934, -26952,
+        -26958, -26952, -26934, -26904, -26863, -26810, -26747, -26673, -26589, -26496, -26395, -26286,
+        -26171, -26051, -25927, -25799, -25669, -25539, -25410, -25282, -25157, -25037, -24922, -24814,
+        -24714, -24623, -24541, -24471, -24411, -24365, -24331, -24310, -24303, -24310, -24331, -24366,
+        -24415, -24478, -24553, -24641, -24742, -24853, -24974, -25105, -25243, -25389, -25540, -25695,
+        -25852, -26011, -26170, -26326, -26479, -26628, -26769, -26903, -27028, -27141, -27243, -27332,
+        -27406, -27465, -27508, -27534, -27543, -27534, -27507, -27462, -27399, -27318, -27220, -27106,
+        -26975, -26829, -26670, -26498, -26315, -26122, -25921, -25713, -25502, -25287, -25073, -24860,
+        -24651, -24447, -24252, -24067, -23894, -23735, -23592, -23468, -23362, -23278, -23217, -23179,
+        -23166, -23179, -23219, -23285, -23378, -23499, -23646, -23819, -24018, -24241, -24487, -24754,
+        -25041, -25345, -25665, -25998, -26340, -26689, -27042, -27396, -27747, -28091, -28425, -28746,
+        -29049, -29330, -29585, -29812, -30005, -30162, -30278, -30350, -30375, -30349, -30270, -30134,
+        -29939, -29683, -29364, -28979, -28529, -28010, -27423, -26768, -26044, -25251, -24390, -23462,
+        -22469, -21411, -20292, -19114, -17879, -16590, -15251, -13865, -12436, -10969,  -9467,  -7936,
+         -6379,  -4802,  -3210,  -1608,      0,
+    },
+    // Level 6, harmonics 1 - 8
+    {
+             0,    804,   1608,   2410,   3210,   4008,   4803,   5593,   6380,   7161,   7937,   8707,
+          9469,  10225,  10972,  11711,  12441,  13162,  13872,  14571,  15260,  15937,  16602,  17254,
+         17894,  18520,  19133,  19731,  20315,  20884,  21439,  21977,  22501,  23008,  23499,  23974,
+         24432,  24874,  25299,  25707,  26097,  26471,  26827,  27167,  27489,  27794,  28081,  28352,
+         28605,  28841,  29061,  29264,  29450,  29620,  29774,  29911,  30033,  30140,  30231,  30307,
+         30369,  30416,  30450,  30470,  30476,  30470,  30451,  30420,  30377,  30323,  30258,  30183,
+         30098,  30003,  29900,  29788,  29667,  29539,  29404,  29262,  29115,  28961,  28802,  28639,
+         28471,  28300,  28125,  27948,  27768,  27587,  27404,  27220,  27036,  26852,  26668,  26485,
+         26303,  26123,  25945,  25770,  25597,  25427,  25261,  25099,  24941,  24787,  24638,  24494,
+         24356,  24223,  24096,  23974,  23859,  23750,  23648,  23552,  23463,  23381,  23306,  23238,
+         23177,  23123,  23077,  23038,  23006,  22981,  22963,  22953,  22949,  22953,  22963,  22980,
+         23004,  23034,  23071,  23114,  23163,  23218,  23278,  23344,  23415,  23491,  23572,  23658,
+         23748,  23842,  23940,  24041,  24145,  24253,  24363,  24476,  24590,  24707,  24825,  24944,
+         25064,  25185,  25306,  25428,  25549,  25669,  25789,  25908,  26025,  26141,  26255,  26367,
+         26477,  26584,  26688,  26789,  26887,  26981,  27072,  27158,  27241,  27319,  27393,  27463,
+         27528,  27588,  27643,  27693,  27739,  27779,  27813,  27843,  27867,  27886,  27899,  27907,
+         27910,  27907,  27899,  27886,  27867,  27844,  27815,  27782,  27743,  27700,  27652,  27600,
+         27543,  27482,  27417,  27348,  27276,  27200,  27121,  27038,  26953,  26865,  26774,  26682,
+         26587,  26490,  26392,  26292,  26192,  26090,  25988,  25886,  25783,  25681,  25579,  25478,
+         25377,  25278,  25179,  25083,  24988,  24895,  24804,  24716,  24631,  24548,  24468,  24391,
+         24318,  24249,  24183,  24121,  24063,  24009,  23959,  23914,  23873,  23837,  23805,  23778,
+         23756,  23739,  23727,  23720,  23717,  23720,  23727,  23739,  23756,  23778,  23805,  23837,
+         23873,  23914,  23959,  24009,  24063,  24121,  24183,  24249,  24318,  24391,  24468,  24548,
+         24631,  24716,  24804,  24895,  24988,  25083,  25179,  25278,  25377,  25478,  25579,  25681,
+         25783,  25886,  25988,  26090,  26192,  26292,  26392,  26490,  26587,  26682,  26774,  26865,
+         26953,  27038,  27121,  27200,  27276,  27348,  27417,  27482,  27543,  27600,  27652,  27700,
+         27743,  27782,  27815,  27844,  27867,  27886,  27899,  27907,  27910,  27907,  27899,  27886,
+         27867,  27843,  27813,  27779,  27739,  27693,  27643,  27588,  27528,  27463,  27393,  27319,
+         27241,  27158,  27072,  26981,  26887,  26789,  26688,  26584,  26477,  26367,  26255,  26141,
+         26025,  25908,  25789,  25669,  25549,  25428,  25306,  25185,  25064,  24944,  24825,  24707,
+         24590,  24476,  24363,  24253,  24145,  24041,  23940,  23842,  23748,  23658,  23572,  23491,
+         23415,  23344,  23278,  23218,  23163,  23114,  23071,  23034,  23004,  22980,  22963,  22953,
+         22949,  22953,  22963,  22981,  23006,  23038,  23077,  23123,  23177,  23238,  23306,  23381,
+         23463,  23552,  23648,  23750,  23859,  23974,  24096,  24223,  24356,  24494,  24638,  24787,
+         24941,  25099,  25261,  25427,  25597,  25770,  25945,  26123,  26303,  26485,  26668,  26852,
+         27036,  27220,  27404,  27587,  27768,  27948,  28125,  28300,  28471,  28639,  28802,  28961,
+         29115,  29262,  29404,  29539,  29667,  29788,  29900,  30003,  30098,  30183,  30258,  30323,
+         30377,  30420,  30451,  30470,  30476,  30470,  30450,  30416,  30369,  30307,  30231,  30140,
+         30033,  29911,  29774,  29620,  29450,  29264,  29061,  28841,  28605,  28352,  28081,  27794,
+         27489,  27167,  26827,  26471,  26097,  25707,  25299,  24874,  24432,  23974,  23499,  23008,
+         22501,  21977,  21439,  20884,  20315,  19731,  19133,  18520,  17894,  17254,  16602,  15937,
+         15260,  14571,  13872,  13162,  12441,  11711,  10972,  10225,   9469,   8707,   7937,   7161,
+          6380,   5593,   4803,   4008,   3210,   2410,   1608,    804,      0,   -804,  -1608,  -2410,
+         -3210,  -4008,  -4803,  -5593,  -6380,  -7161,  -7937,  -8707,  -9469, -10225, -10972, -11711,
+        -12441, -13162, -13872, -14571, -15260, -15937, -16602, -17254, -17894, -18520, -19133, -19731,
+        -20315, -20884, -21439, -21977, -22501, -23008, -23499, -23974, -24432, -24874, -25299, -25707,
+        -26097, -26471, -26827, -27167, -27489, -27794, -28081, -28352, -28605, -28841, -29061, -29264,
+        -29450, -29620, -29774, -29911, -30033, -30140, -30231, -30307, -30369, -30416, -30450, -30470,
+        -30476, -30470, -30451, -30420, -30377, -30323, -30258, -30183, -30098, -30003, -29900, -29788,
+        -29667, -29539, -29404, -29262, -29115, -28961, -28802, -28639, -28471, -28300, -28125, -27948,
+        -27768, -27587, -27404, -27220, -27036, -26852, -26668, -26485, -26303, -26123, -25945, -25770,
+        -25597, -25427, -25261, -25099, -24941, -24787, -24638, -24494, -24356, -24223, -24096, -23974,
+        -23859, -23750, -23648, -23552, -23463, -23381, -23306, -23238, -23177, -23123, -23077, -23038,
+        -23006, -22981, -22963, -22953, -22949, -22953, -22963, -22980, -23004, -23034, -23071, -23114,
+        -23163, -23218, -23278, -23344, -23415, -23491, -23572, -23658, -23748, -23842, -23940, -24041,
+        -24145, -24253, -24363, -24476, -24590, -24707, -24825, -24944, -25064, -25185, -25306, -25428,
+        -25549, -25669, -25789, -25908, -26025, -26141, -26255, -26367, -26477, -26584, -26688, -26789,
+        -26887, -26981, -27072, -27158, -27241, -27319, -27393, -27463, -27528, -27588, -27643, -27693,
+        -27739, -27779, -27813, -27843, -27867, -27886, -27899, -27907, -27910, -27907, -27899, -27886,
+        -27867, -27844, -27815, -27782, -27743, -27700, -27652, -27600, -27543, -27482, -27417, -27348,
+        -27276, -27200, -27121, -27038, -26953, -26865, -26774, -26682, -26587, -26490, -26392, -26292,
+        -26192, -26090, -25988, -25886, -25783, -25681, -25579, -25478, -25377, -25278, -25179, -25083,
+        -24988, -24895, -24804, -24716, -24631, -24548, -24468, -24391, -24318, -24249, -24183, -24121,
+        -24063, -24009, -23959, -23914, -23873, -23837, -23805, -23778, -23756, -23739, -23727, -23720,
+        -23717, -23720, -23727, -23739, -23756, -23778, -23805, -23837, -23873, -23914, -23959, -24009,
+        -24063, -24121, -24183, -24249, -24318, -24391, -24468, -24548, -24631, -24716, -24804, -24895,
+        -24988, -25083, -25179, -25278, -25377, -25478, -25579, -25681, -25783, -25886, -25988, -26090,
+        -26192, -26292, -26392, -26490, -26587, -26682, -26774, -26865, -26953, -27038, -27121, -27200,
+        -27276, -27348, -27417, -27482, -27543, -27600, -27652, -27700, -27743, -27782, -27815, -27844,
+        -27867, -27886, -27899, -27907, -27910, -27907, -27899, -27886, -27867, -27843, -27813, -27779,
+        -27739, -27693, -27643, -27588, -27528, -27463, -27393, -27319, -27241, -27158, -27072, -26981,
+        -26887, -26789, -26688, -26584, -26477, -26367, -26255, -26141, -26025, -25908, -25789, -25669,
+        -25549, -25428, -25306, -25185, -25064, -24944, -24825, -24707, -24590, -24476, -24363, -24253,
+        -24145, -24041, -23940, -23842, -23748, -23658, -23572, -23491, -23415, -23344, -23278, -23218,
+        -23163, -23114, -23071, -23034, -23004, -22980, -22963, -22953, -22949, -22953, -22963, -22981,
+        -23006, -23038, -23077, -23123, -23177, -23238, -23306, -23381, -23463, -23552, -23648, -23750,
+        -23859, -23974, -24096, -24223, -24356, -24494, -24638, -24787, -24941, -25099, -25261, -25427,
+        -25597, -25770, -25945, -26123, -26303, -26485, -26668, -26852, -27036, -27220, -27404, -27587,
+        -27768, -27948, -28125, -28300, -28471, -28639, -28802, -28961, -29115, -29262, -29404, -29539,
+        -29667, -29788, -29900, -30003, -30098, -30183, -30258, -30323, -30377, -30420, -30451, -30470,
+        -30476, -30470, -30450, -30416, -30369, -30307, -30231, -30140, -30033, -29911, -29774, -29620,
+        -29450, -29264, -29061, -28841, -28605, -28352, -28081, -27794, -27489, -27167, -26827, -26471,
+        -26097, -25707, -25299, -24874, -24432, -23974, -23499, -23008, -22501, -21977, -21439, -20884,
+        -20315, -19731, -19133, -18520, -17894, -17254, -16602, -15937, -15260, -14571, -13872, -13162,
+        -12441, -11711, -10972, -10225,  -9469,  -8707,  -7937,  -7161,  -6380,  -5593,  -4803,  -4008,
+         -3210,  -2410,  -1608,   -804,      0,
+    },
+    // Level 7, harmonics 1 - 4
+    {
+             0,    402,    804,   1206,   1608,   2009,   2410,   2810,   3210,   3610,   4009,   4406,
+          4804,   5200,   5595,   5989,   6382,   6774,   7165,   7554,   7942,   8328,   8713,   9096,
+          9478,   9858,  10235,  10611,  10986,  11358,  11727,  12095,  12461,  12824,  13185,  13543,
+         13899,  14252,  14603,  14951,  15297,  15639,  15979,  16316,  16650,  16981,  17309,  17633,
+         17955,  18273,  18588,  18900,  19208,  19513,  19815,  20113,  20407,  20698,  20985,  21269,
+         21549,  21825,  22097,  22366,  22630,  22891,  23148,  23401,  23650,  23894,  24135,  24372,
+         24605,  24833,  25058,  25278,  25494,  25706,  25913,  26117,  26316,  26511,  26701,  26888,
+         27070,  27248,  27421,  27590,  27755,  27915,  28071,  28223,  28370,  28514,  28652,  28787,
+         28917,  29043,  29164,  29281,  29394,  29503,  29607,  29707,  29803,  29895,  29982,  30065,
+         30145,  30220,  30290,  30357,  30420,  30478,  30533,  30584,  30630,  30673,  30712,  30747,
+         30778,  30805,  30829,  30849,  30865,  30877,  30886,  30891,  30893,  30891,  30886,  30878,
+         30866,  30850,  30832,  30810,  30785,  30757,  30726,  30692,  30655,  30615,  30572,  30526,
+         30478,  30427,  30373,  30317,  30258,  30197,  30133,  30067,  29998,  29928,  29855,  29780,
+         29703,  29624,  29543,  29460,  29376,  29289,  29201,  29112,  29020,  28928,  28833,  28738,
+         28641,  28543,  28444,  28343,  28242,  28140,  28036,  27932,  27827,  27722,  27615,  27508,
+         27401,  27293,  27185,  27076,  26967,  26858,  26749,  26639,  26530,  26420,  26311,  26202,
+         26093,  25984,  25876,  25768,  25661,  25554,  25447,  25341,  25236,  25132,  25028,  24926,
+         24824,  24723,  24623,  24525,  24427,  24331,  24235,  24141,  24049,  23957,  23867,  23779,
+         23692,  23607,  23523,  23441,  23360,  23281,  23204,  23129,  23056,  22984,  22915,  22847,
+         22781,  22717,  22656,  22596,  22539,  22483,  22430,  22379,  22330,  22283,  22239,  22197,
+         22157,  22120,  22085,  22052,  22021,  21993,  21968,  21944,  21923,  21905,  21889,  21875,
+         21864,  21856,  21850,  21846,  21845,  21846,  21850,  21856,  21864,  21875,  21889,  21905,
+         21923,  21944,  21968,  21993,  22021,  22052,  22085,  22120,  22157,  22197,  22239,  22283,
+         22330,  22379,  22430,  22483,  22539,  22596,  22656,  22717,  22781,  22847,  22915,  22984,
+         23056,  23129,  23204,  23281,  23360,  23441,  23523,  23607,  23692,  23779,  23867,  23957,
+         24049,  24141,  24235,  24331,  24427,  24525,  24623,  24723,  24824,  24926,  25028,  25132,
+         25236,  25341,  25447,  25554,  25661,  25768,  25876,  25984,  26093,  26202,  26311,  26420,
+         26530,  26639,  26749,  26858,  26967,  27076,  27185,  27293,  27401,  27508,  27615,  27722,
+         27827,  27932,  28036,  28140,  28242,  28343,  28444,  28543,  28641,  28738,  28833,  28928,
+         29020,  29112,  29201,  29289,  29376,  29460,  29543,  29624,  29703,  29780,  29855,  29928,
+         29998,  30067,  30133,  30197,  30258,  30317,  30373,  30427,  30478,  30526,  30572,  30615,
+         30655,  30692,  30726,  30757,  30785,  30810,  30832,  30850,  30866,  30878,  30886,  30891,
+         30893,  30891,  30886,  30877,  30865,  30849,  30829,  30805,  30778,  30747,  30712,  30673,
+         30630,  30584,  30533,  30478,  30420,  30357,  30290,  30220,  30145,  30065,  29982,  29895,
+         29803,  29707,  29607,  29503,  29394,  29281,  29164,  29043,  28917,  28787,  28652,  28514,
+         28370,  28223,  28071,  27915,  27755,  27590,  27421,  27248,  27070,  26888,  26701,  26511,
+         26316,  26117,  25913,  25706,  25494,  25278,  25058,  24833,  24605,  24372,  24135,  23894,
+         23650,  23401,  23148,  22891,  22630,  22366,  22097,  21825,  21549,  21269,  20985,  20698,
+         20407,  20113,  19815,  19513,  19208,  18900,  18588,  18273,  17955,  17633,  17309,  16981,
+         16650,  16316,  15979,  15639,  15297,  14951,  14603,  14252,  13899,  13543,  13185,  12824,
+         12461,  12095,  11727,  11358,  10986,  10611,  10235,   9858,   9478,   9096,   8713,   8328,
+          7942,   7554,   7165,   6774,   6382,   5989,   5595,   5200,   4804,   4406,   4009,   3610,
+          3210,   2810,   2410,   2009,   1608,   1206,    804,    402,      0,   -402,   -804,  -1206,
+         -1608,  -2009,  -2410,  -2810,  -3210,  -3610,  -4009,  -4406,  -4804,  -5200,  -5595,  -5989,
+         -6382,  -6774,  -7165,  -7554,  -7942,  -8328,  -8713,  -9096,  -9478,  -9858, -10235, -10611,
+        -10986, -11358, -11727, -12095, -12461, -12824, -13185, -13543, -13899, -14252, -14603, -14951,
+        -15297, -15639, -15979, -16316, -16650, -16981, -17309, -17633, -17955, -18273, -18588, -18900,
+        -19208, -19513, -19815, -20113, -20407, -20698, -20985, -21269, -21549, -21825, -22097, -22366,
+        -22630, -22891, -23148, -23401, -23650, -23894, -24135, -24372, -24605, -24833, -25058, -25278,
+        -25494, -25706, -25913, -26117, -26316, -26511, -26701, -26888, -27070, -27248, -27421, -27590,
+        -27755, -27915, -28071, -28223, -28370, -28514, -28652, -28787, -28917, -29043, -29164, -29281,
+        -29394, -29503, -29607, -29707, -29803, -29895, -29982, -30065, -30145, -30220, -30290, -30357,
+        -30420, -30478, -30533, -30584, -30630, -30673, -30712, -30747, -30778, -30805, -30829, -30849,
+        -30865, -30877, -30886, -30891, -30893, -30891, -30886, -30878, -30866, -30850, -30832, -30810,
+        -30785, -30757, -30726, -30692, -30655, -30615, -30572, -30526, -30478, -30427, -30373, -30317,
+        -30258, -30197, -30133, -30067, -29998, -29928, -29855, -29780, -29703, -29624, -29543, -29460,
+        -29376, -29289, -29201, -29112, -29020, -28928, -28833, -28738, -28641, -28543, -28444, -28343,
+        -28242, -28140, -28036, -27932, -27827, -27722, -27615, -27508, -27401, -27293, -27185, -27076,
+        -26967, -26858, -26749, -26639, -26530, -26420, -26311, -26202, -26093, -25984, -25876, -25768,
+        -25661, -25554, -25447, -25341, -25236, -25132, -25028, -24926, -24824, -24723, -24623, -24525,
+        -24427, -24331, -24235, -24141, -24049, -23957, -23867, -23779, -23692, -23607, -23523, -23441,
+        -23360, -23281, -23204, -23129, -23056, -22984, -22915, -22847, -22781, -22717, -22656, -22596,
+        -22539, -22483, -22430, -22379, -22330, -22283, -22239, -22197, -22157, -22120, -22085, -22052,
+        -22021, -21993, -21968, -21944, -21923, -21905, -21889, -21875, -21864, -21856, -21850, -21846,
+        -21845, -21846, -21850, -21856, -21864, -21875, -21889, -21905, -21923, -21944, -21968, -21993,
+        -22021, -22052, -22085, -22120, -22157, -22197, -22239, -22283, -22330, -22379, -22430, -22483,
+        -22539, -22596, -22656, -22717, -22781, -22847, -22915, -22984, -23056, -23129, -23204, -23281,
+        -23360, -23441, -23523, -23607, -23692, -23779, -23867, -23957, -24049, -24141, -24235, -24331,
+        -24427, -24525, -24623, -24723, -24824, -24926, -25028, -25132, -25236, -25341, -25447, -25554,
+        -25661, -25768, -25876, -25984, -26093, -26202, -26311, -26420, -26530, -26639, -26749, -26858,
+        -26967, -27076, -27185, -27293, -27401, -27508, -27615, -27722, -27827, -27932, -28036, -28140,
+        -28242, -28343, -28444, -28543, -28641, -28738, -28833, -28928, -29020, -29112, -29201, -29289,
+        -29376, -29460, -29543, -29624, -29703, -29780, -29855, -29928, -29998, -30067, -30133, -30197,
+        -30258, -30317, -30373, -30427, -30478, -30526, -30572, -30615, -30655, -30692, -30726, -30757,
+        -30785, -30810, -30832, -30850, -30866, -30878, -30886, -30891, -30893, -30891, -30886, -30877,
+        -30865, -30849, -30829, -30805, -30778, -30747, -30712, -30673, -30630, -30584, -30533, -30478,
+        -30420, -30357, -30290, -30220, -30145, -30065, -29982, -29895, -29803, -29707, -29607, -29503,
+        -29394, -29281, -29164, -29043, -28917, -28787, -28652, -28514, -28370, -28223, -28071, -27915,
+        -27755, -27590, -27421, -27248, -27070, -26888, -26701, -26511, -26316, -26117, -25913, -25706,
+        -25494, -25278, -25058, -24833, -24605, -24372, -24135, -23894, -23650, -23401, -23148, -22891,
+        -22630, -22366, -22097, -21825, -21549, -21269, -20985, -20698, -20407, -20113, -19815, -19513,
+        -19208, -18900, -18588, -18273, -17955, -17633, -17309, -16981, -16650, -16316, -15979, -15639,
+        -15297, -14951, -14603, -14252, -13899, -13543, -13185, -12824, -12461, -12095, -11727, -11358,
+        -10986, -10611, -10235,  -9858,  -9478,  -9096,  -8713,  -8328,  -7942,  -7554,  -7165,  -6774,
+         -6382,  -5989,  -5595,  -5200,  -4804,  -4406,  -4009,  -3610,  -3210,  -2810,  -2410,  -2009,
+         -1608,  -1206,   -804,   -402,      0,
+    },
+    // Level 8, harmonics 1 - 2
+    {
+             0,    201,    402,    603,    804,   1005,   1206,   1407,   1608,   1809,   2009,   2210,
+          2410,   2611,   2811,   3012,   3212,   3412,   3612,   3811,   4011,   4210,   4410,   4609,
+          4808,   5007,   5205,   5404,   5602,   5800,   5998,   6195,   6393,   6590,   6786,   6983,
+          7179,   7375,   7571,   7767,   7962,   8157,   8351,   8545,   8739,   8933,   9126,   9319,
+          9512,   9704,   9896,  10087,  10278,  10469,  10659,  10849,  11039,  11228,  11417,  11605,
+         11793,  11980,  12167,  12353,  12539,  12725,  12910,  13094,  13279,  13462,  13645,  13828,
+         14010,  14191,  14372,  14553,  14732,  14912,  15090,  15269,  15446,  15623,  15800,  15976,
+         16151,  16325,  16499,  16673,  16846,  17018,  17189,  17360,  17530,  17700,  17869,  18037,
+         18204,  18371,  18537,  18703,  18868,  19032,  19195,  19357,  19519,  19680,  19841,  20000,
+         20159,  20317,  20475,  20631,  20787,  20942,  21096,  21250,  21403,  21554,  21705,  21856,
+         22005,  22154,  22301,  22448,  22594,  22739,  22884,  23027,  23170,  23311,  23452,  23592,
+         23731,  23870,  24007,  24143,  24279,  24413,  24547,  24680,  24811,  24942,  25072,  25201,
+         25329,  25456,  25582,  25708,  25832,  25955,  26077,  26198,  26319,  26438,  26556,  26674,
+         26790,  26905,  27019,  27133,  27245,  27356,  27466,  27575,  27683,  27790,  27896,  28001,
+         28105,  28208,  28310,  28411,  28510,  28609,  28706,  28803,  28898,  28992,  29085,  29177,
+         29268,  29358,  29447,  29534,  29621,  29706,  29791,  29874,  29956,  30037,  30117,  30195,
+         30273,  30349,  30424,  30498,  30571,  30643,  30714,  30783,  30852,  30919,  30985,  31050,
+         31113,  31176,  31237,  31297,  31356,  31414,  31470,  31526,  31580,  31633,  31685,  31736,
+         31785,  31833,  31880,  31926,  31971,  32014,  32057,  32098,  32137,  32176,  32213,  32250,
+         32285,  32318,  32351,  32382,  32412,  32441,  32469,  32495,  32521,  32545,  32567,  32589,
+         32609,  32628,  32646,  32663,  32678,  32692,  32705,  32717,  32728,  32737,  32745,  32752,
+         32757,  32761,  32765,  32766,  32767,  32766,  32765,  32761,  32757,  32752,  32745,  32737,
+         32728,  32717,  32705,  32692,  32678,  32663,  32646,  32628,  32609,  32589,  32567,  32545,
+         32521,  32495,  32469,  32441,  32412,  32382,  32351,  32318,  32285,  32250,  32213,  32176,
+         32137,  32098,  32057,  32014,  31971,  31926,  31880,  31833,  31785,  31736,  31685,  31633,
+         31580,  31526,  31470,  31414,  31356,  31297,  31237,  31176,  31113,  31050,  30985,  30919,
+         30852,  30783,  30714,  30643,  30571,  30498,  30424,  30349,  30273,  30195,  30117,  30037,
+         29956,  29874,  29791,  29706,  29621,  29534,  29447,  29358,  29268,  29177,  29085,  28992,
+         28898,  28803,  28706,  28609,  28510,  28411,  28310,  28208,  28105,  28001,  27896,  27790,
+         27683,  27575,  27466,  27356,  27245,  27133,  27019,  26905,  26790,  26674,  26556,  26438,
+         26319,  26198,  26077,  25955,  25832,  25708,  25582,  25456,  25329,  25201,  25072,  24942,
+         24811,  24680,  24547,  24413,  24279,  24143,  24007,  23870,  23731,  23592,  23452,  23311,
+         23170,  23027,  22884,  22739,  22594,  22448,  22301,  22154,  22005,  21856,  21705,  21554,
+         21403,  21250,  21096,  20942,  20787,  20631,  20475,  20317,  20159,  20000,  19841,  19680,
+         19519,  19357,  19195,  19032,  18868,  18703,  18537,  18371,  18204,  18037,  17869,  17700,
+         17530,  17360,  17189,  17018,  16846,  16673,  16499,  16325,  16151,  15976,  15800,  15623,
+         15446,  15269,  15090,  14912,  14732,  14553,  14372,  14191,  14010,  13828,  13645,  13462,
+         13279,  13094,  12910,  12725,  12539,  12353,  12167,  11980,  11793,  11605,  11417,  11228,
+         11039,  10849,  10659,  10469,  10278,  10087,   9896,   9704,   9512,   9319,   9126,   8933,
+          8739,   8545,   8351,   8157,   7962,   7767,   7571,   7375,   7179,   6983,   6786,   6590,
+          6393,   6195,   5998,   5800,   5602,   5404,   5205,   5007,   4808,   4609,   4410,   4210,
+          4011,   3811,   3612,   3412,   3212,   3012,   2811,   2611,   2410,   2210,   2009,   1809,
+          1608,   1407,   1206,   1005,    804,    603,    402,    201,      0,   -201,   -402,   -603,
+          -804,  -1005,  -1206,  -1407,  -1608,  -1809,  -2009,  -2210,  -2410,  -2611,  -2811,  -3012,
+         -3212,  -3412,  -3612,  -3811,  -4011,  -4210,  -4410,  -4609,  -4808,  -5007,  -5205,  -5404,
+         -5602,  -5800,  -5998,  -6195,  -6393,  -6590,  -6786,  -6983,  -7179,  -7375,  -7571,  -7767,
+         -7962,  -8157,  -8351,  -8545,  -8739,  -8933,  -9126,  -9319,  -9512,  -9704,  -9896, -10087,
+        -10278, -10469, -10659, -10849, -11039, -11228, -11417, -11605, -11793, -11980, -12167, -12353,
+        -12539, -12725, -12910, -13094, -13279, -13462, -13645, -13828, -14010, -14191, -14372, -14553,
+        -14732, -14912, -15090, -15269, -15446, -15623, -15800, -15976, -16151, -16325, -16499, -16673,
+        -16846, -17018, -17189, -17360, -17530, -17700, -17869, -18037, -18204, -18371, -18537, -18703,
+        -18868, -19032, -19195, -19357, -19519, -19680, -19841, -20000, -20159, -20317, -20475, -20631,
+        -20787, -20942, -21096, -21250, -21403, -21554, -21705, -21856, -22005, -22154, -22301, -22448,
+        -22594, -22739, -22884, -23027, -23170, -23311, -23452, -23592, -23731, -23870, -24007, -24143,
+        -24279, -24413, -24547, -24680, -24811, -24942, -25072, -25201, -25329, -25456, -25582, -25708,
+        -25832, -25955, -26077, -26198, -26319, -26438, -26556, -26674, -26790, -26905, -27019, -27133,
+        -27245, -27356, -27466, -27575, -27683, -27790, -27896, -28001, -28105, -28208, -28310, -28411,
+        -28510, -28609, -28706, -28803, -28898, -28992, -29085, -29177, -29268, -29358, -29447, -29534,
+        -29621, -29706, -29791, -29874, -29956, -30037, -30117, -30195, -30273, -30349, -30424, -30498,
+        -30571, -30643, -30714, -30783, -30852, -30919, -30985, -31050, -31113, -31176, -31237, -31297,
+        -31356, -31414, -31470, -31526, -31580, -31633, -31685, -31736, -31785, -31833, -31880, -31926,
+        -31971, -32014, -32057, -32098, -32137, -32176, -32213, -32250, -32285, -32318, -32351, -32382,
+        -32412, -32441, -32469, -32495, -32521, -32545, -32567, -32589, -32609, -32628, -32646, -32663,
+        -32678, -32692, -32705, -32717, -32728, -32737, -32745, -32752, -32757, -32761, -32765, -32766,
+        -32767, -32766, -32765, -32761, -32757, -32752, -32745, -32737, -32728, -32717, -32705, -32692,
+        -32678, -32663, -32646, -32628, -32609, -32589, -32567, -32545, -32521, -32495, -32469, -32441,
+        -32412, -32382, -32351, -32318, -32285, -32250, -32213, -32176, -32137, -32098, -32057, -32014,
+        -31971, -31926, -31880, -31833, -31785, -31736, -31685, -31633, -31580, -31526, -31470, -31414,
+        -31356, -31297, -31237, -31176, -31113, -31050, -30985, -30919, -30852, -30783, -30714, -30643,
+        -30571, -30498, -30424, -30349, -30273, -30195, -30117, -30037, -29956, -29874, -29791, -29706,
+        -29621, -29534, -29447, -29358, -29268, -29177, -29085, -28992, -28898, -28803, -28706, -28609,
+        -28510, -28411, -28310, -28208, -28105, -28001, -27896, -27790, -27683, -27575, -27466, -27356,
+        -27245, -27133, -27019, -26905, -26790, -26674, -26556, -26438, -26319, -26198, -26077, -25955,
+        -25832, -25708, -25582, -25456, -25329, -25201, -25072, -24942, -24811, -24680, -24547, -24413,
+        -24279, -24143, -24007, -23870, -23731, -23592, -23452, -23311, -23170, -23027, -22884, -22739,
+        -22594, -22448, -22301, -22154, -22005, -21856, -21705, -21554, -21403, -21250, -21096, -20942,
+        -20787, -20631, -20475, -20317, -20159, -20000, -19841, -19680, -19519, -19357, -19195, -19032,
+        -18868, -18703, -18537, -18371, -18204, -18037, -17869, -17700, -17530, -17360, -17189, -17018,
+        -16846, -16673, -16499, -16325, -16151, -15976, -15800, -15623, -15446, -15269, -15090, -14912,
+        -14732, -14553, -14372, -14191, -14010, -13828, -13645, -13462, -13279, -13094, -12910, -12725,
+        -12539, -12353, -12167, -11980, -11793, -11605, -11417, -11228, -11039, -10849, -10659, -10469,
+        -10278, -10087,  -9896,  -9704,  -9512,  -9319,  -9126,  -8933,  -8739,  -8545,  -8351,  -8157,
+         -7962,  -7767,  -7571,  -7375,  -7179,  -6983,  -6786,  -6590,  -6393,  -6195,  -5998,  -5800,
+         -5602,  -5404,  -5205,  -5007,  -4808,  -4609,  -4410,  -4210,  -4011,  -3811,  -3612,  -3412,
+         -3212,  -3012,  -2811,  -2611,  -2410,  -2210,  -2009,  -1809,  -1608,  -1407,  -1206,  -1005,
+          -804,   -603,   -402,   -201,      0,
+    },
+    // Level 9, harmonics 1 - 1
+    {
+             0,    201,    402,    603,    804,   1005,   1206,   1407,   1608,   1809,   2009,   2210,
+          2410,   2611,   2811,   3012,   3212,   3412,   3612,   3811,   4011,   4210,   4410,   4609,
+          4808,   5007,   5205,   5404,   5602,   5800,   5998,   6195,   6393,   6590,   6786,   6983,
+          7179,   7375,   7571,   7767,   7962,   8157,   8351,   8545,   8739,   8933,   9126,   9319,
+          9512,   9704,   9896,  10087,  10278,  10469,  10659,  10849,  11039,  11228,  11417,  11605,
+         11793,  11980,  12167,  12353,  12539,  12725,  12910,  13094,  13279,  13462,  13645,  13828,
+         14010,  14191,  14372,  14553,  14732,  14912,  15090,  15269,  15446,  15623,  15800,  15976,
+         16151,  16325,  16499,  16673,  16846,  17018,  17189,  17360,  17530,  17700,  17869,  18037,
+         18204,  18371,  18537,  18703,  18868,  19032,  19195,  19357,  19519,  19680,  19841,  20000,
+         20159,  20317,  20475,  20631,  20787,  20942,  21096,  21250,  21403,  21554,  21705,  21856,
+         22005,  22154,  22301,  22448,  22594,  22739,  22884,  23027,  23170,  23311,  23452,  23592,
+         23731,  23870,  24007,  24143,  24279,  24413,  24547,  24680,  24811,  24942,  25072,  25201,
+         25329,  25456,  25582,  25708,  25832,  25955,  26077,  26198,  26319,  26438,  26556,  26674,
+         26790,  26905,  27019,  27133,  27245,  27356,  27466,  27575,  27683,  27790,  27896,  28001,
+         28105,  28208,  28310,  28411,  28510,  28609,  28706,  28803,  28898,  28992,  29085,  29177,
+         29268,  29358,  29447,  29534,  29621,  29706,  29791,  29874,  29956,  30037,  30117,  30195,
+         30273,  30349,  30424,  30498,  30571,  30643,  30714,  30783,  30852,  30919,  30985,  31050,
+         31113,  31176,  31237,  31297,  31356,  31414,  31470,  31526,  31580,  31633,  31685,  31736,
+         31785,  31833,  31880,  31926,  31971,  32014,  32057,  32098,  32137,  32176,  32213,  32250,
+         32285,  32318,  32351,  32382,  32412,  32441,  32469,  32495,  32521,  32545,  32567,  32589,
+         32609,  32628,  32646,  32663,  32678,  32692,  32705,  32717,  32728,  32737,  32745,  32752,
+         32757,  32761,  32765,  32766,  32767,  32766,  32765,  32761,  32757,  32752,  32745,  32737,
+         32728,  32717,  32705,  32692,  32678,  32663,  32646,  32628,  32609,  32589,  32567,  32545,
+         32521,  32495,  32469,  32441,  32412,  32382,  32351,  32318,  32285,  32250,  32213,  32176,
+         32137,  32098,  32057,  32014,  31971,  31926,  31880,  31833,  31785,  31736,  31685,  31633,
+         31580,  31526,  31470,  31414,  31356,  31297,  31237,  31176,  31113,  31050,  30985,  30919,
+         30852,  30783,  30714,  30643,  30571,  30498,  30424,  30349,  30273,  30195,  30117,  30037,
+         29956,  29874,  29791,  29706,  29621,  29534,  29447,  29358,  29268,  29177,  29085,  28992,
+         28898,  28803,  28706,  28609,  28510,  28411,  28310,  28208,  28105,  28001,  27896,  27790,
+         27683,  27575,  27466,  27356,  27245,  27133,  27019,  26905,  26790,  26674,  26556,  26438,
+         26319,  26198,  26077,  25955,  25832,  25708,  25582,  25456,  25329,  25201,  25072,  24942,
+         24811,  24680,  24547,  24413,  24279,  24143,  24007,  23870,  23731,  23592,  23452,  23311,
+         23170,  23027,  22884,  22739,  22594,  22448,  22301,  22154,  22005,  21856,  21705,  21554,
+         21403,  21250,  21096,  20942,  20787,  20631,  20475,  20317,  20159,  20000,  19841,  19680,
+         19519,  19357,  19195,  19032,  18868,  18703,  18537,  18371,  18204,  18037,  17869,  17700,
+         17530,  17360,  17189,  17018,  16846,  16673,  16499,  16325,  16151,  15976,  15800,  15623,
+         15446,  15269,  15090,  14912,  14732,  14553,  14372,  14191,  14010,  13828,  13645,  13462,
+         13279,  13094,  12910,  12725,  12539,  12353,  12167,  11980,  11793,  11605,  11417,  11228,
+         11039,  10849,  10659,  10469,  10278,  10087,   9896,   9704,   9512,   9319,   9126,   8933,
+          8739,   8545,   8351,   8157,   7962,   7767,   7571,   7375,   7179,   6983,   6786,   6590,
+          6393,   6195,   5998,   5800,   5602,   5404,   5205,   5007,   4808,   4609,   4410,   4210,
+          4011,   3811,   3612,   3412,   3212,   3012,   2811,   2611,   2410,   2210,   2009,   1809,
+          1608,   1407,   1206,   1005,    804,    603,    402,    201,      0,   -201,   -402,   -603,
+          -804,  -1005,  -1206,  -1407,  -1608,  -1809,  -2009,  -2210,  -2410,  -2611,  -2811,  -3012,
+         -3212,  -3412,  -3612,  -3811,  -4011,  -4210,  -4410,  -4609,  -4808,  -5007,  -5205,  -5404,
+         -5602,  -5800,  -5998,  -6195,  -6393,  -6590,  -6786,  -6983,  -7179,  -7375,  -7571,  -7767,
+         -7962,  -8157,  -8351,  -8545,  -8739,  -8933,  -9126,  -9319,  -9512,  -9704,  -9896, -10087,
+        -10278, -10469, -10659, -10849, -11039, -11228, -11417, -11605, -11793, -11980, -12167, -12353,
+        -12539, -12725, -12910, -13094, -13279, -13462, -13645, -13828, -14010, -14191, -14372, -14553,
+        -14732, -14912, -15090, -15269, -15446, -15623, -15800, -15976, -16151, -16325, -16499, -16673,
+        -16846, -17018, -17189, -17360, -17530, -17700, -17869, -18037, -18204, -18371, -18537, -18703,
+        -18868, -19032, -19195, -19357, -19519, -19680, -19841, -20000, -20159, -20317, -20475, -20631,
+        -20787, -20942, -21096, -21250, -21403, -21554, -21705, -21856, -22005, -22154, -22301, -22448,
+        -22594, -22739, -22884, -23027, -23170, -23311, -23452, -23592, -23731, -23870, -24007, -24143,
+        -24279, -24413, -24547, -24680, -24811, -24942, -25072, -25201, -25329, -25456, -25582, -25708,
+        -25832, -25955, -26077, -26198, -26319, -26438, -26556, -26674, -26790, -26905, -27019, -27133,
+        -27245, -27356, -27466, -27575, -27683, -27790, -27896, -28001, -28105, -28208, -28310, -28411,
+        -28510, -28609, -28706, -28803, -28898, -28992, -29085, -29177, -29268, -29358, -29447, -29534,
+        -29621, -29706, -29791, -29874, -29956, -30037, -30117, -30195, -30273, -30349, -30424, -30498,
+        -30571, -30643, -30714, -30783, -30852, -30919, -30985, -31050, -31113, -31176, -31237, -31297,
+        -31356, -31414, -31470, -31526, -31580, -31633, -31685, -31736, -31785, -31833, -31880, -31926,
+        -31971, -32014, -32057, -32098, -32137, -32176, -32213, -32250, -32285, -32318, -32351, -32382,
+        -32412, -32441, -32469, -32495, -32521, -32545, -32567, -32589, -32609, -32628, -32646, -32663,
+        -32678, -32692, -32705, -32717, -32728, -32737, -32745, -32752, -32757, -32761, -32765, -32766,
+        -32767, -32766, -32765, -32761, -32757, -32752, -32745, -32737, -32728, -32717, -32705, -32692,
+        -32678, -32663, -32646, -32628, -32609, -32589, -32567, -32545, -32521, -32495, -32469, -32441,
+        -32412, -32382, -32351, -32318, -32285, -32250, -32213, -32176, -32137, -32098, -32057, -32014,
+        -31971, -31926, -31880, -31833, -31785, -31736, -31685, -31633, -31580, -31526, -31470, -31414,
+        -31356, -31297, -31237, -31176, -31113, -31050, -30985, -30919, -30852, -30783, -30714, -30643,
+        -30571, -30498, -30424, -30349, -30273, -30195, -30117, -30037, -29956, -29874, -29791, -29706,
+        -29621, -29534, -29447, -29358, -29268, -29177, -29085, -28992, -28898, -28803, -28706, -28609,
+        -28510, -28411, -28310, -28208, -28105, -28001, -27896, -27790, -27683, -27575, -27466, -27356,
+        -27245, -27133, -27019, -26905, -26790, -26674, -26556, -26438, -26319, -26198, -26077, -25955,
+        -25832, -25708, -25582, -25456, -25329, -25201, -25072, -24942, -24811, -24680, -24547, -24413,
+        -24279, -24143, -24007, -23870, -23731, -23592, -23452, -23311, -23170, -23027, -22884, -22739,
+        -22594, -22448, -22301, -22154, -22005, -21856, -21705, -21554, -21403, -21250, -21096, -20942,
+        -20787, -20631, -20475, -20317, -20159, -20000, -19841, -19680, -19519, -19357, -19195, -19032,
+        -18868, -18703, -18537, -18371, -18204, -18037, -17869, -17700, -17530, -17360, -17189, -17018,
+        -16846, -16673, -16499, -16325, -16151, -15976, -15800, -15623, -15446, -15269, -15090, -14912,
+        -14732, -14553, -14372, -14191, -14010, -13828, -13645, -13462, -13279, -13094, -12910, -12725,
+        -12539, -12353, -12167, -11980, -11793, -11605, -11417, -11228, -11039, -10849, -10659, -10469,
+        -10278, -10087,  -9896,  -9704,  -9512,  -9319,  -9126,  -8933,  -8739,  -8545,  -8351,  -8157,
+         -7962,  -7767,  -7571,  -7375,  -7179,  -6983,  -6786,  -6590,  -6393,  -6195,  -5998,  -5800,
+         -5602,  -5404,  -5205,  -5007,  -4808,  -4609,  -4410,  -4210,  -4011,  -3811,  -3612,  -3412,
+         -3212,  -3012,  -2811,  -2611,  -2410,  -2210,  -2009,  -1809,  -1608,  -1407,  -1206,  -1005,
+          -804,   -603,   -402,   -201,      0,
+    },
+};
+
+const int16_t wavetable_triangle[WAVE_MIPMAP_LEVELS][WAVE_SAMPLES_COUNT + 1] = {
+    // Level 0, harmonics 1 - 511
+    {
+             0,    128,    256,    384,    512,    640,    769,    897,   1025,   1153,   1281,   1409,
+          1537,   1665,   1793,   1921,   2050,   2178,   2306,   2434,   2562,   2690,   2818,   2946,
+          3074,   3202,   3331,   3459,   3587,   3715,   3843,   3971,   4099,   4227,   4355,   4483,
+          4612,   4740,   4868,   4996,   5124,   5252,   5380,   5508,   5636,   5764,   5892,   6021,
+          6149,   6277,   6405,   6533,   6661,   6789,   6917,   7045,   7173,   7302,   7430,   7558,
+          7686,   7814,   7942,   8070,   8198,   8326,   8454,   8583,   8711,   8839,   8967,   9095,
+          9223,   9351,   9479,   9607,   9735,   9864,   9992,  10120,  10248,  10376,  10504,  10632,
+         10760,  10888,  11016,  11144,  11273,  11401,  11529,  11657,  11785,  11913,  12041,  12169,
+         12297,  12425,  12554,  12682,  12810,  12938,  13066,  13194,  13322,  13450,  13578,  13706,
+         13835,  13963,  14091,  14219,  14347,  14475,  14603,  14731,  14859,  14987,  15116,  15244,
+         15372,  15500,  15628,  15756,  15884,  16012,  16140,  16268,  16396,  16525,  16653,  16781,
+         16909,  17037,  17165,  17293,  17421,  17549,  17677,  17806,  17934,  18062,  18190,  18318,
+         18446,  18574,  18702,  18830,  18958,  19087,  19215,  19343,  19471,  19599,  19727,  19855,
+         19983,  20111,  20239,  20368,  20496,  20624,  20752,  20880,  21008,  21136,  21264,  21392,
+         21520,  21648,  21777,  21905,  22033,  22161,  22289,  22417,  22545,  22673,  22801,  22929,
+         23058,  23186,  23314,  23442,  23570,  23698,  23826,  23954,  24082,  24210,  24339,  24467,
+         24595,  24723,  24851,  24979,  25107,  25235,  25363,  25491,  25619,  25748,  25876,  26004,
+         26132,  26260,  26388,  26516,  26644,  26772,  26900,  27029,  27157,  27285,  27413,  27541,
+         27669,  27797,  27925,  28053,  28181,  28310,  28438,  28566,  28694,  28822,  28950,  29078,
+         29206,  29334,  29462,  29591,  29719,  29847,  29975,  30103,  30231,  30359,  30487,  30615,
+         30743,  30872,  31000,  31128,  31256,  31384,  31512,  31640,  31768,  31896,  32024,  32153,
+         32280,  32409,  32536,  32668,  32767,  32668,  32536,  32409,  32280,  32153,  32024,  31896,
+         31768,  31640,  31512,  31384,  31256,  31128,  31000,  30872,  30743,  30615,  30487,  30359,
+         30231,  30103,  29975,  29847,  29719,  29591,  29462,  29334,  29206,  29078,  28950,  28822,
+         28694,  28566,  28438,  28310,  28181,  28053,  27925,  27797,  27669,  27541,  27413,  27285,
+         27157,  27029,  26900,  26772,  26644,  26516,  26388,  26260,  26132,  26004,  25876,  25748,
+         25619,  25491,  25363,  25235,  25107,  24979,  24851,  24723,  24595,  24467,  24339,  24210,
+         24082,  23954,  23826,  23698,  23570,  23442,  23314,  23186,  23058,  22929,  22801,  22673,
+         22545,  22417,  22289,  22161,  22033,  21905,  21777,  21648,  21520,  21392,  21264,  21136,
+         21008,  20880,  20752,  20624,  20496,  20368,  20239,  20111,  19983,  19855,  19727,  19599,
+         19471,  19343,  19215,  19087,  18958,  18830,  18702,  18574,  18446,  18318,  18190,  18062,
+         17934,  17806,  17677,  17549,  17421,  17293,  17165,  17037,  16909,  16781,  16653,  16525,
+         16396,  16268,  16140,  16012,  15884,  15756,  15628,  15500,  15372,  15244,  15116,  14987,
+         14859,  14731,  14603,  14475,  14347,  14219,  14091,  13963,  13835,  13706,  13578,  13450,
+         13322,  13194,  13066,  12938,  12810,  12682,  12554,  12425,  12297,  12169,  12041,  11913,
+         11785,  11657,  11529,  11401,  11273,  11144,  11016,  10888,  10760,  10632,  10504,  10376,
+         10248,  10120,   9992,   9864,   9735,   9607,   9479,   9351,   9223,   9095,   8967,   8839,
+          8711,   8583,   8454,   8326,   8198,   8070,   7942,   7814,   7686,   7558,   7430,   7302,
+          7173,   7045,   6917,   6789,   6661,   6533,   6405,   6277,   6149,   6021,   5892,   5764,
+          5636,   5508,   5380,   5252,   5124,   4996,   4868,   4740,   4612,   4483,   4355,   4227,
+          4099,   3971,   3843,   3715,   3587,   3459,   3331,   3202,   3074,   2946,   2818,   2690,
+          2562,   2434,   2306,   2178,   2050,   1921,   1793,   1665,   1537,   1409,   1281,   1153,
+          1025,    897,    769,    640,    512,    384,    256,    128,      0,   -128,   -256,   -384,
+          -512,   -640,   -769,   -897,  -1025,  -1153,  -1281,  -1409,  -1537,  -1665,  -1793,  -1921,
+         -2050,  -2178,  -2306,  -2434,  -2562,  -2690,  -2818,  -2946,  -3074,  -3202,  -3331,  -3459,
+         -3587,  -3715,  -3843,  -3971,  -4099,  -4227,  -4355,  -4483,  -4612,  -4740,  -4868,  -4996,
+         -5124,  -5252,  -5380,  -5508,  -5636,  -5764,  -5892,  -6021,  -6149,  -6277,  -6405,  -6533,
+         -6661,  -6789,  -6917,  -7045,  -7173,  -7302,  -7430,  -7558,  -7686,  -7814,  -7942,  -8070,
+         -8198,  -8326,  -8454,  -8583,  -8711,  -8839,  -8967,  -9095,  -9223,  -9351,  -9479,  -9607,
+         -9735,  -9864,  -9992, -10120, -10248, -10376, -10504, -10632, -10760, -10888, -11016, -11144,
+        -11273, -11401, -11529, -11657, -11785, -11913, -12041, -12169, -12297, -12425, -12554, -12682,
+        -12810, -12938, -13066, -13194, -13322, -13450, -13578, -13706, -13835, -13963, -14091, -14219,
+        -14347, -14475, -14603, -14731, -14859, -14987, -15116, -15244, -15372, -15500, -15628, -15756,
+        -15884, -16012, -16140, -16268, -16396, -16525, -16653, -16781, -16909, -17037, -17165, -17293,
+        -17421, -17549, -17677, -17806, -17934, -18062, -18190, -18318, -18446, -18574, -18702, -18830,
+        -18958, -19087, -19215, -19343, -19471, -19599, -19727, -19855, -19983, -20111, -20239, -20368,
+        -20496, -20624, -20752, -20880, -21008, -21136, -21264, -21392, -21520, -21648, -21777, -21905,
+        -22033, -22161, -22289, -22417, -22545, -22673, -22801, -22929, -23058, -23186, -23314, -23442,
+        -23570, -23698, -23826, -23954, -24082, -24210, -24339, -24467, -24595, -24723, -24851, -24979,
+        -25107, -25235, -25363, -25491, -25619, -25748, -25876, -26004, -26132, -26260, -26388, -26516,
+        -26644, -26772, -26900, -27029, -27157, -27285, -27413, -27541, -27669, -27797, -27925, -28053,
+        -28181, -28310, -28438, -28566, -28694, -28822, -28950, -29078, -29206, -29334, -29462, -29591,
+        -29719, -29847, -29975, -30103, -30231, -30359, -30487, -30615, -30743, -30872, -31000, -31128,
+        -31256, -31384, -31512, -31640, -31768, -31896, -32024, -32153, -32280, -32409, -32536, -32668,
+        -32767, -32668, -32536, -32409, -32280, -32153, -32024, -31896, -31768, -31640, -31512, -31384,
+        -31256, -31128, -31000, -30872, -30743, -30615, -30487, -30359, -30231, -30103, -29975, -29847,
+        -29719, -29591, -29462, -29334, -29206, -29078, -28950, -28822, -28694, -28566, -28438, -28310,
+        -28181, -28053, -27925, -27797, -27669, -27541, -27413, -27285, -27157, -27029, -26900, -26772,
+        -26644, -26516, -26388, -26260, -26132, -26004, -25876, -25748, -25619, -25491, -25363, -25235,
+        -25107, -24979, -24851, -24723, -24595, -24467, -24339, -24210, -24082, -23954, -23826, -23698,
+        -23570, -23442, -23314, -23186, -23058, -22929, -22801, -22673, -22545, -22417, -22289, -22161,
+        -22033, -21905, -21777, -21648, -21520, -21392, -21264, -21136, -21008, -20880, -20752, -20624,
+        -20496, -20368, -20239, -20111, -19983, -19855, -19727, -19599, -19471, -19343, -19215, -19087,
+        -18958, -18830, -18702, -18574, -18446, -18318, -18190, -18062, -17934, -17806, -17677, -17549,
+        -17421, -17293, -17165, -17037, -16909, -16781, -16653, -16525, -16396, -16268, -16140, -16012,
+        -15884, -15756, -15628, -15500, -15372, -15244, -15116, -14987, -14859, -14731, -14603, -14475,
+        -14347, -14219, -14091, -13963, -13835, -13706, -13578, -13450, -13322, -13194, -13066, -12938,
+        -12810, -12682, -12554, -12425, -12297, -12169, -12041, -11913, -11785, -11657, -11529, -11401,
+        -11273, -11144, -11016, -10888, -10760, -10632, -10504, -10376, -10248, -10120,  -9992,  -9864,
+         -9735,  -9607,  -9479,  -9351,  -9223,  -9095,  -8967,  -8839,  -8711,  -8583,  -8454,  -8326,
+         -8198,  -8070,  -7942,  -7814,  -7686,  -7558,  -7430,  -7302,  -7173,  -7045,  -6917,  -6789,
+         -6661,  -6533,  -6405,  -6277,  -6149,  -6021,  -5892,  -5764,  -5636,  -5508,  -5380,  -5252,
+         -5124,  -4996,  -4868,  -4740,  -4612,  -4483,  -4355,  -4227,  -4099,  -3971,  -3843,  -3715,
+         -3587,  -3459,  -3331,  -3202,  -3074,  -2946,  -2818,  -2690,  -2562,  -2434,  -2306,  -2178,
+         -2050,  -1921,  -1793,  -1665,  -1537,  -1409,  -1281,  -1153,  -1025,   -897,   -769,   -640,
+          -512,   -384,   -256,   -128,      0,
+    },
+    // Level 1, harmonics 1 - 256
+    {
+             0,    128,    256,    384,    512,    640,    769,    897,   1025,   1153,   1281,   1409,
+          1537,   1665,   1793,   1922,   2050,   2177,   2306,   2434,   2562,   2690,   2818,   2946,
+          3074,   3202,   3331,   3459,   3587,   3715,   3843,   3971,   4099,   4227,   4355,   4484,
+          4612,   4739,   4868,   4996,   5124,   5252,   5380,   5508,   5636,   5764,   5892,   6021,
+          6149,   6277,   6405,   6533,   6661,   6789,   6917,   7046,   7173,   7301,   7430,   7558,
+          7686,   7814,   7942,   8070,   8198,   8326,   8454,   8583,   8711,   8839,   8967,   9095,
+          9223,   9351,   9479,   9608,   9735,   9863,   9992,  10120,  10248,  10376,  10504,  10632,
+         10760,  10888,  11016,  11145,  11273,  11400,  11529,  11657,  11785,  11913,  12041,  12170,
+         12297,  12425,  12554,  12682,  12810,  12938,  13066,  13194,  13322,  13450,  13578,  13707,
+         13835,  13962,  14091,  14219,  14347,  14475,  14603,  14731,  14859,  14987,  15116,  15244,
+         15372,  15500,  15628,  15756,  15884,  16012,  16140,  16269,  16396,  16524,  16653,  16781,
+         16909,  17037,  17165,  17293,  17421,  17549,  17677,  17806,  17934,  18061,  18190,  18318,
+         18446,  18574,  18702,  18831,  18958,  19086,  19215,  19343,  19471,  19599,  19727,  19855,
+         19983,  20111,  20239,  20368,  20496,  20623,  20752,  20880,  21008,  21136,  21264,  21393,
+         21520,  21648,  21777,  21905,  22033,  22160,  22289,  22417,  22545,  22673,  22801,  22930,
+         23058,  23185,  23314,  23442,  23570,  23698,  23826,  23955,  24082,  24210,  24339,  24467,
+         24595,  24722,  24851,  24980,  25107,  25235,  25363,  25492,  25619,  25747,  25876,  26004,
+         26132,  26259,  26388,  26517,  26644,  26772,  26900,  27029,  27157,  27284,  27413,  27542,
+         27669,  27796,  27925,  28054,  28181,  28309,  28438,  28567,  28694,  28821,  28950,  29079,
+         29206,  29333,  29462,  29592,  29719,  29845,  29975,  30104,  30231,  30357,  30487,  30617,
+         30743,  30869,  31000,  31130,  31256,  31381,  31512,  31644,  31768,  31892,  32025,  32159,
+         32278,  32399,  32543,  32681,  32741,  32681,  32543,  32399,  32278,  32159,  32025,  31892,
+         31768,  31644,  31512,  31381,  31256,  31130,  31000,  30869,  30743,  30617,  30487,  30357,
+         30231,  30104,  29975,  29845,  29719,  29592,  29462,  29333,  29206,  29079,  28950,  28821,
+         28694,  28567,  28438,  28309,  28181,  28054,  27925,  27796,  27669,  27542,  27413,  27284,
+         27157,  27029,  26900,  26772,  26644,  26517,  26388,  26259,  26132,  26004,  25876,  25747,
+         25619,  25492,  25363,  25235,  25107,  24980,  24851,  24722,  24595,  24467,  24339,  24210,
+         24082,  23955,  23826,  23698,  23570,  23442,  23314,  23185,  23058,  22930,  22801,  22673,
+         22545,  22417,  22289,  22160,  22033,  21905,  21777,  21648,  21520,  21393,  21264,  21136,
+         21008,  20880,  20752,  20623,  20496,  20368,  20239,  20111,  19983,  19855,  19727,  19599,
+         19471,  19343,  19215,  19086,  18958,  18831,  18702,  18574,  18446,  18318,  18190,  18061,
+         17934,  17806,  17677,  17549,  17421,  17293,  17165,  17037,  16909,  16781,  16653,  16524,
+         16396,  16269,  16140,  16012,  15884,  15756,  15628,  15500,  15372,  15244,  15116,  14987,
+         14859,  14731,  14603,  14475,  14347,  14219,  14091,  13962,  13835,  13707,  13578,  13450,
+         13322,  13194,  13066,  12938,  12810,  12682,  12554,  12425,  12297,  12170,  12041,  11913,
+         11785,  11657,  11529,  11400,  11273,  11145,  11016,  10888,  10760,  10632,  10504,  10376,
+         10248,  10120,   9992,   9863,   9735,   9608,   9479,   9351,   9223,   9095,   8967,   8839,
+          8711,   8583,   8454,   8326,   8198,   8070,   7942,   7814,   7686,   7558,   7430,   7301,
+          7173,   7046,   6917,   6789,   6661,   6533,   6405,   6277,   6149,   6021,   5892,   5764,
+          5636,   5508,   5380,   5252,   5124,   4996,   4868,   4739,   4612,   4484,   4355,   4227,
+          4099,   3971,   3843,   3715,   3587,   3459,   3331,   3202,   3074,   2946,   2818,   2690,
+          2562,   2434,   2306,   2177,   2050,   1922,   1793,   1665,   1537,   1409,   1281,   1153,
+          1025,    897,    769,    640,    512,    384,    256,    128,      0,   -128,   -256,   -384,
+          -512,   -640,   -769,   -897,  -1025,  -1153,  -1281,  -1409,  -1537,  -1665,  -1793,  -1922,
+         -2050,  -2177,  -2306,  -2434,  -2562,  -2690,  -2818,  -2946,  -3074,  -3202,  -3331,  -3459,
+         -3587,  -3715,  -3843,  -3971,  -4099,  -4227,  -4355,  -4484,  -4612,  -4739,  -4868,  -4996,
+         -5124,  -5252,  -5380,  -5508,  -5636,  -5764,  -5892,  -6021,  -6149,  -6277,  -6405,  -6533,
+         -6661,  -6789,  -6917,  -7046,  -7173,  -7301,  -7430,  -7558,  -7686,  -7814,  -7942,  -8070,
+         -8198,  -8326,  -8454,  -8583,  -8711,  -8839,  -8967,  -9095,  -9223,  -9351,  -9479,  -9608,
+         -9735,  -9863,  -9992, -10120, -10248, -10376, -10504, -10632, -10760, -10888, -11016, -11145,
+        -11273, -11400, -11529, -11657, -11785, -11913, -12041, -12170, -12297, -12425, -12554, -12682,
+        -12810, -12938, -13066, -13194, -13322, -13450, -13578, -13707, -13835, -13962, -14091, -14219,
+        -14347, -14475, -14603, -14731, -14859, -14987, -15116, -15244, -15372, -15500, -15628, -15756,
+        -15884, -16012, -16140, -16269, -16396, -16524, -16653, -16781, -16909, -17037, -17165, -17293,
+        -17421, -17549, -17677, -17806, -17934, -18061, -18190, -18318, -18446, -18574, -18702, -18831,
+        -18958, -19086, -19215, -19343, -19471, -19599, -19727, -19855, -19983, -20111, -20239, -20368,
+        -20496, -20623, -20752, -20880, -21008, -21136, -21264, -21393, -21520, -21648, -21777, -21905,
+        -22033, -22160, -22289, -22417, -22545, -22673, -22801, -22930, -23058, -23185, -23314, -23442,
+        -23570, -23698, -23826, -23955, -24082, -24210, -24339, -24467, -24595, -24722, -24851, -24980,
+        -25107, -25235, -25363, -25492, -25619, -25747, -25876, -26004, -26132, -26259, -26388, -26517,
+        -26644, -26772, -26900, -27029, -27157, -27284, -27413, -27542, -27669, -27796, -27925, -28054,
+        -28181, -28309, -28438, -28567, -28694, -28821, -28950, -29079, -29206, -29333, -29462, -29592,
+        -29719, -29845, -29975, -30104, -30231, -30357, -30487, -30617, -30743, -30869, -31000, -31130,
+        -31256, -31381, -31512, -31644, -31768, -31892, -32025, -32159, -32278, -32399, -32543, -32681,
+        -32741, -32681, -32543, -32399, -32278, -32159, -32025, -31892, -31768, -31644, -31512, -31381,
+        -31256, -31130, -31000, -30869, -30743, -30617, -30487, -30357, -30231, -30104, -29975, -29845,
+        -29719, -29592, -29462, -29333, -29206, -29079, -28950, -28821, -28694, -28567, -28438, -28309,
+        -28181, -28054, -27925, -27796, -27669, -27542, -27413, -27284, -27157, -27029, -26900, -26772,
+        -26644, -26517, -26388, -26259, -26132, -26004, -25876, -25747, -25619, -25492, -25363, -25235,
+        -25107, -24980, -24851, -24722, -24595, -24467, -24339, -24210, -24082, -23955, -23826, -23698,
+        -23570, -23442, -23314, -23185, -23058, -22930, -22801, -22673, -22545, -22417, -22289, -22160,
+        -22033, -21905, -21777, -21648, -21520, -21393, -21264, -21136, -21008, -20880, -20752, -20623,
+        -20496, -20368, -20239, -20111, -19983, -19855, -19727, -19599, -19471, -19343, -19215, -19086,
+        -18958, -18831, -18702, -18574, -18446, -18318, -18190, -18061, -17934, -17806, -17677, -17549,
+        -17421, -17293, -17165, -17037, -16909, -16781, -16653, -16524, -16396, -16269, -16140, -16012,
+        -15884, -15756, -15628, -15500, -15372, -15244, -15116, -14987, -14859, -14731, -14603, -14475,
+        -14347, -14219, -14091, -13962, -13835, -13707, -13578, -13450, -13322, -13194, -13066, -12938,
+        -12810, -12682, -12554, -12425, -12297, -12170, -12041, -11913, -11785, -11657, -11529, -11400,
+        -11273, -11145, -11016, -10888, -10760, -10632, -10504, -10376, -10248, -10120,  -9992,  -9863,
+         -9735,  -9608,  -9479,  -9351,  -9223,  -9095,  -8967,  -8839,  -8711,  -8583,  -8454,  -8326,
+         -8198,  -8070,  -7942,  -7814,  -7686,  -7558,  -7430,  -7301,  -7173,  -7046,  -6917,  -6789,
+         -6661,  -6533,  -6405,  -6277,  -6149,  -6021,  -5892,  -5764,  -5636,  -5508,  -5380,  -5252,
+         -5124,  -4996,  -4868,  -4739,  -4612,  -4484,  -4355,  -4227,  -4099,  -3971,  -3843,  -3715,
+         -3587,  -3459,  -3331,  -3202,  -3074,  -2946,  -2818,  -2690,  -2562,  -2434,  -2306,  -2177,
+         -2050,  -1922,  -1793,  -1665,  -1537,  -1409,  -1281,  -1153,  -1025,   -897,   -769,   -640,
+          -512,   -384,   -256,   -128,      0,
+    },
+    // Level 2, harmonics 1 - 128
+    {
+             0,    128,    255,    384,    512,    641,    769,    897,   1025,   1152,   1280,   1408,
+          1537,   1666,   1794,   1922,   2050,   2177,   2305,   2433,   2562,   2691,   2819,   2947,
+          3074,   3202,   3330,   3458,   3587,   3715,   3844,   3972,   4099,   4227,   4354,   4483,
+          4612,   4740,   4869,   4996,   5124,   5251,   5379,   5508,   5636,   5765,   5893,   6021,
+          6149,   6276,   6404,   6532,   6661,   6790,   6918,   7046,   7173,   7301,   7429,   7557,
+          7686,   7815,   7943,   8071,   8198,   8326,   8454,   8582,   8711,   8839,   8968,   9096,
+          9223,   9350,   9478,   9607,   9735,   9864,   9993,  10120,  10248,  10375,  10503,  10631,
+         10760,  10889,  11017,  11145,  11273,  11400,  11528,  11656,  11785,  11914,  12042,  12170,
+         12297,  12425,  12553,  12681,  12810,  12939,  13067,  13195,  13322,  13450,  13577,  13706,
+         13835,  13963,  14092,  14220,  14347,  14474,  14602,  14730,  14859,  14988,  15117,  15244,
+         15372,  15499,  15627,  15755,  15884,  16013,  16141,  16269,  16396,  16524,  16652,  16780,
+         16909,  17038,  17166,  17294,  17421,  17548,  17676,  17805,  17934,  18063,  18191,  18319,
+         18446,  18573,  18701,  18829,  18958,  19087,  19216,  19344,  19471,  19598,  19726,  19854,
+         19983,  20112,  20241,  20368,  20496,  20623,  20750,  20879,  21008,  21137,  21266,  21393,
+         21520,  21647,  21775,  21904,  22033,  22162,  22291,  22418,  22545,  22672,  22800,  22928,
+         23058,  23187,  23316,  23443,  23570,  23697,  23824,  23953,  24082,  24212,  24341,  24468,
+         24595,  24721,  24849,  24978,  25107,  25237,  25366,  25493,  25619,  25746,  25873,  26002,
+         26132,  26262,  26391,  26518,  26644,  26770,  26898,  27027,  27157,  27287,  27416,  27543,
+         27669,  27795,  27922,  28051,  28182,  28312,  28442,  28568,  28694,  28819,  28946,  29075,
+         29207,  29338,  29467,  29594,  29718,  29842,  29969,  30099,  30232,  30365,  30494,  30620,
+         30742,  30865,  30991,  31122,  31258,  31394,  31524,  31647,  31764,  31881,  32006,  32144,
+         32293,  32441,  32569,  32658,  32689,  32658,  32569,  32441,  32293,  32144,  32006,  31881,
+         31764,  31647,  31524,  31394,  31258,  31122,  30991,  30865,  30742,  30620,  30494,  30365,
+         30232,  30099,  29969,  29842,  29718,  29594,  29467,  29338,  29207,  29075,  28946,  28819,
+         28694,  28568,  28442,  28312,  28182,  28051,  27922,  27795,  27669,  27543,  27416,  27287,
+         27157,  27027,  26898,  26770,  26644,  26518,  26391,  26262,  26132,  26002,  25873,  25746,
+         25619,  25493,  25366,  25237,  25107,  24978,  24849,  24721,  24595,  24468,  24341,  24212,
+         24082,  23953,  23824,  23697,  23570,  23443,  23316,  23187,  23058,  22928,  22800,  22672,
+         22545,  22418,  22291,  22162,  22033,  21904,  21775,  21647,  21520,  21393,  21266,  21137,
+         21008,  20879,  20750,  20623,  20496,  20368,  20241,  20112,  19983,  19854,  19726,  19598,
+         19471,  19344,  19216,  19087,  18958,  18829,  18701,  18573,  18446,  18319,  18191,  18063,
+         17934,  17805,  17676,  17548,  17421,  17294,  17166,  17038,  16909,  16780,  16652,  16524,
+         16396,  16269,  16141,  16013,  15884,  15755,  15627,  15499,  15372,  15244,  15117,  14988,
+         14859,  14730,  14602,  14474,  14347,  14220,  14092,  13963,  13835,  13706,  13577,  13450,
+         13322,  13195,  13067,  12939,  12810,  12681,  12553,  12425,  12297,  12170,  12042,  11914,
+         11785,  11656,  11528,  11400,  11273,  11145,  11017,  10889,  10760,  10631,  10503,  10375,
+         10248,  10120,   9993,   9864,   9735,   9607,   9478,   9350,   9223,   9096,   8968,   8839,
+          8711,   8582,   8454,   8326,   8198,   8071,   7943,   7815,   7686,   7557,   7429,   7301,
+          7173,   7046,   6918,   6790,   6661,   6532,   6404,   6276,   6149,   6021,   5893,   5765,
+          5636,   5508,   5379,   5251,   5124,   4996,   4869,   4740,   4612,   4483,   4354,   4227,
+          4099,   3972,   3844,   3715,   3587,   3458,   3330,   3202,   3074,   2947,   2819,   2691,
+          2562,   2433,   2305,   2177,   2050,   1922,   1794,   1666,   1537,   1408,   1280,   1152,
+          1025,    897,    769,    641,    512,    384,    255,    128,      0,   -128,   -255,   -384,
+          -512,   -641,   -769,   -897,  -1025,  -1152,  -1280,  -1408,  -1537,  -1666,  -1794,  -1922,
+         -2050,  -2177,  -2305,  -2433,  -2562,  -2691,  -2819,  -2947,  -3074,  -3202,  -3330,  -3458,
+         -3587,  -3715,  -3844,  -3972,  -4099,  -4227,  -4354,  -4483,  -4612,  -4740,  -4869,  -4996,
+         -5124,  -5251,  -5379,  -5508,  -5636,  -5765,  -5893,  -6021,  -6149,  -6276,  -6404,  -6532,
+         -6661,  -6790,  -6918,  -7046,  -7173,  -7301,  -7429,  -7557,  -7686,  -7815,  -7943,  -8071,
+         -8198,  -8326,  -8454,  -8582,  -8711,  -8839,  -8968,  -9096,  -9223,  -9350,  -9478,  -9607,
+         -9735,  -9864,  -9993, -10120, -10248, -10375, -10503, -10631, -10760, -10889, -11017, -11145,
+        -11273, -11400, -11528, -11656, -11785, -11914, -12042, -12170, -12297, -12425, -12553, -12681,
+        -12810, -12939, -13067, -13195, -13322, -13450, -13577, -13706, -13835, -13963, -14092, -14220,
+        -14347, -14474, -14602, -14730, -14859, -14988, -15117, -15244, -15372, -15499, -15627, -15755,
+        -15884, -16013, -16141, -16269, -16396, -16524, -16652, -16780, -16909, -17038, -17166, -17294,
+        -17421, -17548, -17676, -17805, -17934, -18063, -18191, -18319, -18446, -18573, -18701, -18829,
+        -18958, -19087, -19216, -19344, -19471, -19598, -19726, -19854, -19983, -20112, -20241, -20368,
+        -20496, -20623, -20750, -20879, -21008, -21137, -21266, -21393, -21520, -21647, -21775, -21904,
+        -22033, -22162, -22291, -22418, -22545, -22672, -22800, -22928, -23058, -23187, -23316, -23443,
+        -23570, -23697, -23824, -23953, -24082, -24212, -24341, -24468, -24595, -24721, -24849, -24978,
+        -25107, -25237, -25366, -25493, -25619, -25746, -25873, -26002, -26132, -26262, -26391, -26518,
+        -26644, -26770, -26898, -27027, -27157, -27287, -27416, -27543, -27669, -27795, -27922, -28051,
+        -28182, -28312, -28442, -28568, -28694, -28819, -28946, -29075, -29207, -29338, -29467, -29594,
+        -29718, -29842, -29969, -30099, -30232, -30365, -30494, -30620, -30742, -30865, -30991, -31122,
+        -31258, -31394, -31524, -31647, -31764, -31881, -32006, -32144, -32293, -32441, -32569, -32658,
+        -32689, -32658, -32569, -32441, -32293, -32144, -32006, -31881, -31764, -31647, -31524, -31394,
+        -31258, -31122, -30991, -30865, -30742, -30620, -30494, -30365, -30232, -30099, -29969, -29842,
+        -29718, -29594, -29467, -29338, -29207, -29075, -28946, -28819, -28694, -28568, -28442, -28312,
+        -28182, -28051, -27922, -27795, -27669, -27543, -27416, -27287, -27157, -27027, -26898, -26770,
+        -26644, -26518, -26391, -26262, -26132, -26002, -25873, -25746, -25619, -25493, -25366, -25237,
+        -25107, -24978, -24849, -24721, -24595, -24468, -24341, -24212, -24082, -23953, -23824, -23697,
+        -23570, -23443, -23316, -23187, -23058, -22928, -22800, -22672, -22545, -22418, -22291, -22162,
+        -22033, -21904, -21775, -21647, -21520, -21393, -21266, -21137, -21008, -20879, -20750, -20623,
+        -20496, -20368, -20241, -20112, -19983, -19854, -19726, -19598, -19471, -19344, -19216, -19087,
+        -18958, -18829, -18701, -18573, -18446, -18319, -18191, -18063, -17934, -17805, -17676, -17548,
+        -17421, -17294, -17166, -17038, -16909, -16780, -16652, -16524, -16396, -16269, -16141, -16013,
+        -15884, -15755, -15627, -15499, -15372, -15244, -15117, -14988, -14859, -14730, -14602, -14474,
+        -14347, -14220, -14092, -13963, -13835, -13706, -13577, -13450, -13322, -13195, -13067, -12939,
+        -12810, -12681, -12553, -12425, -12297, -12170, -12042, -11914, -11785, -11656, -11528, -11400,
+        -11273, -11145, -11017, -10889, -10760, -10631, -10503, -10375, -10248, -10120,  -9993,  -9864,
+         -9735,  -9607,  -9478,  -9350,  -9223,  -9096,  -8968,  -8839,  -8711,  -8582,  -8454,  -8326,
+         -8198,  -8071,  -7943,  -7815,  -7686,  -7557,  -7429,  -7301,  -7173,  -7046,  -6918,  -6790,
+         -6661,  -6532,  -6404,  -6276,  -6149,  -6021,  -5893,  -5765,  -5636,  -5508,  -5379,  -5251,
+         -5124,  -4996,  -4869,  -4740,  -4612,  -4483,  -4354,  -4227,  -4099,  -3972,  -3844,  -3715,
+         -3587,  -3458,  -3330,  -3202,  -3074,  -2947,  -2819,  -2691,  -2562,  -2433,  -2305,  -2177,
+         -2050,  -1922,  -1794,  -1666,  -1537,  -1408,  -1280,  -1152,  -1025,   -897,   -769,   -641,
+          -512,   -384,   -255,   -128,      0,
+    },
+    // Level 3, harmonics 1 - 64
+    {
+             0,    127,    254,    381,    509,    637,    766,    895,   1025,   1154,   1283,   1412,
+          1540,   1668,   1796,   1923,   2050,   2176,   2303,   2431,   2559,   2687,   2816,   2945,
+          3074,   3204,   3333,   3462,   3590,   3718,   3845,   3972,   4099,   4226,   4353,   4480,
+          4608,   4737,   4865,   4995,   5124,   5253,   5382,   5511,   5640,   5767,   5895,   6022,
+          6149,   6275,   6402,   6530,   6658,   6786,   6915,   7044,   7173,   7303,   7432,   7561,
+          7689,   7817,   7944,   8071,   8198,   8325,   8452,   8579,   8707,   8835,   8964,   9094,
+          9223,   9353,   9482,   9611,   9739,   9867,   9994,  10121,  10248,  10374,  10501,  10629,
+         10756,  10885,  11014,  11143,  11273,  11402,  11532,  11660,  11789,  11917,  12044,  12171,
+         12297,  12424,  12551,  12678,  12806,  12934,  13063,  13193,  13322,  13452,  13581,  13710,
+         13839,  13966,  14094,  14220,  14347,  14473,  14600,  14727,  14855,  14983,  15113,  15242,
+         15372,  15502,  15631,  15760,  15889,  16016,  16143,  16270,  16396,  16523,  16649,  16776,
+         16904,  17033,  17162,  17291,  17421,  17551,  17681,  17810,  17939,  18066,  18193,  18320,
+         18446,  18572,  18698,  18825,  18953,  19082,  19211,  19341,  19471,  19601,  19731,  19860,
+         19989,  20116,  20243,  20369,  20495,  20621,  20747,  20874,  21002,  21131,  21260,  21390,
+         21521,  21651,  21781,  21911,  22039,  22167,  22293,  22419,  22545,  22670,  22796,  22923,
+         23050,  23179,  23309,  23439,  23570,  23701,  23832,  23962,  24090,  24218,  24344,  24469,
+         24594,  24719,  24844,  24971,  25098,  25227,  25357,  25489,  25620,  25752,  25883,  26013,
+         26142,  26269,  26395,  26519,  26643,  26767,  26892,  27017,  27145,  27274,  27405,  27537,
+         27671,  27804,  27936,  28067,  28196,  28322,  28447,  28570,  28691,  28813,  28936,  29061,
+         29188,  29318,  29451,  29586,  29723,  29859,  29994,  30127,  30255,  30380,  30501,  30619,
+         30735,  30851,  30969,  31091,  31219,  31354,  31495,  31642,  31792,  31943,  32089,  32225,
+         32346,  32447,  32522,  32569,  32585,  32569,  32522,  32447,  32346,  32225,  32089,  31943,
+         31792,  31642,  31495,  31354,  31219,  31091,  30969,  30851,  30735,  30619,  30501,  30380,
+         30255,  30127,  29994,  29859,  29723,  29586,  29451,  29318,  29188,  29061,  28936,  28813,
+         28691,  28570,  28447,  28322,  28196,  28067,  27936,  27804,  27671,  27537,  27405,  27274,
+         27145,  27017,  26892,  26767,  26643,  26519,  26395,  26269,  26142,  26013,  25883,  25752,
+         25620,  25489,  25357,  25227,  25098,  24971,  24844,  24719,  24594,  24469,  24344,  24218,
+         24090,  23962,  23832,  23701,  23570,  23439,  23309,  23179,  23050,  22923,  22796,  22670,
+         22545,  22419,  22293,  22167,  22039,  21911,  21781,  21651,  21521,  21390,  21260,  21131,
+         21002,  20874,  20747,  20621,  20495,  20369,  20243,  20116,  19989,  19860,  19731,  19601,
+         19471,  19341,  19211,  19082,  18953,  18825,  18698,  18572,  18446,  18320,  18193,  18066,
+         17939,  17810,  17681,  17551,  17421,  17291,  17162,  17033,  16904,  16776,  16649,  16523,
+         16396,  16270,  16143,  16016,  15889,  15760,  15631,  15502,  15372,  15242,  15113,  14983,
+         14855,  14727,  14600,  14473,  14347,  14220,  14094,  13966,  13839,  13710,  13581,  13452,
+         13322,  13193,  13063,  12934,  12806,  12678,  12551,  12424,  12297,  12171,  12044,  11917,
+         11789,  11660,  11532,  11402,  11273,  11143,  11014,  10885,  10756,  10629,  10501,  10374,
+         10248,  10121,   9994,   9867,   9739,   9611,   9482,   9353,   9223,   9094,   8964,   8835,
+          8707,   8579,   8452,   8325,   8198,   8071,   7944,   7817,   7689,   7561,   7432,   7303,
+          7173,   7044,   6915,   6786,   6658,   6530,   6402,   6275,   6149,   6022,   5895,   5767,
+          5640,   5511,   5382,   5253,   5124,   4995,   4865,   4737,   4608,   4480,   4353,   4226,
+          4099,   3972,   3845,   3718,   3590,   3462,   3333,   3204,   3074,   2945,   2816,   2687,
+          2559,   2431,   2303,   2176,   2050,   1923,   1796,   1668,   1540,   1412,   1283,   1154,
+          1025,    895,    766,    637,    509,    381,    254,    127,      0,   -127,   -254,   -381,
+          -509,   -637,   -766,   -895,  -1025,  -1154,  -1283,  -1412,  -1540,  -1668,  -1796,  -1923,
+         -2050,  -2176,  -2303,  -2431,  -2559,  -2687,  -2816,  -2945,  -3074,  -3204,  -3333,  -3462,
+         -3590,  -3718,  -3845,  -3972,  -4099,  -4226,  -4353,  -4480,  -4608,  -4737,  -4865,  -4995,
+         -5124,  -5253,  -5382,  -5511,  -5640,  -5767,  -5895,  -6022,  -6149,  -6275,  -6402,  -6530,
+         -6658,  -6786,  -6915,  -7044,  -7173,  -7303,  -7432,  -7561,  -7689,  -7817,  -7944,  -8071,
+         -8198,  -8325,  -8452,  -8579,  -8707,  -8835,  -8964,  -9094,  -9223,  -9353,  -9482,  -9611,
+         -9739,  -9867,  -9994, -10121, -10248, -10374, -10501, -10629, -10756, -10885, -11014, -11143,
+        -11273, -11402, -11532, -11660, -11789, -11917, -12044, -12171, -12297, -12424, -12551, -12678,
+        -12806, -12934, -13063, -13193, -13322, -13452, -13581, -13710, -13839, -13966, -14094, -14220,
+        -14347, -14473, -14600, -14727, -14855, -14983, -15113, -15242, -15372, -15502, -15631, -15760,
+        -15889, -16016, -16143, -16270, -16396, -16523, -16649, -16776, -16904, -17033, -17162, -17291,
+        -17421, -17551, -17681, -17810, -17939, -18066, -18193, -18320, -18446, -18572, -18698, -18825,
+        -18953, -19082, -19211, -19341, -19471, -19601, -19731, -19860, -19989, -20116, -20243, -20369,
+        -20495, -20621, -20747, -20874, -21002, -21131, -21260, -21390, -21521, -21651, -21781, -21911,
+        -22039, -22167, -22293, -22419, -22545, -22670, -22796, -22923, -23050, -23179, -23309, -23439,
+        -23570, -23701, -23832, -23962, -24090, -24218, -24344, -24469, -24594, -24719, -24844, -24971,
+        -25098, -25227, -25357, -25489, -25620, -25752, -25883, -26013, -26142, -26269, -26395, -26519,
+        -26643, -26767, -26892, -27017, -27145, -27274, -27405, -27537, -27671, -27804, -27936, -28067,
+        -28196, -28322, -28447, -28570, -28691, -28813, -28936, -29061, -29188, -29318, -29451, -29586,
+        -29723, -29859, -29994, -30127, -30255, -30380, -30501, -30619, -30735, -30851, -30969, -31091,
+        -31219, -31354, -31495, -31642, -31792, -31943, -32089, -32225, -32346, -32447, -32522, -32569,
+        -32585, -32569, -32522, -32447, -32346, -32225, -32089, -31943, -31792, -31642, -31495, -31354,
+        -31219, -31091, -30969, -30851, -30735, -30619, -30501, -30380, -30255, -30127, -29994, -29859,
+        -29723, -29586, -29451, -29318, -29188, -29061, -28936, -28813, -28691, -28570, -28447, -28322,
+        -28196, -28067, -27936, -27804, -27671, -27537, -27405, -27274, -27145, -27017, -26892, -26767,
+        -26643, -26519, -26395, -26269, -26142, -26013, -25883, -25752, -25620, -25489, -25357, -25227,
+        -25098, -24971, -24844, -24719, -24594, -24469, -24344, -24218, -24090, -23962, -23832, -23701,
+        -23570, -23439, -23309, -23179, -23050, -22923, -22796, -22670, -22545, -22419, -22293, -22167,
+        -22039, -21911, -21781, -21651, -21521, -21390, -21260, -21131, -21002, -20874, -20747, -20621,
+        -20495, -20369, -20243, -20116, -19989, -19860, -19731, -19601, -19471, -19341, -19211, -19082,
+        -18953, -18825, -18698, -18572, -18446, -18320, -18193, -18066, -17939, -17810, -17681, -17551,
+        -17421, -17291, -17162, -17033, -16904, -16776, -16649, -16523, -16396, -16270, -16143, -16016,
+        -15889, -15760, -15631, -15502, -15372, -15242, -15113, -14983, -14855, -14727, -14600, -14473,
+        -14347, -14220, -14094, -13966, -13839, -13710, -13581, -13452, -13322, -13193, -13063, -12934,
+        -12806, -12678, -12551, -12424, -12297, -12171, -12044, -11917, -11789, -11660, -11532, -11402,
+        -11273, -11143, -11014, -10885, -10756, -10629, -10501, -10374, -10248, -10121,  -9994,  -9867,
+         -9739,  -9611,  -9482,  -9353,  -9223,  -9094,  -8964,  -8835,  -8707,  -8579,  -8452,  -8325,
+         -8198,  -8071,  -7944,  -7817,  -7689,  -7561,  -7432,  -7303,  -7173,  -7044,  -6915,  -6786,
+         -6658,  -6530,  -6402,  -6275,  -6149,  -6022,  -5895,  -5767,  -5640,  -5511,  -5382,  -5253,
+         -5124,  -4995,  -4865,  -4737,  -4608,  -4480,  -4353,  -4226,  -4099,  -3972,  -3845,  -3718,
+         -3590,  -3462,  -3333,  -3204,  -3074,  -2945,  -2816,  -2687,  -2559,  -2431,  -2303,  -2176,
+         -2050,  -1923,  -1796,  -1668,  -1540,  -1412,  -1283,  -1154,  -1025,   -895,   -766,   -637,
+          -509,   -381,   -254,   -127,      0,
+    },
+    // Level 4, harmonics 1 - 32
+    {
+             0,    126,    251,    377,    503,    630,    757,    884,   1012,   1140,   1269,   1398,
+          1528,   1658,   1788,   1919,   2050,   2180,   2311,   2441,   2571,   2701,   2830,   2959,
+          3087,   3215,   3343,   3469,   3596,   3722,   3848,   3973,   4099,   4224,   4350,   4476,
+          4602,   4728,   4855,   4983,   5111,   5239,   5368,   5497,   5627,   5757,   5888,   6018,
+          6149,   6280,   6410,   6541,   6671,   6801,   6930,   7059,   7187,   7315,   7442,   7569,
+          7695,   7821,   7947,   8073,   8198,   8323,   8449,   8574,   8700,   8827,   8954,   9081,
+          9209,   9337,   9466,   9596,   9725,   9856,   9986,  10117,  10248,  10379,  10510,  10641,
+         10771,  10901,  11030,  11159,  11288,  11415,  11543,  11669,  11795,  11921,  12046,  12172,
+         12297,  12422,  12547,  12672,  12798,  12924,  13051,  13178,  13306,  13435,  13564,  13693,
+         13824,  13954,  14085,  14216,  14348,  14479,  14610,  14741,  14872,  15002,  15132,  15261,
+         15389,  15517,  15644,  15770,  15896,  16021,  16146,  16271,  16395,  16520,  16645,  16769,
+         16895,  17021,  17147,  17274,  17402,  17531,  17660,  17790,  17921,  18052,  18184,  18315,
+         18448,  18580,  18712,  18843,  18974,  19105,  19235,  19364,  19492,  19620,  19746,  19872,
+         19998,  20122,  20246,  20370,  20493,  20617,  20741,  20865,  20989,  21115,  21241,  21368,
+         21496,  21624,  21754,  21885,  22016,  22149,  22282,  22415,  22548,  22682,  22815,  22948,
+         23080,  23211,  23342,  23471,  23599,  23727,  23853,  23977,  24101,  24224,  24347,  24468,
+         24590,  24712,  24833,  24956,  25079,  25203,  25328,  25455,  25583,  25712,  25843,  25975,
+         26109,  26244,  26380,  26516,  26653,  26789,  26925,  27061,  27196,  27329,  27461,  27590,
+         27718,  27844,  27968,  28090,  28210,  28328,  28445,  28561,  28677,  28793,  28909,  29026,
+         29145,  29266,  29389,  29515,  29645,  29778,  29914,  30054,  30197,  30343,  30491,  30641,
+         30792,  30943,  31092,  31240,  31384,  31523,  31657,  31782,  31899,  32005,  32100,  32183,
+         32252,  32306,  32346,  32370,  32378,  32370,  32346,  32306,  32252,  32183,  32100,  32005,
+         31899,  31782,  31657,  31523,  31384,  31240,  31092,  30943,  30792,  30641,  30491,  30343,
+         30197,  30054,  29914,  29778,  29645,  29515,  29389,  29266,  29145,  29026,  28909,  28793,
+         28677,  28561,  28445,  28328,  28210,  28090,  27968,  27844,  27718,  27590,  27461,  27329,
+         27196,  27061,  26925,  26789,  26653,  26516,  26380,  26244,  26109,  25975,  25843,  25712,
+         25583,  25455,  25328,  25203,  25079,  24956,  24833,  24712,  24590,  24468,  24347,  24224,
+         24101,  23977,  23853,  23727,  23599,  23471,  23342,  23211,  23080,  22948,  22815,  22682,
+         22548,  22415,  22282,  22149,  22016,  21885,  21754,  21624,  21496,  21368,  21241,  21115,
+         20989,  20865,  20741,  20617,  20493,  20370,  20246,  20122,  19998,  19872,  19746,  19620,
+         19492,  19364,  19235,  19105,  18974,  18843,  18712,  18580,  18448,  18315,  18184,  18052,
+         17921,  17790,  17660,  17531,  17402,  17274,  17147,  17021,  16895,  16769,  16645,  16520,
+         16395,  16271,  16146,  16021,  15896,  15770,  15644,  15517,  15389,  15261,  15132,  15002,
+         14872,  14741,  14610,  14479,  14348,  14216,  14085,  13954,  13824,  13693,  13564,  13435,
+         13306,  13178,  13051,  12924,  12798,  12672,  12547,  12422,  12297,  12172,  12046,  11921,
+         11795,  11669,  11543,  11415,  11288,  11159,  11030,  10901,  10771,  10641,  10510,  10379,
+         10248,  10117,   9986,   9856,   9725,   9596,   9466,   9337,   9209,   9081,   8954,   8827,
+          8700,   8574,   8449,   8323,   8198,   8073,   7947,   7821,   7695,   7569,   7442,   7315,
+          7187,   7059,   6930,   6801,   6671,   6541,   6410,   6280,   6149,   6018,   5888,   5757,
+          5627,   5497,   5368,   5239,   5111,   4983,   4855,   4728,   4602,   4476,   4350,   4224,
+          4099,   3973,   3848,   3722,   3596,   3469,   3343,   3215,   3087,   2959,   2830,   2701,
+          2571,   2441,   2311,   2180,   2050,   1919,   1788,   1658,   1528,   1398,   1269,   1140,
+          1012,    884,    757,    630,    503,    377,    251,    126,      0,   -126,   -251,   -377,
+          -503,   -630,   -757,   -884,  -1012,  -1140,  -1269,  -1398,  -1528,  -1658,  -1788,  -1919,
+         -2050,  -2180,  -2311,  -2441,  -2571,  -2701,  -2830,  -2959,  -3087,  -3215,  -3343,  -3469,
+         -3596,  -3722,  -3848,  -3973,  -4099,  -4224,  -4350,  -4476,  -4602,  -4728,  -4855,  -4983,
+         -5111,  -5239,  -5368,  -5497,  -5627,  -5757,  -5888,  -6018,  -6149,  -6280,  -6410,  -6541,
+         -6671,  -6801,  -6930,  -7059,  -7187,  -7315,  -7442,  -7569,  -7695,  -7821,  -7947,  -8073,
+         -8198,  -8323,  -8449,  -8574,  -8700,  -8827,  -8954,  -9081,  -9209,  -9337,  -9466,  -9596,
+         -9725,  -9856,  -9986, -10117, -10248, -10379, -10510, -10641, -10771, -10901, -11030, -11159,
+        -11288, -11415, -11543, -11669, -11795, -11921, -12046, -12172, -12297, -12422, -12547, -12672,
+        -12798, -12924, -13051, -13178, -13306, -13435, -13564, -13693, -13824, -13954, -14085, -14216,
+        -14348, -14479, -14610, -14741, -14872, -15002, -15132, -15261, -15389, -15517, -15644, -15770,
+        -15896, -16021, -16146, -16271, -16395, -16520, -16645, -16769, -16895, -17021, -17147, -17274,
+        -17402, -17531, -17660, -17790, -17921, -18052, -18184, -18315, -18448, -18580, -18712, -18843,
+        -18974, -19105, -19235, -19364, -19492, -19620, -19746, -19872, -19998, -20122, -20246, -20370,
+        -20493, -20617, -20741, -20865, -20989, -21115, -21241, -21368, -21496, -21624, -21754, -21885,
+        -22016, -22149, -22282, -22415, -22548, -22682, -22815, -22948, -23080, -23211, -23342, -23471,
+        -23599, -23727, -23853, -23977, -24101, -24224, -24347, -24468, -24590, -24712, -24833, -24956,
+        -25079, -25203, -25328, -25455, -25583, -25712, -25843, -25975, -26109, -26244, -26380, -26516,
+        -26653, -26789, -26925, -27061, -27196, -27329, -27461, -27590, -27718, -27844, -27968, -28090,
+        -28210, -28328, -28445, -28561, -28677, -28793, -28909, -29026, -29145, -29266, -29389, -29515,
+        -29645, -29778, -29914, -30054, -30197, -30343, -30491, -30641, -30792, -30943, -31092, -31240,
+        -31384, -31523, -31657, -31782, -31899, -32005, -32100, -32183, -32252, -32306, -32346, -32370,
+        -32378, -32370, -32346, -32306, -32252, -32183, -32100, -32005, -31899, -31782, -31657, -31523,
+        -31384, -31240, -31092, -30943, -30792, -30641, -30491, -30343, -30197, -30054, -29914, -29778,
+        -29645, -29515, -29389, -29266, -29145, -29026, -28909, -28793, -28677, -28561, -28445, -28328,
+        -28210, -28090, -27968, -27844, -27718, -27590, -27461, -27329, -27196, -27061, -26925, -26789,
+        -26653, -26516, -26380, -26244, -26109, -25975, -25843, -25712, -25583, -25455, -25328, -25203,
+        -25079, -24956, -24833, -24712, -24590, -24468, -24347, -24224, -24101, -23977, -23853, -23727,
+        -23599, -23471, -23342, -23211, -23080, -22948, -22815, -22682, -22548, -22415, -22282, -22149,
+        -22016, -21885, -21754, -21624, -21496, -21368, -21241, -21115, -20989, -20865, -20741, -20617,
+        -20493, -20370, -20246, -20122, -19998, -19872, -19746, -19620, -19492, -19364, -19235, -19105,
+        -18974, -18843, -18712, -18580, -18448, -18315, -18184, -18052, -17921, -17790, -17660, -17531,
+        -17402, -17274, -17147, -17021, -16895, -16769, -16645, -16520, -16395, -16271, -16146, -16021,
+        -15896, -15770, -15644, -15517, -15389, -15261, -15132, -15002, -14872, -14741, -14610, -14479,
+        -14348, -14216, -14085, -13954, -13824, -13693, -13564, -13435, -13306, -13178, -13051, -12924,
+        -12798, -12672, -12547, -12422, -12297, -12172, -12046, -11921, -11795, -11669, -11543, -11415,
+        -11288, -11159, -11030, -10901, -10771, -10641, -10510, -10379, -10248, -10117,  -9986,  -9856,
+         -9725,  -9596,  -9466,  -9337,  -9209,  -9081,  -8954,  -8827,  -8700,  -8574,  -8449,  -8323,
+         -8198,  -8073,  -7947,  -7821,  -7695,  -7569,  -7442,  -7315,  -7187,  -7059,  -6930,  -6801,
+         -6671,  -6541,  -6410,  -6280,  -6149,  -6018,  -5888,  -5757,  -5627,  -5497,  -5368,  -5239,
+         -5111,  -4983,  -4855,  -4728,  -4602,  -4476,  -4350,  -4224,  -4099,  -3973,  -3848,  -3722,
+         -3596,  -3469,  -3343,  -3215,  -3087,  -2959,  -2830,  -2701,  -2571,  -2441,  -2311,  -2180,
+         -2050,  -1919,  -1788,  -1658,  -1528,  -1398,  -1269,  -1140,  -1012,   -884,   -757,   -630,
+          -503,   -377,   -251,   -126,      0,
+    },
+    // Level 5, harmonics 1 - 16
+    {
+             0,    123,    246,    369,    493,    616,    740,    864,    988,   1113,   1238,   1364,
+          1489,   1616,   1743,   1870,   1998,   2126,   2255,   2385,   2514,   2645,   2776,   2907,
+          3038,   3170,   3303,   3435,   3568,   3701,   3834,   3967,   4100,   4234,   4367,   4500,
+          4633,   4766,   4898,   5030,   5162,   5294,   5425,   5556,   5686,   5816,   5945,   6074,
+          6202,   6330,   6457,   6584,   6710,   6836,   6961,   7086,   7210,   7334,   7458,   7581,
+          7704,   7827,   7950,   8073,   8195,   8318,   8441,   8564,   8686,   8810,   8933,   9057,
+          9181,   9305,   9430,   9555,   9681,   9808,   9935,  10062,  10190,  10319,  10448,  10577,
+         10708,  10838,  10970,  11101,  11234,  11366,  11499,  11633,  11766,  11900,  12034,  12168,
+         12302,  12436,  12571,  12705,  12838,  12972,  13105,  13238,  13371,  13503,  13635,  13766,
+         13896,  14026,  14156,  14284,  14412,  14540,  14667,  14793,  14918,  15043,  15168,  15291,
+         15415,  15537,  15660,  15782,  15903,  16025,  16146,  16267,  16388,  16509,  16630,  16751,
+         16873,  16994,  17116,  17239,  17362,  17485,  17609,  17734,  17859,  17985,  18112,  18239,
+         18368,  18497,  18626,  18757,  18889,  19021,  19154,  19287,  19421,  19556,  19692,  19827,
+         19964,  20100,  20237,  20374,  20511,  20648,  20785,  20922,  21059,  21195,  21330,  21466,
+         21600,  21734,  21867,  22000,  22131,  22262,  22391,  22520,  22647,  22774,  22899,  23023,
+         23146,  23269,  23390,  23510,  23629,  23748,  23866,  23983,  24099,  24215,  24331,  24447,
+         24562,  24677,  24793,  24908,  25025,  25141,  25258,  25377,  25496,  25616,  25737,  25860,
+         25983,  26109,  26236,  26364,  26495,  26627,  26760,  26896,  27033,  27172,  27313,  27455,
+         27599,  27744,  27891,  28039,  28187,  28337,  28488,  28639,  28790,  28941,  29092,  29242,
+         29392,  29540,  29687,  29832,  29975,  30116,  30254,  30389,  30521,  30648,  30772,  30891,
+         31005,  31114,  31218,  31316,  31408,  31494,  31574,  31646,  31712,  31770,  31821,  31864,
+         31900,  31927,  31947,  31959,  31963,  31959,  31947,  31927,  31900,  31864,  31821,  31770,
+         31712,  31646,  31574,  31494,  31408,  31316,  31218,  31114,  31005,  30891,  30772,  30648,
+         30521,  30389,  30254,  30116,  29975,  29832,  29687,  29540,  29392,  29242,  29092,  28941,
+         28790,  28639,  28488,  28337,  28187,  28039,  27891,  27744,  27599,  27455,  27313,  27172,
+         27033,  26896,  26760,  26627,  26495,  26364,  26236,  26109,  25983,  25860,  25737,  25616,
+         25496,  25377,  25258,  25141,  25025,  24908,  24793,  24677,  24562,  24447,  24331,  24215,
+         24099,  23983,  23866,  23748,  23629,  23510,  23390,  23269,  23146,  23023,  22899,  22774,
+         22647,  22520,  22391,  22262,  22131,  22000,  21867,  21734,  21600,  21466,  21330,  21195,
+         21059,  20922,  20785,  20648,  20511,  20374,  20237,  20100,  19964,  19827,  19692,  19556,
+         19421,  19287,  19154,  19021,  18889,  18757,  18626,  18497,  18368,  18239,  18112,  17985,
+         17859,  17734,  17609,  17485,  17362,  17239,  17116,  16994,  16873,  16751,  16630,  16509,
+         16388,  16267,  16146,  16025,  15903,  15782,  15660,  15537,  15415,  15291,  15168,  15043,
+         14918,  14793,  14667,  14540,  14412,  14284,  14156,  14026,  13896,  13766,  13635,  13503,
+         13371,  13238,  13105,  12972,  12838,  12705,  12571,  12436,  12302,  12168,  12034,  11900,
+         11766,  11633,  11499,  11366,  11234,  11101,  10970,  10838,  10708,  10577,  10448,  10319,
+         10190,  10062,   9935,   9808,   9681,   9555,   9430,   9305,   9181,   9057,   8933,   8810,
+          8686,   8564,   8441,   8318,   8195,   8073,   7950,   7827,   7704,   7581,   7458,   7334,
+          7210,   7086,   6961,   6836,   6710,   6584,   6457,   6330,   6202,   6074,   5945,   5816,
+          5686,   5556,   5425,   5294,   5162,   5030,   4898,   4766,   4633,   4500,   4367,   4234,
+          4100,   3967,   3834,   3701,   3568,   3435,   3303,   3170,   3038,   2907,   2776,   2645,
+          2514,   2385,   2255,   2126,   1998,   1870,   1743,   1616,   1489,   1364,   1238,   1113,
+           988,    864,    740,    616,    493,    369,    246,    123,      0,   -123,   -246,   -369,
+          -493,   -616,   -740,   -864,   -988,  -1113,  -1238,  -1364,  -1489,  -1616,  -1743,  -1870,
+         -1998,  -2126,  -2255,  -2385,  -2514,  -2645,  -2776,  -2907,  -3038,  -3170,  -3303,  -3435,
+         -3568,  -3701,  -3834,  -3967,  -4100,  -4234,  -4367,  -4500,  -4633,  -4766,  -4898,  -5030,
+         -5162,  -5294,  -5425,  -5556,  -5686,  -5816,  -5945,  -6074,  -6202,  -6330,  -6457,  -6584,
+         -6710,  -6836,  -6961,  -7086,  -7210,  -7334,  -7458,  -7581,  -7704,  -7827,  -7950,  -8073,
+         -8195,  -8318,  -8441,  -8564,  -8686,  -8810,  -8933,  -9057,  -9181,  -9305,  -9430,  -9555,
+         -9681,  -9808,  -9935, -10062, -10190, -10319, -10448, -10577, -10708, -10838, -10970, -11101,
+        -11234, -11366, -11499, -11633, -11766, -11900, -12034, -12168, -12302, -12436, -12571, -12705,
+        -12838, -12972, -13105, -13238, -13371, -13503, -13635, -13766, -13896, -14026, -14156, -14284,
+        -14412, -14540, -14667, -14793, -14918, -15043, -15168, -15291, -15415, -15537, -15660, -15782,
+        -15903, -16025, -16146, -16267, -16388, -16509, -16630, -16751, -16873, -16994, -17116, -17239,
+        -17362, -17485, -17609, -17734, -17859, -17985, -18112, -18239, -18368, -18497, -18626, -18757,
+        -18889, -19021, -19154, -19287, -19421, -19556, -19692, -19827, -19964, -20100, -20237, -20374,
+        -20511, -20648, -20785, -20922, -21059, -21195, -21330, -21466, -21600, -21734, -21867, -22000,
+        -22131, -22262, -22391, -22520, -22647, -22774, -22899, -23023, -23146, -23269, -23390, -23510,
+        -23629, -23748, -23866, -23983, -24099, -24215, -24331, -24447, -24562, -24677, -24793, -24908,
+        -25025, -25141, -25258, -25377, -25496, -25616, -25737, -25860, -25983, -26109, -26236, -26364,
+        -26495, -26627, -26760, -26896, -27033, -27172, -27313, -27455, -27599, -27744, -27891, -28039,
+        -28187, -28337, -28488, -28639, -28790, -28941, -29092, -29242, -29392, -29540, -29687, -29832,
+        -29975, -30116, -30254, -30389, -30521, -30648, -30772, -30891, -31005, -31114, -31218, -31316,
+        -31408, -31494, -31574, -31646, -31712, -31770, -31821, -31864, -31900, -31927, -31947, -31959,
+        -31963, -31959, -31947, -31927, -31900, -31864, -31821, -31770, -31712, -31646, -31574, -31494,
+        -31408, -31316, -31218, -31114, -31005, -30891, -30772, -30648, -30521, -30389, -30254, -30116,
+        -29975, -29832, -29687, -29540, -29392, -29242, -29092, -28941, -28790, -28639, -28488, -28337,
+        -28187, -28039, -27891, -27744, -27599, -27455, -27313, -27172, -27033, -26896, -26760, -26627,
+        -26495, -26364, -26236, -26109, -25983, -25860, -25737, -25616, -25496, -25377, -25258, -25141,
+        -25025, -24908, -24793, -24677, -24562, -24447, -24331, -24215, -24099, -23983, -23866, -23748,
+        -23629, -23510, -23390, -23269, -23146, -23023, -22899, -22774, -22647, -22520, -22391, -22262,
+        -22131, -22000, -21867, -21734, -21600, -21466, -21330, -21195, -21059, -20922, -20785, -20648,
+        -20511, -20374, -20237, -20100, -19964, -19827, -19692, -19556, -19421, -19287, -19154, -19021,
+        -18889, -18757, -18626, -18497, -18368, -18239, -18112, -17985, -17859, -17734, -17609, -17485,
+        -17362, -17239, -17116, -16994, -16873, -16751, -16630, -16509, -16388, -16267, -16146, -16025,
+        -15903, -15782, -15660, -15537, -15415, -15291, -15168, -15043, -14918, -14793, -14667, -14540,
+        -14412, -14284, -14156, -14026, -13896, -13766, -13635, -13503, -13371, -13238, -13105, -12972,
+        -12838, -12705, -12571, -12436, -12302, -12168, -12034, -11900, -11766, -11633, -11499, -11366,
+        -11234, -11101, -10970, -10838, -10708, -10577, -10448, -10319, -10190, -10062,  -9935,  -9808,
+         -9681,  -9555,  -9430,  -9305,  -9181,  -9057,  -8933,  -8810,  -8686,  -8564,  -8441,  -8318,
+         -8195,  -8073,  -7950,  -7827,  -7704,  -7581,  -7458,  -7334,  -7210,  -7086,  -6961,  -6836,
+         -6710,  -6584,  -6457,  -6330,  -6202,  -6074,  -5945,  -5816,  -5686,  -5556,  -5425,  -5294,
+         -5162,  -5030,  -4898,  -4766,  -4633,  -4500,  -4367,  -4234,  -4100,  -3967,  -3834,  -3701,
+         -3568,  -3435,  -3303,  -3170,  -3038,  -2907,  -2776,  -2645,  -2514,  -2385,  -2255,  -2126,
+         -1998,  -1870,  -1743,  -1616,  -1489,  -1364,  -1238,  -1113,   -988,   -864,   -740,   -616,
+          -493,   -369,   -246,   -123,      0,
+    },
+    // Level 6, harmonics 1 - 8
+    {
+             0,    118,    236,    354,    472,    591,    709,    828,    947,   1065,   1185,   1304,
+          1424,   1544,   1664,   1784,   1905,   2026,   2148,   2270,   2392,   2515,   2638,   2762,
+          2886,   3011,   3136,   3261,   3388,   3514,   3641,   3769,   3897,   4025,   4155,   4284,
+          4414,   4545,   4676,   4808,   4940,   5072,   5205,   5339,   5473,   5607,   5742,   5877,
+          6013,   6149,   6285,   6422,   6559,   6696,   6833,   6971,   7109,   7247,   7386,   7524,
+          7663,   7802,   7940,   8079,   8218,   8357,   8496,   8635,   8774,   8912,   9051,   9189,
+          9327,   9465,   9603,   9740,   9878,  10014,  10151,  10287,  10423,  10558,  10693,  10828,
+         10962,  11095,  11229,  11361,  11493,  11625,  11756,  11886,  12016,  12145,  12274,  12402,
+         12529,  12656,  12783,  12908,  13033,  13158,  13282,  13405,  13528,  13650,  13771,  13892,
+         14013,  14133,  14252,  14371,  14489,  14607,  14725,  14842,  14959,  15075,  15191,  15307,
+         15422,  15537,  15652,  15767,  15882,  15996,  16110,  16225,  16339,  16453,  16567,  16682,
+         16796,  16911,  17026,  17141,  17256,  17371,  17487,  17603,  17720,  17837,  17954,  18072,
+         18191,  18310,  18430,  18550,  18671,  18792,  18915,  19038,  19161,  19286,  19411,  19537,
+         19664,  19792,  19921,  20050,  20181,  20312,  20445,  20578,  20712,  20847,  20983,  21120,
+         21257,  21396,  21536,  21676,  21817,  21960,  22103,  22246,  22391,  22536,  22682,  22829,
+         22976,  23124,  23273,  23422,  23571,  23721,  23872,  24023,  24174,  24325,  24476,  24628,
+         24780,  24931,  25083,  25235,  25386,  25537,  25688,  25838,  25988,  26137,  26285,  26433,
+         26580,  26726,  26871,  27016,  27159,  27300,  27441,  27580,  27717,  27853,  27988,  28120,
+         28251,  28380,  28507,  28632,  28755,  28875,  28993,  29109,  29222,  29333,  29441,  29547,
+         29649,  29749,  29845,  29939,  30030,  30117,  30202,  30283,  30360,  30434,  30505,  30573,
+         30636,  30696,  30753,  30806,  30855,  30900,  30941,  30979,  31013,  31042,  31068,  31090,
+         31108,  31122,  31132,  31138,  31140,  31138,  31132,  31122,  31108,  31090,  31068,  31042,
+         31013,  30979,  30941,  30900,  30855,  30806,  30753,  30696,  30636,  30573,  30505,  30434,
+         30360,  30283,  30202,  30117,  30030,  29939,  29845,  29749,  29649,  29547,  29441,  29333,
+         29222,  29109,  28993,  28875,  28755,  28632,  28507,  28380,  28251,  28120,  27988,  27853,
+         27717,  27580,  27441,  27300,  27159,  27016,  26871,  26726,  26580,  26433,  26285,  26137,
+         25988,  25838,  25688,  25537,  25386,  25235,  25083,  24931,  24780,  24628,  24476,  24325,
+         24174,  24023,  23872,  23721,  23571,  23422,  23273,  23124,  22976,  22829,  22682,  22536,
+         22391,  22246,  22103,  21960,  21817,  21676,  21536,  21396,  21257,  21120,  20983,  20847,
+         20712,  20578,  20445,  20312,  20181,  20050,  19921,  19792,  19664,  19537,  19411,  19286,
+         19161,  19038,  18915,  18792,  18671,  18550,  18430,  18310,  18191,  18072,  17954,  17837,
+         17720,  17603,  17487,  17371,  17256,  17141,  17026,  16911,  16796,  16682,  16567,  16453,
+         16339,  16225,  16110,  15996,  15882,  15767,  15652,  15537,  15422,  15307,  15191,  15075,
+         14959,  14842,  14725,  14607,  14489,  14371,  14252,  14133,  14013,  13892,  13771,  13650,
+         13528,  13405,  13282,  13158,  13033,  12908,  12783,  12656,  12529,  12402,  12274,  12145,
+         12016,  11886,  11756,  11625,  11493,  11361,  11229,  11095,  10962,  10828,  10693,  10558,
+         10423,  10287,  10151,  10014,   9878,   9740,   9603,   9465,   9327,   9189,   9051,   8912,
+          8774,   8635,   8496,   8357,   8218,   8079,   7940,   7802,   7663,   7524,   7386,   7247,
+          7109,   6971,   6833,   6696,   6559,   6422,   6285,   6149,   6013,   5877,   5742,   5607,
+          5473,   5339,   5205,   5072,   4940,   4808,   4676,   4545,   4414,   4284,   4155,   4025,
+          3897,   3769,   3641,   3514,   3388,   3261,   3136,   3011,   2886,   2762,   2638,   2515,
+          2392,   2270,   2148,   2026,   1905,   1784,   1664,   1544,   1424,   1304,   1185,   1065,
+           947,    828,    709,    591,    472,    354,    236,    118,      0,   -118,   -236,   -354,
+          -472,   -591,   -709,   -828,   -947,  -1065,  -1185,  -1304,  -1424,  -1544,  -1664,  -1784,
+         -1905,  -2026,  -2148,  -2270,  -2392,  -2515,  -2638,  -2762,  -2886,  -3011,  -3136,  -3261,
+         -3388,  -3514,  -3641,  -3769,  -3897,  -4025,  -4155,  -4284,  -4414,  -4545,  -4676,  -4808,
+         -4940,  -5072,  -5205,  -5339,  -5473,  -5607,  -5742,  -5877,  -6013,  -6149,  -6285,  -6422,
+         -6559,  -6696,  -6833,  -6971,  -7109,  -7247,  -7386,  -7524,  -7663,  -7802,  -7940,  -8079,
+         -8218,  -8357,  -8496,  -8635,  -8774,  -8912,  -9051,  -9189,  -9327,  -9465,  -9603,  -9740,
+         -9878, -10014, -10151, -10287, -10423, -10558, -10693, -10828, -10962, -11095, -11229, -11361,
+        -11493, -11625, -11756, -11886, -12016, -12145, -12274, -12402, -12529, -12656, -12783, -12908,
+        -13033, -13158, -13282, -13405, -13528, -13650, -13771, -13892, -14013, -14133, -14252, -14371,
+        -14489, -14607, -14725, -14842, -14959, -15075, -15191, -15307, -15422, -15537, -15652, -15767,
+        -15882, -15996, -16110, -16225, -16339, -16453, -16567, -16682, -16796, -16911, -17026, -17141,
+        -17256, -17371, -17487, -17603, -17720, -17837, -17954, -18072, -18191, -18310, -18430, -18550,
+        -18671, -18792, -18915, -19038, -19161, -19286, -19411, -19537, -19664, -19792, -19921, -20050,
+        -20181, -20312, -20445, -20578, -20712, -20847, -20983, -21120, -21257, -21396, -21536, -21676,
+        -21817, -21960, -22103, -22246, -22391, -22536, -22682, -22829, -22976, -23124, -23273, -23422,
+        -23571, -23721, -23872, -24023, -24174, -24325, -24476, -24628, -24780, -24931, -25083, -25235,
+        -25386, -25537, -25688, -25838, -25988, -26137, -26285, -26433, -26580, -26726, -26871, -27016,
+        -27159, -27300, -27441, -27580, -27717, -27853, -27988, -28120, -28251, -28380, -28507, -28632,
+        -28755, -28875, -28993, -29109, -29222, -29333, -29441, -29547, -29649, -29749, -29845, -29939,
+        -30030, -30117, -30202, -30283, -30360, -30434, -30505, -30573, -30636, -30696, -30753, -30806,
+        -30855, -30900, -30941, -30979, -31013, -31042, -31068, -31090, -31108, -31122, -31132, -31138,
+        -31140, -31138, -31132, -31122, -31108, -31090, -31068, -31042, -31013, -30979, -30941, -30900,
+        -30855, -30806, -30753, -30696, -30636, -30573, -30505, -30434, -30360, -30283, -30202, -30117,
+        -30030, -29939, -29845, -29749, -29649, -29547, -29441, -29333, -29222, -29109, -28993, -28875,
+        -28755, -28632, -28507, -28380, -28251, -28120, -27988, -27853, -27717, -27580, -27441, -27300,
+        -27159, -27016, -26871, -26726, -26580, -26433, -26285, -26137, -25988, -25838, -25688, -25537,
+        -25386, -25235, -25083, -24931, -24780, -24628, -24476, -24325, -24174, -24023, -23872, -23721,
+        -23571, -23422, -23273, -23124, -22976, -22829, -22682, -22536, -22391, -22246, -22103, -21960,
+        -21817, -21676, -21536, -21396, -21257, -21120, -20983, -20847, -20712, -20578, -20445, -20312,
+        -20181, -20050, -19921, -19792, -19664, -19537, -19411, -19286, -19161, -19038, -18915, -18792,
+        -18671, -18550, -18430, -18310, -18191, -18072, -17954, -17837, -17720, -17603, -17487, -17371,
+        -17256, -17141, -17026, -16911, -16796, -16682, -16567, -16453, -16339, -16225, -16110, -15996,
+        -15882, -15767, -15652, -15537, -15422, -15307, -15191, -15075, -14959, -14842, -14725, -14607,
+        -14489, -14371, -14252, -14133, -14013, -13892, -13771, -13650, -13528, -13405, -13282, -13158,
+        -13033, -12908, -12783, -12656, -12529, -12402, -12274, -12145, -12016, -11886, -11756, -11625,
+        -11493, -11361, -11229, -11095, -10962, -10828, -10693, -10558, -10423, -10287, -10151, -10014,
+         -9878,  -9740,  -9603,  -9465,  -9327,  -9189,  -9051,  -8912,  -8774,  -8635,  -8496,  -8357,
+         -8218,  -8079,  -7940,  -7802,  -7663,  -7524,  -7386,  -7247,  -7109,  -6971,  -6833,  -6696,
+         -6559,  -6422,  -6285,  -6149,  -6013,  -5877,  -5742,  -5607,  -5473,  -5339,  -5205,  -5072,
+         -4940,  -4808,  -4676,  -4545,  -4414,  -4284,  -4155,  -4025,  -3897,  -3769,  -3641,  -3514,
+         -3388,  -3261,  -3136,  -3011,  -2886,  -2762,  -2638,  -2515,  -2392,  -2270,  -2148,  -2026,
+         -1905,  -1784,  -1664,  -1544,  -1424,  -1304,  -1185,  -1065,   -947,   -828,   -709,   -591,
+          -472,   -354,   -236,   -118,      0,
+    },
+    // Level 7, harmonics 1 - 4
+    {
+             0,    109,    217,    326,    435,    544,    653,    762,    871,    980,   1089,   1199,
+          1308,   1418,   1528,   1638,   1748,   1858,   1969,   2080,   2191,   2302,   2414,   2525,
+          2637,   2750,   2862,   2975,   3089,   3202,   3316,   3430,   3545,   3660,   3775,   3891,
+          4007,   4123,   4240,   4358,   4475,   4593,   4712,   4831,   4950,   5070,   5191,   5312,
+          5433,   5555,   5677,   5800,   5923,   6047,   6171,   6296,   6422,   6547,   6674,   6801,
+          6928,   7056,   7185,   7314,   7443,   7574,   7704,   7836,   7967,   8100,   8233,   8366,
+          8500,   8634,   8769,   8905,   9041,   9178,   9315,   9453,   9591,   9730,   9869,  10009,
+         10149,  10290,  10431,  10573,  10715,  10858,  11002,  11145,  11290,  11434,  11579,  11725,
+         11871,  12017,  12164,  12311,  12459,  12607,  12756,  12904,  13053,  13203,  13353,  13503,
+         13653,  13804,  13955,  14107,  14258,  14410,  14562,  14714,  14867,  15019,  15172,  15325,
+         15478,  15632,  15785,  15939,  16092,  16246,  16400,  16553,  16707,  16861,  17015,  17168,
+         17322,  17476,  17629,  17783,  17936,  18089,  18242,  18395,  18547,  18700,  18852,  19004,
+         19155,  19306,  19457,  19608,  19758,  19908,  20057,  20206,  20355,  20503,  20651,  20798,
+         20944,  21091,  21236,  21381,  21525,  21669,  21812,  21954,  22095,  22236,  22376,  22516,
+         22654,  22792,  22929,  23065,  23200,  23335,  23468,  23600,  23732,  23862,  23992,  24120,
+         24248,  24374,  24499,  24623,  24747,  24868,  24989,  25109,  25227,  25344,  25460,  25575,
+         25688,  25800,  25910,  26020,  26128,  26234,  26339,  26443,  26546,  26646,  26746,  26844,
+         26940,  27035,  27128,  27220,  27310,  27399,  27486,  27571,  27655,  27737,  27817,  27896,
+         27973,  28048,  28122,  28193,  28263,  28332,  28398,  28463,  28526,  28587,  28646,  28704,
+         28759,  28813,  28865,  28915,  28963,  29009,  29054,  29096,  29137,  29175,  29212,  29246,
+         29279,  29310,  29339,  29366,  29391,  29414,  29434,  29453,  29470,  29485,  29498,  29509,
+         29518,  29525,  29530,  29533,  29534,  29533,  29530,  29525,  29518,  29509,  29498,  29485,
+         29470,  29453,  29434,  29414,  29391,  29366,  29339,  29310,  29279,  29246,  29212,  29175,
+         29137,  29096,  29054,  29009,  28963,  28915,  28865,  28813,  28759,  28704,  28646,  28587,
+         28526,  28463,  28398,  28332,  28263,  28193,  28122,  28048,  27973,  27896,  27817,  27737,
+         27655,  27571,  27486,  27399,  27310,  27220,  27128,  27035,  26940,  26844,  26746,  26646,
+         26546,  26443,  26339,  26234,  26128,  26020,  25910,  25800,  25688,  25575,  25460,  25344,
+         25227,  25109,  24989,  24868,  24747,  24623,  24499,  24374,  24248,  24120,  23992,  23862,
+         23732,  23600,  23468,  23335,  23200,  23065,  22929,  22792,  22654,  22516,  22376,  22236,
+         22095,  21954,  21812,  21669,  21525,  21381,  21236,  21091,  20944,  20798,  20651,  20503,
+         20355,  20206,  20057,  19908,  19758,  19608,  19457,  19306,  19155,  19004,  18852,  18700,
+         18547,  18395,  18242,  18089,  17936,  17783,  17629,  17476,  17322,  17168,  17015,  16861,
+         16707,  16553,  16400,  16246,  16092,  15939,  15785,  15632,  15478,  15325,  15172,  15019,
+         14867,  14714,  14562,  14410,  14258,  14107,  13955,  13804,  13653,  13503,  13353,  13203,
+         13053,  12904,  12756,  12607,  12459,  12311,  12164,  12017,  11871,  11725,  11579,  11434,
+         11290,  11145,  11002,  10858,  10715,  10573,  10431,  10290,  10149,  10009,   9869,   9730,
+          9591,   9453,   9315,   9178,   9041,   8905,   8769,   8634,   8500,   8366,   8233,   8100,
+          7967,   7836,   7704,   7574,   7443,   7314,   7185,   7056,   6928,   6801,   6674,   6547,
+          6422,   6296,   6171,   6047,   5923,   5800,   5677,   5555,   5433,   5312,   5191,   5070,
+          4950,   4831,   4712,   4593,   4475,   4358,   4240,   4123,   4007,   3891,   3775,   3660,
+          3545,   3430,   3316,   3202,   3089,   2975,   2862,   2750,   2637,   2525,   2414,   2302,
+          2191,   2080,   1969,   1858,   1748,   1638,   1528,   1418,   1308,   1199,   1089,    980,
+           871,    762,    653,    544,    435,    326,    217,    109,      0,   -109,   -217,   -326,
+          -435,   -544,   -653,   -762,   -871,   -980,  -1089,  -1199,  -1308,  -1418,  -1528,  -1638,
+         -1748,  -1858,  -1969,  -2080,  -2191,  -2302,  -2414,  -2525,  -2637,  -2750,  -2862,  -2975,
+         -3089,  -3202,  -3316,  -3430,  -3545,  -3660,  -3775,  -3891,  -4007,  -4123,  -4240,  -4358,
+         -4475,  -4593,  -4712,  -4831,  -4950,  -5070,  -5191,  -5312,  -5433,  -5555,  -5677,  -5800,
+         -5923,  -6047,  -6171,  -6296,  -6422,  -6547,  -6674,  -6801,  -6928,  -7056,  -7185,  -7314,
+         -7443,  -7574,  -7704,  -7836,  -7967,  -8100,  -8233,  -8366,  -8500,  -8634,  -8769,  -8905,
+         -9041,  -9178,  -9315,  -9453,  -9591,  -9730,  -9869, -10009, -10149, -10290, -10431, -10573,
+        -10715, -10858, -11002, -11145, -11290, -11434, -11579, -11725, -11871, -12017, -12164, -12311,
+        -12459, -12607, -12756, -12904, -13053, -13203, -13353, -13503, -13653, -13804, -13955, -14107,
+        -14258, -14410, -14562, -14714, -14867, -15019, -15172, -15325, -15478, -15632, -15785, -15939,
+        -16092, -16246, -16400, -16553, -16707, -16861, -17015, -17168, -17322, -17476, -17629, -17783,
+        -17936, -18089, -18242, -18395, -18547, -18700, -18852, -19004, -19155, -19306, -19457, -19608,
+        -19758, -19908, -20057, -20206, -20355, -20503, -20651, -20798, -20944, -21091, -21236, -21381,
+        -21525, -21669, -21812, -21954, -22095, -22236, -22376, -22516, -22654, -22792, -22929, -23065,
+        -23200, -23335, -23468, -23600, -23732, -23862, -23992, -24120, -24248, -24374, -24499, -24623,
+        -24747, -24868, -24989, -25109, -25227, -25344, -25460, -25575, -25688, -25800, -25910, -26020,
+        -26128, -26234, -26339, -26443, -26546, -26646, -26746, -26844, -26940, -27035, -27128, -27220,
+        -27310, -27399, -27486, -27571, -27655, -27737, -27817, -27896, -27973, -28048, -28122, -28193,
+        -28263, -28332, -28398, -28463, -28526, -28587, -28646, -28704, -28759, -28813, -28865, -28915,
+        -28963, -29009, -29054, -29096, -29137, -29175, -29212, -29246, -29279, -29310, -29339, -29366,
+        -29391, -29414, -29434, -29453, -29470, -29485, -29498, -29509, -29518, -29525, -29530, -29533,
+        -29534, -29533, -29530, -29525, -29518, -29509, -29498, -29485, -29470, -29453, -29434, -29414,
+        -29391, -29366, -29339, -29310, -29279, -29246, -29212, -29175, -29137, -29096, -29054, -29009,
+        -28963, -28915, -28865, -28813, -28759, -28704, -28646, -28587, -28526, -28463, -28398, -28332,
+        -28263, -28193, -28122, -28048, -27973, -27896, -27817, -27737, -27655, -27571, -27486, -27399,
+        -27310, -27220, -27128, -27035, -26940, -26844, -26746, -26646, -26546, -26443, -26339, -26234,
+        -26128, -26020, -25910, -25800, -25688, -25575, -25460, -25344, -25227, -25109, -24989, -24868,
+        -24747, -24623, -24499, -24374, -24248, -24120, -23992, -23862, -23732, -23600, -23468, -23335,
+        -23200, -23065, -22929, -22792, -22654, -22516, -22376, -22236, -22095, -21954, -21812, -21669,
+        -21525, -21381, -21236, -21091, -20944, -20798, -20651, -20503, -20355, -20206, -20057, -19908,
+        -19758, -19608, -19457, -19306, -19155, -19004, -18852, -18700, -18547, -18395, -18242, -18089,
+        -17936, -17783, -17629, -17476, -17322, -17168, -17015, -16861, -16707, -16553, -16400, -16246,
+        -16092, -15939, -15785, -15632, -15478, -15325, -15172, -15019, -14867, -14714, -14562, -14410,
+        -14258, -14107, -13955, -13804, -13653, -13503, -13353, -13203, -13053, -12904, -12756, -12607,
+        -12459, -12311, -12164, -12017, -11871, -11725, -11579, -11434, -11290, -11145, -11002, -10858,
+        -10715, -10573, -10431, -10290, -10149, -10009,  -9869,  -9730,  -9591,  -9453,  -9315,  -9178,
+         -9041,  -8905,  -8769,  -8634,  -8500,  -8366,  -8233,  -8100,  -7967,  -7836,  -7704,  -7574,
+         -7443,  -7314,  -7185,  -7056,  -6928,  -6801,  -6674,  -6547,  -6422,  -6296,  -6171,  -6047,
+         -5923,  -5800,  -5677,  -5555,  -5433,  -5312,  -5191,  -5070,  -4950,  -4831,  -4712,  -4593,
+         -4475,  -4358,  -4240,  -4123,  -4007,  -3891,  -3775,  -3660,  -3545,  -3430,  -3316,  -3202,
+         -3089,  -2975,  -2862,  -2750,  -2637,  -2525,  -2414,  -2302,  -2191,  -2080,  -1969,  -1858,
+         -1748,  -1638,  -1528,  -1418,  -1308,  -1199,  -1089,   -980,   -871,   -762,   -653,   -544,
+          -435,   -326,   -217,   -109,      0,
+    },
+    // Level 8, harmonics 1 - 2
+    {
+             0,    163,    326,    489,    652,    815,    978,   1141,   1304,   1467,   1630,   1793,
+          1955,   2118,   2281,   2443,   2605,   2768,   2930,   3092,   3254,   3416,   3577,   3739,
+          3900,   4061,   4223,   4384,   4544,   4705,   4865,   5026,   5186,   5346,   5505,   5665,
+          5824,   5983,   6142,   6300,   6459,   6617,   6775,   6932,   7089,   7247,   7403,   7560,
+          7716,   7872,   8028,   8183,   8338,   8493,   8647,   8801,   8955,   9108,   9261,   9414,
+          9566,   9718,   9870,  10021,  10172,  10323,  10473,  10622,  10772,  10921,  11069,  11217,
+         11365,  11512,  11659,  11805,  11951,  12097,  12242,  12386,  12530,  12674,  12817,  12960,
+         13102,  13243,  13385,  13525,  13665,  13805,  13944,  14083,  14221,  14358,  14495,  14632,
+         14768,  14903,  15038,  15172,  15306,  15439,  15571,  15703,  15834,  15965,  16095,  16225,
+         16353,  16482,  16609,  16736,  16863,  16989,  17114,  17238,  17362,  17485,  17608,  17730,
+         17851,  17971,  18091,  18210,  18329,  18446,  18564,  18680,  18796,  18911,  19025,  19138,
+         19251,  19363,  19475,  19585,  19695,  19804,  19913,  20020,  20127,  20233,  20339,  20444,
+         20547,  20650,  20753,  20854,  20955,  21055,  21154,  21252,  21350,  21447,  21543,  21638,
+         21732,  21826,  21918,  22010,  22101,  22191,  22281,  22369,  22457,  22544,  22630,  22715,
+         22799,  22883,  22965,  23047,  23128,  23208,  23287,  23365,  23442,  23519,  23594,  23669,
+         23743,  23816,  23888,  23959,  24029,  24098,  24167,  24234,  24301,  24366,  24431,  24495,
+         24558,  24620,  24681,  24741,  24800,  24858,  24915,  24972,  25027,  25082,  25135,  25188,
+         25239,  25290,  25340,  25389,  25436,  25483,  25529,  25574,  25618,  25661,  25703,  25744,
+         25784,  25824,  25862,  25899,  25935,  25970,  26005,  26038,  26070,  26102,  26132,  26161,
+         26190,  26217,  26243,  26269,  26293,  26317,  26339,  26361,  26381,  26401,  26419,  26436,
+         26453,  26468,  26483,  26496,  26509,  26520,  26531,  26540,  26549,  26556,  26563,  26568,
+         26573,  26576,  26579,  26580,  26581,  26580,  26579,  26576,  26573,  26568,  26563,  26556,
+         26549,  26540,  26531,  26520,  26509,  26496,  26483,  26468,  26453,  26436,  26419,  26401,
+         26381,  26361,  26339,  26317,  26293,  26269,  26243,  26217,  26190,  26161,  26132,  26102,
+         26070,  26038,  26005,  25970,  25935,  25899,  25862,  25824,  25784,  25744,  25703,  25661,
+         25618,  25574,  25529,  25483,  25436,  25389,  25340,  25290,  25239,  25188,  25135,  25082,
+         25027,  24972,  24915,  24858,  24800,  24741,  24681,  24620,  24558,  24495,  24431,  24366,
+         24301,  24234,  24167,  24098,  24029,  23959,  23888,  23816,  23743,  23669,  23594,  23519,
+         23442,  23365,  23287,  23208,  23128,  23047,  22965,  22883,  22799,  22715,  22630,  22544,
+         22457,  22369,  22281,  22191,  22101,  22010,  21918,  21826,  21732,  21638,  21543,  21447,
+         21350,  21252,  21154,  21055,  20955,  20854,  20753,  20650,  20547,  20444,  20339,  20233,
+         20127,  20020,  19913,  19804,  19695,  19585,  19475,  19363,  19251,  19138,  19025,  18911,
+         18796,  18680,  18564,  18446,  18329,  18210,  18091,  17971,  17851,  17730,  17608,  17485,
+         17362,  17238,  17114,  16989,  16863,  16736,  16609,  16482,  16353,  16225,  16095,  15965,
+         15834,  15703,  15571,  15439,  15306,  15172,  15038,  14903,  14768,  14632,  14495,  14358,
+         14221,  14083,  13944,  13805,  13665,  13525,  13385,  13243,  13102,  12960,  12817,  12674,
+         12530,  12386,  12242,  12097,  11951,  11805,  11659,  11512,  11365,  11217,  11069,  10921,
+         10772,  10622,  10473,  10323,  10172,  10021,   9870,   9718,   9566,   9414,   9261,   9108,
+          8955,   8801,   8647,   8493,   8338,   8183,   8028,   7872,   7716,   7560,   7403,   7247,
+          7089,   6932,   6775,   6617,   6459,   6300,   6142,   5983,   5824,   5665,   5505,   5346,
+          5186,   5026,   4865,   4705,   4544,   4384,   4223,   4061,   3900,   3739,   3577,   3416,
+          3254,   3092,   2930,   2768,   2605,   2443,   2281,   2118,   1955,   1793,   1630,   1467,
+          1304,   1141,    978,    815,    652,    489,    326,    163,      0,   -163,   -326,   -489,
+          -652,   -815,   -978,  -1141,  -1304,  -1467,  -1630,  -1793,  -1955,  -2118,  -2281,  -2443,
+         -2605,  -2768,  -2930,  -3092,  -3254,  -3416,  -3577,  -3739,  -3900,  -4061,  -4223,  -4384,
+         -4544,  -4705,  -4865,  -5026,  -5186,  -5346,  -5505,  -5665,  -5824,  -5983,  -6142,  -6300,
+         -6459,  -6617,  -6775,  -6932,  -7089,  -7247,  -7403,  -7560,  -7716,  -7872,  -8028,  -8183,
+         -8338,  -8493,  -8647,  -8801,  -8955,  -9108,  -9261,  -9414,  -9566,  -9718,  -9870, -10021,
+        -10172, -10323, -10473, -10622, -10772, -10921, -11069, -11217, -11365, -11512, -11659, -11805,
+        -11951, -12097, -12242, -12386, -12530, -12674, -12817, -12960, -13102, -13243, -13385, -13525,
+        -13665, -13805, -13944, -14083, -14221, -14358, -14495, -14632, -14768, -14903, -15038, -15172,
+        -15306, -15439, -15571, -15703, -15834, -15965, -16095, -16225, -16353, -16482, -16609, -16736,
+        -16863, -16989, -17114, -17238, -17362, -17485, -17608, -17730, -17851, -17971, -18091, -18210,
+        -18329, -18446, -18564, -18680, -18796, -18911, -19025, -19138, -19251, -19363, -19475, -19585,
+        -19695, -19804, -19913, -20020, -20127, -20233, -20339, -20444, -20547, -20650, -20753, -20854,
+        -20955, -21055, -21154, -21252, -21350, -21447, -21543, -21638, -21732, -21826, -21918, -22010,
+        -22101, -22191, -22281, -22369, -22457, -22544, -22630, -22715, -22799, -22883, -22965, -23047,
+        -23128, -23208, -23287, -23365, -23442, -23519, -23594, -23669, -23743, -23816, -23888, -23959,
+        -24029, -24098, -24167, -24234, -24301, -24366, -24431, -24495, -24558, -24620, -24681, -24741,
+        -24800, -24858, -24915, -24972, -25027, -25082, -25135, -25188, -25239, -25290, -25340, -25389,
+        -25436, -25483, -25529, -25574, -25618, -25661, -25703, -25744, -25784, -25824, -25862, -25899,
+        -25935, -25970, -26005, -26038, -26070, -26102, -26132, -26161, -26190, -26217, -26243, -26269,
+        -26293, -26317, -26339, -26361, -26381, -26401, -26419, -26436, -26453, -26468, -26483, -26496,
+        -26509, -26520, -26531, -26540, -26549, -26556, -26563, -26568, -26573, -26576, -26579, -26580,
+        -26581, -26580, -26579, -26576, -26573, -26568, -26563, -26556, -26549, -26540, -26531, -26520,
+        -26509, -26496, -26483, -26468, -26453, -26436, -26419, -26401, -26381, -26361, -26339, -26317,
+        -26293, -26269, -26243, -26217, -26190, -26161, -26132, -26102, -26070, -26038, -26005, -25970,
+        -25935, -25899, -25862, -25824, -25784, -25744, -25703, -25661, -25618, -25574, -25529, -25483,
+        -25436, -25389, -25340, -25290, -25239, -25188, -25135, -25082, -25027, -24972, -24915, -24858,
+        -24800, -24741, -24681, -24620, -24558, -24495, -24431, -24366, -24301, -24234, -24167, -24098,
+        -24029, -23959, -23888, -23816, -23743, -23669, -23594, -23519, -23442, -23365, -23287, -23208,
+        -23128, -23047, -22965, -22883, -22799, -22715, -22630, -22544, -22457, -22369, -22281, -22191,
+        -22101, -22010, -21918, -21826, -21732, -21638, -21543, -21447, -21350, -21252, -21154, -21055,
+        -20955, -20854, -20753, -20650, -20547, -20444, -20339, -20233, -20127, -20020, -19913, -19804,
+        -19695, -19585, -19475, -19363, -19251, -19138, -19025, -18911, -18796, -18680, -18564, -18446,
+        -18329, -18210, -18091, -17971, -17851, -17730, -17608, -17485, -17362, -17238, -17114, -16989,
+        -16863, -16736, -16609, -16482, -16353, -16225, -16095, -15965, -15834, -15703, -15571, -15439,
+        -15306, -15172, -15038, -14903, -14768, -14632, -14495, -14358, -14221, -14083, -13944, -13805,
+        -13665, -13525, -13385, -13243, -13102, -12960, -12817, -12674, -12530, -12386, -12242, -12097,
+        -11951, -11805, -11659, -11512, -11365, -11217, -11069, -10921, -10772, -10622, -10473, -10323,
+        -10172, -10021,  -9870,  -9718,  -9566,  -9414,  -9261,  -9108,  -8955,  -8801,  -8647,  -8493,
+         -8338,  -8183,  -8028,  -7872,  -7716,  -7560,  -7403,  -7247,  -7089,  -6932,  -6775,  -6617,
+         -6459,  -6300,  -6142,  -5983,  -5824,  -5665,  -5505,  -5346,  -5186,  -5026,  -4865,  -4705,
+         -4544,  -4384,  -4223,  -4061,  -3900,  -3739,  -3577,  -3416,  -3254,  -3092,  -2930,  -2768,
+         -2605,  -2443,  -2281,  -2118,  -1955,  -1793,  -1630,  -1467,  -1304,  -1141,   -978,   -815,
+          -652,   -489,   -326,   -163,      0,
+    },
+    // Level 9, harmonics 1 - 1
+    {
+             0,    163,    326,    489,    652,    815,    978,   1141,   1304,   1467,   1630,   1793,
+          1955,   2118,   2281,   2443,   2605,   2768,   2930,   3092,   3254,   3416,   3577,   3739,
+          3900,   4061,   4223,   4384,   4544,   4705,   4865,   5026,   5186,   5346,   5505,   5665,
+          5824,   5983,   6142,   6300,   6459,   6617,   6775,   6932,   7089,   7247,   7403,   7560,
+          7716,   7872,   8028,   8183,   8338,   8493,   8647,   8801,   8955,   9108,   9261,   9414,
+          9566,   9718,   9870,  10021,  10172,  10323,  10473,  10622,  10772,  10921,  11069,  11217,
+         11365,  11512,  11659,  11805,  11951,  12097,  12242,  12386,  12530,  12674,  12817,  12960,
+         13102,  13243,  13385,  13525,  13665,  13805,  13944,  14083,  14221,  14358,  14495,  14632,
+         14768,  14903,  15038,  15172,  15306,  15439,  15571,  15703,  15834,  15965,  16095,  16225,
+         16353,  16482,  16609,  16736,  16863,  16989,  17114,  17238,  17362,  17485,  17608,  17730,
+         17851,  17971,  18091,  18210,  18329,  18446,  18564,  18680,  18796,  18911,  19025,  19138,
+         19251,  19363,  19475,  19585,  19695,  19804,  19913,  20020,  20127,  20233,  20339,  20444,
+         20547,  20650,  20753,  20854,  20955,  21055,  21154,  21252,  21350,  21447,  21543,  21638,
+         21732,  21826,  21918,  22010,  22101,  22191,  22281,  22369,  22457,  22544,  22630,  22715,
+         22799,  22883,  22965,  23047,  23128,  23208,  23287,  23365,  23442,  23519,  23594,  23669,
+         23743,  23816,  23888,  23959,  24029,  24098,  24167,  24234,  24301,  24366,  24431,  24495,
+         24558,  24620,  24681,  24741,  24800,  24858,  24915,  24972,  25027,  25082,  25135,  25188,
+         25239,  25290,  25340,  25389,  25436,  25483,  25529,  25574,  25618,  25661,  25703,  25744,
+         25784,  25824,  25862,  25899,  25935,  25970,  26005,  26038,  26070,  26102,  26132,  26161,
+         26190,  26217,  26243,  26269,  26293,  26317,  26339,  26361,  26381,  26401,  26419,  26436,
+         26453,  26468,  26483,  26496,  26509,  26520,  26531,  26540,  26549,  26556,  26563,  26568,
+         26573,  26576,  26579,  26580,  26581,  26580,  26579,  26576,  26573,  26568,  26563,  26556,
+         26549,  26540,  26531,  26520,  26509,  26496,  26483,  26468,  26453,  26436,  26419,  26401,
+         26381,  26361,  26339,  26317,  26293,  26269,  26243,  26217,  26190,  26161,  26132,  26102,
+         26070,  26038,  26005,  25970,  25935,  25899,  25862,  25824,  25784,  25744,  25703,  25661,
+         25618,  25574,  25529,  25483,  25436,  25389,  25340,  25290,  25239,  25188,  25135,  25082,
+         25027,  24972,  24915,  24858,  24800,  24741,  24681,  24620,  24558,  24495,  24431,  24366,
+         24301,  24234,  24167,  24098,  24029,  23959,  23888,  23816,  23743,  23669,  23594,  23519,
+         23442,  23365,  23287,  23208,  23128,  23047,  22965,  22883,  22799,  22715,  22630,  22544,
+         22457,  22369,  22281,  22191,  22101,  22010,  21918,  21826,  21732,  21638,  21543,  21447,
+         21350,  21252,  21154,  21055,  20955,  20854,  20753,  20650,  20547,  20444,  20339,  20233,
+         20127,  20020,  19913,  19804,  19695,  19585,  19475,  19363,  19251,  19138,  19025,  18911,
+         18796,  18680,  18564,  18446,  18329,  18210,  18091,  17971,  17851,  17730,  17608,  17485,
+         17362,  17238,  17114,  16989,  16863,  16736,  16609,  16482,  16353,  16225,  16095,  15965,
+         15834,  15703,  15571,  15439,  15306,  15172,  15038,  14903,  14768,  14632,  14495,  14358,
+         14221,  14083,  13944,  13805,  13665,  13525,  13385,  13243,  13102,  12960,  12817,  12674,
+         12530,  12386,  12242,  12097,  11951,  11805,  11659,  11512,  11365,  11217,  11069,  10921,
+         10772,  10622,  10473,  10323,  10172,  10021,   9870,   9718,   9566,   9414,   9261,   9108,
+          8955,   8801,   8647,   8493,   8338,   8183,   8028,   7872,   7716,   7560,   7403,   7247,
+          7089,   6932,   6775,   6617,   6459,   6300,   6142,   5983,   5824,   5665,   5505,   5346,
+          5186,   5026,   4865,   4705,   4544,   4384,   4223,   4061,   3900,   3739,   3577,   3416,
+          3254,   3092,   2930,   2768,   2605,   2443,   2281,   2118,   1955,   1793,   1630,   1467,
+          1304,   1141,    978,    815,    652,    489,    326,    163,      0,   -163,   -326,   -489,
+          -652,   -815,   -978,  -1141,  -1304,  -1467,  -1630,  -1793,  -1955,  -2118,  -2281,  -2443,
+         -2605,  -2768,  -2930,  -3092,  -3254,  -3416,  -3577,  -3739,  -3900,  -4061,  -4223,  -4384,
+         -4544,  -4705,  -4865,  -5026,  -5186,  -5346,  -5505,  -5665,  -5824,  -5983,  -6142,  -6300,
+         -6459,  -6617,  -6775,  -6932,  -7089,  -7247,  -7403,  -7560,  -7716,  -7872,  -8028,  -8183,
+         -8338,  -8493,  -8647,  -8801,  -8955,  -9108,  -9261,  -9414,  -9566,  -9718,  -9870, -10021,
+        -10172, -10323, -10473, -10622, -10772, -10921, -11069, -11217, -11365, -11512, -11659, -11805,
+        -11951, -12097, -12242, -12386, -12530, -12674, -12817, -12960, -13102, -13243, -13385, -13525,
+        -13665, -13805, -13944, -14083, -14221, -14358, -14495, -14632, -14768, -14903, -15038, -15172,
+        -15306, -15439, -15571, -15703, -15834, -15965, -16095, -16225, -16353, -16482, -16609, -16736,
+        -16863, -16989, -17114, -17238, -17362, -17485, -17608, -17730, -17851, -17971, -18091, -18210,
+        -18329, -18446, -18564, -18680, -18796, -18911, -19025, -19138, -19251, -19363, -19475, -19585,
+        -19695, -19804, -19913, -20020, -20127, -20233, -20339, -20444, -20547, -20650, -20753, -20854,
+        -20955, -21055, -21154, -21252, -21350, -21447, -21543, -21638, -21732, -21826, -21918, -22010,
+        -22101, -22191, -22281, -22369, -22457, -22544, -22630, -22715, -22799, -22883, -22965, -23047,
+        -23128, -23208, -23287, -23365, -23442, -23519, -23594, -23669, -23743, -23816, -23888, -23959,
+        -24029, -24098, -24167, -24234, -24301, -24366, -24431, -24495, -24558, -24620, -24681, -24741,
+        -24800, -24858, -24915, -24972, -25027, -25082, -25135, -25188, -25239, -25290, -25340, -25389,
+        -25436, -25483, -25529, -25574, -25618, -25661, -25703, -25744, -25784, -25824, -25862, -25899,
+        -25935, -25970, -26005, -26038, -26070, -26102, -26132, -26161, -26190, -26217, -26243, -26269,
+        -26293, -26317, -26339, -26361, -26381, -26401, -26419, -26436, -26453, -26468, -26483, -26496,
+        -26509, -26520, -26531, -26540, -26549, -26556, -26563, -26568, -26573, -26576, -26579, -26580,
+        -26581, -26580, -26579, -26576, -26573, -26568, -26563, -26556, -26549, -26540, -26531, -26520,
+        -26509, -26496, -26483, -26468, -26453, -26436, -26419, -26401, -26381, -26361, -26339, -26317,
+        -26293, -26269, -26243, -26217, -26190, -26161, -26132, -26102, -26070, -26038, -26005, -25970,
+        -25935, -25899, -25862, -25824, -25784, -25744, -25703, -25661, -25618, -25574, -25529, -25483,
+        -25436, -25389, -25340, -25290, -25239, -25188, -25135, -25082, -25027, -24972, -24915, -24858,
+        -24800, -24741, -24681, -24620, -24558, -24495, -24431, -24366, -24301, -24234, -24167, -24098,
+        -24029, -23959, -23888, -23816, -23743, -23669, -23594, -23519, -23442, -23365, -23287, -23208,
+        -23128, -23047, -22965, -22883, -22799, -22715, -22630, -22544, -22457, -22369, -22281, -22191,
+        -22101, -22010, -21918, -21826, -21732, -21638, -21543, -21447, -21350, -21252, -21154, -21055,
+        -20955, -20854, -20753, -20650, -20547, -20444, -20339, -20233, -20127, -20020, -19913, -19804,
+        -19695, -19585, -19475, -19363, -19251, -19138, -19025, -18911, -18796, -18680, -18564, -18446,
+        -18329, -18210, -18091, -17971, -17851, -17730, -17608, -17485, -17362, -17238, -17114, -16989,
+        -16863, -16736, -16609, -16482, -16353, -16225, -16095, -15965, -15834, -15703, -15571, -15439,
+        -15306, -15172, -15038, -14903, -14768, -14632, -14495, -14358, -14221, -14083, -13944, -13805,
+        -13665, -13525, -13385, -13243, -13102, -12960, -12817, -12674, -12530, -12386, -12242, -12097,
+        -11951, -11805, -11659, -11512, -11365, -11217, -11069, -10921, -10772, -10622, -10473, -10323,
+        -10172, -10021,  -9870,  -9718,  -9566,  -9414,  -9261,  -9108,  -8955,  -8801,  -8647,  -8493,
+         -8338,  -8183,  -8028,  -7872,  -7716,  -7560,  -7403,  -7247,  -7089,  -6932,  -6775,  -6617,
+         -6459,  -6300,  -6142,  -5983,  -5824,  -5665,  -5505,  -5346,  -5186,  -5026,  -4865,  -4705,
+         -4544,  -4384,  -4223,  -4061,  -3900,  -3739,  -3577,  -3416,  -3254,  -3092,  -2930,  -2768,
+         -2605,  -2443,  -2281,  -2118,  -1955,  -1793,  -1630,  -1467,  -1304,  -1141,   -978,   -815,
+          -652,   -489,   -326,   -163,      0,
+    },
+};
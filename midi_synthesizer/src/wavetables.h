@@ -0,0 +1,23 @@
+// This file is generated by tools/gen_wavetables.py, do not edit it by hand.
+
+#ifndef WAVETABLES_H
+#define WAVETABLES_H
+
+#include <stdint.h>
+
+// Number of samples in one period, must be a power of two.
+#define WAVE_SAMPLES_COUNT      1024
+#define WAVE_SAMPLES_COUNT_LOG2 10
+
+// Band-limited waves have one table per octave. Level L is free of aliasing for
+// phase steps below 2^(WAVE_MIPMAP_FIRST_STEP_LOG2 + L).
+#define WAVE_MIPMAP_LEVELS          10
+#define WAVE_MIPMAP_FIRST_STEP_LOG2 22
+
+// Each table has one extra guard sample equal to the first one.
+extern const int16_t wavetable_sine[WAVE_SAMPLES_COUNT + 1];
+extern const int16_t wavetable_saw[WAVE_MIPMAP_LEVELS][WAVE_SAMPLES_COUNT + 1];
+extern const int16_t wavetable_square[WAVE_MIPMAP_LEVELS][WAVE_SAMPLES_COUNT + 1];
+extern const int16_t wavetable_triangle[WAVE_MIPMAP_LEVELS][WAVE_SAMPLES_COUNT + 1];
+
+#endif
@@ -0,0 +1,417 @@
+/*
+ * Times the EEPROM driver (Lib_EaBaseBoard/src/eeprom.c) against the host 24LC08 emulator
+ * on a PC. It compares a settings save and the settings load at boot with the old driver,
+ * which waited a fixed delay loop after every page and before every read, for a range of
+ * write cycle times. The load, which blocks, is also timed while a write cycle is still
+ * running, as after a reset during a save; it must not take longer than the write cycle on
+ * top of a normal load. It shows what the asynchronous write leaves to the CPU, and checks the
+ * driver: random writes and reads, synchronous and asynchronous, must read back what was
+ * written, and without an EEPROM on the bus every call must fail within the timeout. The
+ * exit status is 1 if any check fails.
+ *
+ * Build from the repository root:
+ *
+ *   gcc -std=gnu99 -ILib_EaBaseBoard/host/inc -ILib_EaBaseBoard/host -ILib_EaBaseBoard/inc \
+ *       -ILib_MCU/inc -Imidi_synthesizer/src midi_synthesizer/tools/eeprom_timing.c \
+ *       midi_synthesizer/src/settings.c Lib_EaBaseBoard/src/eeprom.c \
+ *       Lib_EaBaseBoard/src/i2cbus.c Lib_EaBaseBoard/host/i2c_emu.c \
+ *       Lib_EaBaseBoard/host/eeprom_emu.c -o eeprom_timing
+ *
+ * Usage: eeprom_timing
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lpc17xx_i2c.h"
+#include "i2cbus.h"
+#include "eeprom.h"
+#include "eeprom_emu.h"
+
+#include "settings.h"
+
+// The old driver's delay loops at 100 MHz. A volatile loop iteration is about 8 cycles on
+// the Cortex-M3, this is an estimate, the real delay depends on the compiler flags.
+#define OLD_CPU_HZ              100000000
+#define OLD_CYCLES_PER_LOOP     8
+#define OLD_WRITE_LOOPS         0x20000
+#define OLD_READ_LOOPS          0x2000
+#define OLD_RETRIES             3
+
+// Write cycle times to compare, the 24LC08 data sheet allows up to 5 ms.
+static const uint32_t write_cycles_us[] = {1500, 3000, 5000};
+
+// Random writes and reads checked against a copy of the EEPROM contents.
+#define RANDOM_ROUNDS           2000
+
+// A call without an EEPROM must give up within this time at 100 kHz.
+#define TIMEOUT_MAX_US          30000
+
+static const int16_t defaults[SETTINGS_VALUE_COUNT] = {440, 10, 0, 0, 0};
+
+static uint32_t failures = 0;
+
+// Result passed to async_done(), INT16_MIN while the write is running.
+static int16_t async_result = INT16_MIN;
+
+/**
+ * @brief   Reports a failed check.
+ *
+ * @param   what    Description of the check.
+ *
+ * @return  None
+ */
+static void fail(const char *what) {
+    printf("FAILED: %s\n", what);
+    failures++;
+}
+
+/**
+ * @brief   Converts a loop count of the old driver to microseconds.
+ *
+ * @param   loops   Delay loop iterations.
+ *
+ * @return  Microseconds.
+ */
+static uint32_t loops_to_us(uint32_t loops) {
+    return (uint32_t)(((uint64_t)loops * OLD_CYCLES_PER_LOOP * 1000000U) / OLD_CPU_HZ);
+}
+
+/**
+ * @brief   Polled I2C transfer with the retries of the old driver.
+ *
+ * @return  bool    true on success.
+ */
+static bool old_transfer(uint8_t addr, uint8_t *tx, uint32_t tx_len, uint8_t *rx,
+                         uint32_t rx_len) {
+    I2C_M_SETUP_Type setup;
+
+    setup.sl_addr7bit = addr;
+    setup.tx_data = tx;
+    setup.tx_length = tx_len;
+    setup.rx_data = rx;
+    setup.rx_length = rx_len;
+    setup.retransmissions_max = OLD_RETRIES;
+    return I2C_MasterTransferData(LPC_I2C2, &setup, I2C_TRANSFER_POLLING) == SUCCESS;
+}
+
+/**
+ * @brief   The old eeprom_read(): address write, delay loop, read.
+ *
+ * @return  Number of bytes read, -1 on an error (which the old driver didn't report).
+ */
+static int16_t old_read(uint8_t *buf, uint16_t offset, uint16_t len) {
+    uint8_t addr = (uint8_t)(EEPROM_EMU_I2C_ADDR + (offset / EEPROM_EMU_BLOCK_SIZE));
+    uint8_t off = (uint8_t)(offset % EEPROM_EMU_BLOCK_SIZE);
+    bool ok = old_transfer(addr, &off, 1, NULL, 0);
+
+    eepromEmu_wait(loops_to_us(OLD_READ_LOOPS));
+    ok = old_transfer(addr, NULL, 0, buf, len) && ok;
+    return ok ? (int16_t)len : -1;
+}
+
+/**
+ * @brief   The old eeprom_write(): every page followed by the delay loop.
+ *
+ * @return  Number of bytes written, -1 on an error (which the old driver didn't report).
+ */
+static int16_t old_write(uint8_t *buf, uint16_t offset, uint16_t len) {
+    uint8_t page[EEPROM_EMU_PAGE_SIZE + 1];
+    uint16_t written = 0;
+    bool ok = true;
+
+    while (written < len) {
+        uint16_t at = offset + written;
+        uint16_t size = EEPROM_EMU_PAGE_SIZE - (at % EEPROM_EMU_PAGE_SIZE);
+        if (size > (len - written)) {
+            size = len - written;
+        }
+        page[0] = (uint8_t)(at % EEPROM_EMU_BLOCK_SIZE);
+        memcpy(&page[1], &buf[written], size);
+        ok = old_transfer((uint8_t)(EEPROM_EMU_I2C_ADDR + (at / EEPROM_EMU_BLOCK_SIZE)), page,
+                          size + 1U, NULL, 0) && ok;
+        eepromEmu_wait(loops_to_us(OLD_WRITE_LOOPS));
+        written += size;
+    }
+
+    return ok ? (int16_t)len : -1;
+}
+
+/**
+ * @brief   The old eeprom_write() behind the asynchronous interface the settings use: it
+ *          blocks until the write is done and calls `done` before returning.
+ *
+ * @return  Number of bytes to write.
+ */
+static int16_t old_write_async(uint8_t *buf, uint16_t offset, uint16_t len,
+                               SettingsWriteDone done) {
+    done(old_write(buf, offset, len));
+    return (int16_t)len;
+}
+
+/**
+ * @brief   Completion callback of eeprom_writeAsync().
+ *
+ * @param   result  Number of bytes written or -1.
+ *
+ * @return  None
+ */
+static void async_done(int16_t result) {
+    async_result = result;
+}
+
+/**
+ * @brief   Returns the microseconds since a time stamp of the emulator.
+ *
+ * @param   start   Emulator time in nanoseconds.
+ *
+ * @return  Microseconds.
+ */
+static uint32_t us_since(uint64_t start) {
+    return (uint32_t)((eepromEmu_now() - start) / 1000U);
+}
+
+/**
+ * @brief   Saves the settings once and returns how long the CPU was blocked.
+ *
+ * @param   read    Read function for the settings.
+ * @param   write   Write function for the settings.
+ *
+ * @return  Microseconds, 0 if the save failed.
+ */
+static uint32_t time_save(SettingsReadFunction read, SettingsWriteFunction write) {
+    struct Settings settings;
+
+    (void)settings_init(&settings, read, write, defaults);
+    settings_set(&settings, SETTING_FREQUENCY, 523, 0);
+
+    uint64_t start = eepromEmu_now();
+    if (!settings_save(&settings)) {
+        fail("settings save");
+        return 0;
+    }
+    uint32_t blocked = us_since(start);
+    eepromEmu_run();
+    if ((settings_poll(&settings, 0) != SETTINGS_POLL_SAVED) || settings.dirty) {
+        fail("settings save");
+        return 0;
+    }
+    return blocked;
+}
+
+/**
+ * @brief   Loads the settings as at boot, with a saved record, and returns the time taken.
+ *
+ * @param   read    Read function for the settings.
+ * @param   write   Write function for the settings.
+ * @param   writing true to start the load right after a page write to the first block,
+ *                  while its write cycle runs.
+ *
+ * @return  Microseconds.
+ */
+static uint32_t time_load(SettingsReadFunction read, SettingsWriteFunction write,
+                          bool writing) {
+    struct Settings settings;
+    uint8_t page[2] = {0, 0xA5};
+
+    eepromEmu_wait(EEPROM_EMU_WRITE_US);
+    if (writing && (i2cbus_write(EEPROM_EMU_I2C_ADDR, page, sizeof(page)) != 0)) {
+        fail("page write before the load");
+    }
+    uint64_t start = eepromEmu_now();
+    if (!settings_init(&settings, read, write, defaults) ||
+        (settings_get(&settings, SETTING_FREQUENCY) != 523)) {
+        fail("settings load");
+    }
+    return us_since(start);
+}
+
+/**
+ * @brief   Writes a record with eeprom_writeAsync() and reports what it costs.
+ *
+ * @return  None
+ */
+static void time_async(void) {
+    uint8_t record[SETTINGS_RECORD_SIZE];
+    eeprom_emu_stats_t stats;
+
+    memset(record, 0x5A, sizeof(record));
+    eepromEmu_clearStats();
+    async_result = INT16_MIN;
+
+    uint64_t start = eepromEmu_now();
+    if (eeprom_writeAsync(record, SETTINGS_LOG_OFFSET, sizeof(record), async_done) !=
+        (int16_t)sizeof(record)) {
+        fail("async write not started");
+        return;
+    }
+    uint32_t blocked = us_since(start);
+    eepromEmu_run();
+    eepromEmu_getStats(&stats);
+
+    printf("  async:  %5u us blocked, done after %5u us, %u I2C interrupts\n",
+           (unsigned)blocked, (unsigned)us_since(start), (unsigned)stats.interrupts);
+    if (async_result != (int16_t)sizeof(record) || eeprom_isBusy()) {
+        fail("async write not completed");
+    }
+}
+
+/**
+ * @brief   Random writes and reads, synchronous and asynchronous, against a copy.
+ *
+ * @return  None
+ */
+static void check_random(void) {
+    static uint8_t copy[EEPROM_EMU_SIZE];
+    static uint8_t buf[EEPROM_EMU_SIZE];
+
+    eepromEmu_reset();
+    memset(copy, 0xFF, sizeof(copy));
+    srand(1);
+
+    for (uint32_t round = 0; round < RANDOM_ROUNDS; round++) {
+        uint16_t offset = (uint16_t)(rand() % EEPROM_EMU_SIZE);
+        uint16_t len = (uint16_t)(rand() % (EEPROM_EMU_SIZE - offset + 1));
+        if ((rand() % 4) != 0) {
+            len = len % 64U;
+        }
+
+        switch (rand() % 3) {
+        case 0:
+            for (uint16_t i = 0; i < len; i++) {
+                buf[i] = (uint8_t)rand();
+            }
+            if (eeprom_write(buf, offset, len) != (int16_t)len) {
+                fail("write");
+            }
+            memcpy(&copy[offset], buf, len);
+            break;
+        case 1:
+            for (uint16_t i = 0; i < len; i++) {
+                buf[i] = (uint8_t)rand();
+            }
+            async_result = INT16_MIN;
+            if (eeprom_writeAsync(buf, offset, len, async_done) != (int16_t)len) {
+                fail("async write not started");
+            }
+            eepromEmu_run();
+            if ((len != 0U) && (async_result != (int16_t)len)) {
+                fail("async write");
+            }
+            memcpy(&copy[offset], buf, len);
+            break;
+        default:
+            if ((eeprom_read(buf, offset, len) != (int16_t)len) ||
+                (memcmp(buf, &copy[offset], len) != 0)) {
+                printf("  read of %u bytes at %u\n", (unsigned)len, (unsigned)offset);
+                fail("read back");
+            }
+            break;
+        }
+
+        // Sometimes the next call comes while the write cycle is still running.
+        eepromEmu_wait((uint32_t)(rand() % 8000));
+    }
+
+    if (memcmp(eepromEmu_getMemory(), copy, sizeof(copy)) != 0) {
+        fail("EEPROM contents");
+    }
+}
+
+/**
+ * @brief   Without an EEPROM every call must fail, and not take longer than the timeout.
+ *
+ * @return  None
+ */
+static void check_timeout(void) {
+    uint8_t buf[EEPROM_EMU_PAGE_SIZE] = {0};
+    uint64_t start;
+
+    eepromEmu_reset();
+    eepromEmu_setPresent(0);
+
+    start = eepromEmu_now();
+    if (eeprom_write(buf, 0, sizeof(buf)) != -1) {
+        fail("write without EEPROM");
+    }
+    printf("no EEPROM:         write fails after %5u us\n", (unsigned)us_since(start));
+    if (us_since(start) > TIMEOUT_MAX_US) {
+        fail("write timeout");
+    }
+
+    start = eepromEmu_now();
+    if (eeprom_read(buf, 0, sizeof(buf)) != -1) {
+        fail("read without EEPROM");
+    }
+    if (us_since(start) > TIMEOUT_MAX_US) {
+        fail("read timeout");
+    }
+
+    async_result = INT16_MIN;
+    start = eepromEmu_now();
+    (void)eeprom_writeAsync(buf, 0, sizeof(buf), async_done);
+    eepromEmu_run();
+    if ((async_result != -1) || eeprom_isBusy()) {
+        fail("async write without EEPROM");
+    }
+    if (us_since(start) > TIMEOUT_MAX_US) {
+        fail("async write timeout");
+    }
+}
+
+int main(void) {
+    static uint8_t all[EEPROM_EMU_SIZE];
+    eeprom_emu_stats_t stats;
+
+    printf("old delay loops at %u MHz: %u us after each page, %u us before each read\n",
+           (unsigned)(OLD_CPU_HZ / 1000000), (unsigned)loops_to_us(OLD_WRITE_LOOPS),
+           (unsigned)loops_to_us(OLD_READ_LOOPS));
+
+    for (uint32_t i = 0; i < (sizeof(write_cycles_us) / sizeof(write_cycles_us[0])); i++) {
+        uint32_t old_save, new_save, old_load, new_load, busy_load;
+
+        eepromEmu_reset();
+        eepromEmu_setWriteCycle(write_cycles_us[i]);
+        old_save = time_save(old_read, old_write_async);
+        old_load = time_load(old_read, old_write_async, false);
+
+        eepromEmu_reset();
+        eepromEmu_setWriteCycle(write_cycles_us[i]);
+        new_save = time_save(eeprom_read, eeprom_writeAsync);
+        new_load = time_load(eeprom_read, eeprom_writeAsync, false);
+        busy_load = time_load(eeprom_read, eeprom_writeAsync, true);
+
+        printf("write cycle %4u us, 100 kHz:\n", (unsigned)write_cycles_us[i]);
+        printf("  settings save:  old %6u us, new %6u us\n", (unsigned)old_save,
+               (unsigned)new_save);
+        printf("  settings load:  old %6u us, new %6u us, %6u us during a write cycle\n",
+               (unsigned)old_load, (unsigned)new_load, (unsigned)busy_load);
+        if (busy_load > (new_load + write_cycles_us[i])) {
+            fail("load during a write cycle waits longer than the write cycle");
+        }
+        time_async();
+    }
+
+    // The whole EEPROM in one call: a single transaction per 256 byte block.
+    eepromEmu_reset();
+    uint64_t start = eepromEmu_now();
+    if (eeprom_read(all, 0, sizeof(all)) != (int16_t)sizeof(all)) {
+        fail("1 KiB read");
+    }
+    eepromEmu_getStats(&stats);
+    printf("1 KiB read:        %u transactions, %u us\n", (unsigned)stats.transfers,
+           (unsigned)us_since(start));
+
+    check_random();
+    check_timeout();
+
+    if (failures != 0U) {
+        printf("%u checks failed\n", (unsigned)failures);
+        return 1;
+    }
+    printf("all checks passed\n");
+    return 0;
+}
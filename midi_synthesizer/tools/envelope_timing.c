@@ -0,0 +1,349 @@
+/*
+ * Checks the timing of the ADSR envelope (midi_synthesizer/src/envelope.c) on a PC and
+ * measures what the envelopes cost in the render path. For every whole millisecond from 0
+ * to ENV_TIME_MAX_MS the attack must reach full scale, and the decay to silence and the
+ * release from full scale must fall by 60 dB, in exactly the number of blocks the time
+ * rounds to (2 ms each at 32 kHz, at least one). Longer times must be clamped. The shape
+ * is checked too: the attack only rises, decay and release only fall, sustain holds its
+ * level, a retrigger continues from the current level and a gate off on a silent envelope
+ * leaves it silent. The exit status is 1 if any check fails.
+ *
+ * Then 16 MIDI voices of all four waves are rendered with notes restarted and released all
+ * the time, so every envelope stage is in use, and the time per voice per block is
+ * reported, both for env_next_block() alone and for the whole of synth_render_block().
+ * The times are those of the PC, they only compare changes to the render loop.
+ *
+ * Build from the repository root:
+ *
+ *   gcc -O2 -std=gnu99 -Imidi_synthesizer/src midi_synthesizer/tools/envelope_timing.c \
+ *       midi_synthesizer/src/synth.c midi_synthesizer/src/oscillator.c \
+ *       midi_synthesizer/src/wavetables.c midi_synthesizer/src/voice_alloc.c \
+ *       midi_synthesizer/src/envelope.c midi_synthesizer/src/ramp.c -o envelope_timing
+ *
+ * Usage: envelope_timing
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "audio.h"
+#include "envelope.h"
+#include "synth.h"
+
+// -60 dB of full scale, where decay and release times are measured to.
+#define SILENCE_LEVEL           (ENV_LEVEL_MAX / 1000UL)
+
+// Blocks per measurement, the fastest of BENCH_RUNS measurements is reported.
+#define BENCH_BLOCKS            100000U
+#define BENCH_RUNS              5
+#define BENCH_VOICES            16U
+
+// Blocks between note changes while rendering: with 16 voices, each note is held for 16
+// blocks and released for another 16, so every stage is in use.
+#define NOTE_CHANGE_BLOCKS      2U
+
+static uint32_t failures = 0;
+
+// Keeps the compiler from dropping the results.
+static volatile uint32_t sink;
+
+/**
+ * @brief   Reports a failed check.
+ *
+ * @param   what    Description of the check.
+ *
+ * @return  None
+ */
+static void fail(const char *what) {
+    printf("FAILED: %s\n", what);
+    failures++;
+}
+
+/**
+ * @brief   Returns the time of a monotonic clock.
+ *
+ * @return  Time in seconds.
+ */
+static double now_seconds(void) {
+    struct timespec time;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &time);
+    return (double)time.tv_sec + ((double)time.tv_nsec * 1e-9);
+}
+
+/**
+ * @brief   Number of blocks a segment time should take.
+ *
+ * @param   time_ms     Time in milliseconds, at most ENV_TIME_MAX_MS.
+ *
+ * @return  Blocks, rounded to the nearest and at least one.
+ */
+static uint32_t expected_blocks(uint32_t time_ms) {
+    double blocks = ((double)time_ms * AUDIO_SAMPLE_RATE) / (1000.0 * AUDIO_BLOCK_SIZE);
+    uint32_t rounded = (uint32_t)(blocks + 0.5);
+
+    return (rounded == 0U) ? 1U : rounded;
+}
+
+/**
+ * @brief   Runs the envelope until it leaves a stage, checking the direction of the level.
+ *
+ * @param   env     Pointer to the envelope, in the stage to measure.
+ * @param   params  Segment rates.
+ * @param   rising  true if the level may only rise, false if it may only fall.
+ * @param   ok      Cleared if the level moves the wrong way.
+ *
+ * @return  Blocks until the stage changed, counting the block that changed it.
+ */
+static uint32_t stage_blocks(struct Envelope *env, const struct EnvelopeParams *params,
+                             bool rising, bool *ok) {
+    enum EnvelopeStage stage = env->stage;
+    uint32_t last = env->level;
+    uint32_t blocks = 0;
+
+    // Twice the longest segment, so a stuck envelope is caught.
+    while ((env->stage == stage) && (blocks <= (2U * expected_blocks(ENV_TIME_MAX_MS)))) {
+        uint32_t level = env_next_block(env, params);
+        if ((rising && (level < last)) || (!rising && (level > last))) {
+            *ok = false;
+        }
+        last = level;
+        blocks++;
+    }
+
+    return blocks;
+}
+
+/**
+ * @brief   Measures attack, decay and release for one segment time.
+ *
+ * @param   time_ms     Time in milliseconds.
+ * @param   attack      Blocks the attack took.
+ * @param   decay       Blocks the decay to silence took.
+ * @param   release     Blocks the release from full scale took.
+ *
+ * @return  true if the levels moved the right way and ended where they should.
+ */
+static bool measure_segments(uint32_t time_ms, uint32_t *attack, uint32_t *decay,
+                             uint32_t *release) {
+    struct EnvelopeParams params;
+    struct Envelope env;
+    bool ok = true;
+
+    env_set_params(&params, time_ms, 0, ENV_SUSTAIN_MAX, 0);
+    env_init(&env);
+    env_gate_on(&env);
+    *attack = stage_blocks(&env, &params, true, &ok);
+    ok = ok && (env.level == ENV_LEVEL_MAX) && (env.stage == ENV_STAGE_DECAY);
+
+    // Sustain at zero, so the decay falls from full scale to silence.
+    env_set_params(&params, 0, time_ms, 0, 0);
+    env_init(&env);
+    env_gate_on(&env);
+    (void)env_next_block(&env, &params);
+    *decay = stage_blocks(&env, &params, false, &ok);
+    ok = ok && (env.level == 0U) && (env.stage == ENV_STAGE_SUSTAIN);
+
+    // Sustain at full scale, so the release starts from there.
+    env_set_params(&params, 0, 0, ENV_SUSTAIN_MAX, time_ms);
+    env_init(&env);
+    env_gate_on(&env);
+    (void)env_next_block(&env, &params);
+    (void)env_next_block(&env, &params);
+    ok = ok && (env.level == ENV_LEVEL_MAX) && (env.stage == ENV_STAGE_SUSTAIN);
+    env_gate_off(&env);
+    *release = stage_blocks(&env, &params, false, &ok);
+    ok = ok && (env.level == 0U) && env_is_idle(&env);
+
+    return ok;
+}
+
+/**
+ * @brief   Segment times for every whole millisecond, and the clamp of longer ones.
+ *
+ * @return  None
+ */
+static void check_times(void) {
+    uint32_t attack;
+    uint32_t decay;
+    uint32_t release;
+    uint32_t wrong = 0;
+    bool shape = true;
+
+    for (uint32_t ms = 0; ms <= (uint32_t)ENV_TIME_MAX_MS; ms++) {
+        uint32_t expected = expected_blocks(ms);
+        shape = measure_segments(ms, &attack, &decay, &release) && shape;
+        if ((attack != expected) || (decay != expected) || (release != expected)) {
+            if (wrong < 5U) {
+                printf("  %u ms: attack %u, decay %u, release %u blocks (expected %u)\n",
+                       (unsigned)ms, (unsigned)attack, (unsigned)decay, (unsigned)release,
+                       (unsigned)expected);
+            }
+            wrong++;
+        }
+    }
+
+    printf("segment times 0 - %u ms: %u of %u off the expected block\n",
+           (unsigned)ENV_TIME_MAX_MS, (unsigned)wrong, (unsigned)(ENV_TIME_MAX_MS + 1));
+    if (wrong != 0U) {
+        fail("segment times");
+    }
+    if (!shape) {
+        fail("levels move the right way and end at their target");
+    }
+
+    uint32_t expected = expected_blocks(ENV_TIME_MAX_MS);
+    (void)measure_segments(3U * ENV_TIME_MAX_MS, &attack, &decay, &release);
+    if ((attack != expected) || (decay != expected) || (release != expected)) {
+        fail("times above ENV_TIME_MAX_MS clamped");
+    }
+}
+
+/**
+ * @brief   Sustain, retrigger and gate off of a silent envelope.
+ *
+ * @return  None
+ */
+static void check_gates(void) {
+    struct EnvelopeParams params;
+    struct Envelope env;
+    bool ok = true;
+
+    env_set_params(&params, 10, 20, 128, 100);
+    env_init(&env);
+
+    env_gate_off(&env);
+    ok = (env_next_block(&env, &params) == 0U) && env_is_idle(&env) && ok;
+
+    env_gate_on(&env);
+    for (uint32_t b = 0; b < 100U; b++) {
+        (void)env_next_block(&env, &params);
+    }
+    ok = (env.stage == ENV_STAGE_SUSTAIN) && (env.level == (ENV_LEVEL_MAX / 2U)) && ok;
+    ok = (env_next_block(&env, &params) == (ENV_LEVEL_MAX / 2U)) && ok;
+
+    // Sustain follows a change of the parameters.
+    env_set_params(&params, 10, 20, 64, 100);
+    ok = (env_next_block(&env, &params) == (ENV_LEVEL_MAX / 4U)) && ok;
+
+    // Retrigger during the release: the attack continues from the current level.
+    env_gate_off(&env);
+    (void)env_next_block(&env, &params);
+    uint32_t released = env_next_block(&env, &params);
+    env_gate_on(&env);
+    uint32_t retriggered = env_next_block(&env, &params);
+    ok = (released > SILENCE_LEVEL) && (retriggered > released) &&
+         ((retriggered - released) == params.attack_step) && ok;
+
+    if (!ok) {
+        fail("sustain, retrigger and gate off when silent");
+    }
+}
+
+/**
+ * @brief   Sends a MIDI message to the synth.
+ *
+ * @return  None
+ */
+static void send_midi(uint8_t status, uint8_t data1, uint8_t data2) {
+    struct MidiEvent event = {status, data1, data2, 2};
+
+    synth_handle_midi_event(&event);
+}
+
+/**
+ * @brief   Measures env_next_block() alone, with voices in every stage.
+ *
+ * @return  Nanoseconds per voice per block.
+ */
+static double measure_envelopes(void) {
+    struct EnvelopeParams params;
+    struct Envelope envs[BENCH_VOICES];
+    double best = 0.0;
+
+    env_set_params(&params, 5, 300, 192, 200);
+
+    for (int run = 0; run < BENCH_RUNS; run++) {
+        for (uint32_t v = 0; v < BENCH_VOICES; v++) {
+            env_init(&envs[v]);
+        }
+
+        double start = now_seconds();
+        for (uint32_t b = 0; b < BENCH_BLOCKS; b++) {
+            // Same pattern of gates as the render measurement.
+            if ((b % NOTE_CHANGE_BLOCKS) == 0U) {
+                uint32_t v = (b / NOTE_CHANGE_BLOCKS) % BENCH_VOICES;
+                env_gate_on(&envs[v]);
+                env_gate_off(&envs[(v + (BENCH_VOICES / 2U)) % BENCH_VOICES]);
+            }
+            for (uint32_t v = 0; v < BENCH_VOICES; v++) {
+                sink += env_next_block(&envs[v], &params);
+            }
+        }
+        double time = (now_seconds() - start) * 1e9 / ((double)BENCH_BLOCKS * BENCH_VOICES);
+        if ((run == 0) || (time < best)) {
+            best = time;
+        }
+    }
+
+    return best;
+}
+
+/**
+ * @brief   Measures synth_render_block() with 16 voices of all four waves.
+ *
+ * @note    A new note starts on every NOTE_CHANGE_BLOCKS blocks and the one started half
+ *          a round before is released, so there are always 16 voices, half of them held
+ *          and half of them releasing.
+ *
+ * @return  Nanoseconds per voice per block.
+ */
+static double measure_render(void) {
+    uint32_t buffer[AUDIO_BLOCK_SIZE];
+    double best = 0.0;
+
+    for (int run = 0; run < BENCH_RUNS; run++) {
+        synth_init();
+        for (uint8_t channel = 0; channel < (uint8_t)SYNTH_WAVE_COUNT; channel++) {
+            send_midi((uint8_t)(MIDI_STATUS_PROGRAM_CHANGE | channel), channel, 0);
+        }
+
+        double start = now_seconds();
+        for (uint32_t b = 0; b < BENCH_BLOCKS; b++) {
+            if ((b % NOTE_CHANGE_BLOCKS) == 0U) {
+                uint32_t v = (b / NOTE_CHANGE_BLOCKS) % BENCH_VOICES;
+                uint32_t off = (v + (BENCH_VOICES / 2U)) % BENCH_VOICES;
+                send_midi((uint8_t)(MIDI_STATUS_NOTE_ON | (v % SYNTH_WAVE_COUNT)),
+                          (uint8_t)(36U + (v * 3U)), 100);
+                send_midi((uint8_t)(MIDI_STATUS_NOTE_ON | (off % SYNTH_WAVE_COUNT)),
+                          (uint8_t)(36U + (off * 3U)), 0);
+            }
+            synth_render_block(buffer, AUDIO_BLOCK_SIZE);
+            sink += buffer[b % AUDIO_BLOCK_SIZE];
+        }
+        double time = (now_seconds() - start) * 1e9 / ((double)BENCH_BLOCKS * BENCH_VOICES);
+        if ((run == 0) || (time < best)) {
+            best = time;
+        }
+    }
+
+    return best;
+}
+
+int main(void) {
+    check_times();
+    check_gates();
+
+    printf("16 voices, ns per voice per block:\n");
+    printf("  %-28s %8.1f\n", "env_next_block():", measure_envelopes());
+    printf("  %-28s %8.1f\n", "synth_render_block(), mixed:", measure_render());
+
+    if (failures != 0U) {
+        printf("%u checks failed\n", (unsigned)failures);
+        return 1;
+    }
+    printf("all checks passed\n");
+    return 0;
+}
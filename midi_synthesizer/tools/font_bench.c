@@ -0,0 +1,288 @@
+/*
+ * Compares text drawing in the OLED driver with the per-pixel path it replaced, on a PC with
+ * the OLED emulator from Lib_EaBaseBoard/host. The per-pixel path is the old drawChar() of
+ * Lib_EaBaseBoard/src/oled.c, kept here as it was: every row of a font5x7 glyph is drawn
+ * pixel by pixel with oled_putPixel(). The driver now writes whole columns from
+ * font5x7_columns into the framebuffer.
+ *
+ * First, random characters, colors and positions mixed with lines are drawn with both
+ * paths and flushed, and the display memory must end up the same. The positions are the
+ * ones the old bounds check accepted. Then putString() is timed with both paths, with y
+ * alternating between a page boundary (8) and the middle of a page (10). Nothing is
+ * flushed while timing, so only the drawing is measured, in characters per second. The
+ * best of several runs is reported. The exit status is 1 if the pictures differ.
+ *
+ * The rates are those of the PC, they only compare the two paths.
+ *
+ * Build from the repository root:
+ *
+ *   gcc -O2 -no-pie -std=gnu99 -ILib_EaBaseBoard/host/inc -ILib_EaBaseBoard/host \
+ *       -ILib_EaBaseBoard/inc -ILib_MCU/inc \
+ *       midi_synthesizer/tools/font_bench.c Lib_EaBaseBoard/src/oled.c \
+ *       Lib_EaBaseBoard/src/font5x7.c Lib_EaBaseBoard/host/oled_emu.c \
+ *       Lib_EaBaseBoard/host/i2c_emu.c -o font_bench
+ *
+ * Usage: font_bench
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "font5x7.h"
+#include "oled.h"
+#include "oled_emu.h"
+
+// Characters of the picture check, with a line after every CHECK_LINE_EVERY of them.
+#define CHECK_CHARS             3000U
+#define CHECK_LINE_EVERY        7U
+
+// Strings per measurement, the fastest of BENCH_RUNS measurements is reported.
+#define BENCH_STRINGS           400000U
+#define BENCH_RUNS              7
+
+// Last positions the old bounds check accepted.
+#define OLD_X_MAX               (OLED_DISPLAY_WIDTH - 9)
+#define OLD_Y_MAX               (OLED_DISPLAY_HEIGHT - 9)
+
+#define GLYPH_ROWS              8
+
+enum Path {
+    PATH_PIXELS,
+    PATH_COLUMNS,
+};
+
+struct Op {
+    bool line;
+    uint8_t x0;
+    uint8_t y0;
+    uint8_t x1;             // Character for a glyph.
+    uint8_t y1;
+    oled_color_t fg;
+    oled_color_t bg;
+};
+
+static uint32_t failures = 0;
+
+static struct Op ops[CHECK_CHARS + (CHECK_CHARS / CHECK_LINE_EVERY)];
+static uint32_t op_count;
+
+// 15 characters, a menu line.
+static uint8_t bench_text[] = "Frequency 12345";
+
+static uint8_t first_picture[OLED_EMU_COLUMNS * OLED_EMU_PAGES];
+
+/**
+ * @brief   Reports a failed check.
+ *
+ * @param   what    Description of the check.
+ *
+ * @return  None
+ */
+static void fail(const char *what) {
+    printf("FAILED: %s\n", what);
+    failures++;
+}
+
+/**
+ * @brief   Returns the time of a monotonic clock.
+ *
+ * @return  Time in seconds.
+ */
+static double now_seconds(void) {
+    struct timespec time;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &time);
+    return (double)time.tv_sec + ((double)time.tv_nsec * 1e-9);
+}
+
+/**
+ * @brief   Returns a pseudo-random number.
+ *
+ * @param   range   Upper bound, excluded.
+ *
+ * @return  Number from 0 to range - 1.
+ */
+static uint32_t random_below(uint32_t range) {
+    static uint32_t seed = 1;
+
+    seed = (seed * 1103515245U) + 12345U;
+    return (seed >> 8) % range;
+}
+
+/**
+ * @brief   The old drawChar(): every glyph row pixel by pixel.
+ *
+ * @return  1 if the character was drawn, 0 if it doesn't fit on the display.
+ */
+static uint8_t pixel_draw_char(uint8_t x, uint8_t y, uint8_t ch, oled_color_t fg,
+                               oled_color_t bg) {
+    if ((x >= (OLED_DISPLAY_WIDTH - 8)) || (y >= (OLED_DISPLAY_HEIGHT - 8))) {
+        return 0;
+    }
+    if ((ch < 0x20U) || (ch > 0x7FU)) {
+        ch = 0x20;
+    }
+
+    for (uint8_t row = 0; row < (uint8_t)GLYPH_ROWS; row++) {
+        uint8_t bits = font5x7[ch - 0x20U][row];
+        for (uint8_t col = 0; col < (uint8_t)FONT5X7_COLUMNS; col++) {
+            oled_putPixel((uint8_t)(x + col), (uint8_t)(y + row),
+                          ((bits & (0x80U >> col)) != 0U) ? fg : bg);
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief   The old oled_putString() on top of pixel_draw_char().
+ *
+ * @return  None
+ */
+static void pixel_put_string(uint8_t x, uint8_t y, const uint8_t *text, oled_color_t fg,
+                             oled_color_t bg) {
+    for (const uint8_t *c = text; *c != '\0'; c++) {
+        if (pixel_draw_char(x, y, *c, fg, bg) == 0U) {
+            return;
+        }
+        x = (uint8_t)(x + FONT5X7_COLUMNS);
+    }
+}
+
+/**
+ * @brief   Returns a random color.
+ *
+ * @return  OLED_COLOR_BLACK or OLED_COLOR_WHITE.
+ */
+static oled_color_t random_color(void) {
+    return (random_below(2) == 0U) ? OLED_COLOR_BLACK : OLED_COLOR_WHITE;
+}
+
+/**
+ * @brief   Fills `ops` with random characters, also outside of the font, and lines.
+ *
+ * @return  None
+ */
+static void fill_ops(void) {
+    op_count = 0;
+    for (uint32_t i = 0; i < CHECK_CHARS; i++) {
+        struct Op *op = &ops[op_count++];
+        op->line = false;
+        op->x0 = (uint8_t)random_below(OLD_X_MAX + 1);
+        op->y0 = (uint8_t)random_below(OLD_Y_MAX + 1);
+        op->x1 = (uint8_t)random_below(0x90);
+        op->y1 = 0;
+        op->fg = random_color();
+        op->bg = random_color();
+
+        if ((i % CHECK_LINE_EVERY) == (CHECK_LINE_EVERY - 1U)) {
+            op = &ops[op_count++];
+            op->line = true;
+            op->x0 = (uint8_t)random_below(OLED_DISPLAY_WIDTH);
+            op->y0 = (uint8_t)random_below(OLED_DISPLAY_HEIGHT);
+            op->x1 = (uint8_t)random_below(OLED_DISPLAY_WIDTH);
+            op->y1 = (uint8_t)random_below(OLED_DISPLAY_HEIGHT);
+            op->fg = random_color();
+            op->bg = op->fg;
+        }
+    }
+}
+
+/**
+ * @brief   Draws all of `ops` on a black screen with one path and flushes them.
+ *
+ * @param   path    Path for the characters.
+ *
+ * @return  None
+ */
+static void draw_ops(enum Path path) {
+    oledEmu_reset();
+    oled_init();
+    oled_setAutoFlush(0);
+    oled_clearScreen(OLED_COLOR_BLACK);
+
+    for (uint32_t i = 0; i < op_count; i++) {
+        const struct Op *op = &ops[i];
+        if (op->line) {
+            oled_line(op->x0, op->y0, op->x1, op->y1, op->fg);
+        } else if (path == PATH_PIXELS) {
+            (void)pixel_draw_char(op->x0, op->y0, op->x1, op->fg, op->bg);
+        } else {
+            (void)oled_putChar(op->x0, op->y0, op->x1, op->fg, op->bg);
+        }
+    }
+    oled_flush();
+}
+
+/**
+ * @brief   Both paths give the same display memory.
+ *
+ * @return  None
+ */
+static void check_pictures(void) {
+    fill_ops();
+
+    draw_ops(PATH_PIXELS);
+    memcpy(first_picture, oledEmu_getGddram(), sizeof(first_picture));
+    draw_ops(PATH_COLUMNS);
+    bool same = (memcmp(first_picture, oledEmu_getGddram(), sizeof(first_picture)) == 0);
+
+    printf("%u random characters and %u lines: display memory %s\n", (unsigned)CHECK_CHARS,
+           (unsigned)(op_count - CHECK_CHARS), same ? "identical" : "DIFFERS");
+    if (!same) {
+        fail("same picture with both paths");
+    }
+}
+
+/**
+ * @brief   Measures putString() with one path.
+ *
+ * @param   path    Path for the characters.
+ *
+ * @return  Characters per second.
+ */
+static double measure(enum Path path) {
+    uint32_t chars = BENCH_STRINGS * (uint32_t)(sizeof(bench_text) - 1U);
+    double best = 0.0;
+
+    oledEmu_reset();
+    oled_init();
+    oled_setAutoFlush(0);
+
+    for (int run = 0; run < BENCH_RUNS; run++) {
+        double start = now_seconds();
+        for (uint32_t i = 0; i < BENCH_STRINGS; i++) {
+            uint8_t y = ((i & 1U) == 0U) ? 8U : 10U;
+            oled_color_t fg = ((i & 2U) == 0U) ? OLED_COLOR_WHITE : OLED_COLOR_BLACK;
+            oled_color_t bg = (fg == OLED_COLOR_WHITE) ? OLED_COLOR_BLACK : OLED_COLOR_WHITE;
+            if (path == PATH_PIXELS) {
+                pixel_put_string(0, y, bench_text, fg, bg);
+            } else {
+                oled_putString(0, y, bench_text, fg, bg);
+            }
+        }
+        double rate = (double)chars / (now_seconds() - start);
+        if (rate > best) {
+            best = rate;
+        }
+    }
+
+    return best;
+}
+
+int main(void) {
+    check_pictures();
+
+    printf("putString, y alternating 8 / 10:\n");
+    printf("  %-16s %8.1f M chars/s\n", "per-pixel path", measure(PATH_PIXELS) / 1e6);
+    printf("  %-16s %8.1f M chars/s\n", "column blitter", measure(PATH_COLUMNS) / 1e6);
+
+    if (failures != 0U) {
+        printf("%u checks failed\n", (unsigned)failures);
+        return 1;
+    }
+    printf("all checks passed\n");
+    return 0;
+}
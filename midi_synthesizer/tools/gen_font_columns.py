@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+"""Generates font5x7_columns in Lib_EaBaseBoard/src/font5x7.c from the font5x7 table.
+
+font5x7 is drawn by hand, one row of 8 pixels per line with X for a set pixel. The OLED
+driver blits glyphs a column at a time, so font5x7_columns holds the same glyphs in the
+SSD1305 memory layout: one byte per column with the top row in bit 0. Only the
+FONT5X7_COLUMNS columns that are drawn are kept.
+
+The table and the comment above it are replaced in place, everything else in the file is
+left as it is. Run it again after changing a glyph.
+
+Usage: gen_font_columns.py <font5x7.c>
+"""
+
+import re
+import sys
+
+# Has to match FONT5X7_COLUMNS in font5x7.h.
+FONT5X7_COLUMNS = 6
+FONT_ROWS = 8
+FIRST_CHAR = 0x20
+
+NEWLINE = "\r\n"
+
+COMMENT = """/*
+ * The same glyphs rotated to the SSD1305 memory layout, one byte per
+ * column with the top row in bit 0. Generated from font5x7 above by
+ * midi_synthesizer/tools/gen_font_columns.py: bit r of column c is set
+ * when row r has pixel c set. Only the 6 columns that are drawn are kept.
+ */
+"""
+
+GLYPH = re.compile(r"\{([^{}]*)\}")
+ROW = re.compile(r"[X_]{8}")
+EMPTY_ROW = "_" * 8
+
+
+def read_glyphs(source):
+    """Returns the glyphs of font5x7 as lists of FONT_ROWS strings of X and _.
+
+    A glyph with fewer rows is padded with empty ones, as the C compiler does.
+    """
+    start = source.index("{", source.index("const unsigned char font5x7[][8] ="))
+    end = source.index("};", start)
+    glyphs = []
+    for body in GLYPH.findall(source, start + 1, end):
+        rows = ROW.findall(body)
+        if len(rows) > FONT_ROWS:
+            sys.exit("glyph %d of font5x7 has %d rows" % (len(glyphs), len(rows)))
+        glyphs.append(rows + [EMPTY_ROW] * (FONT_ROWS - len(rows)))
+    return glyphs
+
+
+def glyph_columns(glyph):
+    """Column bytes of a glyph, bit r is row r."""
+    columns = []
+    for c in range(FONT5X7_COLUMNS):
+        value = 0
+        for r, row in enumerate(glyph):
+            if row[c] == "X":
+                value |= 1 << r
+        columns.append(value)
+    return columns
+
+
+def char_name(code):
+    """Name of a character in the comment of its row."""
+    if code == 0x20:
+        return "space"
+    # Characters that could end the comment or read as a line continuation.
+    if code >= 0x7E or chr(code) in "*/\\":
+        return "0x%02x" % code
+    return chr(code)
+
+
+def columns_table(glyphs):
+    lines = [COMMENT + "const unsigned char font5x7_columns[][FONT5X7_COLUMNS] =", "{"]
+    for i, glyph in enumerate(glyphs):
+        values = ", ".join("0x%02x" % v for v in glyph_columns(glyph))
+        separator = "," if i < len(glyphs) - 1 else " "
+        lines.append("  {%s}%s /* %s */" % (values, separator, char_name(FIRST_CHAR + i)))
+    lines.append("};")
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit(__doc__)
+
+    path = sys.argv[1]
+    with open(path, newline="") as f:
+        source = f.read().replace(NEWLINE, "\n")
+
+    start = source.index(COMMENT.splitlines()[0] + "\n * The same glyphs rotated")
+    end = source.index("};", source.index("const unsigned char font5x7_columns")) + len("};\n")
+    source = source[:start] + columns_table(read_glyphs(source)) + source[end:]
+
+    with open(path, "w", newline="") as f:
+        f.write(source.replace("\n", NEWLINE))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+"""Generates wavetables.c and wavetables.h with const, flash-resident wavetables.
+
+Every table holds one period of the wave as signed Q15 samples, followed by a guard
+sample equal to the first one, so oscillators can interpolate between `index` and
+`index + 1` without wrapping.
+
+Saw, square and triangle are band-limited: they are summed from their harmonic series
+once per octave (mipmap level), keeping only harmonics below Nyquist for the highest
+fundamental of that octave. Level L is meant for phase steps below
+2^(WAVE_MIPMAP_FIRST_STEP_LOG2 + L), the last level is used for anything above.
+
+Usage: gen_wavetables.py <output directory>
+"""
+
+import math
+import os
+import sys
+
+WAVE_SAMPLES_COUNT = 1024
+Q15_MAX = 32767
+
+# Has to match AUDIO_SAMPLE_RATE in audio.h.
+SAMPLE_RATE = 32000
+WAVE_MIPMAP_LEVELS = 10
+WAVE_MIPMAP_FIRST_STEP_LOG2 = 22
+
+HEADER = "// This file is generated by tools/gen_wavetables.py, do not edit it by hand.\n"
+
+
+SINE = [math.sin(2.0 * math.pi * i / WAVE_SAMPLES_COUNT) for i in range(WAVE_SAMPLES_COUNT)]
+
+
+# Amplitudes of harmonics of the naive waves, scaled so the waves span -1 to 1.
+def saw_harmonic(h):
+    # Rising ramp from -1 to 1.
+    return -2.0 / (math.pi * h)
+
+
+def square_harmonic(h):
+    # 1 in the first half of the period, -1 in the second one.
+    return 4.0 / (math.pi * h) if h % 2 == 1 else 0.0
+
+
+def triangle_harmonic(h):
+    # Starts at 0 and rises to 1 at a quarter of the period.
+    if h % 2 == 0:
+        return 0.0
+    sign = 1.0 if (h // 2) % 2 == 0 else -1.0
+    return sign * 8.0 / ((math.pi * h) ** 2)
+
+
+BAND_LIMITED_WAVES = [
+    ("saw", saw_harmonic),
+    ("square", square_harmonic),
+    ("triangle", triangle_harmonic),
+]
+
+
+def level_harmonics(level):
+    """Number of harmonics that stay below Nyquist for every fundamental of the level."""
+    max_step = 2 ** (WAVE_MIPMAP_FIRST_STEP_LOG2 + level)
+    max_frequency = max_step * SAMPLE_RATE / 2.0 ** 32
+    # The table itself can't hold more than WAVE_SAMPLES_COUNT / 2 - 1 harmonics.
+    return max(1, min(int((SAMPLE_RATE / 2.0) / max_frequency), (WAVE_SAMPLES_COUNT // 2) - 1))
+
+
+def band_limited_levels(harmonic):
+    """Returns WAVE_MIPMAP_LEVELS lists of samples, from the richest to the purest one."""
+    levels = []
+    # Harmonics of each level are a subset of the previous one, so the sums are built
+    # from the last level up and every harmonic is added only once.
+    samples = [0.0] * WAVE_SAMPLES_COUNT
+    added = 0
+    for level in reversed(range(WAVE_MIPMAP_LEVELS)):
+        for h in range(added + 1, level_harmonics(level) + 1):
+            amplitude = harmonic(h)
+            if amplitude != 0.0:
+                for i in range(WAVE_SAMPLES_COUNT):
+                    samples[i] += amplitude * SINE[(h * i) % WAVE_SAMPLES_COUNT]
+        added = max(added, level_harmonics(level))
+        levels.insert(0, list(samples))
+    # Gibbs ripple overshoots 1, so all levels are scaled by the same factor to keep
+    # the loudness equal when a voice moves between levels.
+    peak = max(max(abs(x) for x in level) for level in levels)
+    return [[x / peak for x in level] for level in levels]
+
+
+def to_q15(value):
+    return max(-Q15_MAX, min(Q15_MAX, int(round(value * Q15_MAX))))
+
+
+def format_samples(samples, indent):
+    q15 = [to_q15(x) for x in samples]
+    q15.append(q15[0])
+    lines = []
+    for start in range(0, len(q15), 12):
+        chunk = q15[start:start + 12]
+        lines.append(indent + ", ".join("%6d" % s for s in chunk) + ",")
+    return lines
+
+
+def format_table(name, samples):
+    lines = ["const int16_t wavetable_%s[WAVE_SAMPLES_COUNT + 1] = {" % name]
+    lines += format_samples(samples, "    ")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def format_mipmap(name, levels):
+    lines = ["const int16_t wavetable_%s[WAVE_MIPMAP_LEVELS][WAVE_SAMPLES_COUNT + 1] = {" % name]
+    for level, samples in enumerate(levels):
+        lines.append("    // Level %d, harmonics 1 - %d" % (level, level_harmonics(level)))
+        lines.append("    {")
+        lines += format_samples(samples, "        ")
+        lines.append("    },")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def generate_header():
+    out = [HEADER, "#ifndef WAVETABLES_H", "#define WAVETABLES_H", "", "#include <stdint.h>", ""]
+    out.append("// Number of samples in one period, must be a power of two.")
+    out.append("#define WAVE_SAMPLES_COUNT      %d" % WAVE_SAMPLES_COUNT)
+    out.append("#define WAVE_SAMPLES_COUNT_LOG2 %d" % int(math.log2(WAVE_SAMPLES_COUNT)))
+    out.append("")
+    out.append("// Band-limited waves have one table per octave. Level L is free of aliasing for")
+    out.append("// phase steps below 2^(WAVE_MIPMAP_FIRST_STEP_LOG2 + L).")
+    out.append("#define WAVE_MIPMAP_LEVELS          %d" % WAVE_MIPMAP_LEVELS)
+    out.append("#define WAVE_MIPMAP_FIRST_STEP_LOG2 %d" % WAVE_MIPMAP_FIRST_STEP_LOG2)
+    out.append("")
+    out.append("// Each table has one extra guard sample equal to the first one.")
+    out.append("extern const int16_t wavetable_sine[WAVE_SAMPLES_COUNT + 1];")
+    for name, _ in BAND_LIMITED_WAVES:
+        out.append("extern const int16_t wavetable_%s[WAVE_MIPMAP_LEVELS][WAVE_SAMPLES_COUNT + 1];" % name)
+    out += ["", "#endif", ""]
+    return "\n".join(out)
+
+
+def generate_source():
+    out = [HEADER, '#include "wavetables.h"', ""]
+    out.append(format_table("sine", SINE))
+    out.append("")
+    for name, harmonic in BAND_LIMITED_WAVES:
+        out.append(format_mipmap(name, band_limited_levels(harmonic)))
+        out.append("")
+    return "\n".join(out)
+
+
+def write_if_changed(path, content):
+    # Keep timestamps intact when nothing changed, so the build doesn't recompile everything.
+    if os.path.exists(path):
+        with open(path, "r", newline="\n") as f:
+            if f.read() == content:
+                return
+    with open(path, "w", newline="\n") as f:
+        f.write(content)
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.stderr.write("Usage: %s <output directory>\n" % sys.argv[0])
+        return 1
+    assert WAVE_SAMPLES_COUNT & (WAVE_SAMPLES_COUNT - 1) == 0
+    write_if_changed(os.path.join(sys.argv[1], "wavetables.h"), generate_header())
+    write_if_changed(os.path.join(sys.argv[1], "wavetables.c"), generate_source())
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,495 @@
+/*
+ * Measures what the I2C2 devices of the synthesizer cost on a PC, with the unmodified base
+ * board drivers and the shared transfer queue (Lib_EaBaseBoard/src/i2cbus.c) on the host bus
+ * emulator. One second of the main loop is simulated: the LED animation at its fastest step
+ * of 1 ms, a light sensor read every 250 ms and one settings record saved to the EEPROM. It
+ * runs once with every transfer polled, as the drivers did before the queue, and once through
+ * the queue, at 100 and 400 kHz, and reports the transfers, bus time, CPU time spent waiting
+ * and I2C interrupts per device. It also checks the queue itself: order, a full queue, busy
+ * transfers, callbacks, failed transfers and blocking calls behind queued ones; and, with the
+ * emulator completing every transfer as soon as its interrupt is enabled, that no callback
+ * runs inside i2cbus_lock() and that the LED and light sensor drivers still work. The exit
+ * status is 1 if any check fails.
+ *
+ * Build from the repository root:
+ *
+ *   gcc -std=gnu99 -ILib_EaBaseBoard/host/inc -ILib_EaBaseBoard/host -ILib_EaBaseBoard/inc \
+ *       -ILib_MCU/inc midi_synthesizer/tools/i2c_load.c Lib_EaBaseBoard/src/i2cbus.c \
+ *       Lib_EaBaseBoard/src/pca9532.c Lib_EaBaseBoard/src/light.c \
+ *       Lib_EaBaseBoard/src/eeprom.c Lib_EaBaseBoard/host/i2c_emu.c \
+ *       Lib_EaBaseBoard/host/pca9532_emu.c Lib_EaBaseBoard/host/light_emu.c \
+ *       Lib_EaBaseBoard/host/eeprom_emu.c -o i2c_load
+ *
+ * Usage: i2c_load
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "lpc17xx_i2c.h"
+#include "i2cbus.h"
+#include "pca9532.h"
+#include "light.h"
+#include "eeprom.h"
+
+#include "i2c_emu.h"
+#include "pca9532_emu.h"
+#include "light_emu.h"
+#include "eeprom_emu.h"
+
+// The simulated main loop: task periods and the time of the settings save.
+#define RUN_US                  1000000
+#define TICK_US                 100
+#define LED_PERIOD_US           1000
+#define LIGHT_PERIOD_US         250000
+#define SAVE_AT_US              100000
+#define RECORD_SIZE             16
+
+// Retries of the polled transfers the drivers used before the queue.
+#define OLD_RETRIES             3
+#define OLD_ACK_POLL_MAX        250
+
+// Light sensor ADC value, and the lux light.c makes of it at its default range and width.
+#define LIGHT_DATA              1000
+#define LIGHT_LUX               ((LIGHT_DATA * 973) / 65536)
+
+// Address of the device the queue checks talk to, nothing else uses it.
+#define RECORDER_ADDR           0x30
+#define RECORDER_LOG_SIZE       64
+
+static const uint32_t bus_clocks_hz[] = {100000, 400000};
+
+static uint32_t failures = 0;
+
+// Set by light_done().
+static int32_t light_value = -1;
+
+// What the recorder device has been sent, and whether it acknowledges.
+static uint8_t recorder_log[RECORDER_LOG_SIZE];
+static uint32_t recorder_count = 0;
+static bool recorder_ack = true;
+
+// Completion order seen by the queue check callbacks.
+static i2cbus_xfer_t *done_order[I2CBUS_QUEUE_SIZE + 2];
+static uint32_t done_count = 0;
+static i2cbus_xfer_t *chained = NULL;
+
+// Set between i2cbus_lock() and i2cbus_unlock() by the lock check.
+static bool locked = false;
+static uint32_t done_locked = 0;
+
+/**
+ * @brief   Reports a failed check.
+ *
+ * @param   what    Description of the check.
+ *
+ * @return  None
+ */
+static void fail(const char *what) {
+    printf("FAILED: %s\n", what);
+    failures++;
+}
+
+static uint8_t recorder_start(uint8_t addr, uint8_t read, uint64_t ns) {
+    (void)addr;
+    (void)read;
+    (void)ns;
+    return recorder_ack ? 1U : 0U;
+}
+
+static void recorder_write(uint8_t addr, uint8_t value) {
+    (void)addr;
+    if (recorder_count < RECORDER_LOG_SIZE) {
+        recorder_log[recorder_count] = value;
+    }
+    recorder_count++;
+}
+
+static const i2c_emu_device_t recorder = {
+    "recorder", RECORDER_ADDR, 1, recorder_start, recorder_write, NULL, NULL
+};
+
+/**
+ * @brief   Polled I2C transfer, as the drivers copied it before the queue.
+ *
+ * @return  bool    true on success.
+ */
+static bool old_transfer(uint8_t addr, uint8_t *tx, uint32_t tx_len, uint8_t *rx,
+                         uint32_t rx_len, uint32_t retries) {
+    I2C_M_SETUP_Type setup;
+
+    setup.sl_addr7bit = addr;
+    setup.tx_data = tx;
+    setup.tx_length = tx_len;
+    setup.rx_data = rx;
+    setup.rx_length = rx_len;
+    setup.retransmissions_max = retries;
+    return I2C_MasterTransferData(LPC_I2C2, &setup, I2C_TRANSFER_POLLING) == SUCCESS;
+}
+
+/**
+ * @brief   The old pca9532_setLeds(): the four LS registers in one polled write.
+ *
+ * @param   on      LEDs to turn on.
+ *
+ * @return  None
+ */
+static void old_set_leds(uint16_t on) {
+    uint8_t buf[5] = {PCA9532_LS0 | PCA9532_AUTO_INC, 0, 0, 0, 0};
+
+    for (uint32_t i = 0; i < 16U; i++) {
+        if ((on & (1U << i)) != 0U) {
+            buf[1U + (i / 4U)] |= (uint8_t)(1U << ((i % 4U) * 2U));
+        }
+    }
+    (void)old_transfer(PCA9532_I2C_ADDR, buf, sizeof(buf), NULL, 0, OLD_RETRIES);
+}
+
+/**
+ * @brief   The old light_read(): LSB and MSB sensor registers, polled.
+ *
+ * @return  None
+ */
+static void old_light_read(void) {
+    uint8_t reg = 0x04;
+    uint8_t lsb = 0;
+    uint8_t msb = 0;
+
+    (void)old_transfer(LIGHT_EMU_I2C_ADDR, &reg, 1, &lsb, 1, OLD_RETRIES);
+    reg = 0x05;
+    (void)old_transfer(LIGHT_EMU_I2C_ADDR, &reg, 1, &msb, 1, OLD_RETRIES);
+    light_value = (int32_t)(((((uint32_t)msb << 8) | lsb) * 973U) / 65536U);
+}
+
+/**
+ * @brief   The old eeprom_write() of one page: polled, retried until it is acknowledged.
+ *
+ * @return  None
+ */
+static void old_eeprom_write(uint8_t *buf, uint16_t len) {
+    uint8_t page[EEPROM_EMU_PAGE_SIZE + 1];
+
+    page[0] = 0;
+    memcpy(&page[1], buf, len);
+    (void)old_transfer(EEPROM_EMU_I2C_ADDR, page, len + 1U, NULL, 0, OLD_ACK_POLL_MAX);
+}
+
+static void light_done(int32_t lux) {
+    light_value = lux;
+}
+
+/**
+ * @brief   One LED of the 16 moving along, the pattern of the fastest animation.
+ *
+ * @param   step    Animation step.
+ *
+ * @return  uint16_t    LEDs to turn on.
+ */
+static uint16_t led_pattern(uint32_t step) {
+    return (uint16_t)(1U << (step % 16U));
+}
+
+/**
+ * @brief   Puts all devices on the bus and starts over.
+ *
+ * @param   hz  Bus clock.
+ *
+ * @return  None
+ */
+static void reset_bus(uint32_t hz) {
+    eepromEmu_reset();
+    pca9532Emu_reset();
+    lightEmu_reset();
+    i2cEmu_reset();
+    i2cEmu_attach(&recorder);
+    i2cEmu_setBusClock(hz);
+    i2cbus_init();
+    lightEmu_setData(LIGHT_DATA);
+}
+
+/**
+ * @brief   Prints the statistics of one device.
+ *
+ * @param   name    Device name.
+ * @param   addr    Device address.
+ *
+ * @return  None
+ */
+static void print_device(const char *name, uint8_t addr) {
+    i2c_emu_stats_t s;
+
+    (void)i2cEmu_getDeviceStats(addr, &s);
+    printf("    %-8s %5u transfers %6u bytes %7u us bus %7u us waited %6u interrupts\n", name,
+           (unsigned)s.transfers, (unsigned)s.bytes, (unsigned)(s.busNs / 1000U),
+           (unsigned)(s.blockedNs / 1000U), (unsigned)s.interrupts);
+}
+
+/**
+ * @brief   Runs one second of the main loop and reports what the I2C devices cost.
+ *
+ * @param   queued  true to go through the queue, false for the old polled transfers.
+ * @param   hz      Bus clock.
+ *
+ * @return  None
+ */
+static void run_load(bool queued, uint32_t hz) {
+    uint8_t record[RECORD_SIZE];
+    uint64_t next_led = 0;
+    uint64_t next_light = 0;
+    bool saved = false;
+    uint32_t steps = 0;
+    uint16_t leds = 0;
+    i2c_emu_stats_t total;
+
+    reset_bus(hz);
+    memset(record, 0x5A, sizeof(record));
+    light_value = -1;
+
+    while (i2cEmu_now() < (uint64_t)RUN_US * 1000U) {
+        uint64_t now = i2cEmu_now();
+
+        // The LED task adds itself again after each step, so a late step isn't repeated.
+        if (now >= next_led) {
+            uint16_t off = leds;
+            leds = led_pattern(steps++);
+            if (queued) {
+                pca9532_setLeds(leds, off);
+            } else {
+                old_set_leds(leds);
+            }
+            next_led = i2cEmu_now() + (uint64_t)LED_PERIOD_US * 1000U;
+        }
+        if (now >= next_light) {
+            if (queued) {
+                (void)light_readAsync(light_done);
+            } else {
+                old_light_read();
+            }
+            next_light += (uint64_t)LIGHT_PERIOD_US * 1000U;
+        }
+        if (!saved && (now >= (uint64_t)SAVE_AT_US * 1000U)) {
+            if (queued) {
+                // As settings_task() saves them, without waiting for the write cycles.
+                (void)eeprom_writeAsync(record, 0, sizeof(record), NULL);
+            } else {
+                old_eeprom_write(record, sizeof(record));
+            }
+            saved = true;
+        }
+        i2cEmu_wait(TICK_US);
+    }
+    i2cEmu_run();
+
+    i2cEmu_getStats(&total);
+    printf("  %s, %u kHz: %u LED steps, bus busy %u.%u%%, CPU waited %u us, %u interrupts\n",
+           queued ? "queued" : "polled", (unsigned)(hz / 1000U), (unsigned)steps,
+           (unsigned)(total.busNs / (RUN_US * 10U)),
+           (unsigned)((total.busNs / RUN_US) % 10U), (unsigned)(total.blockedNs / 1000U),
+           (unsigned)total.interrupts);
+    print_device("PCA9532", PCA9532_EMU_I2C_ADDR);
+    print_device("ISL29003", LIGHT_EMU_I2C_ADDR);
+    print_device("24LC08", EEPROM_EMU_I2C_ADDR);
+
+    // Coalesced LED writes must still leave the last pattern on the LEDs.
+    if (pca9532Emu_getLeds(PCA9532_EMU_LS_ON) != leds) {
+        fail("LEDs don't show the last pattern");
+    }
+    if (light_value != LIGHT_LUX) {
+        fail("light sensor value not read");
+    }
+    if (memcmp(eepromEmu_getMemory(), record, sizeof(record)) != 0) {
+        fail("settings record not written");
+    }
+}
+
+static void record_done(i2cbus_xfer_t *xfer) {
+    if (done_count < (sizeof(done_order) / sizeof(done_order[0]))) {
+        done_order[done_count] = xfer;
+    }
+    done_count++;
+    if (locked) {
+        done_locked++;
+    }
+
+    if (chained != NULL) {
+        i2cbus_xfer_t *next = chained;
+        chained = NULL;
+        if (i2cbus_submit(next) != 0) {
+            fail("submit from a callback");
+        }
+    }
+}
+
+/**
+ * @brief   Fills in a one byte write to the recorder.
+ *
+ * @return  None
+ */
+static void make_xfer(i2cbus_xfer_t *xfer, uint8_t *byte, uint16_t retries) {
+    xfer->addr = RECORDER_ADDR;
+    xfer->txBuf = byte;
+    xfer->txLen = 1;
+    xfer->rxBuf = NULL;
+    xfer->rxLen = 0;
+    xfer->retries = retries;
+    xfer->done = record_done;
+    xfer->status = I2CBUS_IDLE;
+}
+
+/**
+ * @brief   Checks the queue: order, limits, callbacks, failures and blocking calls.
+ *
+ * @return  None
+ */
+static void check_queue(void) {
+    static i2cbus_xfer_t xfers[I2CBUS_QUEUE_SIZE + 2];
+    static uint8_t bytes[I2CBUS_QUEUE_SIZE + 2];
+    i2c_emu_stats_t s;
+    uint32_t n = I2CBUS_QUEUE_SIZE + 1U;
+
+    reset_bus(100000);
+    recorder_count = 0;
+    recorder_ack = true;
+    done_count = 0;
+
+    // One transfer on the bus and a full queue behind it.
+    for (uint32_t i = 0; i < n; i++) {
+        bytes[i] = (uint8_t)i;
+        make_xfer(&xfers[i], &bytes[i], 0);
+        if (i2cbus_submit(&xfers[i]) != 0) {
+            fail("submit to a queue with room");
+        }
+    }
+    bytes[n] = (uint8_t)n;
+    make_xfer(&xfers[n], &bytes[n], 0);
+    if (i2cbus_submit(&xfers[n]) != -1) {
+        fail("submit to a full queue");
+    }
+    if (i2cbus_submit(&xfers[1]) != -1) {
+        fail("submit of a busy transfer");
+    }
+    if (i2cbus_isIdle()) {
+        fail("bus idle with transfers queued");
+    }
+
+    i2cEmu_run();
+    if (done_count != n || recorder_count != n || !i2cbus_isIdle()) {
+        fail("every transfer done once");
+    }
+    for (uint32_t i = 0; i < n && i < done_count; i++) {
+        if (done_order[i] != &xfers[i] || recorder_log[i] != (uint8_t)i ||
+            xfers[i].status != I2CBUS_DONE) {
+            fail("transfers done in the order queued");
+            break;
+        }
+    }
+
+    // A transfer queued from a callback, and a blocking call behind both.
+    done_count = 0;
+    recorder_count = 0;
+    chained = &xfers[1];
+    make_xfer(&xfers[0], &bytes[0], 0);
+    make_xfer(&xfers[1], &bytes[1], 0);
+    (void)i2cbus_submit(&xfers[0]);
+    bytes[2] = 0xAA;
+    if (i2cbus_write(RECORDER_ADDR, &bytes[2], 1) != 0) {
+        fail("blocking write");
+    }
+    if (xfers[0].status != I2CBUS_DONE || recorder_log[0] != 0 || recorder_log[1] != 0xAA) {
+        fail("blocking write after the queued transfer");
+    }
+    i2cEmu_run();
+    if (done_count != 2U || xfers[1].status != I2CBUS_DONE || recorder_log[2] != 1) {
+        fail("transfer queued from a callback");
+    }
+
+    // Not acknowledged: all retries, then an error for the callback and the blocking call.
+    recorder_ack = false;
+    done_count = 0;
+    i2cEmu_clearStats();
+    make_xfer(&xfers[0], &bytes[0], 2);
+    (void)i2cbus_submit(&xfers[0]);
+    i2cEmu_run();
+    (void)i2cEmu_getDeviceStats(RECORDER_ADDR, &s);
+    if (done_count != 1U || xfers[0].status != I2CBUS_ERROR || s.attempts != 3U) {
+        fail("failed transfer");
+    }
+    if (i2cbus_write(RECORDER_ADDR, &bytes[0], 1) != -1) {
+        fail("failed blocking write");
+    }
+    recorder_ack = true;
+}
+
+/**
+ * @brief   Checks that the interrupt stays masked inside i2cbus_lock(), even when a transfer
+ *          is submitted to an idle bus there, with every interrupt at the earliest moment.
+ *
+ * @return  None
+ */
+static void check_lock(void) {
+    static i2cbus_xfer_t xfers[2];
+    static uint8_t bytes[2] = {0x11, 0x22};
+
+    reset_bus(100000);
+    i2cEmu_setEagerIrq(1);
+    recorder_count = 0;
+    recorder_ack = true;
+    done_count = 0;
+    done_locked = 0;
+
+    i2cbus_lock();
+    locked = true;
+    for (uint32_t i = 0; i < 2U; i++) {
+        make_xfer(&xfers[i], &bytes[i], 0);
+        if (i2cbus_submit(&xfers[i]) != 0) {
+            fail("submit inside the lock");
+        }
+    }
+    if (recorder_count != 0U || done_count != 0U) {
+        fail("nothing sent inside the lock");
+    }
+    locked = false;
+    i2cbus_unlock();
+
+    if (done_locked != 0U) {
+        fail("callback ran inside the lock");
+    }
+    if (done_count != 2U || recorder_count != 2U || recorder_log[0] != 0x11 ||
+        recorder_log[1] != 0x22 || !i2cbus_isIdle()) {
+        fail("transfers submitted inside the lock sent at the unlock");
+    }
+
+    // The drivers that lock around their submits.
+    light_value = -1;
+    if (light_readAsync(light_done) != 0 || light_value != LIGHT_LUX) {
+        fail("light sensor read with eager interrupts");
+    }
+    pca9532_setLeds(0x00F0, 0xFFFF);
+    pca9532_setLeds(0x0F00, 0x00F0);
+    if (pca9532Emu_getLeds(PCA9532_EMU_LS_ON) != 0x0F00U) {
+        fail("LEDs set with eager interrupts");
+    }
+    i2cEmu_setEagerIrq(0);
+}
+
+int main(void) {
+    printf("one second of LEDs every %u ms, light sensor every %u ms, one %u byte save:\n",
+           (unsigned)(LED_PERIOD_US / 1000U), (unsigned)(LIGHT_PERIOD_US / 1000U),
+           (unsigned)RECORD_SIZE);
+    for (uint32_t i = 0; i < (sizeof(bus_clocks_hz) / sizeof(bus_clocks_hz[0])); i++) {
+        run_load(false, bus_clocks_hz[i]);
+        run_load(true, bus_clocks_hz[i]);
+    }
+
+    check_queue();
+    check_lock();
+
+    if (failures != 0U) {
+        printf("%u checks failed\n", (unsigned)failures);
+        return 1;
+    }
+    printf("all checks passed\n");
+    return 0;
+}
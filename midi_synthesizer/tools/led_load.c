@@ -0,0 +1,223 @@
+/*
+ * Measures the I2C traffic of the synthesizer's LED animation on a PC, with the unmodified
+ * pca_leds.c, PCA9532 driver and bus queue on the host bus emulator. For a range of chase
+ * step periods (the LED task runs at 1 ms per step at the highest frequency and 791 ms at
+ * the lowest) it compares the bytes per second on the bus, address bytes included, of the
+ * old driver, which wrote all four LS registers on every step, with the current one, which
+ * only writes the registers that changed and hands chases too fast to follow to the PCA9532
+ * blink engines. It also checks that the LEDs end up as the driver's shadow state says and
+ * that updates are batched and diffed. The exit status is 1 if any check fails.
+ *
+ * Build from the repository root:
+ *
+ *   gcc -std=gnu99 -ILib_EaBaseBoard/host/inc -ILib_EaBaseBoard/host -ILib_EaBaseBoard/inc \
+ *       -ILib_MCU/inc -Imidi_synthesizer/src midi_synthesizer/tools/led_load.c \
+ *       midi_synthesizer/src/pca_leds.c Lib_EaBaseBoard/src/pca9532.c \
+ *       Lib_EaBaseBoard/src/i2cbus.c Lib_EaBaseBoard/host/i2c_emu.c \
+ *       Lib_EaBaseBoard/host/pca9532_emu.c -o led_load
+ *
+ * Usage: led_load
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "i2cbus.h"
+#include "pca9532.h"
+
+#include "i2c_emu.h"
+#include "pca9532_emu.h"
+
+#include "pca_leds.h"
+
+#define RUN_MS                  10000U
+#define BUS_HZ                  100000U
+
+// The old driver's write: the LS0 control byte and the four LS registers.
+#define OLD_WRITE_BYTES         5U
+
+static const uint32_t step_periods_ms[] = {1, 2, 3, 4, 10, 50, 200, 791};
+
+static uint32_t failures = 0;
+
+/**
+ * @brief   Reports a failed check.
+ *
+ * @param   what    Description of the check.
+ *
+ * @return  None
+ */
+static void fail(const char *what) {
+    printf("FAILED: %s\n", what);
+    failures++;
+}
+
+/**
+ * @brief   Bytes sent to the PCA9532 so far, address bytes included.
+ *
+ * @return  uint32_t    Bytes.
+ */
+static uint32_t wire_bytes(void) {
+    i2c_emu_stats_t s;
+
+    (void)i2cEmu_getDeviceStats(PCA9532_EMU_I2C_ADDR, &s);
+    return s.bytes + s.attempts;
+}
+
+/**
+ * @brief   Transfers to the PCA9532 so far.
+ *
+ * @return  uint32_t    Transfers.
+ */
+static uint32_t transfers(void) {
+    i2c_emu_stats_t s;
+
+    (void)i2cEmu_getDeviceStats(PCA9532_EMU_I2C_ADDR, &s);
+    return s.transfers;
+}
+
+/**
+ * @brief   LEDs on either blink engine.
+ *
+ * @return  uint16_t    LED mask, bit 0 is LED4.
+ */
+static uint16_t blinking_leds(void) {
+    return pca9532Emu_getLeds(PCA9532_EMU_LS_BLINK0) | pca9532Emu_getLeds(PCA9532_EMU_LS_BLINK1);
+}
+
+/**
+ * @brief   Checks that the LEDs show what the driver's shadow state says.
+ *
+ * @param   what    Description of the check.
+ *
+ * @return  None
+ */
+static void check_leds(const char *what) {
+    i2cEmu_run();
+    uint16_t lit = pca9532Emu_getLeds(PCA9532_EMU_LS_ON) | blinking_leds();
+    if (lit != pca9532_getLedState(1)) {
+        fail(what);
+    }
+}
+
+/**
+ * @brief   Runs the LED task for RUN_MS at one step period and reports its traffic.
+ *
+ * @param   step_ms     Chase step period.
+ *
+ * @return  None
+ */
+static void run_chase(uint32_t step_ms) {
+    uint32_t steps = 0;
+    uint32_t bytes_before;
+    uint32_t writes_before;
+    uint64_t next = i2cEmu_now();
+    uint64_t end = next + (uint64_t)RUN_MS * 1000000U;
+
+    // One call first, so switching between the chase and the blink engines isn't counted.
+    next += (uint64_t)leds_chase(step_ms) * 1000000U;
+    i2cEmu_run();
+    bytes_before = wire_bytes();
+    writes_before = transfers();
+
+    while (next < end) {
+        i2cEmu_wait((uint32_t)((next - i2cEmu_now()) / 1000U));
+        next += (uint64_t)leds_chase(step_ms) * 1000000U;
+        steps++;
+    }
+    i2cEmu_wait((uint32_t)((end - i2cEmu_now()) / 1000U));
+    i2cEmu_run();
+
+    // The old driver wrote every step in full.
+    uint32_t old_steps = RUN_MS / step_ms;
+    uint32_t old_rate = (old_steps * (OLD_WRITE_BYTES + 1U) * 1000U) / RUN_MS;
+    uint32_t new_rate = ((wire_bytes() - bytes_before) * 1000U) / RUN_MS;
+    bool blinking = blinking_leds() != 0U;
+    printf("  %4u ms  %6u B/s  %6u B/s  %5u writes in %5u calls  %s\n", (unsigned)step_ms,
+           (unsigned)old_rate, (unsigned)new_rate, (unsigned)(transfers() - writes_before),
+           (unsigned)steps, blinking ? "blink engines" : "chase");
+
+    check_leds("LEDs differ from the shadow state");
+    if (new_rate > old_rate) {
+        fail("more traffic than the old driver");
+    }
+}
+
+/**
+ * @brief   Checks the register diffing and batching of the PCA9532 driver.
+ *
+ * @return  None
+ */
+static void check_driver(void) {
+    uint32_t before;
+
+    pca9532_setLeds(0, 0xFFFF);
+    i2cEmu_run();
+
+    // Unchanged state: nothing to write.
+    before = transfers();
+    pca9532_setLeds(0, LED4);
+    pca9532_setLeds(0, 0xFFFF);
+    i2cEmu_run();
+    if (transfers() != before) {
+        fail("unchanged LEDs written");
+    }
+
+    // Period, duty cycle and selectors in one write.
+    before = transfers();
+    set_leds_blink(0, LED4 | LED5, 500, 50);
+    i2cEmu_run();
+    if ((transfers() != before + 1U) ||
+        (pca9532Emu_getLeds(PCA9532_EMU_LS_BLINK0) != (LED4 | LED5)) ||
+        (pca9532Emu_getRegister(PCA9532_PSC0) != 75U) ||
+        (pca9532Emu_getRegister(PCA9532_PWM0) != 128U)) {
+        fail("blink setup in one write");
+    }
+
+    // A change of one LED only writes its LS register: control byte and one data byte.
+    before = wire_bytes();
+    pca9532_setLeds(LED19, 0);
+    i2cEmu_run();
+    if ((wire_bytes() != before + 3U) || (pca9532Emu_getLeds(PCA9532_EMU_LS_ON) != LED19)) {
+        fail("single register write");
+    }
+
+    // Changes made while a write is on the bus end up on the LEDs.
+    for (uint32_t i = 0; i < 16U; i++) {
+        pca9532_setLeds((uint16_t)(1U << i), (uint16_t)~(1U << i));
+    }
+    check_leds("changes made while writing");
+    pca9532_setLeds(0, 0xFFFF);
+    i2cEmu_run();
+}
+
+int main(void) {
+    pca9532Emu_reset();
+    i2cEmu_setBusClock(BUS_HZ);
+    i2cbus_init();
+
+    printf("LED chase, I2C bytes per second to the PCA9532 (address bytes included):\n");
+    printf("  step     before      after\n");
+    for (uint32_t i = 0; i < (sizeof(step_periods_ms) / sizeof(step_periods_ms[0])); i++) {
+        run_chase(step_periods_ms[i]);
+    }
+
+    // Back from the blink engines to the chase.
+    (void)leds_chase(1);
+    (void)leds_chase(100);
+    i2cEmu_run();
+    if (blinking_leds() != 0U) {
+        fail("LEDs still blinking after the chase took over");
+    }
+    check_leds("chase after the blink engines");
+
+    check_driver();
+
+    if (failures != 0U) {
+        printf("%u checks failed\n", (unsigned)failures);
+        return 1;
+    }
+    printf("all checks passed\n");
+    return 0;
+}
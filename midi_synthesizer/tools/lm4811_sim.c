@@ -0,0 +1,326 @@
+/*
+ * Runs the LM4811 pulse sequence (midi_synthesizer/src/lm4811.c) against a model of the
+ * amplifier on a PC. The model steps its gain on every rising CLK edge in the direction of
+ * UP/DN and stays at the ends of its range, as the datasheet describes. The pins are copied
+ * to it after every lm4811_tick(), as TIMER1_IRQHandler() does, and every tick it checks
+ * that at most one pin changed, that UP/DN was stable for at least a tick before each
+ * rising edge and that CLK was low for at least a tick between pulses.
+ *
+ * Checked: from every real start level 0 - 15 to every target the amplifier ends at the
+ * target, including the calibration after init; steps in the same direction requested while
+ * a train runs coalesce into one train (5 steps in 11 ticks with 5 pulses); a new target in
+ * the other direction turns the train around; and a long run of random targets at random
+ * ticks always ends where the model says. The boot to level 10 is reported in ticks, which
+ * are 1 ms on the board. The exit status is 1 if any check fails.
+ *
+ * Build from the repository root:
+ *
+ *   gcc -O2 -std=gnu99 -Imidi_synthesizer/src midi_synthesizer/tools/lm4811_sim.c \
+ *       midi_synthesizer/src/lm4811.c -o lm4811_sim
+ *
+ * Usage: lm4811_sim
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "lm4811.h"
+
+// Level the firmware boots to with the default settings.
+#define BOOT_LEVEL              10
+
+// Longest sequence: calibration through the whole range down and back up, with UP/DN
+// changes and a low tick after every pulse. Anything longer is stuck.
+#define TICKS_MAX               (4 * (LM4811_LEVEL_MAX + 2))
+
+#define RANDOM_TICKS            1000000U
+
+// The amplifier as seen from its pins.
+struct Chip {
+    uint8_t level;
+    bool up;
+    bool clock;
+    uint32_t up_ticks;      // Ticks UP/DN has had its current state.
+    uint32_t low_ticks;     // Ticks CLK has been low.
+    uint32_t pulses;        // Rising CLK edges.
+    uint32_t up_changes;
+    bool violated;          // A timing rule was broken.
+};
+
+static uint32_t failures = 0;
+
+/**
+ * @brief   Reports a failed check.
+ *
+ * @param   what    Description of the check.
+ *
+ * @return  None
+ */
+static void fail(const char *what) {
+    printf("FAILED: %s\n", what);
+    failures++;
+}
+
+/**
+ * @brief   Returns a pseudo-random number.
+ *
+ * @param   range   Upper bound, excluded.
+ *
+ * @return  Number from 0 to range - 1.
+ */
+static uint32_t random_below(uint32_t range) {
+    static uint32_t seed = 1;
+
+    seed = (seed * 1103515245U) + 12345U;
+    return (seed >> 8) % range;
+}
+
+/**
+ * @brief   Powers up the amplifier model with both pins low.
+ *
+ * @param   chip    Pointer to the model.
+ * @param   level   Real gain level, unknown to the firmware.
+ *
+ * @return  None
+ */
+static void chip_init(struct Chip *chip, uint8_t level) {
+    chip->level = level;
+    chip->up = false;
+    chip->clock = false;
+    chip->up_ticks = 1;
+    chip->low_ticks = 1;
+    chip->pulses = 0;
+    chip->up_changes = 0;
+    chip->violated = false;
+}
+
+/**
+ * @brief   Applies the pins after a tick and checks the timing rules.
+ *
+ * @param   chip    Pointer to the model.
+ * @param   up      UP/DN pin.
+ * @param   clock   CLK pin.
+ *
+ * @return  None
+ */
+static void chip_apply(struct Chip *chip, bool up, bool clock) {
+    bool up_changed = (up != chip->up);
+    bool clock_changed = (clock != chip->clock);
+
+    if (up_changed && clock_changed) {
+        chip->violated = true;
+    }
+    if (clock && !chip->clock) {
+        // Rising edge: UP/DN must have been stable for a tick and CLK low for one.
+        if (up_changed || (chip->up_ticks == 0U) || (chip->low_ticks == 0U)) {
+            chip->violated = true;
+        }
+        if (up && (chip->level < (uint8_t)LM4811_LEVEL_MAX)) {
+            chip->level++;
+        } else if (!up && (chip->level > 0U)) {
+            chip->level--;
+        } else {
+            // Stays at the end of its range.
+        }
+        chip->pulses++;
+    }
+
+    if (up_changed) {
+        chip->up_changes++;
+        chip->up_ticks = 0;
+    }
+    chip->up_ticks++;
+    chip->low_ticks = clock ? 0U : (chip->low_ticks + 1U);
+    chip->up = up;
+    chip->clock = clock;
+}
+
+/**
+ * @brief   Ticks the sequence until it stops.
+ *
+ * @param   amp     Pointer to the sequence.
+ * @param   chip    Pointer to the amplifier model.
+ *
+ * @return  Ticks taken, more than TICKS_MAX if the sequence didn't stop.
+ */
+static uint32_t run(struct Lm4811 *amp, struct Chip *chip) {
+    uint32_t ticks = 0;
+    bool running = true;
+
+    while (running && (ticks <= (uint32_t)TICKS_MAX)) {
+        running = lm4811_tick(amp);
+        chip_apply(chip, amp->up, amp->clock);
+        ticks++;
+    }
+
+    return ticks;
+}
+
+/**
+ * @brief   Every start level to every target, through init and then through a level change.
+ *
+ * @return  None
+ */
+static void check_targets(void) {
+    uint32_t worst_init = 0;
+    uint32_t worst_change = 0;
+    bool ok = true;
+
+    for (uint8_t start = 0; start <= (uint8_t)LM4811_LEVEL_MAX; start++) {
+        for (uint8_t target = 0; target <= (uint8_t)LM4811_LEVEL_MAX; target++) {
+            struct Lm4811 amp;
+            struct Chip chip;
+
+            chip_init(&chip, start);
+            lm4811_init(&amp, target);
+            uint32_t ticks = run(&amp, &chip);
+            ok = (ticks <= (uint32_t)TICKS_MAX) && (chip.level == target) && !chip.clock &&
+                 !chip.violated && ok;
+            worst_init = (ticks > worst_init) ? ticks : worst_init;
+
+            // From the calibrated level to every other one.
+            for (uint8_t next = 0; next <= (uint8_t)LM4811_LEVEL_MAX; next++) {
+                struct Lm4811 moved = amp;
+                struct Chip moved_chip = chip;
+                lm4811_set_target(&moved, next);
+                ticks = run(&moved, &moved_chip);
+                ok = (ticks <= (uint32_t)TICKS_MAX) && (moved_chip.level == next) &&
+                     !moved_chip.clock && !moved_chip.violated && lm4811_is_settled(&moved) &&
+                     ok;
+                worst_change = (ticks > worst_change) ? ticks : worst_change;
+            }
+        }
+    }
+
+    printf("every start level to every target: at most %u ticks after init, %u after that\n",
+           (unsigned)worst_init, (unsigned)worst_change);
+    if (!ok) {
+        fail("start levels and targets");
+    }
+}
+
+/**
+ * @brief   Boot to BOOT_LEVEL from the worst start level.
+ *
+ * @return  None
+ */
+static void report_boot(void) {
+    struct Lm4811 amp;
+    struct Chip chip;
+
+    chip_init(&chip, LM4811_LEVEL_MAX);
+    lm4811_init(&amp, BOOT_LEVEL);
+    uint32_t ticks = run(&amp, &chip);
+
+    printf("boot to level %u: %u ticks (1 ms each), %u pulses\n", (unsigned)BOOT_LEVEL,
+           (unsigned)ticks, (unsigned)chip.pulses);
+}
+
+/**
+ * @brief   Settles the sequence at a level, with UP/DN left down.
+ *
+ * @param   amp     Pointer to the sequence.
+ * @param   chip    Pointer to the amplifier model.
+ * @param   level   Level to settle at, below LM4811_LEVEL_MAX.
+ *
+ * @return  None
+ */
+static void settle_at(struct Lm4811 *amp, struct Chip *chip, uint8_t level) {
+    chip_init(chip, 0);
+    lm4811_init(amp, (uint8_t)(level + 1U));
+    (void)run(amp, chip);
+    // Come down to the level, so UP/DN ends up down.
+    lm4811_set_target(amp, level);
+    (void)run(amp, chip);
+    chip->pulses = 0;
+    chip->up_changes = 0;
+}
+
+/**
+ * @brief   Steps requested while a train runs, in the same and in the other direction.
+ *
+ * @return  None
+ */
+static void check_coalescing(void) {
+    struct Lm4811 amp;
+    struct Chip chip;
+    uint32_t ticks = 0;
+
+    // Five rotary steps up, one per tick, the first one while the amplifier is settled.
+    settle_at(&amp, &chip, 5);
+    for (uint8_t step = 1; step <= 5U; step++) {
+        lm4811_set_target(&amp, (uint8_t)(5U + step));
+        (void)lm4811_tick(&amp);
+        chip_apply(&chip, amp.up, amp.clock);
+        ticks++;
+    }
+    ticks += run(&amp, &chip);
+
+    printf("5 coalesced steps: %u ticks, %u pulses, %u UP/DN change\n", (unsigned)ticks,
+           (unsigned)chip.pulses, (unsigned)chip.up_changes);
+    if ((ticks != 11U) || (chip.pulses != 5U) || (chip.up_changes != 1U) ||
+        (chip.level != 10U) || chip.violated) {
+        fail("steps in the same direction coalesce");
+    }
+
+    // Up by 6, then back down to 8 after two pulses.
+    settle_at(&amp, &chip, 5);
+    lm4811_set_target(&amp, 11);
+    for (uint32_t t = 0; t < 4U; t++) {
+        (void)lm4811_tick(&amp);
+        chip_apply(&chip, amp.up, amp.clock);
+    }
+    lm4811_set_target(&amp, 4);
+    (void)run(&amp, &chip);
+    if ((chip.level != 4U) || chip.violated || (chip.up_changes != 2U)) {
+        fail("train turned around by a target in the other direction");
+    }
+}
+
+/**
+ * @brief   Random targets at random ticks, as from a fast rotary encoder.
+ *
+ * @return  None
+ */
+static void check_random(void) {
+    struct Lm4811 amp;
+    struct Chip chip;
+    uint32_t settles = 0;
+    bool ok = true;
+
+    chip_init(&chip, (uint8_t)random_below(LM4811_LEVEL_MAX + 1));
+    lm4811_init(&amp, (uint8_t)random_below(LM4811_LEVEL_MAX + 1));
+
+    for (uint32_t t = 0; t < RANDOM_TICKS; t++) {
+        if (random_below(8) == 0U) {
+            // Also out of range targets, which are clamped.
+            lm4811_set_target(&amp, (uint8_t)random_below(LM4811_LEVEL_MAX + 4));
+        }
+        bool running = lm4811_tick(&amp);
+        chip_apply(&chip, amp.up, amp.clock);
+        if (!running) {
+            ok = (chip.level == amp.target) && (amp.level == chip.level) && ok;
+            settles++;
+        }
+    }
+
+    printf("%u random ticks: settled %u times\n", (unsigned)RANDOM_TICKS, (unsigned)settles);
+    if (!ok || chip.violated || (settles == 0U)) {
+        fail("random targets");
+    }
+}
+
+int main(void) {
+    check_targets();
+    report_boot();
+    check_coalescing();
+    check_random();
+
+    if (failures != 0U) {
+        printf("%u checks failed\n", (unsigned)failures);
+        return 1;
+    }
+    printf("all checks passed\n");
+    return 0;
+}
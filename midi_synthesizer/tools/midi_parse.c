@@ -0,0 +1,287 @@
+/*
+ * Runs the MIDI parser and event queue (midi_synthesizer/src/midi.c) on a PC. A byte stream
+ * written out the way a keyboard with a clock source sends it (running status, note off as
+ * note on with velocity 0, clock and active sensing bytes in the middle of messages, a
+ * SysEx message, system common messages and stray bytes) must give exactly the expected
+ * events. The queue is checked for order, for dropping and counting events when it is full
+ * and across the wrap of its indices. Then the parser is timed on a long generated stream.
+ * The exit status is 1 if any check fails.
+ *
+ * The time is that of the PC. At 31250 baud, MIDI brings at most 3125 bytes per second.
+ *
+ * Build from the repository root:
+ *
+ *   gcc -O2 -std=gnu99 -Imidi_synthesizer/src midi_synthesizer/tools/midi_parse.c \
+ *       midi_synthesizer/src/midi.c -o midi_parse
+ *
+ * Usage: midi_parse
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "midi.h"
+
+// Bytes per measurement, the fastest of BENCH_RUNS measurements is reported.
+#define BENCH_BYTES             (1U << 24)
+#define BENCH_RUNS              5
+
+// Events are taken from the queue after this many bytes, as the audio interrupt would.
+#define BENCH_DRAIN_BYTES       32U
+
+static const uint8_t stream[] = {
+    0x42, 0x10,                     // Data bytes before the first status, ignored.
+    0xFE,                           // Active sensing.
+    0xC0, 0x05,                     // Program change.
+    0x90, 0x3C, 0x64,               // Note on C4.
+    0x40, 0x5A,                     // Running status: note on E4.
+    0xF8,                           // Clock before a message...
+    0x43, 0xF8, 0x50,               // ...and inside one: note on G4.
+    0x3C, 0x00,                     // Note off C4 as note on with velocity 0.
+    0xB0, 0x40, 0x7F,               // Sustain pedal.
+    0xE0, 0x00, 0x48,               // Pitch bend.
+    0x00, 0x40,                     // Running status: pitch bend back to the center.
+    0xF0, 0x7E, 0x7F, 0xF8, 0x06,   // SysEx identity request with a clock inside.
+    0x01, 0xF7,
+    0xF7,                           // Stray end of SysEx, ignored.
+    0x7F,                           // Data byte without status after SysEx, ignored.
+    0xF2, 0x10, 0x02,               // Song position.
+    0x20,                           // System common has no running status, ignored.
+    0xF6,                           // Tune request.
+    0xFA,                           // Start.
+    0x81, 0x43, 0x40,               // Note off on channel 2.
+    0xD1, 0x30,                     // Channel pressure on channel 2.
+    0x28,                           // Running status: channel pressure.
+    0xF0, 0x01, 0x02, 0x03, 0x90,   // SysEx cut short by a status byte.
+    0x3C, 0x00,
+};
+
+static const struct MidiEvent expected[] = {
+    {0xFE, 0x00, 0x00, 0},
+    {0xC0, 0x05, 0x00, 1},
+    {0x90, 0x3C, 0x64, 2},
+    {0x90, 0x40, 0x5A, 2},
+    {0xF8, 0x00, 0x00, 0},
+    {0xF8, 0x00, 0x00, 0},
+    {0x90, 0x43, 0x50, 2},
+    {0x90, 0x3C, 0x00, 2},
+    {0xB0, 0x40, 0x7F, 2},
+    {0xE0, 0x00, 0x48, 2},
+    {0xE0, 0x00, 0x40, 2},
+    {0xF0, 0x7E, 0x7F, 2},
+    {0xF8, 0x00, 0x00, 0},
+    {0xF0, 0x06, 0x01, 2},
+    {0xF0, 0xF7, 0x00, 1},
+    {0xF2, 0x10, 0x02, 2},
+    {0xF6, 0x00, 0x00, 0},
+    {0xFA, 0x00, 0x00, 0},
+    {0x81, 0x43, 0x40, 2},
+    {0xD1, 0x30, 0x00, 1},
+    {0xD1, 0x28, 0x00, 1},
+    {0xF0, 0x01, 0x02, 2},
+    {0xF0, 0x03, 0x00, 1},
+    {0x90, 0x3C, 0x00, 2},
+};
+
+static uint32_t failures = 0;
+
+static uint8_t bench_stream[BENCH_BYTES];
+
+// Keeps the compiler from dropping the events.
+static volatile uint32_t sink;
+
+/**
+ * @brief   Reports a failed check.
+ *
+ * @param   what    Description of the check.
+ *
+ * @return  None
+ */
+static void fail(const char *what) {
+    printf("FAILED: %s\n", what);
+    failures++;
+}
+
+/**
+ * @brief   Returns the time of a monotonic clock.
+ *
+ * @return  Time in seconds.
+ */
+static double now_seconds(void) {
+    struct timespec time;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &time);
+    return (double)time.tv_sec + ((double)time.tv_nsec * 1e-9);
+}
+
+/**
+ * @brief   Returns a pseudo-random number.
+ *
+ * @param   range   Upper bound, excluded.
+ *
+ * @return  Number from 0 to range - 1.
+ */
+static uint32_t random_below(uint32_t range) {
+    static uint32_t seed = 1;
+
+    seed = (seed * 1103515245U) + 12345U;
+    return (seed >> 8) % range;
+}
+
+/**
+ * @brief   Parses the stream and compares the events with the expected ones.
+ *
+ * @return  None
+ */
+static void check_stream(void) {
+    struct MidiQueue queue;
+    struct MidiParser parser;
+    struct MidiEvent event;
+    uint32_t count = 0;
+
+    midi_queue_init(&queue);
+    midi_parser_init(&parser, &queue);
+    for (uint32_t i = 0; i < sizeof(stream); i++) {
+        midi_parse_byte(&parser, stream[i]);
+    }
+
+    while (midi_queue_pop(&queue, &event)) {
+        if ((count < (sizeof(expected) / sizeof(expected[0]))) &&
+            ((event.status != expected[count].status) || (event.data1 != expected[count].data1) ||
+             (event.data2 != expected[count].data2) || (event.length != expected[count].length))) {
+            printf("  event %u: %02X %02X %02X (%u bytes), expected %02X %02X %02X (%u bytes)\n",
+                   (unsigned)count, event.status, event.data1, event.data2,
+                   (unsigned)event.length, expected[count].status, expected[count].data1,
+                   expected[count].data2, (unsigned)expected[count].length);
+            fail("event differs");
+        }
+        count++;
+    }
+
+    printf("%u bytes parsed into %u events (expected %u)\n", (unsigned)sizeof(stream),
+           (unsigned)count, (unsigned)(sizeof(expected) / sizeof(expected[0])));
+    if (count != (sizeof(expected) / sizeof(expected[0]))) {
+        fail("number of events");
+    }
+}
+
+/**
+ * @brief   Order, overflow and index wrap of the event queue.
+ *
+ * @return  None
+ */
+static void check_queue(void) {
+    struct MidiQueue queue;
+    struct MidiEvent event = {MIDI_STATUS_NOTE_ON, 0, 0, 2};
+    bool ok = true;
+
+    midi_queue_init(&queue);
+    // Start close to the wrap of the free running indices.
+    queue.head = 0xFFFFFFF0U;
+    queue.tail = 0xFFFFFFF0U;
+
+    for (uint32_t i = 0; i < (uint32_t)MIDI_QUEUE_SIZE + 3U; i++) {
+        event.data1 = (uint8_t)i;
+        ok = (midi_queue_push(&queue, &event) == (i < (uint32_t)MIDI_QUEUE_SIZE)) && ok;
+    }
+    ok = (queue.dropped == 3U) && ok;
+
+    for (uint32_t i = 0; i < (uint32_t)MIDI_QUEUE_SIZE; i++) {
+        ok = midi_queue_pop(&queue, &event) && (event.data1 == (uint8_t)i) && ok;
+    }
+    ok = !midi_queue_pop(&queue, &event) && ok;
+
+    if (!ok) {
+        fail("queue order, overflow or index wrap");
+    }
+}
+
+/**
+ * @brief   Fills the benchmark stream with notes, controllers, pitch bends and clocks.
+ *
+ * @return  None
+ */
+static void fill_bench_stream(void) {
+    uint32_t length = 0;
+    uint8_t status = 0;
+
+    while (length < (BENCH_BYTES - 3U)) {
+        uint32_t kind = random_below(16);
+        if (kind < 2U) {
+            bench_stream[length++] = 0xF8;
+            continue;
+        }
+
+        uint8_t next = MIDI_STATUS_NOTE_ON;
+        if (kind >= 14U) {
+            next = MIDI_STATUS_PITCH_BEND;
+        } else if (kind >= 12U) {
+            next = MIDI_STATUS_CONTROL_CHANGE;
+        }
+        next = (uint8_t)(next | random_below(16));
+        // Mostly running status, as keyboards send it.
+        if ((next != status) || (random_below(4) == 0U)) {
+            bench_stream[length++] = next;
+            status = next;
+        }
+        bench_stream[length++] = (uint8_t)random_below(128);
+        bench_stream[length++] = (uint8_t)random_below(128);
+    }
+    while (length < BENCH_BYTES) {
+        bench_stream[length++] = 0xF8;
+    }
+}
+
+/**
+ * @brief   Measures the parser on the benchmark stream.
+ *
+ * @return  Nanoseconds per byte.
+ */
+static double measure(void) {
+    struct MidiQueue queue;
+    struct MidiParser parser;
+    struct MidiEvent event;
+    double best = 0.0;
+
+    for (int run = 0; run < BENCH_RUNS; run++) {
+        midi_queue_init(&queue);
+        midi_parser_init(&parser, &queue);
+
+        double start = now_seconds();
+        for (uint32_t i = 0; i < BENCH_BYTES; i += BENCH_DRAIN_BYTES) {
+            for (uint32_t j = i; j < (i + BENCH_DRAIN_BYTES); j++) {
+                midi_parse_byte(&parser, bench_stream[j]);
+            }
+            while (midi_queue_pop(&queue, &event)) {
+                sink += event.data1;
+            }
+        }
+        double time = (now_seconds() - start) * 1e9 / BENCH_BYTES;
+        if ((run == 0) || (time < best)) {
+            best = time;
+        }
+
+        if (queue.dropped != 0U) {
+            fail("events dropped while draining");
+        }
+    }
+
+    return best;
+}
+
+int main(void) {
+    check_stream();
+    check_queue();
+
+    fill_bench_stream();
+    printf("parse and queue: %.2f ns per byte\n", measure());
+
+    if (failures != 0U) {
+        printf("%u checks failed\n", (unsigned)failures);
+        return 1;
+    }
+    printf("all checks passed\n");
+    return 0;
+}
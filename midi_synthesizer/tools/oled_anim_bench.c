@@ -0,0 +1,210 @@
+/*
+ * Reports how many bytes the OLED flush sends per frame for typical animations, with the
+ * OLED emulator from Lib_EaBaseBoard/host. Every frame is redrawn the way the firmware
+ * does it (e.g. the scope view clears and redraws its whole area) and sent with
+ * oled_flushDma(), so the numbers show how much of each frame the driver can skip.
+ *
+ * Build from the repository root, add -DOLED_USE_I2C for the I2C back end:
+ *
+ *   gcc -no-pie -std=gnu99 -ILib_EaBaseBoard/host/inc -ILib_EaBaseBoard/host \
+ *       -ILib_EaBaseBoard/inc -ILib_MCU/inc -Imidi_synthesizer/src \
+ *       midi_synthesizer/tools/oled_anim_bench.c midi_synthesizer/src/scope.c \
+ *       midi_synthesizer/src/fft.c midi_synthesizer/src/wavetables.c \
+ *       midi_synthesizer/src/menu.c midi_synthesizer/src/ui.c midi_synthesizer/src/utils.c \
+ *       Lib_EaBaseBoard/src/oled.c Lib_EaBaseBoard/src/font5x7.c \
+ *       Lib_EaBaseBoard/host/oled_emu.c \
+ *       Lib_EaBaseBoard/host/i2c_emu.c -o oled_anim_bench
+ *
+ * Usage: oled_anim_bench
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "oled.h"
+#include "oled_emu.h"
+
+#include "amplifier.h"
+#include "audio.h"
+#include "menu.h"
+#include "scope.h"
+#include "synth.h"
+#include "wavetables.h"
+
+// Frames per animation, the counts are averaged.
+#define ANIM_FRAMES             64
+
+// Blocks needed for one scope capture.
+#define CAPTURE_BLOCKS          ((SCOPE_SAMPLE_COUNT * 2) / AUDIO_BLOCK_SIZE)
+
+// Saw table used for the scope input, free of aliasing over the sweep.
+#define SAW_LEVEL               3
+
+// Scope input sweeps from this frequency up by SWEEP_STEP Hz per frame.
+#define SWEEP_START             220
+#define SWEEP_STEP              5
+
+// Needle gauge, a half circle in the middle of the display.
+#define GAUGE_X                 48
+#define GAUGE_Y                 56
+#define GAUGE_RADIUS            40
+
+#define BOOT_FREQUENCY          440
+#define BOOT_VOLUME             10
+
+struct Animation {
+    const char *name;
+    void (*start)(void);
+    void (*draw)(uint32_t frame);
+};
+
+static uint32_t blocks[CAPTURE_BLOCKS][AUDIO_BLOCK_SIZE];
+
+/**
+ * @brief   Shows the menu as after boot.
+ *
+ * @return  None
+ */
+static void start_menu(void) {
+    menu_init(false, BOOT_FREQUENCY, BOOT_VOLUME, MENU_ENTRY_FREQUENCY);
+    (void)menu_render();
+}
+
+/**
+ * @brief   Turns the frequency up by one step per frame, as with the rotary encoder.
+ *
+ * @param   frame   Frame number.
+ *
+ * @return  None
+ */
+static void draw_frequency(uint32_t frame) {
+    menu_set_value(MENU_ENTRY_FREQUENCY, BOOT_FREQUENCY + (int)frame + 1);
+    (void)menu_render();
+}
+
+/**
+ * @brief   Moves the volume up and down through its whole range.
+ *
+ * @param   frame   Frame number.
+ *
+ * @return  None
+ */
+static void draw_volume(uint32_t frame) {
+    uint32_t step = frame % (2U * AMPLIFIER_LEVEL_MAX);
+    int volume = (int)((step < AMPLIFIER_LEVEL_MAX) ? step : ((2U * AMPLIFIER_LEVEL_MAX) - step));
+
+    menu_set_value(MENU_ENTRY_VOLUME, volume);
+    (void)menu_render();
+}
+
+/**
+ * @brief   Clears the display for the animations that draw everything themselves.
+ *
+ * @return  None
+ */
+static void start_blank(void) {
+    oled_clearScreen(OLED_COLOR_BLACK);
+}
+
+/**
+ * @brief   Draws a scope view frame of a saw wave that sweeps up in frequency.
+ *
+ * @param   frame   Frame number.
+ *
+ * @return  None
+ */
+static void draw_scope(uint32_t frame) {
+    uint32_t frequency = SWEEP_START + (frame * SWEEP_STEP);
+    // 32 bit phase, the top WAVE_SAMPLES_COUNT_LOG2 bits index the table.
+    uint32_t step = (uint32_t)(((uint64_t)frequency << 32) / AUDIO_SAMPLE_RATE);
+    uint32_t phase = 0;
+
+    for (uint32_t b = 0; b < CAPTURE_BLOCKS; b++) {
+        for (uint32_t i = 0; i < AUDIO_BLOCK_SIZE; i++) {
+            int32_t sample = wavetable_saw[SAW_LEVEL][phase >> (32 - WAVE_SAMPLES_COUNT_LOG2)];
+            int32_t value = (sample >> 7) + DAC_VALUE_CENTER;
+            blocks[b][i] = (uint32_t)value << DAC_VALUE_SHIFT;
+            phase += step;
+        }
+    }
+
+    scope_arm();
+    for (uint32_t b = 0; b < CAPTURE_BLOCKS; b++) {
+        scope_capture(blocks[b], AUDIO_BLOCK_SIZE);
+    }
+    scope_analyze();
+    scope_draw(false);
+}
+
+/**
+ * @brief   Draws a gauge whose needle swings across its scale, clearing the dial each frame.
+ *
+ * @param   frame   Frame number.
+ *
+ * @return  None
+ */
+static void draw_needle(uint32_t frame) {
+    // Needle end points on the dial, left to right, from the sine table.
+    uint32_t position = frame % (2U * 32U);
+    uint32_t angle = (position < 32U) ? position : (64U - position);
+    uint32_t index = (angle * WAVE_SAMPLES_COUNT) / 64U;
+    int32_t sine = wavetable_sine[index];
+    int32_t cosine = wavetable_sine[(index + (WAVE_SAMPLES_COUNT / 4U)) % WAVE_SAMPLES_COUNT];
+    int32_t x = GAUGE_X - ((cosine * GAUGE_RADIUS) / 32768);
+    int32_t y = GAUGE_Y - ((sine * GAUGE_RADIUS) / 32768);
+
+    oled_fillRect(GAUGE_X - GAUGE_RADIUS, GAUGE_Y - GAUGE_RADIUS, GAUGE_X + GAUGE_RADIUS,
+                  GAUGE_Y, OLED_COLOR_BLACK);
+    oled_circle(GAUGE_X, GAUGE_Y, GAUGE_RADIUS, OLED_COLOR_WHITE);
+    oled_line(GAUGE_X, GAUGE_Y, (uint8_t)x, (uint8_t)y, OLED_COLOR_WHITE);
+}
+
+static const struct Animation animations[] = {
+    { "frequency ramp", start_menu, draw_frequency },
+    { "volume ramp", start_menu, draw_volume },
+    { "scope sweep", start_blank, draw_scope },
+    { "needle gauge", start_blank, draw_needle },
+};
+
+int main(void) {
+    oled_emu_stats_t stats;
+
+    oledEmu_reset();
+    oled_init();
+    oled_setAutoFlush(0);
+
+#ifdef OLED_USE_I2C
+    printf("I2C back end\n");
+#else
+    printf("SPI back end\n");
+#endif
+    printf("%-16s %10s %10s %10s\n", "animation", "writes", "cmd B", "total B");
+
+    for (size_t i = 0; i < sizeof(animations) / sizeof(animations[0]); i++) {
+        const struct Animation *animation = &animations[i];
+
+        animation->start();
+        (void)oled_flushDma(NULL);
+        oledEmu_runDma();
+        oledEmu_clearStats();
+
+        for (uint32_t frame = 0; frame < ANIM_FRAMES; frame++) {
+            animation->draw(frame);
+            (void)oled_flushDma(NULL);
+            oledEmu_runDma();
+        }
+        oledEmu_getStats(&stats);
+
+        // Data writes, each needs its own address setup.
+        uint32_t writes = stats.dmaTransfers + stats.i2cTransfers;
+        uint32_t total = (stats.i2cTransfers != 0U) ? stats.i2cBytes
+                                                    : (stats.commandBytes + stats.dataBytes);
+
+        printf("%-16s %10.1f %10.1f %10.1f\n", animation->name, (double)writes / ANIM_FRAMES,
+               (double)stats.commandBytes / ANIM_FRAMES, (double)total / ANIM_FRAMES);
+    }
+
+    return EXIT_SUCCESS;
+}
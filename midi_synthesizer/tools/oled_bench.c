@@ -0,0 +1,140 @@
+/*
+ * Measures how many drawing primitives per second the OLED driver renders into its shadow
+ * framebuffer on a PC, with the OLED emulator from Lib_EaBaseBoard/host. Nothing is
+ * flushed, so only the drawing itself is timed. Every primitive gets the same pseudo-random
+ * coordinates in every run, and the best of several runs is reported.
+ *
+ * Build from the repository root:
+ *
+ *   gcc -O2 -no-pie -std=gnu99 -ILib_EaBaseBoard/host/inc -ILib_EaBaseBoard/host \
+ *       -ILib_EaBaseBoard/inc -ILib_MCU/inc \
+ *       midi_synthesizer/tools/oled_bench.c Lib_EaBaseBoard/src/oled.c \
+ *       Lib_EaBaseBoard/src/font5x7.c Lib_EaBaseBoard/host/oled_emu.c \
+ *       Lib_EaBaseBoard/host/i2c_emu.c -o oled_bench
+ *
+ * Usage: oled_bench
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "oled.h"
+#include "oled_emu.h"
+
+// Primitives drawn per run.
+#define BENCH_COUNT             200000
+
+// Runs per primitive, the fastest one is reported.
+#define BENCH_RUNS              7
+
+enum Primitive {
+    PRIMITIVE_LINE,
+    PRIMITIVE_CIRCLE,
+    PRIMITIVE_RECT,
+    PRIMITIVE_FILL_RECT,
+    PRIMITIVE_H_LINE,
+    PRIMITIVE_V_LINE,
+    PRIMITIVE_COUNT,
+};
+
+static const char *const names[PRIMITIVE_COUNT] = {
+    "line",
+    "circle",
+    "rect",
+    "fillRect",
+    "hLine",
+    "vLine",
+};
+
+static uint32_t seed;
+
+/**
+ * @brief   Returns a pseudo-random number.
+ *
+ * @param   range   Upper bound, excluded.
+ *
+ * @return  Number from 0 to range - 1.
+ */
+static uint8_t random_below(uint32_t range) {
+    seed = (seed * 1103515245U) + 12345U;
+    return (uint8_t)((seed >> 8) % range);
+}
+
+/**
+ * @brief   Returns the time of a monotonic clock.
+ *
+ * @return  Time in seconds.
+ */
+static double now_seconds(void) {
+    struct timespec time;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &time);
+    return (double)time.tv_sec + ((double)time.tv_nsec * 1e-9);
+}
+
+/**
+ * @brief   Draws BENCH_COUNT primitives of one kind.
+ *
+ * @param   primitive   Kind of primitive.
+ *
+ * @return  Time taken in seconds.
+ */
+static double run(enum Primitive primitive) {
+    seed = 1;
+    double start = now_seconds();
+
+    for (uint32_t i = 0; i < BENCH_COUNT; i++) {
+        uint8_t x0 = random_below(OLED_DISPLAY_WIDTH);
+        uint8_t y0 = random_below(OLED_DISPLAY_HEIGHT);
+        uint8_t x1 = random_below(OLED_DISPLAY_WIDTH);
+        uint8_t y1 = random_below(OLED_DISPLAY_HEIGHT);
+        oled_color_t color = ((i & 1U) == 0U) ? OLED_COLOR_WHITE : OLED_COLOR_BLACK;
+
+        switch (primitive) {
+            case PRIMITIVE_LINE:
+                oled_line(x0, y0, x1, y1, color);
+                break;
+            case PRIMITIVE_CIRCLE:
+                oled_circle(x0, y0, y1 / 2U, color);
+                break;
+            case PRIMITIVE_RECT:
+                oled_rect(x0, y0, x1, y1, color);
+                break;
+            case PRIMITIVE_FILL_RECT:
+                oled_fillRect(x0, y0, x1, y1, color);
+                break;
+            case PRIMITIVE_H_LINE:
+                oled_line(x0, y0, x1, y0, color);
+                break;
+            case PRIMITIVE_V_LINE:
+                oled_line(x0, y0, x0, y1, color);
+                break;
+            default:
+                break;
+        }
+    }
+
+    return now_seconds() - start;
+}
+
+int main(void) {
+    oledEmu_reset();
+    oled_init();
+    oled_setAutoFlush(0);
+
+    printf("%-10s %14s\n", "primitive", "per second");
+    for (int primitive = 0; primitive < PRIMITIVE_COUNT; primitive++) {
+        double best = run((enum Primitive)primitive);
+        for (int i = 1; i < BENCH_RUNS; i++) {
+            double time = run((enum Primitive)primitive);
+            if (time < best) {
+                best = time;
+            }
+        }
+        printf("%-10s %14.0f\n", names[primitive], (double)BENCH_COUNT / best);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,139 @@
+/*
+ * Reports how many frames per second the OLED bus can carry for typical screen updates, with
+ * the OLED emulator from Lib_EaBaseBoard/host. Every frame is drawn into the framebuffer and
+ * sent with oled_flushDma() like the firmware does; the bytes and transactions on the bus are
+ * counted and turned into bus time. The CPU time for drawing isn't included, see oled_bench.c.
+ *
+ * Bus time is counted as on the target: SPI (SSP1) runs at 1 MHz with 8 clocks per byte.
+ * I2C runs at 100 kHz (and 400 kHz in fast mode) with 9 clocks per byte including the ACK,
+ * one more byte for the address and about 2 clocks for the start and stop of every
+ * transaction.
+ *
+ * Build from the repository root, add -DOLED_USE_I2C for the I2C back end:
+ *
+ *   gcc -no-pie -std=gnu99 -ILib_EaBaseBoard/host/inc -ILib_EaBaseBoard/host \
+ *       -ILib_EaBaseBoard/inc -ILib_MCU/inc \
+ *       midi_synthesizer/tools/oled_fps.c Lib_EaBaseBoard/src/oled.c \
+ *       Lib_EaBaseBoard/src/font5x7.c Lib_EaBaseBoard/host/oled_emu.c \
+ *       Lib_EaBaseBoard/host/i2c_emu.c -o oled_fps
+ *
+ * Usage: oled_fps
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "oled.h"
+#include "oled_emu.h"
+
+// Bus clocks, see oled.c and init_i2c() in main.c.
+#define SPI_CLOCK_HZ            1000000.0
+#define I2C_CLOCK_HZ            100000.0
+#define I2C_FAST_CLOCK_HZ       400000.0
+
+// Frames sent per kind of update, the counts are averaged.
+#define FPS_FRAMES              16
+
+struct Frame {
+    const char *name;
+    void (*draw)(uint32_t frame);
+};
+
+/**
+ * @brief   Changes every pixel, e.g. a screen switch or the scope view.
+ *
+ * @param   frame   Frame number.
+ *
+ * @return  None
+ */
+static void draw_full(uint32_t frame) {
+    oled_clearScreen(((frame & 1U) == 0U) ? OLED_COLOR_WHITE : OLED_COLOR_BLACK);
+}
+
+/**
+ * @brief   Rewrites one row of text across the display, e.g. a menu line.
+ *
+ * @param   frame   Frame number.
+ *
+ * @return  None
+ */
+static void draw_row(uint32_t frame) {
+    static uint8_t volume[] = "Volume    12345";
+    static uint8_t frequency[] = "Frequency 54321";
+
+    oled_putString(0, 8, ((frame & 1U) == 0U) ? volume : frequency, OLED_COLOR_WHITE,
+                   OLED_COLOR_BLACK);
+}
+
+/**
+ * @brief   Rewrites a five digit value, e.g. one rotary tick.
+ *
+ * @param   frame   Frame number.
+ *
+ * @return  None
+ */
+static void draw_value(uint32_t frame) {
+    uint8_t text[6];
+
+    (void)snprintf((char *)text, sizeof(text), "%05u", (unsigned)(frame * 37U));
+    oled_putString(60, 8, text, OLED_COLOR_WHITE, OLED_COLOR_BLACK);
+}
+
+static const struct Frame frames[] = {
+    { "full screen", draw_full },
+    { "text row", draw_row },
+    { "5-char value", draw_value },
+};
+
+int main(void) {
+    oled_emu_stats_t stats;
+
+    oledEmu_reset();
+    oled_init();
+    oled_setAutoFlush(0);
+
+#ifdef OLED_USE_I2C
+    printf("I2C back end\n");
+    printf("%-14s %8s %8s %10s %8s %10s %8s\n", "frame", "trans", "bytes", "100k us", "fps",
+           "400k us", "fps");
+#else
+    printf("SPI back end\n");
+    printf("%-14s %8s %8s %10s %8s\n", "frame", "trans", "bytes", "1M us", "fps");
+#endif
+
+    for (size_t i = 0; i < sizeof(frames) / sizeof(frames[0]); i++) {
+        oled_clearScreen(OLED_COLOR_BLACK);
+        (void)oled_flushDma(NULL);
+        oledEmu_runDma();
+        oledEmu_clearStats();
+
+        for (uint32_t frame = 0; frame < FPS_FRAMES; frame++) {
+            frames[i].draw(frame);
+            (void)oled_flushDma(NULL);
+            oledEmu_runDma();
+        }
+        oledEmu_getStats(&stats);
+
+#ifdef OLED_USE_I2C
+        double transactions = (double)stats.i2cTransfers / FPS_FRAMES;
+        double bytes = (double)stats.i2cBytes / FPS_FRAMES;
+        double bits = ((bytes + transactions) * 9.0) + (2.0 * transactions);
+        double time = bits / I2C_CLOCK_HZ;
+        double fast_time = bits / I2C_FAST_CLOCK_HZ;
+
+        printf("%-14s %8.1f %8.1f %10.0f %8.1f %10.0f %8.1f\n", frames[i].name, transactions,
+               bytes, time * 1e6, 1.0 / time, fast_time * 1e6, 1.0 / fast_time);
+#else
+        double transactions = (double)(stats.transfers + stats.dmaTransfers) / FPS_FRAMES;
+        double bytes = (double)(stats.commandBytes + stats.dataBytes) / FPS_FRAMES;
+        double time = (bytes * 8.0) / SPI_CLOCK_HZ;
+
+        printf("%-14s %8.1f %8.1f %10.0f %8.1f\n", frames[i].name, transactions, bytes,
+               time * 1e6, 1.0 / time);
+#endif
+    }
+
+    return EXIT_SUCCESS;
+}
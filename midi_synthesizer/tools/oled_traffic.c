@@ -0,0 +1,345 @@
+/*
+ * Counts the SPI transfers and bytes the OLED driver sends for a few typical drawing
+ * calls, before and after drawing went through the shadow framebuffer, with the OLED
+ * emulator from Lib_EaBaseBoard/host.
+ *
+ * "Before" is the old per-pixel path of Lib_EaBaseBoard/src/oled.c, kept here as it was:
+ * every pixel set its page and column with three one-byte command transfers and then sent
+ * its framebuffer byte in a fourth, and oled_clearScreen() sent every page with an address
+ * setup and all 132 controller columns. Its pixel bounds check let x == 96 through, which
+ * is kept too, as it changes the counts. "After" is the driver as it is: drawing only
+ * changes the framebuffer and oled_flush() sends the changed columns of every page in one
+ * burst. Both start from a black screen that is already on the display.
+ *
+ * The pictures of both paths are compared where the old path stays inside the display.
+ * The exit status is 1 if they differ or the new path doesn't send fewer transfers and
+ * bytes, except for clearScreen, which needs the same transfers.
+ *
+ * Build from the repository root (SPI back end only, the old path doesn't know I2C):
+ *
+ *   gcc -no-pie -std=gnu99 -ILib_EaBaseBoard/host/inc -ILib_EaBaseBoard/host \
+ *       -ILib_EaBaseBoard/inc -ILib_MCU/inc \
+ *       midi_synthesizer/tools/oled_traffic.c Lib_EaBaseBoard/src/oled.c \
+ *       Lib_EaBaseBoard/src/font5x7.c Lib_EaBaseBoard/host/oled_emu.c \
+ *       Lib_EaBaseBoard/host/i2c_emu.c -o oled_traffic
+ *
+ * Usage: oled_traffic
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "lpc17xx_gpio.h"
+#include "lpc17xx_ssp.h"
+
+#include "font5x7.h"
+#include "oled.h"
+#include "oled_emu.h"
+
+#ifdef OLED_USE_I2C
+#error "oled_traffic only counts the SPI back end"
+#endif
+
+// Pins and layout of the old driver.
+#define OLD_DC_PORT             2
+#define OLD_DC_PIN              (1UL << 7)
+#define OLD_CS_PORT             0
+#define OLD_CS_PIN              (1UL << 6)
+#define OLD_X_OFFSET            18
+#define OLD_PAGE_COUNT          8
+#define OLD_CONTROLLER_COLUMNS  132
+#define OLD_FONT_COLUMNS        6
+#define OLD_FONT_ROWS           8
+
+#define OLD_FB_SIZE             ((OLED_DISPLAY_WIDTH * OLED_DISPLAY_HEIGHT) / 8)
+
+struct Traffic {
+    uint32_t transfers;
+    uint32_t bytes;
+};
+
+struct Scenario {
+    const char *name;
+    void (*draw_old)(void);
+    void (*draw_new)(void);
+    bool inside;        // The old path stays inside the display, the pictures must match.
+    bool same_count;    // Both paths need the same number of transfers.
+};
+
+static uint32_t failures = 0;
+
+// Framebuffer of the old driver.
+static uint8_t old_fb[OLD_FB_SIZE];
+
+static uint8_t old_picture[OLED_DISPLAY_WIDTH * OLED_DISPLAY_HEIGHT];
+static uint8_t new_picture[OLED_DISPLAY_WIDTH * OLED_DISPLAY_HEIGHT];
+
+/**
+ * @brief   Reports a failed check.
+ *
+ * @param   what    Description of the check.
+ *
+ * @return  None
+ */
+static void fail(const char *what) {
+    printf("FAILED: %s\n", what);
+    failures++;
+}
+
+/**
+ * @brief   Sends bytes to the display in one polled SSP transfer, as the old driver did.
+ *
+ * @param   data    true for display data, false for commands.
+ * @param   buf     Bytes to send.
+ * @param   len     Number of bytes.
+ *
+ * @return  None
+ */
+static void old_write(bool data, uint8_t *buf, uint32_t len) {
+    SSP_DATA_SETUP_Type xfer;
+
+    if (data) {
+        GPIO_SetValue(OLD_DC_PORT, OLD_DC_PIN);
+    } else {
+        GPIO_ClearValue(OLD_DC_PORT, OLD_DC_PIN);
+    }
+    GPIO_ClearValue(OLD_CS_PORT, OLD_CS_PIN);
+
+    xfer.tx_data = buf;
+    xfer.rx_data = NULL;
+    xfer.length = len;
+    (void)SSP_ReadWrite(LPC_SSP1, &xfer, SSP_TRANSFER_POLLING);
+
+    GPIO_SetValue(OLD_CS_PORT, OLD_CS_PIN);
+}
+
+/**
+ * @brief   Sets the page and column, three one-byte command transfers.
+ *
+ * @return  None
+ */
+static void old_set_address(uint8_t page, uint8_t low, uint8_t high) {
+    old_write(false, &page, 1);
+    old_write(false, &low, 1);
+    old_write(false, &high, 1);
+}
+
+/**
+ * @brief   The old oled_putPixel(): updates the framebuffer and sends its byte.
+ *
+ * @note    The bounds check of the old driver is kept, x == OLED_DISPLAY_WIDTH writes
+ *          column 0 of the next page in the framebuffer and an unused controller column.
+ *
+ * @return  None
+ */
+static void old_put_pixel(uint8_t x, uint8_t y, oled_color_t color) {
+    if ((x > OLED_DISPLAY_WIDTH) || (y > OLED_DISPLAY_HEIGHT)) {
+        return;
+    }
+
+    uint8_t page = (uint8_t)(y >> 3);
+    uint16_t column = (uint16_t)(x + OLD_X_OFFSET);
+    old_set_address((uint8_t)(0xB0U + page), (uint8_t)(column & 0x0FU),
+                    (uint8_t)(0x10U | (column >> 4)));
+
+    uint32_t pos = ((uint32_t)page * OLED_DISPLAY_WIDTH) + x;
+    if (color != OLED_COLOR_BLACK) {
+        old_fb[pos] |= (uint8_t)(1U << (y & 7U));
+    } else {
+        old_fb[pos] &= (uint8_t)~(1U << (y & 7U));
+    }
+    old_write(true, &old_fb[pos], 1);
+}
+
+/**
+ * @brief   The old oled_fillRect(): one pixel at a time.
+ *
+ * @return  None
+ */
+static void old_fill_rect(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, oled_color_t color) {
+    for (uint32_t y = y0; y <= y1; y++) {
+        for (uint32_t x = x0; x <= x1; x++) {
+            old_put_pixel((uint8_t)x, (uint8_t)y, color);
+        }
+    }
+}
+
+/**
+ * @brief   The old oled_putString(): every glyph row drawn pixel by pixel.
+ *
+ * @return  None
+ */
+static void old_put_string(uint8_t x, uint8_t y, const char *text, oled_color_t fg,
+                           oled_color_t bg) {
+    for (const char *c = text; *c != '\0'; c++) {
+        if ((x >= (OLED_DISPLAY_WIDTH - 8)) || (y >= (OLED_DISPLAY_HEIGHT - 8))) {
+            return;
+        }
+        uint8_t ch = (uint8_t)*c;
+        if ((ch < 0x20U) || (ch > 0x7FU)) {
+            ch = 0x20;
+        }
+        for (uint32_t row = 0; row < OLD_FONT_ROWS; row++) {
+            uint8_t bits = font5x7[ch - 0x20U][row];
+            for (uint32_t col = 0; col < OLD_FONT_COLUMNS; col++) {
+                old_put_pixel((uint8_t)(x + col), (uint8_t)(y + row),
+                              ((bits & (0x80U >> col)) != 0U) ? fg : bg);
+            }
+        }
+        x = (uint8_t)(x + OLD_FONT_COLUMNS);
+    }
+}
+
+/**
+ * @brief   The old oled_clearScreen(): every page with all controller columns.
+ *
+ * @return  None
+ */
+static void old_clear_screen(oled_color_t color) {
+    uint8_t buf[OLD_CONTROLLER_COLUMNS];
+    uint8_t value = (color == OLED_COLOR_WHITE) ? 0xFFU : 0x00U;
+
+    for (uint8_t page = 0; page < (uint8_t)OLD_PAGE_COUNT; page++) {
+        old_set_address((uint8_t)(0xB0U + page), 0x00, 0x10);
+        memset(buf, value, sizeof(buf));
+        old_write(true, buf, sizeof(buf));
+    }
+    memset(old_fb, value, sizeof(old_fb));
+}
+
+static void draw_char_old(void) {
+    old_put_string(1, 1, "A", OLED_COLOR_WHITE, OLED_COLOR_BLACK);
+}
+
+static void draw_char_new(void) {
+    (void)oled_putChar(1, 1, 'A', OLED_COLOR_WHITE, OLED_COLOR_BLACK);
+}
+
+// The frequency line of the old main screen: its bar and "Freq: 440" in inverted colors.
+static void draw_frequency_old(void) {
+    old_fill_rect(0, 0, 100, 9, OLED_COLOR_WHITE);
+    old_put_string(1, 1, "Freq: ", OLED_COLOR_BLACK, OLED_COLOR_WHITE);
+    old_put_string(1 + (6 * 6), 1, "440", OLED_COLOR_BLACK, OLED_COLOR_WHITE);
+}
+
+static void draw_frequency_new(void) {
+    oled_fillRect(0, 0, 100, 9, OLED_COLOR_WHITE);
+    oled_putString(1, 1, (uint8_t *)"Freq: ", OLED_COLOR_BLACK, OLED_COLOR_WHITE);
+    oled_putString(1 + (6 * 6), 1, (uint8_t *)"440", OLED_COLOR_BLACK, OLED_COLOR_WHITE);
+}
+
+static void draw_clear_old(void) {
+    old_clear_screen(OLED_COLOR_WHITE);
+}
+
+static void draw_clear_new(void) {
+    oled_clearScreen(OLED_COLOR_WHITE);
+}
+
+static const struct Scenario scenarios[] = {
+    { "putChar", draw_char_old, draw_char_new, true, false },
+    // x == 96 of the old bar wrote a framebuffer byte of the next page, which is then sent
+    // for column 0, so the old picture is wrong there.
+    { "frequency line", draw_frequency_old, draw_frequency_new, false, false },
+    { "clearScreen", draw_clear_old, draw_clear_new, true, true },
+};
+
+/**
+ * @brief   Reads the bus counters of the emulator.
+ *
+ * @return  Transfers and bytes since the counters were cleared.
+ */
+static struct Traffic traffic(void) {
+    oled_emu_stats_t stats;
+    struct Traffic result;
+
+    oledEmu_getStats(&stats);
+    result.transfers = stats.transfers + stats.dmaTransfers;
+    result.bytes = stats.commandBytes + stats.dataBytes;
+    return result;
+}
+
+/**
+ * @brief   Copies the visible pixels of the emulated display.
+ *
+ * @param   picture     OLED_DISPLAY_WIDTH * OLED_DISPLAY_HEIGHT pixels.
+ *
+ * @return  None
+ */
+static void take_picture(uint8_t *picture) {
+    for (uint8_t y = 0; y < (uint8_t)OLED_DISPLAY_HEIGHT; y++) {
+        for (uint8_t x = 0; x < (uint8_t)OLED_DISPLAY_WIDTH; x++) {
+            picture[((uint32_t)y * OLED_DISPLAY_WIDTH) + x] = oledEmu_getPixel(x, y);
+        }
+    }
+}
+
+/**
+ * @brief   Draws a scenario with the old path on a black screen.
+ *
+ * @return  Transfers and bytes of the drawing.
+ */
+static struct Traffic run_old(const struct Scenario *scenario) {
+    oledEmu_reset();
+    oled_init();
+    old_clear_screen(OLED_COLOR_BLACK);
+    oledEmu_clearStats();
+
+    scenario->draw_old();
+    take_picture(old_picture);
+    return traffic();
+}
+
+/**
+ * @brief   Draws a scenario with the driver as it is on a black screen, then flushes.
+ *
+ * @return  Transfers and bytes of the flush.
+ */
+static struct Traffic run_new(const struct Scenario *scenario) {
+    oledEmu_reset();
+    oled_init();
+    oled_setAutoFlush(0);
+    oled_clearScreen(OLED_COLOR_BLACK);
+    oled_flush();
+    oledEmu_clearStats();
+
+    scenario->draw_new();
+    oled_flush();
+    take_picture(new_picture);
+    return traffic();
+}
+
+int main(void) {
+    printf("%-16s %18s %18s\n", "", "before", "after");
+    printf("%-16s %9s %8s %9s %8s\n", "drawing", "transfers", "bytes", "transfers", "bytes");
+
+    for (size_t i = 0; i < (sizeof(scenarios) / sizeof(scenarios[0])); i++) {
+        const struct Scenario *scenario = &scenarios[i];
+        struct Traffic before = run_old(scenario);
+        struct Traffic after = run_new(scenario);
+
+        printf("%-16s %9u %8u %9u %8u\n", scenario->name, (unsigned)before.transfers,
+               (unsigned)before.bytes, (unsigned)after.transfers, (unsigned)after.bytes);
+
+        if (scenario->inside && (memcmp(old_picture, new_picture, sizeof(old_picture)) != 0)) {
+            printf("  %s\n", scenario->name);
+            fail("same picture on both paths");
+        }
+        bool fewer_transfers = scenario->same_count ? (after.transfers == before.transfers)
+                                                    : (after.transfers < before.transfers);
+        if (!fewer_transfers || (after.bytes >= before.bytes)) {
+            printf("  %s\n", scenario->name);
+            fail("fewer transfers and bytes after");
+        }
+    }
+
+    if (failures != 0U) {
+        printf("%u checks failed\n", (unsigned)failures);
+        return 1;
+    }
+    printf("all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,245 @@
+/*
+ * Checks the tuning of the phase-accumulator oscillators (midi_synthesizer/src/oscillator.c)
+ * on a PC and compares them with the old way of setting the pitch. The firmware used to play
+ * a 60-sample LUT with the DAC DMA and set the pitch in whole Hz through the DMA timeout,
+ * 25 MHz / (f * 60) rounded down, so only one pitch could play at a time.
+ *
+ * The worst error of osc_phase_step_from_note() against equal temperament is reported over
+ * every note from 0 to 127 with every detune from -100 to +100 cents, and must be below
+ * 0.01 cent. The old DMA timeout is reported for the notes it could reach. Then the time
+ * per sample is measured for a voice read from the old 60-sample LUT (index from a 64 bit
+ * multiply, no interpolation) and from the 1024-sample sine table with linear interpolation
+ * the way synth.c does it. The exit status is 1 if any check fails.
+ *
+ * The times are those of the PC, they only compare the two loops.
+ *
+ * Build from the repository root:
+ *
+ *   gcc -O2 -std=gnu99 -Imidi_synthesizer/src midi_synthesizer/tools/osc_tuning.c \
+ *       midi_synthesizer/src/oscillator.c midi_synthesizer/src/wavetables.c -lm -o osc_tuning
+ *
+ * Usage: osc_tuning
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "audio.h"
+#include "oscillator.h"
+#include "wavetables.h"
+
+#define TUNING_ERROR_MAX_CENTS  0.01
+
+// The old pitch setting: DAC clock, LUT length and the panel frequency range.
+#define OLD_PCLK_DAC            25000000U
+#define OLD_SAMPLES_COUNT       60
+#define OLD_FREQUENCY_MIN       10
+#define OLD_FREQUENCY_MAX       800
+
+// Samples per measurement, the fastest of BENCH_RUNS measurements is reported.
+#define BENCH_SAMPLES           (1U << 26)
+#define BENCH_RUNS              5
+#define BENCH_BLOCK_SIZE        64
+
+// Same split of the phase as in synth.c.
+#define PHASE_INDEX_SHIFT       (32 - WAVE_SAMPLES_COUNT_LOG2)
+#define PHASE_FRACTION_BITS     15
+#define PHASE_FRACTION_SHIFT    (PHASE_INDEX_SHIFT - PHASE_FRACTION_BITS)
+#define PHASE_FRACTION_MASK     ((1UL << PHASE_FRACTION_BITS) - 1UL)
+
+#define PI                      3.14159265358979
+
+static uint32_t failures = 0;
+
+// The old 60-sample sine LUT in DACR format.
+static uint32_t old_lut[OLD_SAMPLES_COUNT];
+
+// Keeps the compiler from dropping the samples.
+static volatile int32_t sink;
+
+/**
+ * @brief   Reports a failed check.
+ *
+ * @param   what    Description of the check.
+ *
+ * @return  None
+ */
+static void fail(const char *what) {
+    printf("FAILED: %s\n", what);
+    failures++;
+}
+
+/**
+ * @brief   Returns the time of a monotonic clock.
+ *
+ * @return  Time in seconds.
+ */
+static double now_seconds(void) {
+    struct timespec time;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &time);
+    return (double)time.tv_sec + ((double)time.tv_nsec * 1e-9);
+}
+
+/**
+ * @brief   Frequency of a pitch in equal temperament, A4 (note 69) is 440 Hz.
+ *
+ * @param   cents   Pitch in cents above note 0.
+ *
+ * @return  Frequency in Hz.
+ */
+static double pitch_frequency(double cents) {
+    return 440.0 * pow(2.0, (cents - (69.0 * OSC_CENTS_PER_SEMITONE)) / 1200.0);
+}
+
+/**
+ * @brief   Distance between two frequencies.
+ *
+ * @return  Absolute difference in cents.
+ */
+static double cents_between(double a, double b) {
+    return fabs(1200.0 * log2(a / b));
+}
+
+/**
+ * @brief   Worst error of osc_phase_step_from_note() over all notes and detunes.
+ *
+ * @return  None
+ */
+static void check_note_tuning(void) {
+    double worst = 0.0;
+    uint32_t worst_note = 0;
+    int32_t worst_cents = 0;
+
+    for (uint32_t note = 0; note <= (uint32_t)OSC_NOTE_MAX; note++) {
+        for (int32_t cents = -OSC_CENTS_PER_SEMITONE; cents <= OSC_CENTS_PER_SEMITONE; cents++) {
+            int32_t pitch = ((int32_t)note * OSC_CENTS_PER_SEMITONE) + cents;
+            if ((pitch < 0) || (pitch > (OSC_NOTE_MAX * OSC_CENTS_PER_SEMITONE))) {
+                continue;   // Clamped, checked below.
+            }
+            double frequency = ((double)osc_phase_step_from_note(note, cents) * AUDIO_SAMPLE_RATE) /
+                               4294967296.0;
+            double error = cents_between(frequency, pitch_frequency(pitch));
+            if (error > worst) {
+                worst = error;
+                worst_note = note;
+                worst_cents = cents;
+            }
+        }
+    }
+
+    printf("phase steps:  worst error %.5f cent (note %u, %+d cents)\n", worst,
+           (unsigned)worst_note, (int)worst_cents);
+    if (worst >= TUNING_ERROR_MAX_CENTS) {
+        fail("note tuning");
+    }
+
+    if ((osc_phase_step_from_note(0, -50) != osc_phase_step_from_note(0, 0)) ||
+        (osc_phase_step_from_note(127, 50) != osc_phase_step_from_note(127, 0)) ||
+        (osc_phase_step_from_note(200, 0) != osc_phase_step_from_note(127, 0))) {
+        fail("pitches outside of notes 0 - 127 clamped");
+    }
+}
+
+/**
+ * @brief   Worst error of the old DMA timeout for the notes in the old frequency range.
+ *
+ * @note    The old firmware only had whole Hz, so a note is first rounded to them.
+ *
+ * @return  None
+ */
+static void report_old_tuning(void) {
+    double worst = 0.0;
+    uint32_t worst_note = 0;
+
+    for (uint32_t note = 0; note <= (uint32_t)OSC_NOTE_MAX; note++) {
+        double exact = pitch_frequency((double)note * OSC_CENTS_PER_SEMITONE);
+        uint32_t hz = (uint32_t)lround(exact);
+        if ((hz < (uint32_t)OLD_FREQUENCY_MIN) || (hz > (uint32_t)OLD_FREQUENCY_MAX)) {
+            continue;
+        }
+        uint32_t timeout = OLD_PCLK_DAC / (hz * (uint32_t)OLD_SAMPLES_COUNT);
+        double played = (double)OLD_PCLK_DAC / ((double)timeout * OLD_SAMPLES_COUNT);
+        double error = cents_between(played, exact);
+        if (error > worst) {
+            worst = error;
+            worst_note = note;
+        }
+    }
+
+    printf("DMA timeout:  worst error %.2f cents (note %u), notes of %u - %u Hz only\n", worst,
+           (unsigned)worst_note, (unsigned)OLD_FREQUENCY_MIN, (unsigned)OLD_FREQUENCY_MAX);
+}
+
+/**
+ * @brief   Builds the old sine LUT.
+ *
+ * @return  None
+ */
+static void fill_old_lut(void) {
+    for (uint32_t i = 0; i < (uint32_t)OLD_SAMPLES_COUNT; i++) {
+        double value = 512.0 + (511.0 * sin((2.0 * PI * i) / OLD_SAMPLES_COUNT));
+        old_lut[i] = (uint32_t)lround(value) << 6;
+    }
+}
+
+/**
+ * @brief   Renders BENCH_SAMPLES samples of one voice from a table.
+ *
+ * @param   interpolated    true for the 1024-sample table, false for the old LUT.
+ *
+ * @return  Nanoseconds per sample.
+ */
+static double measure(int interpolated) {
+    int32_t mix[BENCH_BLOCK_SIZE];
+    uint32_t phase = 0;
+    uint32_t phase_step = osc_phase_step_from_note(69, 0);
+    double best = 0.0;
+
+    for (int run = 0; run < BENCH_RUNS; run++) {
+        double start = now_seconds();
+        for (uint32_t block = 0; block < (BENCH_SAMPLES / BENCH_BLOCK_SIZE); block++) {
+            if (interpolated) {
+                for (uint32_t i = 0; i < BENCH_BLOCK_SIZE; i++) {
+                    uint32_t index = phase >> PHASE_INDEX_SHIFT;
+                    int32_t fraction = (int32_t)((phase >> PHASE_FRACTION_SHIFT) & PHASE_FRACTION_MASK);
+                    int32_t a = wavetable_sine[index];
+                    int32_t b = wavetable_sine[index + 1U];
+                    mix[i] = a + (((b - a) * fraction) >> PHASE_FRACTION_BITS);
+                    phase += phase_step;
+                }
+            } else {
+                for (uint32_t i = 0; i < BENCH_BLOCK_SIZE; i++) {
+                    uint32_t index = (uint32_t)(((uint64_t)phase * OLD_SAMPLES_COUNT) >> 32);
+                    mix[i] = (int32_t)(old_lut[index] >> 6) - 512;
+                    phase += phase_step;
+                }
+            }
+            sink += mix[block % BENCH_BLOCK_SIZE];
+        }
+        double time = (now_seconds() - start) * 1e9 / BENCH_SAMPLES;
+        if ((run == 0) || (time < best)) {
+            best = time;
+        }
+    }
+
+    return best;
+}
+
+int main(void) {
+    check_note_tuning();
+    report_old_tuning();
+
+    fill_old_lut();
+    printf("%-32s %6.2f ns per sample\n", "60-sample LUT:", measure(0));
+    printf("%-32s %6.2f ns per sample\n", "1024-sample table, interpolated:", measure(1));
+
+    if (failures != 0U) {
+        printf("%u checks failed\n", (unsigned)failures);
+        return 1;
+    }
+    printf("all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,242 @@
+/*
+ * Builds the audio render path (synth.c and what it uses) on a PC, which shows that it
+ * doesn't depend on any peripherals, and measures how long synth_render_block() takes per
+ * output sample with 1 to 16 voices: sines, and notes played from MIDI with the channels
+ * set to all four waves, so a band-limited table is picked for every voice and block. It
+ * also checks the output: silence without any voice, the pitch and level of a single
+ * voice, that every value is in the DACR format and that no more than a block is written.
+ * The exit status is 1 if any check fails.
+ *
+ * The times are those of the PC, they only compare voice counts and changes to the render
+ * loop. At 32 kHz the Cortex-M3 has 31.25 us per sample for everything.
+ *
+ * Build from the repository root:
+ *
+ *   gcc -O2 -std=gnu99 -Imidi_synthesizer/src midi_synthesizer/tools/render_bench.c \
+ *       midi_synthesizer/src/synth.c midi_synthesizer/src/oscillator.c \
+ *       midi_synthesizer/src/wavetables.c midi_synthesizer/src/voice_alloc.c \
+ *       midi_synthesizer/src/envelope.c midi_synthesizer/src/ramp.c -o render_bench
+ *
+ * Usage: render_bench
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "audio.h"
+#include "synth.h"
+
+// Blocks per measurement, the fastest of BENCH_RUNS measurements is reported.
+#define BENCH_BLOCKS            100000
+#define BENCH_RUNS              5
+
+#define BENCH_VOICES_MAX        16
+
+// Blocks until the envelope of a new voice has reached its sustain level.
+#define SETTLE_BLOCKS           500
+
+// Single voice check: a 1 kHz sine at full level, measured over one second.
+#define CHECK_FREQUENCY         1000
+#define CHECK_BLOCKS            (AUDIO_SAMPLE_RATE / AUDIO_BLOCK_SIZE)
+
+// Four voices at full level reach full scale and the envelope holds at 192 / 256.
+#define CHECK_AMPLITUDE         (((DAC_VALUE_MAX + 1) / 2 / 4) * 192 / 256)
+
+// Never written by synth_render_block(), the low bits of a DACR value are always 0.
+#define GUARD_VALUE             0xFFFFFFFFU
+
+static uint32_t failures = 0;
+
+// Keeps the compiler from dropping the rendered samples.
+static volatile uint32_t sink;
+
+/**
+ * @brief   Reports a failed check.
+ *
+ * @param   what    Description of the check.
+ *
+ * @return  None
+ */
+static void fail(const char *what) {
+    printf("FAILED: %s\n", what);
+    failures++;
+}
+
+/**
+ * @brief   Returns the time of a monotonic clock.
+ *
+ * @return  Time in seconds.
+ */
+static double now_seconds(void) {
+    struct timespec time;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &time);
+    return (double)time.tv_sec + ((double)time.tv_nsec * 1e-9);
+}
+
+/**
+ * @brief   Converts a rendered DACR value to a signed sample around the DAC center.
+ *
+ * @param   value   DACR value.
+ *
+ * @return  Sample in DAC steps.
+ */
+static int32_t dac_sample(uint32_t value) {
+    return (int32_t)(value >> DAC_VALUE_SHIFT) - DAC_VALUE_CENTER;
+}
+
+/**
+ * @brief   Renders blocks and checks that every value is a valid DACR value.
+ *
+ * @param   blocks  Number of blocks.
+ *
+ * @return  None
+ */
+static void render_checked(uint32_t blocks) {
+    uint32_t buffer[AUDIO_BLOCK_SIZE];
+
+    for (uint32_t b = 0; b < blocks; b++) {
+        synth_render_block(buffer, AUDIO_BLOCK_SIZE);
+        for (uint32_t i = 0; i < (uint32_t)AUDIO_BLOCK_SIZE; i++) {
+            if (((buffer[i] & ((1U << DAC_VALUE_SHIFT) - 1U)) != 0U) ||
+                ((buffer[i] >> DAC_VALUE_SHIFT) > (uint32_t)DAC_VALUE_MAX)) {
+                fail("value not in the DACR format");
+                return;
+            }
+        }
+    }
+}
+
+/**
+ * @brief   Silence without voices, and a block size limit on the samples written.
+ *
+ * @return  None
+ */
+static void check_silence(void) {
+    uint32_t buffer[AUDIO_BLOCK_SIZE + 1];
+
+    synth_init();
+    buffer[AUDIO_BLOCK_SIZE] = GUARD_VALUE;
+    synth_render_block(buffer, AUDIO_BLOCK_SIZE + 1);
+
+    for (uint32_t i = 0; i < (uint32_t)AUDIO_BLOCK_SIZE; i++) {
+        if (buffer[i] != ((uint32_t)DAC_VALUE_CENTER << DAC_VALUE_SHIFT)) {
+            fail("silence without voices");
+            break;
+        }
+    }
+    if (buffer[AUDIO_BLOCK_SIZE] != GUARD_VALUE) {
+        fail("more than a block written");
+    }
+}
+
+/**
+ * @brief   Pitch and amplitude of a single voice.
+ *
+ * @return  None
+ */
+static void check_voice(void) {
+    uint32_t buffer[AUDIO_BLOCK_SIZE];
+    uint32_t crossings = 0;
+    int32_t peak = 0;
+    int32_t last = 0;
+
+    synth_init();
+    synth_voice_start(0, CHECK_FREQUENCY, SYNTH_LEVEL_MAX);
+    render_checked(SETTLE_BLOCKS);
+
+    for (uint32_t b = 0; b < (uint32_t)CHECK_BLOCKS; b++) {
+        synth_render_block(buffer, AUDIO_BLOCK_SIZE);
+        for (uint32_t i = 0; i < (uint32_t)AUDIO_BLOCK_SIZE; i++) {
+            int32_t sample = dac_sample(buffer[i]);
+            if ((last < 0) && (sample >= 0)) {
+                crossings++;
+            }
+            if (abs(sample) > peak) {
+                peak = abs(sample);
+            }
+            last = sample;
+        }
+    }
+
+    printf("1 voice at %u Hz: %u periods per second, peak %d DAC steps (expected %d)\n",
+           (unsigned)CHECK_FREQUENCY, (unsigned)crossings, (int)peak, CHECK_AMPLITUDE);
+    if ((abs((int)crossings - CHECK_FREQUENCY) > 1) || (abs(peak - CHECK_AMPLITUDE) > 2)) {
+        fail("pitch or level of a single voice");
+    }
+}
+
+/**
+ * @brief   Sends a MIDI message to the synth.
+ *
+ * @return  None
+ */
+static void send_midi(uint8_t status, uint8_t data1, uint8_t data2) {
+    struct MidiEvent event = {status, data1, data2, 2};
+
+    synth_handle_midi_event(&event);
+}
+
+/**
+ * @brief   Measures synth_render_block() with a number of voices.
+ *
+ * @param   voice_count     Voices playing.
+ * @param   mixed           true for MIDI notes of all four waves, false for sines.
+ *
+ * @return  Nanoseconds per output sample.
+ */
+static double measure(uint32_t voice_count, bool mixed) {
+    uint32_t buffer[AUDIO_BLOCK_SIZE];
+    double best = 0.0;
+
+    synth_init();
+    for (uint8_t channel = 0; channel < (uint8_t)SYNTH_WAVE_COUNT; channel++) {
+        send_midi((uint8_t)(MIDI_STATUS_PROGRAM_CHANGE | channel), channel, 0);
+    }
+    for (uint32_t v = 0; v < voice_count; v++) {
+        // Spread over four octaves, so the phase steps and the table levels differ.
+        if (mixed) {
+            send_midi((uint8_t)(MIDI_STATUS_NOTE_ON | (v % SYNTH_WAVE_COUNT)),
+                      (uint8_t)(36U + (v * 3U)), 64);
+        } else {
+            synth_voice_start(v, 110U + (v * 97U), SYNTH_LEVEL_MAX / 4U);
+        }
+    }
+    render_checked(SETTLE_BLOCKS);
+
+    for (int run = 0; run < BENCH_RUNS; run++) {
+        double start = now_seconds();
+        for (uint32_t b = 0; b < BENCH_BLOCKS; b++) {
+            synth_render_block(buffer, AUDIO_BLOCK_SIZE);
+            sink += buffer[b % AUDIO_BLOCK_SIZE];
+        }
+        double time = (now_seconds() - start) * 1e9 / ((double)BENCH_BLOCKS * AUDIO_BLOCK_SIZE);
+        if ((run == 0) || (time < best)) {
+            best = time;
+        }
+    }
+
+    return best;
+}
+
+int main(void) {
+    check_silence();
+    check_voice();
+
+    printf("ns per output sample:\n");
+    printf("%-8s %12s %12s\n", "voices", "sines", "mixed waves");
+    for (uint32_t voices = 1; voices <= BENCH_VOICES_MAX; voices *= 2U) {
+        printf("%-8u %12.1f %12.1f\n", (unsigned)voices, measure(voices, false),
+               measure(voices, true));
+    }
+
+    if (failures != 0U) {
+        printf("%u checks failed\n", (unsigned)failures);
+        return 1;
+    }
+    printf("all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,363 @@
+/*
+ * Drives the cooperative scheduler core (midi_synthesizer/src/sched.c) with a simulated tick
+ * counter on a PC, the way sched_systick.c drives it with SysTick on the board: every tick,
+ * tasks are run one at a time until none is due.
+ *
+ * Checked: periodic tasks with the periods main.c uses run exactly one period apart; the
+ * earliest deadline runs first and equal deadlines go to the lower slot; one-shot tasks run
+ * once, free their slot and can add themselves again with a varying delay; all slots in use
+ * refuse new tasks and a cancelled task doesn't run; everything keeps its spacing across the
+ * tick counter wrap from 0xFFFFFF00; and a periodic task that runs late skips and counts its
+ * missed periods instead of running them in a burst. sched_is_due() must agree with
+ * sched_run_next() on every tick. The exit status is 1 if any check fails.
+ *
+ * Build from the repository root:
+ *
+ *   gcc -O2 -std=gnu99 -Imidi_synthesizer/src midi_synthesizer/tools/sched_sim.c \
+ *       midi_synthesizer/src/sched.c -o sched_sim
+ *
+ * Usage: sched_sim
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "sched.h"
+
+// Task periods of main.c in 1 ms ticks: input, light sensor and the idle report.
+#define INPUT_PERIOD            5U
+#define LIGHT_PERIOD            250U
+#define REPORT_PERIOD           5000U
+
+#define SPACING_TICKS           100000U
+
+#define WRAP_START              0xFFFFFF00U
+#define WRAP_TICKS              1000U
+
+#define LOG_SIZE                64U
+
+// More runs than this in a single tick means a task is always due, e.g. a wrong deadline
+// comparison at the counter wrap.
+#define RUNS_PER_TICK_MAX       (4U * SCHED_TASK_COUNT)
+
+// Tasks of the simulation: each one logs the ticks it ran at.
+enum Task {
+    TASK_A,
+    TASK_B,
+    TASK_C,
+    TASK_COUNT,
+};
+
+struct TaskLog {
+    uint32_t runs;
+    uint32_t last;                  // Tick of the last run.
+    bool spaced;                    // Every run was exactly `spacing` after the previous one.
+    uint32_t spacing;               // 0 if the spacing isn't checked.
+    uint32_t ticks[LOG_SIZE];       // Ticks of the first runs.
+};
+
+static uint32_t failures = 0;
+
+static struct Scheduler sched;
+static uint32_t now;
+static struct TaskLog logs[TASK_COUNT];
+
+// Order in which tasks ran, for the ordering checks.
+static enum Task order[LOG_SIZE];
+static uint32_t order_count;
+
+// Delays of the self-rearming one-shot task, it stops at the end.
+static const uint32_t rearm_delays[] = {3, 1, 8, 0, 5, 2};
+static uint32_t rearm_index;
+
+/**
+ * @brief   Reports a failed check.
+ *
+ * @param   what    Description of the check.
+ *
+ * @return  None
+ */
+static void fail(const char *what) {
+    printf("FAILED: %s\n", what);
+    failures++;
+}
+
+/**
+ * @brief   Logs a run of a task.
+ *
+ * @param   task    Task that ran.
+ *
+ * @return  None
+ */
+static void record(enum Task task) {
+    struct TaskLog *log = &logs[task];
+
+    if ((log->runs != 0U) && (log->spacing != 0U) && ((now - log->last) != log->spacing)) {
+        log->spaced = false;
+    }
+    if (log->runs < LOG_SIZE) {
+        log->ticks[log->runs] = now;
+    }
+    if (order_count < LOG_SIZE) {
+        order[order_count] = task;
+        order_count++;
+    }
+    log->last = now;
+    log->runs++;
+}
+
+static void task_a(void) {
+    record(TASK_A);
+}
+
+static void task_b(void) {
+    record(TASK_B);
+}
+
+static void task_c(void) {
+    record(TASK_C);
+}
+
+/**
+ * @brief   One-shot task that adds itself again with the next delay, like the LED animation.
+ *
+ * @return  None
+ */
+static void task_rearm(void) {
+    record(TASK_A);
+    if (rearm_index < (sizeof(rearm_delays) / sizeof(rearm_delays[0]))) {
+        (void)sched_add_once(&sched, task_rearm, now, rearm_delays[rearm_index]);
+        rearm_index++;
+    }
+}
+
+/**
+ * @brief   Clears the scheduler, the logs and the tick counter.
+ *
+ * @param   start   First tick.
+ *
+ * @return  None
+ */
+static void reset(uint32_t start) {
+    sched_init(&sched);
+    now = start;
+    for (uint32_t t = 0; t < (uint32_t)TASK_COUNT; t++) {
+        logs[t].runs = 0;
+        logs[t].last = 0;
+        logs[t].spaced = true;
+        logs[t].spacing = 0;
+    }
+    order_count = 0;
+    rearm_index = 0;
+}
+
+/**
+ * @brief   Runs all due tasks, then advances the tick counter, for a number of ticks.
+ *
+ * @param   ticks   Ticks to simulate.
+ *
+ * @return  true if sched_is_due() agreed with sched_run_next() every time and the tasks
+ *          ran out in every tick.
+ */
+static bool simulate(uint32_t ticks) {
+    bool agreed = true;
+
+    for (uint32_t t = 0; t < ticks; t++) {
+        bool due = sched_is_due(&sched, now);
+        bool ran = sched_run_next(&sched, now);
+        uint32_t runs = 0;
+        agreed = (due == ran) && agreed;
+        while (ran && (runs < RUNS_PER_TICK_MAX)) {
+            ran = sched_run_next(&sched, now);
+            runs++;
+        }
+        if (ran) {
+            fail("tasks still due after RUNS_PER_TICK_MAX runs in a tick");
+            return false;
+        }
+        agreed = !sched_is_due(&sched, now) && agreed;
+        now++;
+    }
+
+    return agreed;
+}
+
+/**
+ * @brief   Adds a periodic task whose runs are checked for their spacing.
+ *
+ * @return  None
+ */
+static void add_spaced(enum Task task, SchedTaskFunction function, uint32_t period) {
+    logs[task].spacing = period;
+    if (sched_add_periodic(&sched, function, now, period) == SCHED_TASK_NONE) {
+        fail("periodic task added");
+    }
+}
+
+/**
+ * @brief   Spacing of periodic tasks, from tick 0 and across the counter wrap.
+ *
+ * @param   start   First tick.
+ * @param   ticks   Ticks to simulate.
+ *
+ * @return  None
+ */
+static void check_spacing(uint32_t start, uint32_t ticks) {
+    reset(start);
+    add_spaced(TASK_A, task_a, INPUT_PERIOD);
+    add_spaced(TASK_B, task_b, LIGHT_PERIOD);
+    add_spaced(TASK_C, task_c, REPORT_PERIOD);
+    bool agreed = simulate(ticks);
+
+    printf("from 0x%08X, %u ticks: %u, %u and %u runs, %u periods missed\n", (unsigned)start,
+           (unsigned)ticks, (unsigned)logs[TASK_A].runs, (unsigned)logs[TASK_B].runs,
+           (unsigned)logs[TASK_C].runs, (unsigned)sched.missed);
+
+    // The first run is one period after the task was added, the last one at most a period
+    // before the end.
+    bool ok = agreed && (sched.missed == 0U);
+    ok = ok && logs[TASK_A].spaced && (logs[TASK_A].ticks[0] == (start + INPUT_PERIOD));
+    ok = ok && logs[TASK_B].spaced && (logs[TASK_B].ticks[0] == (start + LIGHT_PERIOD));
+    ok = ok && (logs[TASK_A].runs == ((ticks - 1U) / INPUT_PERIOD));
+    ok = ok && (logs[TASK_B].runs == ((ticks - 1U) / LIGHT_PERIOD));
+    ok = ok && (logs[TASK_C].runs == ((ticks - 1U) / REPORT_PERIOD));
+    if (!ok) {
+        fail("periodic task spacing");
+    }
+}
+
+/**
+ * @brief   Earliest deadline first, lower slot first on equal deadlines.
+ *
+ * @return  None
+ */
+static void check_order(void) {
+    reset(100);
+    // Slot 0 is due last, slots 1 and 2 at the same tick.
+    (void)sched_add_once(&sched, task_a, now, 10);
+    (void)sched_add_once(&sched, task_b, now, 4);
+    (void)sched_add_once(&sched, task_c, now, 4);
+    // All of them are overdue when the scheduler gets to run.
+    now += 20;
+    (void)simulate(1);
+
+    if ((order_count != 3U) || (order[0] != TASK_B) || (order[1] != TASK_C) ||
+        (order[2] != TASK_A)) {
+        fail("earliest deadline first, lower slot on a tie");
+    }
+}
+
+/**
+ * @brief   One-shot tasks, slots and cancel.
+ *
+ * @return  None
+ */
+static void check_once(void) {
+    reset(0);
+    (void)sched_add_once(&sched, task_b, now, 0);
+    (void)sched_add_once(&sched, task_c, now, 7);
+    (void)simulate(20);
+    if ((logs[TASK_B].runs != 1U) || (logs[TASK_B].ticks[0] != 0U) ||
+        (logs[TASK_C].runs != 1U) || (logs[TASK_C].ticks[0] != 7U)) {
+        fail("one-shot tasks run once at their delay");
+    }
+
+    // Re-arming itself with a varying delay, as the LED animation does.
+    reset(50);
+    (void)sched_add_once(&sched, task_rearm, now, 2);
+    (void)simulate(100);
+    uint32_t expected = 52;
+    bool ok = (logs[TASK_A].runs == 7U);
+    for (uint32_t i = 0; ok && (i < logs[TASK_A].runs); i++) {
+        ok = (logs[TASK_A].ticks[i] == expected);
+        if (i < (sizeof(rearm_delays) / sizeof(rearm_delays[0]))) {
+            expected += rearm_delays[i];
+        }
+    }
+    if (!ok) {
+        fail("one-shot task re-arms itself");
+    }
+
+    // Every slot is free again: all of them can be taken, and no more.
+    for (uint32_t i = 0; i < (uint32_t)SCHED_TASK_COUNT; i++) {
+        ok = (sched_add_periodic(&sched, task_b, now, 10) == (int32_t)i) && ok;
+    }
+    ok = (sched_add_once(&sched, task_c, now, 1) == SCHED_TASK_NONE) && ok;
+    for (uint32_t i = 0; i < (uint32_t)SCHED_TASK_COUNT; i++) {
+        sched_cancel(&sched, (int32_t)i);
+    }
+    sched_cancel(&sched, SCHED_TASK_NONE);
+    sched_cancel(&sched, SCHED_TASK_COUNT);
+    ok = simulate(100) && (logs[TASK_B].runs == 0U) && ok;
+    if (!ok) {
+        fail("slots freed, all used and cancelled");
+    }
+}
+
+/**
+ * @brief   A periodic task that runs late skips its missed periods.
+ *
+ * @return  None
+ */
+static void check_missed(void) {
+    reset(0);
+    (void)sched_add_periodic(&sched, task_a, now, 10);
+    // The main loop is held up from tick 0 to 35, e.g. by a long flash write.
+    now = 35;
+    (void)simulate(1);
+    bool ok = (logs[TASK_A].runs == 1U) && (sched.missed == 2U);
+
+    // The next run is a period after the late one.
+    (void)simulate(10);
+    ok = ok && (logs[TASK_A].runs == 2U) && (logs[TASK_A].last == 45U);
+
+    // Late by exactly one period: the run that is due now counts as missed.
+    now = 65;
+    (void)simulate(1);
+    ok = ok && (logs[TASK_A].runs == 3U) && (sched.missed == 3U);
+
+    // Late across the counter wrap.
+    reset(WRAP_START + 0xF0U);
+    (void)sched_add_periodic(&sched, task_a, now, 16);
+    now += 16U + 40U;
+    (void)simulate(1);
+    ok = ok && (logs[TASK_A].runs == 1U) && (sched.missed == 2U);
+    (void)simulate(16);
+    ok = ok && (logs[TASK_A].runs == 2U) && ((logs[TASK_A].last - logs[TASK_A].ticks[0]) == 16U);
+
+    printf("late periodic task: ran once, skipped periods counted\n");
+    if (!ok) {
+        fail("missed periods skipped and counted");
+    }
+}
+
+/**
+ * @brief   A one-shot task waiting across the counter wrap doesn't run early.
+ *
+ * @return  None
+ */
+static void check_wrap_once(void) {
+    reset(WRAP_START + 0xFEU);
+    (void)sched_add_once(&sched, task_b, now, 3);
+    (void)simulate(5);
+    if ((logs[TASK_B].runs != 1U) || (logs[TASK_B].ticks[0] != 1U)) {
+        fail("one-shot task across the counter wrap");
+    }
+}
+
+int main(void) {
+    check_spacing(0, SPACING_TICKS);
+    check_spacing(WRAP_START, WRAP_TICKS);
+    check_order();
+    check_once();
+    check_missed();
+    check_wrap_once();
+
+    if (failures != 0U) {
+        printf("%u checks failed\n", (unsigned)failures);
+        return 1;
+    }
+    printf("all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,167 @@
+/*
+ * Measures the cost of one scope view frame on a PC: capturing the audio blocks, the
+ * window and FFT, and drawing into the OLED framebuffer (OLED emulator from
+ * Lib_EaBaseBoard/host). The input is a band-limited saw wave from the synth wavetables,
+ * written in the DACR format the audio interrupt sees. The drawn frame can be saved as a
+ * PGM image to check it.
+ *
+ * Build from the repository root:
+ *
+ *   gcc -O2 -no-pie -std=gnu99 -ILib_EaBaseBoard/host/inc -ILib_EaBaseBoard/host \
+ *       -ILib_EaBaseBoard/inc -ILib_MCU/inc -Imidi_synthesizer/src \
+ *       midi_synthesizer/tools/scope_bench.c midi_synthesizer/src/scope.c \
+ *       midi_synthesizer/src/fft.c midi_synthesizer/src/wavetables.c \
+ *       Lib_EaBaseBoard/src/oled.c Lib_EaBaseBoard/src/font5x7.c \
+ *       Lib_EaBaseBoard/host/oled_emu.c \
+ *       Lib_EaBaseBoard/host/i2c_emu.c -o scope_bench
+ *
+ * Usage: scope_bench [frequency in Hz] [image.pgm]
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "oled.h"
+#include "oled_emu.h"
+
+#include "audio.h"
+#include "scope.h"
+#include "synth.h"
+#include "wavetables.h"
+
+// Frames per measurement, the fastest of BENCH_RUNS measurements is reported.
+#define BENCH_FRAMES            20000
+#define BENCH_RUNS              5
+
+// Blocks needed for one capture.
+#define CAPTURE_BLOCKS          ((SCOPE_SAMPLE_COUNT * 2) / AUDIO_BLOCK_SIZE)
+
+#define DEFAULT_FREQUENCY       440
+
+// Saw table used for the test wave, low enough to be free of aliasing at DEFAULT_FREQUENCY.
+#define SAW_LEVEL               3
+
+static uint32_t blocks[CAPTURE_BLOCKS][AUDIO_BLOCK_SIZE];
+
+/**
+ * @brief   Returns the time of a monotonic clock.
+ *
+ * @return  Time in seconds.
+ */
+static double now_seconds(void) {
+    struct timespec time;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &time);
+    return (double)time.tv_sec + ((double)time.tv_nsec * 1e-9);
+}
+
+/**
+ * @brief   Fills the blocks with a half scale saw wave.
+ *
+ * @param   frequency   Frequency in Hz.
+ *
+ * @return  None
+ */
+static void render_saw(uint32_t frequency) {
+    // 32 bit phase, the top WAVE_SAMPLES_COUNT_LOG2 bits index the table.
+    uint32_t step = (uint32_t)(((uint64_t)frequency << 32) / AUDIO_SAMPLE_RATE);
+    uint32_t phase = 0;
+
+    for (uint32_t b = 0; b < CAPTURE_BLOCKS; b++) {
+        for (uint32_t i = 0; i < AUDIO_BLOCK_SIZE; i++) {
+            int32_t sample = wavetable_saw[SAW_LEVEL][phase >> (32 - WAVE_SAMPLES_COUNT_LOG2)];
+            int32_t value = (sample >> 7) + DAC_VALUE_CENTER;
+            blocks[b][i] = (uint32_t)value << DAC_VALUE_SHIFT;
+            phase += step;
+        }
+    }
+}
+
+/**
+ * @brief   Captures all blocks, as the audio interrupt does.
+ *
+ * @return  None
+ */
+static void capture(void) {
+    scope_arm();
+    for (uint32_t b = 0; b < CAPTURE_BLOCKS; b++) {
+        scope_capture(blocks[b], AUDIO_BLOCK_SIZE);
+    }
+}
+
+/**
+ * @brief   Times one stage of the frame.
+ *
+ * @param   stage   0 capture, 1 analyze, 2 draw.
+ *
+ * @return  Fastest time per frame in microseconds.
+ */
+static double measure(int stage) {
+    double best = 0.0;
+
+    for (int run = 0; run < BENCH_RUNS; run++) {
+        double start = now_seconds();
+        for (int i = 0; i < BENCH_FRAMES; i++) {
+            switch (stage) {
+                case 0:
+                    capture();
+                    break;
+                case 1:
+                    scope_analyze();
+                    break;
+                default:
+                    scope_draw(false);
+                    break;
+            }
+        }
+        double time = (now_seconds() - start) * 1e6 / BENCH_FRAMES;
+        if ((run == 0) || (time < best)) {
+            best = time;
+        }
+    }
+
+    return best;
+}
+
+int main(int argc, char **argv) {
+    uint32_t frequency = (argc > 1) ? (uint32_t)atoi(argv[1]) : DEFAULT_FREQUENCY;
+    oled_emu_stats_t stats;
+
+    oledEmu_reset();
+    oled_init();
+    oled_setAutoFlush(0);
+
+    render_saw(frequency);
+    capture();
+    if (!scope_is_ready()) {
+        fprintf(stderr, "Capture didn't complete\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("capture  %8.3f us per frame (%d blocks)\n", measure(0), CAPTURE_BLOCKS);
+    printf("analyze  %8.3f us per frame\n", measure(1));
+    printf("draw     %8.3f us per frame\n", measure(2));
+
+    // The flush only sends what differs from the display, so start from a blank one. See
+    // oled_anim_bench.c for the bytes per frame while the view is animated.
+    oled_clearScreen(OLED_COLOR_BLACK);
+    oled_flush();
+    oledEmu_clearStats();
+    scope_draw(false);
+    oled_flush();
+    oledEmu_getStats(&stats);
+    printf("flush    %8u bytes for a frame on a blank display\n",
+           (unsigned)(stats.commandBytes + stats.dataBytes));
+
+    if (argc > 2) {
+        if (oledEmu_writePgm(argv[2], 2) != 0) {
+            fprintf(stderr, "Can't write %s\n", argv[2]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
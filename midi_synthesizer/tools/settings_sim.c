@@ -0,0 +1,394 @@
+/*
+ * Runs the settings log (src/settings.c) against a simulated 24LC08 EEPROM on a PC. It
+ * counts the page writes of a fast rotary turn and of a long session, compared with
+ * writing the settings on every detent as the firmware used to, and checks power loss
+ * recovery: writes are cut off after every possible number of bytes, and after each
+ * "reboot" the settings must be those of the last completed save. It also checks that a
+ * change made while a record is being written keeps the settings dirty. The exit status is 1
+ * if any check fails.
+ *
+ * Build from the repository root:
+ *
+ *   gcc -std=gnu99 -Imidi_synthesizer/src midi_synthesizer/tools/settings_sim.c \
+ *       midi_synthesizer/src/settings.c -o settings_sim
+ *
+ * Usage: settings_sim
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "settings.h"
+
+// 24LC08: 1 KiB in 16 byte pages, erased to 0xFF.
+#define EEPROM_SIZE             1024
+#define EEPROM_PAGE_SIZE        16
+#define EEPROM_PAGE_COUNT       (EEPROM_SIZE / EEPROM_PAGE_SIZE)
+
+// Where the old firmware wrote its settings on every change.
+#define OLD_OFFSET              240
+
+// Input timing as in main.c: rotary read every 5 ms, settings polled every 100 ms.
+#define DETENT_MS               5
+#define POLL_MS                 100
+
+// Fast rotary turn: this many detents in a row.
+#define TURN_DETENTS            300
+
+// Long session: this many separate adjustments, each followed by a pause.
+#define SESSION_ADJUSTMENTS     1600
+
+// Power loss: saves completed before the one that is cut off, for every cut off point.
+#define LOSS_SAVES_MAX          40
+
+static uint8_t eeprom[EEPROM_SIZE];
+static uint32_t page_writes[EEPROM_PAGE_COUNT];
+
+// Bytes that are still written before the power fails, negative for no power loss.
+static int32_t power_budget = -1;
+
+// With deferred set, sim_write() leaves the completion callback to the caller, as if
+// the write were still running.
+static bool deferred = false;
+static SettingsWriteDone deferred_done = NULL;
+
+static const int16_t defaults[SETTINGS_VALUE_COUNT] = {440, 10, 0, 0, 0};
+
+static uint32_t failures = 0;
+
+/**
+ * @brief   Reads from the simulated EEPROM, same as eeprom_read().
+ *
+ * @param   buf     Buffer for the data.
+ * @param   offset  EEPROM offset.
+ * @param   len     Number of bytes.
+ *
+ * @return  Number of bytes read, -1 if out of range.
+ */
+static int16_t sim_read(uint8_t *buf, uint16_t offset, uint16_t len) {
+    if (((uint32_t)offset + len) > EEPROM_SIZE) {
+        return -1;
+    }
+    memcpy(buf, &eeprom[offset], len);
+    return (int16_t)len;
+}
+
+/**
+ * @brief   Writes to the simulated EEPROM page by page.
+ *
+ * @note    Every page touched counts as one write cycle. With a power budget, the bytes
+ *          after it runs out are not written and the write fails.
+ *
+ * @param   buf     Data to write.
+ * @param   offset  EEPROM offset.
+ * @param   len     Number of bytes.
+ *
+ * @return  Number of bytes written, -1 if out of range or the power failed.
+ */
+static int16_t sim_program(const uint8_t *buf, uint16_t offset, uint16_t len) {
+    if (((uint32_t)offset + len) > EEPROM_SIZE) {
+        return -1;
+    }
+
+    for (uint16_t i = 0; i < len; i++) {
+        uint16_t address = offset + i;
+        if (power_budget == 0) {
+            return -1;
+        }
+        if (power_budget > 0) {
+            power_budget--;
+        }
+        if ((i == 0U) || ((address % EEPROM_PAGE_SIZE) == 0U)) {
+            page_writes[address / EEPROM_PAGE_SIZE]++;
+        }
+        eeprom[address] = buf[i];
+    }
+
+    return (int16_t)len;
+}
+
+/**
+ * @brief   Writes to the simulated EEPROM, same as eeprom_writeAsync() but done right away.
+ *
+ * @param   buf     Data to write.
+ * @param   offset  EEPROM offset.
+ * @param   len     Number of bytes.
+ * @param   done    Called with the result of the write, unless it is deferred.
+ *
+ * @return  Number of bytes to write, -1 if out of range.
+ */
+static int16_t sim_write(uint8_t *buf, uint16_t offset, uint16_t len, SettingsWriteDone done) {
+    if (((uint32_t)offset + len) > EEPROM_SIZE) {
+        return -1;
+    }
+
+    int16_t result = sim_program(buf, offset, len);
+    if (deferred) {
+        deferred_done = done;
+    } else {
+        done(result);
+    }
+    return (int16_t)len;
+}
+
+/**
+ * @brief   Erases the simulated EEPROM and its write counters.
+ *
+ * @return  None
+ */
+static void sim_erase(void) {
+    memset(eeprom, 0xFF, sizeof(eeprom));
+    memset(page_writes, 0, sizeof(page_writes));
+    power_budget = -1;
+}
+
+/**
+ * @brief   Returns the total and the highest page write count.
+ *
+ * @param   most    Highest write count of a single page.
+ *
+ * @return  Total page writes.
+ */
+static uint32_t count_writes(uint32_t *most) {
+    uint32_t total = 0;
+
+    *most = 0;
+    for (uint32_t page = 0; page < EEPROM_PAGE_COUNT; page++) {
+        total += page_writes[page];
+        if (page_writes[page] > *most) {
+            *most = page_writes[page];
+        }
+    }
+
+    return total;
+}
+
+/**
+ * @brief   Reports a failed check.
+ *
+ * @param   what    Description of the check.
+ *
+ * @return  None
+ */
+static void fail(const char *what) {
+    printf("FAILED: %s\n", what);
+    failures++;
+}
+
+/**
+ * @brief   Saves the settings and waits for the write, as settings_poll() would see it.
+ *
+ * @param   settings    Pointer to the settings.
+ *
+ * @return  bool    true if the record was written.
+ */
+static bool save(struct Settings *settings) {
+    return settings_save(settings) && (settings_poll(settings, 0) == SETTINGS_POLL_SAVED);
+}
+
+/**
+ * @brief   Turns the frequency by `detents` steps and then leaves it alone, as main.c does.
+ *
+ * @param   settings    Pointer to the settings.
+ * @param   now         Current time in milliseconds, advanced.
+ * @param   detents     Number of detents.
+ *
+ * @return  None
+ */
+static void turn(struct Settings *settings, uint32_t *now, uint32_t detents) {
+    uint32_t end = *now + (detents * DETENT_MS) + SETTINGS_QUIET_TICKS + POLL_MS;
+
+    for (uint32_t i = 0; i < detents; i++) {
+        int16_t frequency = settings_get(settings, SETTING_FREQUENCY);
+        settings_set(settings, SETTING_FREQUENCY, (frequency >= 800) ? 10 : (frequency + 10), *now);
+        *now += DETENT_MS;
+        if ((*now % POLL_MS) == 0U) {
+            (void)settings_poll(settings, *now);
+        }
+    }
+    while (*now < end) {
+        *now += DETENT_MS;
+        if ((*now % POLL_MS) == 0U) {
+            (void)settings_poll(settings, *now);
+        }
+    }
+}
+
+/**
+ * @brief   Writes the settings on every detent, as the firmware used to.
+ *
+ * @param   detents     Number of detents.
+ *
+ * @return  None
+ */
+static void turn_old(uint32_t detents) {
+    int32_t data[2] = {440, 10};
+
+    for (uint32_t i = 0; i < detents; i++) {
+        data[0] = (data[0] >= 800) ? 10 : (data[0] + 10);
+        (void)sim_program((const uint8_t *)data, OLD_OFFSET, sizeof(data));
+    }
+}
+
+/**
+ * @brief   Compares the settings found at boot with the expected values.
+ *
+ * @param   expected    Expected values.
+ *
+ * @return  bool    true if equal.
+ */
+static bool boot_matches(const int16_t expected[SETTINGS_VALUE_COUNT]) {
+    struct Settings settings;
+
+    (void)settings_init(&settings, sim_read, sim_write, defaults);
+    return memcmp(settings.values, expected, sizeof(settings.values)) == 0;
+}
+
+/**
+ * @brief   Cuts off a save after every possible number of bytes, at every log position.
+ *
+ * @return  Number of power loss cases checked.
+ */
+static uint32_t check_power_loss(void) {
+    uint32_t cases = 0;
+
+    for (uint32_t saves = 0; saves <= LOSS_SAVES_MAX; saves++) {
+        for (int32_t cut = 0; cut < SETTINGS_RECORD_SIZE; cut++) {
+            struct Settings settings;
+            int16_t expected[SETTINGS_VALUE_COUNT];
+
+            sim_erase();
+            (void)settings_init(&settings, sim_read, sim_write, defaults);
+            for (uint32_t i = 0; i < saves; i++) {
+                settings_set(&settings, SETTING_FREQUENCY, (int16_t)(10 + (i * 10U)), 0);
+                settings_set(&settings, SETTING_VOLUME, (int16_t)(i % 16U), 0);
+                if (!save(&settings)) {
+                    fail("save without power loss");
+                }
+            }
+            memcpy(expected, settings.values, sizeof(expected));
+
+            // The power fails while the next save is written.
+            settings_set(&settings, SETTING_FREQUENCY, 1234, 0);
+            settings_set(&settings, SETTING_VOLUME, -1, 0);
+            power_budget = cut;
+            if (save(&settings)) {
+                fail("save succeeded although the power failed");
+            }
+            power_budget = -1;
+            cases++;
+
+            if (!boot_matches(expected)) {
+                printf("  after %u saves, cut after %d bytes\n", (unsigned)saves, (int)cut);
+                fail("power loss lost the last completed save");
+                continue;
+            }
+
+            // After the reboot the log goes on and the next save is the one found.
+            (void)settings_init(&settings, sim_read, sim_write, defaults);
+            settings_set(&settings, SETTING_VOLUME, 7, 0);
+            memcpy(expected, settings.values, sizeof(expected));
+            if (!save(&settings) || !boot_matches(expected)) {
+                printf("  after %u saves, cut after %d bytes\n", (unsigned)saves, (int)cut);
+                fail("save after power loss not found");
+            }
+        }
+    }
+
+    return cases;
+}
+
+/**
+ * @brief   A change made while a record is being written must be saved by a later one.
+ *
+ * @return  None
+ */
+static void check_change_during_save(void) {
+    struct Settings settings;
+    int16_t expected[SETTINGS_VALUE_COUNT];
+
+    sim_erase();
+    (void)settings_init(&settings, sim_read, sim_write, defaults);
+    settings_set(&settings, SETTING_FREQUENCY, 600, 0);
+
+    deferred = true;
+    if (settings_poll(&settings, SETTINGS_QUIET_TICKS) != SETTINGS_POLL_STARTED) {
+        fail("save not started after the quiet period");
+    }
+    settings_set(&settings, SETTING_VOLUME, 3, SETTINGS_QUIET_TICKS);
+    if (settings_save(&settings) ||
+        (settings_poll(&settings, SETTINGS_QUIET_TICKS) != SETTINGS_POLL_IDLE)) {
+        fail("second save started while writing");
+    }
+    deferred_done(SETTINGS_RECORD_SIZE);
+    deferred = false;
+
+    if ((settings_poll(&settings, SETTINGS_QUIET_TICKS) != SETTINGS_POLL_SAVED) ||
+        !settings.dirty) {
+        fail("change made while writing taken for saved");
+    }
+    memcpy(expected, settings.values, sizeof(expected));
+    if ((settings_poll(&settings, 2U * SETTINGS_QUIET_TICKS) != SETTINGS_POLL_STARTED) ||
+        (settings_poll(&settings, 2U * SETTINGS_QUIET_TICKS) != SETTINGS_POLL_SAVED) ||
+        settings.dirty || !boot_matches(expected)) {
+        fail("change made while writing not saved later");
+    }
+}
+
+int main(void) {
+    struct Settings settings;
+    uint32_t now = 0;
+    uint32_t total;
+    uint32_t most;
+
+    // A blank EEPROM gives the defaults.
+    sim_erase();
+    if (settings_init(&settings, sim_read, sim_write, defaults) ||
+        (memcmp(settings.values, defaults, sizeof(defaults)) != 0)) {
+        fail("blank EEPROM doesn't give the defaults");
+    }
+
+    // One fast turn of the rotary encoder.
+    turn(&settings, &now, TURN_DETENTS);
+    total = count_writes(&most);
+    printf("%u detent turn:        %5u page writes (every detent: %u)\n",
+           (unsigned)TURN_DETENTS, (unsigned)total, (unsigned)TURN_DETENTS);
+    if (!boot_matches(settings.values)) {
+        fail("turn not saved");
+    }
+
+    // A long session of separate adjustments, the log spreads the wear.
+    sim_erase();
+    (void)settings_init(&settings, sim_read, sim_write, defaults);
+    now = 0;
+    for (uint32_t i = 0; i < SESSION_ADJUSTMENTS; i++) {
+        turn(&settings, &now, 1U + (i % 8U));
+    }
+    total = count_writes(&most);
+    printf("%u adjustments:       %5u page writes, at most %u on one page\n",
+           (unsigned)SESSION_ADJUSTMENTS, (unsigned)total, (unsigned)most);
+    if (!boot_matches(settings.values)) {
+        fail("session not saved");
+    }
+
+    sim_erase();
+    for (uint32_t i = 0; i < SESSION_ADJUSTMENTS; i++) {
+        turn_old(1U + (i % 8U));
+    }
+    total = count_writes(&most);
+    printf("  every detent:          %5u page writes, at most %u on one page\n",
+           (unsigned)total, (unsigned)most);
+
+    printf("power loss:              %5u cut off saves checked\n", (unsigned)check_power_loss());
+    check_change_during_save();
+
+    if (failures != 0U) {
+        printf("%u checks failed\n", (unsigned)failures);
+        return 1;
+    }
+    printf("all checks passed\n");
+    return 0;
+}
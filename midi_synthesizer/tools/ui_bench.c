@@ -0,0 +1,121 @@
+/*
+ * Measures the CPU time of the most frequent UI update, a changed parameter value, on a PC
+ * with the OLED emulator from Lib_EaBaseBoard/host: the value is changed and the widgets
+ * are rendered into the framebuffer, as main.c does on every rotary tick. Nothing is
+ * flushed, see oled_anim_bench.c for the bytes sent. The best of several runs is reported.
+ *
+ * Build from the repository root:
+ *
+ *   gcc -O2 -no-pie -std=gnu99 -ILib_EaBaseBoard/host/inc -ILib_EaBaseBoard/host \
+ *       -ILib_EaBaseBoard/inc -ILib_MCU/inc -Imidi_synthesizer/src \
+ *       midi_synthesizer/tools/ui_bench.c midi_synthesizer/src/menu.c \
+ *       midi_synthesizer/src/ui.c midi_synthesizer/src/utils.c \
+ *       Lib_EaBaseBoard/src/oled.c Lib_EaBaseBoard/src/font5x7.c \
+ *       Lib_EaBaseBoard/host/oled_emu.c \
+ *       Lib_EaBaseBoard/host/i2c_emu.c -o ui_bench
+ *
+ * Usage: ui_bench
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "oled.h"
+#include "oled_emu.h"
+
+#include "menu.h"
+#include "ui.h"
+
+// Updates per run.
+#define BENCH_UPDATES           200000
+
+// Runs per case, the fastest one is reported.
+#define BENCH_RUNS              15
+
+// Frequencies stepped through, the same range as the firmware.
+#define FREQUENCY_MIN           10
+#define FREQUENCY_MAX           800
+
+static struct Ui ui;
+static int32_t number;
+
+/**
+ * @brief   Returns the time of a monotonic clock.
+ *
+ * @return  Time in seconds.
+ */
+static double now_seconds(void) {
+    struct timespec time;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &time);
+    return (double)time.tv_sec + ((double)time.tv_nsec * 1e-9);
+}
+
+/**
+ * @brief   Changes the frequency in the menu list and renders it.
+ *
+ * @param   i   Update number.
+ *
+ * @return  None
+ */
+static void update_menu(uint32_t i) {
+    menu_set_value(MENU_ENTRY_FREQUENCY,
+                   FREQUENCY_MIN + (int)(i % (FREQUENCY_MAX - FREQUENCY_MIN + 1)));
+    (void)menu_render();
+}
+
+/**
+ * @brief   Changes a number widget and renders it.
+ *
+ * @param   i   Update number.
+ *
+ * @return  None
+ */
+static void update_number(uint32_t i) {
+    ui_set_value(&ui, number, (int32_t)(i % 100000U));
+    (void)ui_render(&ui);
+}
+
+/**
+ * @brief   Times one kind of update.
+ *
+ * @param   update  Update function.
+ *
+ * @return  Fastest time per update in nanoseconds.
+ */
+static double measure(void (*update)(uint32_t i)) {
+    double best = 0.0;
+
+    for (int run = 0; run < BENCH_RUNS; run++) {
+        double start = now_seconds();
+        for (uint32_t i = 0; i < BENCH_UPDATES; i++) {
+            update(i);
+        }
+        double time = (now_seconds() - start) * 1e9 / BENCH_UPDATES;
+        if ((run == 0) || (time < best)) {
+            best = time;
+        }
+    }
+
+    return best;
+}
+
+int main(void) {
+    oledEmu_reset();
+    oled_init();
+    oled_setAutoFlush(0);
+
+    menu_init(false, FREQUENCY_MIN, 10, MENU_ENTRY_FREQUENCY);
+    (void)menu_render();
+    printf("menu value    %8.1f ns per update\n", measure(update_menu));
+
+    ui_init(&ui, false);
+    number = ui_add_number(&ui, 0, 40, OLED_DISPLAY_WIDTH, "Value", 0);
+    (void)ui_render(&ui);
+    printf("number widget %8.1f ns per update\n", measure(update_number));
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,210 @@
+/*
+ * Renders the synthesizer screens on a PC with the OLED emulator from Lib_EaBaseBoard/host,
+ * saves them as PGM images and prints how many bytes each frame sent over SPI (or I2C, when
+ * built with -DOLED_USE_I2C; the total then includes the I2C control bytes). Every frame
+ * is one typical interaction, e.g. a single rotary tick, applied to the menu the same way
+ * main.c does it.
+ *
+ * Given a reference directory (e.g. the output of an earlier run), every image is compared
+ * with the one of the same name there, so UI changes can be checked pixel by pixel.
+ *
+ * The exit status is 0 if all images were written (and match the references), 1 if any
+ * differ from its reference and 2 if an image or a reference can't be written or read, a
+ * path is too long or the output can't be written.
+ *
+ * Build from the repository root:
+ *
+ *   gcc -no-pie -std=gnu99 -ILib_EaBaseBoard/host/inc -ILib_EaBaseBoard/host \
+ *       -ILib_EaBaseBoard/inc -ILib_MCU/inc -Imidi_synthesizer/src \
+ *       midi_synthesizer/tools/ui_snapshot.c midi_synthesizer/src/utils.c \
+ *       midi_synthesizer/src/menu.c midi_synthesizer/src/ui.c \
+ *       Lib_EaBaseBoard/src/oled.c Lib_EaBaseBoard/src/font5x7.c \
+ *       Lib_EaBaseBoard/host/oled_emu.c \
+ *       Lib_EaBaseBoard/host/i2c_emu.c -o ui_snapshot
+ *
+ * With -DOLED_USE_I2C, Lib_EaBaseBoard/src/i2cbus.c has to be added as well.
+ *
+ * Usage: ui_snapshot <output directory> [reference directory]
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "oled.h"
+#include "oled_emu.h"
+
+#include "utils.h"
+#include "menu.h"
+
+// Images are saved at this many image pixels per display pixel.
+#define SNAPSHOT_SCALE          2
+
+#define PATH_LENGTH             512
+
+// Initial state of the menu, the same as the firmware defaults.
+#define BOOT_FREQUENCY          440
+#define BOOT_VOLUME             10
+
+struct Frame {
+    const char *name;
+    void (*apply)(void);    // Changes the menu state, NULL for none.
+};
+
+static void frequency_up(void) {
+    menu_set_value(MENU_ENTRY_FREQUENCY, BOOT_FREQUENCY + 10);
+}
+
+static void frequency_max(void) {
+    menu_set_value(MENU_ENTRY_FREQUENCY, 800);
+}
+
+static void select_volume(void) {
+    menu_select(MENU_ENTRY_VOLUME);
+}
+
+static void volume_down(void) {
+    menu_set_value(MENU_ENTRY_VOLUME, BOOT_VOLUME - 1);
+}
+
+static void dark_mode(void) {
+    menu_set_dark_mode(true);
+}
+
+static void dark_frequency(void) {
+    menu_select(MENU_ENTRY_FREQUENCY);
+    menu_set_value(MENU_ENTRY_FREQUENCY, 10);
+}
+
+// The sequence of screen updates the firmware does at boot and on typical input.
+static const struct Frame frames[] = {
+    {"boot",             NULL},
+    {"frequency_up",     frequency_up},
+    {"frequency_max",    frequency_max},
+    {"select_volume",    select_volume},
+    {"volume_down",      volume_down},
+    {"dark_mode",        dark_mode},
+    {"dark_frequency",   dark_frequency},
+};
+
+/**
+ * @brief   Compares the contents of two files.
+ *
+ * @param   path_a  First file.
+ * @param   path_b  Second file.
+ *
+ * @return  int     0 if they are equal, 1 if they differ, -1 if either can't be read.
+ */
+static int files_compare(const char *path_a, const char *path_b) {
+    FILE *a = fopen(path_a, "rb");
+    FILE *b = fopen(path_b, "rb");
+    int result = ((a != NULL) && (b != NULL)) ? 0 : -1;
+
+    while (result == 0) {
+        int ca = fgetc(a);
+        int cb = fgetc(b);
+        if (ferror(a) || ferror(b)) {
+            result = -1;
+        } else if (ca != cb) {
+            result = 1;
+        } else if (ca == EOF) {
+            break;
+        }
+    }
+
+    if (a != NULL) {
+        fclose(a);
+    }
+    if (b != NULL) {
+        fclose(b);
+    }
+    return result;
+}
+
+/**
+ * @brief   Builds the path of a frame's image in a directory.
+ *
+ * @param   path        Buffer of PATH_LENGTH bytes for the path.
+ * @param   directory   Directory.
+ * @param   name        Frame name.
+ *
+ * @return  bool    true if the path fits.
+ */
+static bool image_path(char path[PATH_LENGTH], const char *directory, const char *name) {
+    int len = snprintf(path, PATH_LENGTH, "%s/%s.pgm", directory, name);
+    if ((len < 0) || (len >= PATH_LENGTH)) {
+        fprintf(stderr, "Path too long: %s/%s.pgm\n", directory, name);
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char **argv) {
+    if ((argc < 2) || (argc > 3)) {
+        fprintf(stderr, "Usage: %s <output directory> [reference directory]\n", argv[0]);
+        return 2;
+    }
+
+    char path[PATH_LENGTH];
+    char reference[PATH_LENGTH];
+    int differences = 0;
+    oled_emu_stats_t stats;
+
+    oledEmu_reset();
+    oled_init();
+    // Same as the firmware: draw into the framebuffer, send the changes with GPDMA.
+    oled_setAutoFlush(0);
+    menu_init(false, BOOT_FREQUENCY, BOOT_VOLUME, MENU_ENTRY_FREQUENCY);
+
+    printf("%-16s %9s %9s %9s %9s\n", "frame", "transfers", "cmd B", "data B", "total B");
+    for (size_t i = 0; i < sizeof(frames) / sizeof(frames[0]); i++) {
+        const struct Frame *frame = &frames[i];
+
+        oledEmu_clearStats();
+        if (frame->apply != NULL) {
+            frame->apply();
+        }
+        (void)menu_render();
+        (void)oled_flushDma(NULL);
+        oledEmu_runDma();
+        oledEmu_getStats(&stats);
+
+        printf("%-16s %9u %9u %9u %9u\n", frame->name,
+               (unsigned)(stats.transfers + stats.dmaTransfers + stats.i2cTransfers),
+               (unsigned)stats.commandBytes, (unsigned)stats.dataBytes,
+               (unsigned)((stats.i2cTransfers != 0U) ? stats.i2cBytes
+                                                     : (stats.commandBytes + stats.dataBytes)));
+
+        if (!image_path(path, argv[1], frame->name)) {
+            return 2;
+        }
+        if (oledEmu_writePgm(path, SNAPSHOT_SCALE) != 0) {
+            fprintf(stderr, "Can't write %s\n", path);
+            return 2;
+        }
+
+        if (argc == 3) {
+            if (!image_path(reference, argv[2], frame->name)) {
+                return 2;
+            }
+            int compared = files_compare(path, reference);
+            if (compared < 0) {
+                fprintf(stderr, "Can't read %s or %s\n", path, reference);
+                return 2;
+            }
+            if (compared != 0) {
+                printf("  differs from %s\n", reference);
+                differences++;
+            }
+        }
+    }
+
+    if (fflush(stdout) != 0 || ferror(stdout)) {
+        fprintf(stderr, "Can't write the statistics\n");
+        return 2;
+    }
+
+    return (differences == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
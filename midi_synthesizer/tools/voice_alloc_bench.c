@@ -0,0 +1,343 @@
+/*
+ * Checks the voice allocator (midi_synthesizer/src/voice_alloc.c) on a PC and measures it.
+ * The policy is checked step by step: a note already sounding keeps its voice, a new note
+ * takes a free voice, then the oldest released one, and only then the oldest held note is
+ * stolen and counted. Out of range and unknown notes are refused, and a freed voice no
+ * longer plays its note. Then dense chords and arpeggios on all 16 channels are generated,
+ * about 75% note on so most of them steal, the lists and the note map are checked for
+ * consistency after every event of a short run, and the time per event is measured on a
+ * long one. The exit status is 1 if any check fails.
+ *
+ * The times are those of the PC, they only compare changes to the allocator.
+ *
+ * Build from the repository root:
+ *
+ *   gcc -O2 -std=gnu99 -Imidi_synthesizer/src midi_synthesizer/tools/voice_alloc_bench.c \
+ *       midi_synthesizer/src/voice_alloc.c -o voice_alloc_bench
+ *
+ * Usage: voice_alloc_bench
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "voice_alloc.h"
+
+// Events of the consistency check and of a measurement, the fastest of BENCH_RUNS
+// measurements is reported.
+#define CHECK_EVENTS            100000U
+#define BENCH_EVENTS            (1U << 24)
+#define BENCH_RUNS              5
+
+// Recent notes per channel, note offs are picked from them.
+#define RECENT_NOTES            8U
+
+enum EventType {
+    EVENT_NOTE_ON,
+    EVENT_NOTE_OFF,
+};
+
+struct Event {
+    uint8_t type;   // enum EventType
+    uint8_t channel;
+    uint8_t note;
+};
+
+// Intervals of the chords, in semitones above the root.
+static const uint8_t chord[] = {0, 4, 7, 10, 12, 16};
+
+static uint32_t failures = 0;
+
+static struct Event events[BENCH_EVENTS];
+
+// Keeps the compiler from dropping the voices.
+static volatile uint32_t sink;
+
+/**
+ * @brief   Reports a failed check.
+ *
+ * @param   what    Description of the check.
+ *
+ * @return  None
+ */
+static void fail(const char *what) {
+    printf("FAILED: %s\n", what);
+    failures++;
+}
+
+/**
+ * @brief   Returns the time of a monotonic clock.
+ *
+ * @return  Time in seconds.
+ */
+static double now_seconds(void) {
+    struct timespec time;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &time);
+    return (double)time.tv_sec + ((double)time.tv_nsec * 1e-9);
+}
+
+/**
+ * @brief   Returns a pseudo-random number.
+ *
+ * @param   range   Upper bound, excluded.
+ *
+ * @return  Number from 0 to range - 1.
+ */
+static uint32_t random_below(uint32_t range) {
+    static uint32_t seed = 1;
+
+    seed = (seed * 1103515245U) + 12345U;
+    return (seed >> 8) % range;
+}
+
+/**
+ * @brief   Checks that every voice is in exactly one list and the note map matches.
+ *
+ * @param   alloc   Pointer to the allocator.
+ *
+ * @return  true if the allocator is consistent.
+ */
+static bool consistent(const struct VoiceAllocator *alloc) {
+    uint32_t seen = 0;
+    uint32_t mapped = 0;
+
+    for (uint32_t s = 0; s < (uint32_t)VOICE_ALLOC_STATE_COUNT; s++) {
+        uint8_t prev = VOICE_ALLOC_NONE;
+        uint8_t voice = alloc->lists[s].head;
+        while (voice != VOICE_ALLOC_NONE) {
+            if ((voice >= (uint8_t)VOICE_ALLOC_VOICE_COUNT) || ((seen & (1UL << voice)) != 0U) ||
+                (alloc->state[voice] != (uint8_t)s) || (alloc->prev[voice] != prev)) {
+                return false;
+            }
+            seen |= 1UL << voice;
+            prev = voice;
+            voice = alloc->next[voice];
+        }
+        if (alloc->lists[s].tail != prev) {
+            return false;
+        }
+    }
+    if (seen != ((1UL << VOICE_ALLOC_VOICE_COUNT) - 1UL)) {
+        return false;
+    }
+
+    for (uint32_t c = 0; c < (uint32_t)VOICE_ALLOC_CHANNEL_COUNT; c++) {
+        for (uint32_t n = 0; n < (uint32_t)VOICE_ALLOC_NOTE_COUNT; n++) {
+            uint8_t voice = alloc->voice_of_note[c][n];
+            if (voice == VOICE_ALLOC_NONE) {
+                continue;
+            }
+            if ((alloc->state[voice] == (uint8_t)VOICE_ALLOC_FREE) ||
+                (alloc->channel[voice] != c) || (alloc->note[voice] != n)) {
+                return false;
+            }
+            mapped++;
+        }
+    }
+    // Every used voice plays exactly one note.
+    for (uint32_t v = 0; v < (uint32_t)VOICE_ALLOC_VOICE_COUNT; v++) {
+        if (alloc->state[v] != (uint8_t)VOICE_ALLOC_FREE) {
+            mapped--;
+        }
+    }
+    return mapped == 0U;
+}
+
+/**
+ * @brief   Checks the order in which voices are picked.
+ *
+ * @return  None
+ */
+static void check_policy(void) {
+    struct VoiceAllocator alloc;
+    uint8_t voices[VOICE_ALLOC_VOICE_COUNT];
+    uint32_t used = 0;
+
+    voice_alloc_init(&alloc);
+
+    // Free voices first, every note gets its own.
+    for (uint8_t n = 0; n < (uint8_t)VOICE_ALLOC_VOICE_COUNT; n++) {
+        voices[n] = voice_alloc_note_on(&alloc, 0, (uint8_t)(60U + n));
+        if (voices[n] < (uint8_t)VOICE_ALLOC_VOICE_COUNT) {
+            used |= 1UL << voices[n];
+        }
+    }
+    if ((used != ((1UL << VOICE_ALLOC_VOICE_COUNT) - 1UL)) || (alloc.stolen != 0U)) {
+        fail("free voices used first, one per note");
+    }
+
+    // A sounding note keeps its voice and becomes the newest held one.
+    if ((voice_alloc_note_on(&alloc, 0, 60) != voices[0]) || (alloc.stolen != 0U)) {
+        fail("retriggered note keeps its voice");
+    }
+
+    // Released voices go before held ones, the oldest released first.
+    (void)voice_alloc_note_off(&alloc, 0, 65);
+    (void)voice_alloc_note_off(&alloc, 0, 63);
+    if ((voice_alloc_note_on(&alloc, 1, 40) != voices[5]) ||
+        (voice_alloc_note_on(&alloc, 1, 41) != voices[3]) || (alloc.stolen != 0U)) {
+        fail("oldest released voice used before stealing");
+    }
+    if ((voice_alloc_find(&alloc, 0, 65) != VOICE_ALLOC_NONE) ||
+        (voice_alloc_find(&alloc, 1, 40) != voices[5])) {
+        fail("note map after reusing a released voice");
+    }
+
+    // All held: the oldest held note is stolen. Note 60 was retriggered, so 61 is the oldest.
+    if ((voice_alloc_note_on(&alloc, 2, 50) != voices[1]) || (alloc.stolen != 1U) ||
+        (voice_alloc_find(&alloc, 0, 61) != VOICE_ALLOC_NONE)) {
+        fail("oldest held note stolen and counted");
+    }
+    if ((voice_alloc_note_on(&alloc, 2, 51) != voices[2]) || (alloc.stolen != 2U)) {
+        fail("next oldest held note stolen");
+    }
+
+    // Note off only for held notes, and only once.
+    if ((voice_alloc_note_off(&alloc, 0, 61) != VOICE_ALLOC_NONE) ||
+        (voice_alloc_note_off(&alloc, 2, 50) != voices[1]) ||
+        (voice_alloc_note_off(&alloc, 2, 50) != VOICE_ALLOC_NONE)) {
+        fail("note off of held notes only");
+    }
+
+    // A released note can be retriggered until its voice is freed.
+    if (voice_alloc_note_on(&alloc, 2, 50) != voices[1]) {
+        fail("released note retriggered on its voice");
+    }
+    (void)voice_alloc_note_off(&alloc, 2, 50);
+    voice_alloc_free(&alloc, voices[1]);
+    if ((voice_alloc_find(&alloc, 2, 50) != VOICE_ALLOC_NONE) ||
+        (voice_alloc_note_on(&alloc, 3, 70) != voices[1]) || (alloc.stolen != 2U)) {
+        fail("freed voice no longer plays its note and is reused first");
+    }
+
+    if ((voice_alloc_note_on(&alloc, VOICE_ALLOC_CHANNEL_COUNT, 60) != VOICE_ALLOC_NONE) ||
+        (voice_alloc_note_on(&alloc, 0, VOICE_ALLOC_NOTE_COUNT) != VOICE_ALLOC_NONE) ||
+        (voice_alloc_find(&alloc, VOICE_ALLOC_CHANNEL_COUNT, 0) != VOICE_ALLOC_NONE)) {
+        fail("channel or note out of range refused");
+    }
+
+    if (!consistent(&alloc)) {
+        fail("lists and note map consistent after the policy checks");
+    }
+}
+
+/**
+ * @brief   Fills `events` with chords and arpeggios on all channels.
+ *
+ * @note    Each channel plays around its own root, which moves now and then. Note offs are
+ *          for one of the last notes of the channel, so some are for notes already stolen.
+ *
+ * @return  None
+ */
+static void fill_events(void) {
+    uint8_t root[VOICE_ALLOC_CHANNEL_COUNT];
+    uint8_t recent[VOICE_ALLOC_CHANNEL_COUNT][RECENT_NOTES] = {{0}};
+
+    for (uint32_t c = 0; c < (uint32_t)VOICE_ALLOC_CHANNEL_COUNT; c++) {
+        root[c] = (uint8_t)(36U + random_below(36));
+    }
+
+    for (uint32_t i = 0; i < BENCH_EVENTS; i++) {
+        uint8_t channel = (uint8_t)random_below(VOICE_ALLOC_CHANNEL_COUNT);
+
+        if (random_below(4) == 0U) {
+            events[i].type = EVENT_NOTE_OFF;
+            events[i].note = recent[channel][random_below(RECENT_NOTES)];
+        } else {
+            if (random_below(32) == 0U) {
+                root[channel] = (uint8_t)(36U + random_below(36));
+            }
+            events[i].type = EVENT_NOTE_ON;
+            events[i].note = (uint8_t)(root[channel] + chord[random_below(sizeof(chord))] +
+                                       (12U * random_below(3)));
+            recent[channel][i % RECENT_NOTES] = events[i].note;
+        }
+        events[i].channel = channel;
+    }
+}
+
+/**
+ * @brief   Applies one event to the allocator.
+ *
+ * @param   alloc   Pointer to the allocator.
+ * @param   event   Event.
+ *
+ * @return  Voice, VOICE_ALLOC_NONE if there is none.
+ */
+static uint8_t apply(struct VoiceAllocator *alloc, const struct Event *event) {
+    if (event->type == (uint8_t)EVENT_NOTE_ON) {
+        return voice_alloc_note_on(alloc, event->channel, event->note);
+    }
+    return voice_alloc_note_off(alloc, event->channel, event->note);
+}
+
+/**
+ * @brief   Runs the first CHECK_EVENTS events with a consistency check after each one.
+ *
+ * @return  None
+ */
+static void check_events(void) {
+    struct VoiceAllocator alloc;
+
+    voice_alloc_init(&alloc);
+    for (uint32_t i = 0; i < CHECK_EVENTS; i++) {
+        uint8_t voice = apply(&alloc, &events[i]);
+        if ((events[i].type == (uint8_t)EVENT_NOTE_ON) &&
+            ((voice == VOICE_ALLOC_NONE) ||
+             (voice_alloc_find(&alloc, events[i].channel, events[i].note) != voice))) {
+            fail("note on without a voice");
+            return;
+        }
+        if (!consistent(&alloc)) {
+            printf("  after event %u\n", (unsigned)i);
+            fail("lists and note map consistent");
+            return;
+        }
+    }
+
+    printf("%u chord and arpeggio events: %u notes stolen\n", (unsigned)CHECK_EVENTS,
+           (unsigned)alloc.stolen);
+}
+
+/**
+ * @brief   Measures the allocator on all events.
+ *
+ * @return  Nanoseconds per event.
+ */
+static double measure(void) {
+    struct VoiceAllocator alloc;
+    double best = 0.0;
+
+    for (int run = 0; run < BENCH_RUNS; run++) {
+        voice_alloc_init(&alloc);
+
+        double start = now_seconds();
+        for (uint32_t i = 0; i < BENCH_EVENTS; i++) {
+            sink += apply(&alloc, &events[i]);
+        }
+        double time = (now_seconds() - start) * 1e9 / BENCH_EVENTS;
+        if ((run == 0) || (time < best)) {
+            best = time;
+        }
+    }
+
+    return best;
+}
+
+int main(void) {
+    check_policy();
+
+    fill_events();
+    check_events();
+    printf("%u events: %.2f ns per event\n", (unsigned)BENCH_EVENTS, measure());
+
+    if (failures != 0U) {
+        printf("%u checks failed\n", (unsigned)failures);
+        return 1;
+    }
+    printf("all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,265 @@
+/*
+ * Runs the LED level meter on a PC: rendered blocks of test signals go through the envelope
+ * follower (midi_synthesizer/src/vu_meter.c) as from the audio interrupt, and the LED task's
+ * update every VU_METER_PERIOD_MS drives the unmodified pca_leds.c and PCA9532 driver on the
+ * host bus emulator. It reports the levels read and the LEDs lit for sines of falling
+ * amplitude, the I2C traffic of a steady tone and of a decaying note, and checks the levels,
+ * the LED bars, that a short burst between two updates still shows up and that the traffic
+ * stays within what one write per update can cost. The exit status is 1 if any check fails.
+ *
+ * Build from the repository root:
+ *
+ *   gcc -std=gnu99 -ILib_EaBaseBoard/host/inc -ILib_EaBaseBoard/host -ILib_EaBaseBoard/inc \
+ *       -ILib_MCU/inc -Imidi_synthesizer/src midi_synthesizer/tools/vu_meter_sim.c \
+ *       midi_synthesizer/src/vu_meter.c midi_synthesizer/src/pca_leds.c \
+ *       Lib_EaBaseBoard/src/pca9532.c Lib_EaBaseBoard/src/i2cbus.c \
+ *       Lib_EaBaseBoard/host/i2c_emu.c Lib_EaBaseBoard/host/pca9532_emu.c -lm -o vu_meter_sim
+ *
+ * Usage: vu_meter_sim
+ */
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "i2cbus.h"
+#include "pca9532.h"
+
+#include "i2c_emu.h"
+#include "pca9532_emu.h"
+
+#include "audio.h"
+#include "pca_leds.h"
+#include "synth.h"
+#include "vu_meter.h"
+
+#define BLOCK_US                ((AUDIO_BLOCK_SIZE * 1000000) / AUDIO_SAMPLE_RATE)
+#define TONE_HZ                 440.0
+#define PI                      3.14159265358979
+
+// Largest write the meter can cause: control byte, LS0 - LS3 and the address byte.
+#define MAX_WRITE_BYTES         6U
+
+static const uint16_t amplitudes[] = {511, 362, 256, 128, 64, 16, 4, 0};
+
+static uint32_t failures = 0;
+
+// Signal time in samples, so the sine is continuous from block to block.
+static uint32_t sample_index = 0;
+static uint32_t block_count = 0;
+static uint32_t next_update_us = 0;
+
+// Levels read by the last update.
+static struct VuLevels levels;
+
+/**
+ * @brief   Reports a failed check.
+ *
+ * @param   what    Description of the check.
+ *
+ * @return  None
+ */
+static void fail(const char *what) {
+    printf("FAILED: %s\n", what);
+    failures++;
+}
+
+/**
+ * @brief   Bytes sent to the PCA9532 so far, address bytes included.
+ *
+ * @return  uint32_t    Bytes.
+ */
+static uint32_t wire_bytes(void) {
+    i2c_emu_stats_t s;
+
+    (void)i2cEmu_getDeviceStats(PCA9532_EMU_I2C_ADDR, &s);
+    return s.bytes + s.attempts;
+}
+
+/**
+ * @brief   Plays one block of a sine through the meter, with an LED update when one is due.
+ *
+ * @param   amplitude   Amplitude in DAC steps.
+ *
+ * @return  None
+ */
+static void play_block(double amplitude) {
+    uint32_t block[AUDIO_BLOCK_SIZE];
+
+    for (uint32_t i = 0; i < (uint32_t)AUDIO_BLOCK_SIZE; i++) {
+        double phase = (2.0 * PI * TONE_HZ * (double)sample_index) / AUDIO_SAMPLE_RATE;
+        int32_t value = DAC_VALUE_CENTER + (int32_t)lround(amplitude * sin(phase));
+        if (value > DAC_VALUE_MAX) {
+            value = DAC_VALUE_MAX;
+        }
+        block[i] = (uint32_t)value << DAC_VALUE_SHIFT;
+        sample_index++;
+    }
+
+    vu_meter_capture(block, AUDIO_BLOCK_SIZE);
+    block_count++;
+    i2cEmu_wait(BLOCK_US);
+
+    // The LED task.
+    if ((block_count * BLOCK_US) >= next_update_us) {
+        vu_meter_read(&levels);
+        set_leds_vu(levels.rms, levels.peak);
+        next_update_us += VU_METER_PERIOD_MS * 1000U;
+    }
+}
+
+/**
+ * @brief   Plays a sine for a while.
+ *
+ * @param   amplitude   Amplitude in DAC steps.
+ * @param   ms          Duration.
+ *
+ * @return  None
+ */
+static void play(double amplitude, uint32_t ms) {
+    for (uint32_t i = 0; i < (ms * 1000U) / BLOCK_US; i++) {
+        play_block(amplitude);
+    }
+}
+
+/**
+ * @brief   LEDs of a meter bar the way the tool expects them: one per octave, at most 8.
+ *
+ * @param   amplitude   Amplitude in DAC steps.
+ *
+ * @return  uint16_t    Bar, bit 0 first.
+ */
+static uint16_t expected_bar(uint16_t amplitude) {
+    uint32_t count = (amplitude == 0U) ? 0U : (uint32_t)floor(log2(amplitude));
+    if (count > 8U) {
+        count = 8U;
+    }
+    return (uint16_t)((1U << count) - 1U);
+}
+
+/**
+ * @brief   Checks a level against the expected one, 5 % or 1 DAC step off at most.
+ *
+ * @return  bool    true if it is close enough.
+ */
+static bool close_to(uint16_t level, double expected) {
+    double error = fabs((double)level - expected);
+    return (error <= 1.0) || (error <= (expected * 0.05));
+}
+
+/**
+ * @brief   Steady sines of falling amplitude: levels and LED bars.
+ *
+ * @return  None
+ */
+static void check_levels(void) {
+    printf("steady %.0f Hz sine, levels after 6 s:\n", TONE_HZ);
+    printf("  amplitude   rms  peak  red LEDs  green LEDs\n");
+    for (uint32_t i = 0; i < (sizeof(amplitudes) / sizeof(amplitudes[0])); i++) {
+        double amplitude = amplitudes[i];
+
+        // Lower than before: wait for the held peak to fall to it.
+        play(amplitude, 6000);
+        i2cEmu_run();
+
+        uint16_t on = pca9532Emu_getLeds(PCA9532_EMU_LS_ON);
+        printf("  %9u  %4u  %4u  %8u  %10u\n", (unsigned)amplitudes[i], (unsigned)levels.rms,
+               (unsigned)levels.peak, (unsigned)__builtin_popcount(on & 0xFFU),
+               (unsigned)__builtin_popcount(on >> 8));
+
+        if (!close_to(levels.peak, amplitude) || !close_to(levels.rms, amplitude / sqrt(2.0))) {
+            fail("levels of a steady sine");
+        }
+        // Against the levels read: one right at an LED step may be read on either side.
+        uint16_t red = (uint16_t)(on & 0xFFU);
+        uint16_t green = (uint16_t)(on >> 8);
+        if ((red != expected_bar(levels.rms)) || (green != expected_bar(levels.peak))) {
+            fail("LED bars");
+        }
+    }
+}
+
+/**
+ * @brief   Plays silence until the next LED update has been done.
+ *
+ * @return  None
+ */
+static void wait_for_update(void) {
+    uint32_t due = next_update_us;
+
+    while (next_update_us == due) {
+        play_block(0.0);
+    }
+}
+
+/**
+ * @brief   A 4 ms burst right after an update must show at the next one and be held.
+ *
+ * @return  None
+ */
+static void check_burst(void) {
+    play(0.0, 3000);
+    wait_for_update();
+    play(500.0, 4);
+    wait_for_update();
+
+    uint16_t seen = levels.peak;
+    play(0.0, 400);
+    uint16_t held = levels.peak;
+    play(0.0, 1000);
+    uint16_t fallen = levels.peak;
+
+    printf("4 ms burst: peak %u at the next update, %u after 0.4 s, %u after 1.4 s\n",
+           (unsigned)seen, (unsigned)held, (unsigned)fallen);
+    if (!close_to(seen, 500.0) || (held != seen) || (fallen >= (seen / 2U))) {
+        fail("burst between two updates");
+    }
+}
+
+/**
+ * @brief   I2C traffic of the meter for a steady tone and a decaying note.
+ *
+ * @return  None
+ */
+static void check_traffic(void) {
+    uint32_t updates_per_s = 1000U / VU_METER_PERIOD_MS;
+    uint32_t bound = (updates_per_s + 1U) * MAX_WRITE_BYTES;
+
+    play(300.0, 2000);
+    uint32_t start = wire_bytes();
+    play(300.0, 2000);
+    uint32_t steady = (wire_bytes() - start) / 2U;
+
+    // A note decaying by 20 dB per second from full scale, with 8 re-strikes.
+    start = wire_bytes();
+    for (uint32_t note = 0; note < 8U; note++) {
+        for (uint32_t ms = 0; ms < 1000U; ms += 2U) {
+            play_block(511.0 * pow(10.0, -(double)ms / 1000.0));
+        }
+    }
+    uint32_t decaying = (wire_bytes() - start) / 8U;
+
+    printf("I2C to the PCA9532: steady tone %u B/s, decaying notes %u B/s, "
+           "at most %u B/s for %u updates per second\n",
+           (unsigned)steady, (unsigned)decaying, (unsigned)bound, (unsigned)updates_per_s);
+    if ((steady != 0U) || (decaying > bound)) {
+        fail("I2C traffic");
+    }
+}
+
+int main(void) {
+    pca9532Emu_reset();
+    i2cbus_init();
+
+    check_levels();
+    check_burst();
+    check_traffic();
+
+    if (failures != 0U) {
+        printf("%u checks failed\n", (unsigned)failures);
+        return 1;
+    }
+    printf("all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,300 @@
+/*
+ * Checks the generated wavetables (midi_synthesizer/src/wavetables.c) on a PC. Every table
+ * must end with a guard sample equal to its first one and stay within Q15. The sine table
+ * is compared with the exact sine: its peak error, and the error and the total harmonic
+ * distortion of a sine played from it with linear interpolation the way synth.c does it,
+ * at a few frequencies over one second of samples. For the band-limited waves, the highest
+ * harmonic of every level is found with a DFT of the table, and it must stay below Nyquist
+ * for the highest pitch osc_mipmap_level() picks the level for. The exit status is 1 if any
+ * check fails.
+ *
+ * Build from the repository root:
+ *
+ *   gcc -O2 -std=gnu99 -Imidi_synthesizer/src midi_synthesizer/tools/wavetable_check.c \
+ *       midi_synthesizer/src/oscillator.c midi_synthesizer/src/wavetables.c -lm \
+ *       -o wavetable_check
+ *
+ * Usage: wavetable_check
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "audio.h"
+#include "oscillator.h"
+#include "wavetables.h"
+
+#define Q15_MAX                 32767.0
+#define PI                      3.14159265358979
+
+// Largest errors of the sine, relative to full scale. Rounding to Q15 alone gives 1.5e-5.
+#define TABLE_ERROR_MAX         2e-5
+#define PLAYED_ERROR_MAX_DB     (-80.0)
+#define THD_MAX_DB              (-80.0)
+
+// Harmonics weaker than this, relative to full scale, are taken as absent.
+#define HARMONIC_MIN            1e-4
+
+// One second of samples, so every whole frequency falls on a DFT bin.
+#define PLAYED_SAMPLES          AUDIO_SAMPLE_RATE
+
+// Same split of the phase as in synth.c.
+#define PHASE_INDEX_SHIFT       (32 - WAVE_SAMPLES_COUNT_LOG2)
+#define PHASE_FRACTION_BITS     15
+#define PHASE_FRACTION_SHIFT    (PHASE_INDEX_SHIFT - PHASE_FRACTION_BITS)
+#define PHASE_FRACTION_MASK     ((1UL << PHASE_FRACTION_BITS) - 1UL)
+
+static const uint32_t frequencies[] = {55, 440, 1234, 3520, 7040};
+
+static uint32_t failures = 0;
+
+static double played[PLAYED_SAMPLES];
+
+// cos and sin of 2 * pi * i / WAVE_SAMPLES_COUNT, for the DFT of the tables.
+static double table_cos[WAVE_SAMPLES_COUNT];
+static double table_sin[WAVE_SAMPLES_COUNT];
+
+/**
+ * @brief   Reports a failed check.
+ *
+ * @param   what    Description of the check.
+ *
+ * @return  None
+ */
+static void fail(const char *what) {
+    printf("FAILED: %s\n", what);
+    failures++;
+}
+
+/**
+ * @brief   Converts a ratio to decibels.
+ *
+ * @return  Decibels.
+ */
+static double to_db(double ratio) {
+    return 20.0 * log10(ratio);
+}
+
+/**
+ * @brief   Checks the guard sample and the range of one table.
+ *
+ * @param   name    Name of the table, for the report.
+ * @param   table   WAVE_SAMPLES_COUNT + 1 samples.
+ *
+ * @return  None
+ */
+static void check_table(const char *name, const int16_t *table) {
+    if (table[WAVE_SAMPLES_COUNT] != table[0]) {
+        printf("  %s\n", name);
+        fail("guard sample differs from the first one");
+    }
+    for (uint32_t i = 0; i <= (uint32_t)WAVE_SAMPLES_COUNT; i++) {
+        if (table[i] < -(int16_t)Q15_MAX) {
+            printf("  %s\n", name);
+            fail("sample out of the Q15 range");
+            break;
+        }
+    }
+}
+
+/**
+ * @brief   Checks every table.
+ *
+ * @return  None
+ */
+static void check_tables(void) {
+    char name[32];
+
+    check_table("sine", wavetable_sine);
+    for (uint32_t level = 0; level < (uint32_t)WAVE_MIPMAP_LEVELS; level++) {
+        (void)snprintf(name, sizeof(name), "saw level %u", (unsigned)level);
+        check_table(name, wavetable_saw[level]);
+        (void)snprintf(name, sizeof(name), "square level %u", (unsigned)level);
+        check_table(name, wavetable_square[level]);
+        (void)snprintf(name, sizeof(name), "triangle level %u", (unsigned)level);
+        check_table(name, wavetable_triangle[level]);
+    }
+}
+
+/**
+ * @brief   Peak error of the sine table.
+ *
+ * @return  None
+ */
+static void check_sine_table(void) {
+    double worst = 0.0;
+
+    for (uint32_t i = 0; i < (uint32_t)WAVE_SAMPLES_COUNT; i++) {
+        double exact = sin((2.0 * PI * i) / WAVE_SAMPLES_COUNT);
+        double error = fabs(((double)wavetable_sine[i] / Q15_MAX) - exact);
+        if (error > worst) {
+            worst = error;
+        }
+    }
+
+    printf("sine table: peak error %.2e of full scale\n", worst);
+    if (worst > TABLE_ERROR_MAX) {
+        fail("sine table error");
+    }
+}
+
+/**
+ * @brief   Plays the sine table at a frequency into `played`, in full scale units.
+ *
+ * @param   frequency   Frequency in Hz.
+ *
+ * @return  None
+ */
+static void play(uint32_t frequency) {
+    uint32_t phase = 0;
+    uint32_t phase_step = (uint32_t)(((uint64_t)frequency << 32) / AUDIO_SAMPLE_RATE);
+
+    for (uint32_t i = 0; i < PLAYED_SAMPLES; i++) {
+        uint32_t index = phase >> PHASE_INDEX_SHIFT;
+        int32_t fraction = (int32_t)((phase >> PHASE_FRACTION_SHIFT) & PHASE_FRACTION_MASK);
+        int32_t a = wavetable_sine[index];
+        int32_t b = wavetable_sine[index + 1U];
+        played[i] = (double)(a + (((b - a) * fraction) >> PHASE_FRACTION_BITS)) / Q15_MAX;
+        phase += phase_step;
+    }
+}
+
+/**
+ * @brief   Amplitude of one DFT bin of `played`.
+ *
+ * @param   bin     Bin, in Hz since a second is played.
+ *
+ * @return  Amplitude in full scale units.
+ */
+static double bin_amplitude(uint32_t bin) {
+    double re = 0.0;
+    double im = 0.0;
+
+    for (uint32_t i = 0; i < PLAYED_SAMPLES; i++) {
+        double angle = (2.0 * PI * (double)(((uint64_t)bin * i) % PLAYED_SAMPLES)) / PLAYED_SAMPLES;
+        re += played[i] * cos(angle);
+        im += played[i] * sin(angle);
+    }
+
+    return (2.0 * sqrt((re * re) + (im * im))) / PLAYED_SAMPLES;
+}
+
+/**
+ * @brief   Error and THD of the interpolated sine at one frequency.
+ *
+ * @param   frequency   Frequency in Hz.
+ *
+ * @return  None
+ */
+static void check_played(uint32_t frequency) {
+    uint32_t phase_step = (uint32_t)(((uint64_t)frequency << 32) / AUDIO_SAMPLE_RATE);
+    double worst = 0.0;
+    double harmonics = 0.0;
+
+    play(frequency);
+    for (uint32_t i = 0; i < PLAYED_SAMPLES; i++) {
+        // The phase of the sample as played, with the truncation of the phase step.
+        double exact = sin((2.0 * PI * (double)(uint32_t)(phase_step * i)) / 4294967296.0);
+        double error = fabs(played[i] - exact);
+        if (error > worst) {
+            worst = error;
+        }
+    }
+
+    for (uint32_t h = 2; (h * frequency) < (AUDIO_SAMPLE_RATE / 2); h++) {
+        double amplitude = bin_amplitude(h * frequency);
+        harmonics += amplitude * amplitude;
+    }
+    double thd = to_db(sqrt(harmonics) / bin_amplitude(frequency));
+
+    printf("  %5u Hz  %8.1f dB  %8.1f dB\n", (unsigned)frequency, to_db(worst), thd);
+    if ((to_db(worst) > PLAYED_ERROR_MAX_DB) || (thd > THD_MAX_DB)) {
+        fail("interpolated sine");
+    }
+}
+
+/**
+ * @brief   Finds the highest harmonic in a table.
+ *
+ * @param   table   WAVE_SAMPLES_COUNT + 1 samples.
+ *
+ * @return  Highest harmonic of at least HARMONIC_MIN, 0 if there is none.
+ */
+static uint32_t highest_harmonic(const int16_t *table) {
+    for (uint32_t h = (WAVE_SAMPLES_COUNT / 2) - 1U; h > 0U; h--) {
+        double re = 0.0;
+        double im = 0.0;
+        for (uint32_t i = 0; i < (uint32_t)WAVE_SAMPLES_COUNT; i++) {
+            uint32_t angle = (h * i) % WAVE_SAMPLES_COUNT;
+            re += (double)table[i] * table_cos[angle];
+            im += (double)table[i] * table_sin[angle];
+        }
+        double amplitude = (2.0 * sqrt((re * re) + (im * im))) / (WAVE_SAMPLES_COUNT * Q15_MAX);
+        if (amplitude >= HARMONIC_MIN) {
+            return h;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief   Checks that no level of a band-limited wave aliases at the pitches it is used for.
+ *
+ * @param   name    Name of the wave.
+ * @param   tables  WAVE_MIPMAP_LEVELS tables.
+ *
+ * @return  None
+ */
+static void check_levels(const char *name, const int16_t (*tables)[WAVE_SAMPLES_COUNT + 1]) {
+    uint32_t highest_step = osc_phase_step_from_note(OSC_NOTE_MAX, 0);
+
+    printf("  %-8s", name);
+    for (uint32_t level = 0; level < (uint32_t)WAVE_MIPMAP_LEVELS; level++) {
+        // Level L is picked for phase steps below 2^(WAVE_MIPMAP_FIRST_STEP_LOG2 + L), the
+        // last one for everything up to the highest note.
+        uint32_t step = highest_step;
+        if (level < ((uint32_t)WAVE_MIPMAP_LEVELS - 1U)) {
+            step = (1UL << (WAVE_MIPMAP_FIRST_STEP_LOG2 + level)) - 1UL;
+        }
+        if (osc_mipmap_level(step) != level) {
+            fail("level picked for its highest phase step");
+        }
+
+        uint32_t harmonic = highest_harmonic(tables[level]);
+        double frequency = ((double)step * AUDIO_SAMPLE_RATE) / 4294967296.0;
+        printf(" %4u", (unsigned)harmonic);
+        if ((harmonic * frequency) >= (AUDIO_SAMPLE_RATE / 2)) {
+            printf("\n");
+            fail("harmonic above Nyquist");
+        }
+    }
+    printf("\n");
+}
+
+int main(void) {
+    for (uint32_t i = 0; i < (uint32_t)WAVE_SAMPLES_COUNT; i++) {
+        table_cos[i] = cos((2.0 * PI * i) / WAVE_SAMPLES_COUNT);
+        table_sin[i] = sin((2.0 * PI * i) / WAVE_SAMPLES_COUNT);
+    }
+
+    check_tables();
+    check_sine_table();
+
+    printf("interpolated sine, peak error and THD relative to full scale:\n");
+    for (uint32_t i = 0; i < (sizeof(frequencies) / sizeof(frequencies[0])); i++) {
+        check_played(frequencies[i]);
+    }
+
+    printf("highest harmonic of levels 0 - %u:\n", (unsigned)(WAVE_MIPMAP_LEVELS - 1));
+    check_levels("saw", wavetable_saw);
+    check_levels("square", wavetable_square);
+    check_levels("triangle", wavetable_triangle);
+
+    if (failures != 0U) {
+        printf("%u checks failed\n", (unsigned)failures);
+        return 1;
+    }
+    printf("all checks passed\n");
+    return 0;
+}